@@ -197,7 +197,6 @@ macro(ivw_define_standard_definitions project_name target)
         $<$<BOOL:${BUILD_SHARED_LIBS}>:INVIWO_ALL_DYN_LINK>
         $<$<BOOL:${IVW_CFG_PROFILING}>:IVW_PROFILING>
         $<$<BOOL:${IVW_CFG_FORCE_ASSERTIONS}>:IVW_FORCE_ASSERTIONS>
-        $<$<BOOL:${IVW_ENABLE_OPENMP}>:IVW_USE_OPENMP>
         $<$<CONFIG:Debug>:IVW_DEBUG>
         $<$<CONFIG:Release>:IVW_RELEASE>
     )
@@ -227,20 +227,18 @@ if(APPLE AND NOT OpenMP_CXX_INCLUDE_DIR)
     set(OpenMP_CXX_INCLUDE_DIR /opt/homebrew/opt/libomp/include)
 endif()
 
-# Check if OpenMP is available and set it to use, and include the dll in packs, except for MSVC
-
-if(MSVC)
-    option(IVW_ENABLE_OPENMP "Use OpenMP" OFF)
-    if(IVW_ENABLE_OPENMP)
+# OpenMP is only used by CImg, Inviwo's own kernels run on the thread pool (see util/parallel.h)
+# such that the pool size is the only thread budget. Enabling it will make CImg run its own threads
+# next to the pool.
+option(IVW_ENABLE_OPENMP "Use OpenMP in CImg" OFF)
+if(IVW_ENABLE_OPENMP)
+    if(MSVC)
         set(OpenMP_CXX_FLAGS /openmp:llvm
             CACHE STRING "CXX compiler flags for OpenMP parallelization")
         set(OpenMP_C_FLAGS /openmp:llvm
             CACHE STRING "C compiler flags for OpenMP parallelization")
-        find_package(OpenMP QUIET COMPONENTS CXX)
     endif()
-else()
     find_package(OpenMP QUIET COMPONENTS CXX)
-    option(IVW_ENABLE_OPENMP "Use OpenMP" ${OpenMP_CXX_FOUND})
 endif()
 
 if(IVW_ENABLE_OPENMP AND NOT OpenMP_CXX_FOUND)
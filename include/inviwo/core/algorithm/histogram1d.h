@@ -33,9 +33,12 @@
 #include <inviwo/core/util/glmutils.h>
 #include <inviwo/core/util/glmcomp.h>
 #include <inviwo/core/util/glmmatext.h>
+#include <inviwo/core/util/threadutil.h>
 
 #include <glm/common.hpp>
 
+#include <algorithm>
+#include <functional>
 #include <ranges>
 #include <vector>
 #include <array>
@@ -112,6 +115,13 @@ std::pair<size_t, double> optimalBinCount(DataMapper dataMap, size_t bins) {
     }
 }
 
+/**
+ * Number of values per partition when calculating histograms in parallel, and the upper limit of
+ * partitions. Each partition needs its own set of bins.
+ */
+constexpr size_t histogramGrainSize = size_t{1} << 18;
+constexpr size_t maxPartitions = 64;
+
 }  // namespace detail
 
 /**
@@ -123,6 +133,8 @@ std::pair<size_t, double> optimalBinCount(DataMapper dataMap, size_t bins) {
  * @param bins     upper limit of bins to use, actual number of bins might be lower based on data
  *                 range and data type of \p T
  * @return vector of histograms, one per channel/component in \p data
+ *
+ * Large data is split into partitions that are binned in parallel using the thread pool.
  */
 template <typename T>
 std::vector<Histogram1D> calculateHistograms(std::span<const T> data, const DataMapper& dataMap,
@@ -134,45 +146,71 @@ std::vector<Histogram1D> calculateHistograms(std::span<const T> data, const Data
 
     constexpr size_t extent = util::rank<T>::value > 0 ? util::extent<T>::value : 1;
 
-    D min(std::numeric_limits<double>::max());
-    D max(std::numeric_limits<double>::lowest());
-    D sum(0);
-    D sum2(0);
-    size_t count(0);
-
-    std::array<size_t, extent> underflow{0};
-    std::array<size_t, extent> overflow{0};
-
     auto [numbins, effectiveRange] = detail::optimalBinCount<T>(dataMap, bins);
     const D rangeMin(dataMap.dataRange.x);
     const D rangeScaleFactor(static_cast<double>(numbins - 1) / effectiveRange);
-
-    std::array<std::vector<size_t>, extent> hists;
-    for (size_t i = 0; i < extent; ++i) {
-        hists[i].resize(numbins, 0);
-    }
     const ptrdiff_t maxBin = static_cast<ptrdiff_t>(numbins) - 1;
 
-    for (const auto& item : data) {
-        const auto val = static_cast<D>(item);
-
-        min = glm::min(min, val);
-        max = glm::max(max, val);
-        sum += val;
-        sum2 += val * val;
-        count++;
+    struct Partial {
+        D min{std::numeric_limits<double>::max()};
+        D max{std::numeric_limits<double>::lowest()};
+        D sum{0};
+        D sum2{0};
+        size_t count{0};
+        std::array<size_t, extent> underflow{0};
+        std::array<size_t, extent> overflow{0};
+        std::array<std::vector<size_t>, extent> hists;
+    };
 
-        const auto ind = static_cast<I>((val - rangeMin) * rangeScaleFactor);
-        for (size_t channel = 0; channel < extent; ++channel) {
-            const auto v = util::glmcomp(ind, channel);
-            if (v < 0) {
-                ++underflow[channel];
-            } else if (v > maxBin) {
-                ++overflow[channel];
-            } else {
-                ++hists[channel][v];
+    // The data is split into a number of partitions that only depends on the data size, each
+    // partition is binned into its own histograms in parallel. The partial results are then
+    // merged in order, which keeps the result independent of the number of threads.
+    const auto partitions =
+        std::clamp(data.size() / detail::histogramGrainSize, size_t{1}, detail::maxPartitions);
+    std::vector<Partial> partials(partitions);
+    util::parallelFor(partitions, [&](size_t p) {
+        auto& partial = partials[p];
+        for (auto& hist : partial.hists) {
+            hist.resize(numbins, 0);
+        }
+        const auto begin = data.size() * p / partitions;
+        const auto end = data.size() * (p + 1) / partitions;
+        for (const auto& item : data.subspan(begin, end - begin)) {
+            const auto val = static_cast<D>(item);
+
+            partial.min = glm::min(partial.min, val);
+            partial.max = glm::max(partial.max, val);
+            partial.sum += val;
+            partial.sum2 += val * val;
+            partial.count++;
+
+            const auto ind = static_cast<I>((val - rangeMin) * rangeScaleFactor);
+            for (size_t channel = 0; channel < extent; ++channel) {
+                const auto v = util::glmcomp(ind, channel);
+                if (v < 0) {
+                    ++partial.underflow[channel];
+                } else if (v > maxBin) {
+                    ++partial.overflow[channel];
+                } else {
+                    ++partial.hists[channel][v];
+                }
             }
         }
+    });
+
+    auto& [min, max, sum, sum2, count, underflow, overflow, hists] = partials.front();
+    for (const auto& partial : std::span{partials}.subspan(1)) {
+        min = glm::min(min, partial.min);
+        max = glm::max(max, partial.max);
+        sum += partial.sum;
+        sum2 += partial.sum2;
+        count += partial.count;
+        for (size_t channel = 0; channel < extent; ++channel) {
+            underflow[channel] += partial.underflow[channel];
+            overflow[channel] += partial.overflow[channel];
+            std::ranges::transform(hists[channel], partial.hists[channel], hists[channel].begin(),
+                                   std::plus<>{});
+        }
     }
 
     const auto dcount = static_cast<double>(count);
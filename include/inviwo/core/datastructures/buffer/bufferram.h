@@ -38,6 +38,8 @@
 #include <inviwo/core/util/stdextensions.h>
 
 #include <initializer_list>
+#include <memory>
+#include <vector>
 
 namespace inviwo {
 
@@ -139,6 +141,11 @@ protected:
 
 /**
  * \ingroup datastructures
+ * The data is copy-on-write, clones of the representation share the same data until one of them
+ * is accessed for writing, i.e. through one of the non-const data accessors or setters. Only then
+ * is the data copied. Copying the representation invalidates all pointers and references obtained
+ * earlier from the non-const accessors, writing through them would modify the data of the copy as
+ * well.
  */
 template <typename T, BufferTarget Target = BufferTarget::Data>
 class BufferRAMPrecision : public BufferRAM {
@@ -159,8 +166,16 @@ public:
     virtual void setSize(size_t size) override;
     virtual size_t getSize() const override;
 
+    /**
+     * Get the data for writing, it is copied first if it is shared. The pointer is invalidated by
+     * copying the representation.
+     */
     virtual void* getData() override;
     virtual const void* getData() const override;
+    /**
+     * Get the data container for writing, it is copied first if it is shared. The reference, and
+     * pointers and iterators into the container, are invalidated by copying the representation.
+     */
     std::vector<T>& getDataContainer();
     const std::vector<T>& getDataContainer() const;
 
@@ -191,17 +206,28 @@ public:
     void append(const std::vector<T>* data);
     void append(const std::vector<T>& data);
 
+    /**
+     * Get element @p i for writing, see getDataContainer()
+     */
     T& operator[](size_t i);
     const T& operator[](size_t i) const;
 
     void set(size_t index, const T& item);
     T get(size_t index) const;
+    /**
+     * Get element @p index for writing, see getDataContainer()
+     */
     T& get(size_t index);
 
     virtual void clear() override;
 
 private:
-    std::vector<T> data_;
+    std::vector<T>& editableData() {
+        if (data_.use_count() > 1) data_ = std::make_shared<std::vector<T>>(*data_);
+        return *data_;
+    }
+
+    std::shared_ptr<std::vector<T>> data_;
 };
 
 using FloatBufferRAM = BufferRAMPrecision<float>;
@@ -213,12 +239,12 @@ using IndexBufferRAM = BufferRAMPrecision<std::uint32_t, BufferTarget::Index>;
 
 template <typename T, BufferTarget Target>
 const T& BufferRAMPrecision<T, Target>::operator[](size_t i) const {
-    return data_[i];
+    return (*data_)[i];
 }
 
 template <typename T, BufferTarget Target>
 T& BufferRAMPrecision<T, Target>::operator[](size_t i) {
-    return data_[i];
+    return editableData()[i];
 }
 
 template <typename T, BufferTarget Target>
@@ -227,11 +253,11 @@ BufferRAMPrecision<T, Target>::BufferRAMPrecision(BufferUsage usage)
 
 template <typename T, BufferTarget Target>
 BufferRAMPrecision<T, Target>::BufferRAMPrecision(size_t size, BufferUsage usage)
-    : BufferRAM(usage, Target), data_(size) {}
+    : BufferRAM(usage, Target), data_(std::make_shared<std::vector<T>>(size)) {}
 
 template <typename T, BufferTarget Target>
 BufferRAMPrecision<T, Target>::BufferRAMPrecision(std::vector<T> data, BufferUsage usage)
-    : BufferRAM(usage, Target), data_(std::move(data)) {}
+    : BufferRAM(usage, Target), data_(std::make_shared<std::vector<T>>(std::move(data))) {}
 
 template <typename T, BufferTarget Target>
 BufferRAMPrecision<T, Target>* BufferRAMPrecision<T, Target>::clone() const {
@@ -244,159 +270,166 @@ const DataFormatBase* BufferRAMPrecision<T, Target>::getDataFormat() const {
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setSize(size_t size) {
-    return data_.resize(size);
+    if (size != data_->size()) editableData().resize(size);
 }
 
 template <typename T, BufferTarget Target>
 size_t BufferRAMPrecision<T, Target>::getSize() const {
-    return data_.size();
+    return data_->size();
 }
 
 template <typename T, BufferTarget Target>
 void* BufferRAMPrecision<T, Target>::getData() {
-    return (data_.empty() ? nullptr : data_.data());
+    return (data_->empty() ? nullptr : editableData().data());
 }
 
 template <typename T, BufferTarget Target>
 const void* BufferRAMPrecision<T, Target>::getData() const {
-    return (data_.empty() ? nullptr : data_.data());
+    return (data_->empty() ? nullptr : data_->data());
 }
 
 template <typename T, BufferTarget Target>
 std::vector<T>& BufferRAMPrecision<T, Target>::getDataContainer() {
-    return data_;
+    return editableData();
 }
 
 template <typename T, BufferTarget Target>
 const std::vector<T>& BufferRAMPrecision<T, Target>::getDataContainer() const {
-    return data_;
+    return *data_;
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::reserve(size_t size) {
-    data_.reserve(size);
+    editableData().reserve(size);
 }
 
 template <typename T, BufferTarget Target>
 double BufferRAMPrecision<T, Target>::getAsDouble(const size_t& pos) const {
-    return util::glm_convert<double>(data_[pos]);
+    return util::glm_convert<double>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 dvec2 BufferRAMPrecision<T, Target>::getAsDVec2(const size_t& pos) const {
-    return util::glm_convert<dvec2>(data_[pos]);
+    return util::glm_convert<dvec2>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 dvec3 BufferRAMPrecision<T, Target>::getAsDVec3(const size_t& pos) const {
-    return util::glm_convert<dvec3>(data_[pos]);
+    return util::glm_convert<dvec3>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 dvec4 BufferRAMPrecision<T, Target>::getAsDVec4(const size_t& pos) const {
-    return util::glm_convert<dvec4>(data_[pos]);
+    return util::glm_convert<dvec4>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromDouble(const size_t& pos, double val) {
-    data_[pos] = util::glm_convert<T>(val);
+    editableData()[pos] = util::glm_convert<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromDVec2(const size_t& pos, dvec2 val) {
-    data_[pos] = util::glm_convert<T>(val);
+    editableData()[pos] = util::glm_convert<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromDVec3(const size_t& pos, dvec3 val) {
-    data_[pos] = util::glm_convert<T>(val);
+    editableData()[pos] = util::glm_convert<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromDVec4(const size_t& pos, dvec4 val) {
-    data_[pos] = util::glm_convert<T>(val);
+    editableData()[pos] = util::glm_convert<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 double BufferRAMPrecision<T, Target>::getAsNormalizedDouble(const size_t& pos) const {
-    return util::glm_convert_normalized<double>(data_[pos]);
+    return util::glm_convert_normalized<double>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 dvec2 BufferRAMPrecision<T, Target>::getAsNormalizedDVec2(const size_t& pos) const {
-    return util::glm_convert_normalized<dvec2>(data_[pos]);
+    return util::glm_convert_normalized<dvec2>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 dvec3 BufferRAMPrecision<T, Target>::getAsNormalizedDVec3(const size_t& pos) const {
-    return util::glm_convert_normalized<dvec3>(data_[pos]);
+    return util::glm_convert_normalized<dvec3>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 dvec4 BufferRAMPrecision<T, Target>::getAsNormalizedDVec4(const size_t& pos) const {
-    return util::glm_convert_normalized<dvec4>(data_[pos]);
+    return util::glm_convert_normalized<dvec4>((*data_)[pos]);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromNormalizedDouble(const size_t& pos, double val) {
-    data_[pos] = util::glm_convert_normalized<T>(val);
+    editableData()[pos] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromNormalizedDVec2(const size_t& pos, dvec2 val) {
-    data_[pos] = util::glm_convert_normalized<T>(val);
+    editableData()[pos] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromNormalizedDVec3(const size_t& pos, dvec3 val) {
-    data_[pos] = util::glm_convert_normalized<T>(val);
+    editableData()[pos] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::setFromNormalizedDVec4(const size_t& pos, dvec4 val) {
-    data_[pos] = util::glm_convert_normalized<T>(val);
+    editableData()[pos] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::add(const T& item) {
-    data_.push_back(item);
+    editableData().push_back(item);
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::add(std::initializer_list<T> data) {
+    auto& container = editableData();
     for (auto& elem : data) {
-        data_.push_back(elem);
+        container.push_back(elem);
     }
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::append(const std::vector<T>* data) {
-    data_.insert(data_.end(), data->begin(), data->end());
+    auto& container = editableData();
+    container.insert(container.end(), data->begin(), data->end());
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::append(const std::vector<T>& data) {
-    data_.insert(data_.end(), data.begin(), data.end());
+    auto& container = editableData();
+    container.insert(container.end(), data.begin(), data.end());
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::set(size_t index, const T& item) {
-    data_[index] = item;
+    editableData()[index] = item;
 }
 
 template <typename T, BufferTarget Target>
 T BufferRAMPrecision<T, Target>::get(size_t index) const {
-    return data_[index];
+    return (*data_)[index];
 }
 
 template <typename T, BufferTarget Target>
 T& BufferRAMPrecision<T, Target>::get(size_t index) {
-    return data_[index];
+    return editableData()[index];
 }
 
 template <typename T, BufferTarget Target>
 void BufferRAMPrecision<T, Target>::clear() {
-    data_.clear();
+    if (data_.use_count() > 1) {
+        data_ = std::make_shared<std::vector<T>>();
+    } else {
+        data_->clear();
+    }
 }
 
 template <typename Result, template <class> class Predicate, typename Callable, typename... Args>
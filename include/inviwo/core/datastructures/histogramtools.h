@@ -65,12 +65,20 @@ public:
 private:
     enum class Status { Valid, Calculating, NotSet };
     struct State {
+        ~State();
+
         std::mutex mutex;
         std::vector<Histogram1D> histograms;
         Dispatcher<Callback> callbacks;
         Status status = Status::NotSet;
     };
 
+    /**
+     * Register valid histograms as evictable data with the ResourceManager, when evicted they are
+     * calculated again on the next request.
+     */
+    static void makeEvictable(const std::shared_ptr<State>& cache);
+
     std::shared_ptr<State> state_;
 };
 
@@ -40,6 +40,8 @@
 #include <algorithm>
 
 #include <glm/gtx/component_wise.hpp>
+#include <memory>
+#include <optional>
 #include <span>
 
 namespace inviwo {
@@ -151,6 +153,11 @@ protected:
 
 /**
  * \ingroup datastructures
+ * The pixel data is copy-on-write, clones of the representation share the same data until one of
+ * them is accessed for writing, i.e. through one of the non-const data accessors or setters. Only
+ * then is the data copied. Copying the representation invalidates all pointers and views obtained
+ * earlier from the non-const accessors, writing through them would modify the data of the copy as
+ * well.
  */
 template <typename T>
 class LayerRAMPrecision : public LayerRAM {
@@ -175,12 +182,23 @@ public:
 
     virtual const DataFormatBase* getDataFormat() const override;
 
+    /**
+     * Get the pixel data for writing, it is copied first if it is shared. The pointer is
+     * invalidated by copying the representation.
+     */
     T* getDataTyped();
     const T* getDataTyped() const;
 
+    /**
+     * Get a view of the pixel data for writing, it is copied first if it is shared. The view is
+     * invalidated by copying the representation.
+     */
     std::span<T> getView();
     std::span<const T> getView() const;
 
+    /**
+     * @copydoc getDataTyped()
+     */
     virtual void* getData() override;
     virtual const void* getData() const override;
     virtual void setData(void* data, size2_t dimensions) override;
@@ -226,8 +244,20 @@ public:
     }
 
 private:
+    T* editableData() {
+        if (data_.use_count() > 1) data_ = copyData(data_.get());
+        return data_.get();
+    }
+    std::shared_ptr<T[]> makeData(std::unique_ptr<T[]> data,
+                                  std::optional<ResourceMeta> meta = std::nullopt) const;
+    std::shared_ptr<T[]> copyData(const T* src) const;
+    /**
+     * Get the resource meta of the current data, if no one else is sharing it.
+     */
+    std::optional<ResourceMeta> takeMeta();
+
     size2_t dimensions_;
-    std::unique_ptr<T[]> data_;
+    std::shared_ptr<T[]> data_;
     SwizzleMask swizzleMask_;
     InterpolationType interpolation_;
     Wrapping2D wrapping_;
@@ -259,16 +289,12 @@ LayerRAMPrecision<T>::LayerRAMPrecision(size2_t dimensions, LayerType type,
                                         InterpolationType interpolation, const Wrapping2D& wrapping)
     : LayerRAM(type)
     , dimensions_(dimensions)
-    , data_(std::make_unique<T[]>(glm::compMul(dimensions_)))
+    , data_(makeData(std::make_unique<T[]>(glm::compMul(dimensions_))))
     , swizzleMask_(swizzleMask)
     , interpolation_{interpolation}
     , wrapping_{wrapping} {
     std::fill(data_.get(), data_.get() + glm::compMul(dimensions_),
               (type == LayerType::Depth) ? T{1} : T{0});
-
-    resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0, 0},
-                                                   .format = DataFormat<T>::id(),
-                                                   .desc = "LayerRAM"});
 }
 
 template <typename T>
@@ -277,18 +303,15 @@ LayerRAMPrecision<T>::LayerRAMPrecision(T* data, size2_t dimensions, LayerType t
                                         InterpolationType interpolation, const Wrapping2D& wrapping)
     : LayerRAM(type)
     , dimensions_(dimensions)
-    , data_(data)
+    , data_(makeData(data ? std::unique_ptr<T[]>(data)
+                          : std::make_unique<T[]>(glm::compMul(dimensions_))))
     , swizzleMask_(swizzleMask)
     , interpolation_{interpolation}
     , wrapping_{wrapping} {
     if (!data) {
-        data_ = std::make_unique<T[]>(glm::compMul(dimensions_));
         std::fill(data_.get(), data_.get() + glm::compMul(dimensions_),
                   (type == LayerType::Depth) ? T{1} : T{0});
     }
-    resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0, 0},
-                                                   .format = DataFormat<T>::id(),
-                                                   .desc = "LayerRAM"});
 }
 
 template <typename T>
@@ -308,43 +331,25 @@ template <typename T>
 LayerRAMPrecision<T>::LayerRAMPrecision(const LayerRAMPrecision<T>& rhs)
     : LayerRAM(rhs)
     , dimensions_(rhs.dimensions_)
-    , data_(std::make_unique<T[]>(glm::compMul(dimensions_)))
+    , data_(rhs.data_)
     , swizzleMask_(rhs.swizzleMask_)
     , interpolation_{rhs.interpolation_}
-    , wrapping_{rhs.wrapping_} {
-    std::copy(rhs.getView().begin(), rhs.getView().end(), data_.get());
-
-    resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0, 0},
-                                                   .format = DataFormat<T>::id(),
-                                                   .desc = "LayerRAM"});
-}
+    , wrapping_{rhs.wrapping_} {}
 
 template <typename T>
 LayerRAMPrecision<T>& LayerRAMPrecision<T>::operator=(const LayerRAMPrecision<T>& that) {
     if (this != &that) {
         LayerRAM::operator=(that);
-
-        const auto dim = that.dimensions_;
-        auto data = std::make_unique<T[]>(glm::compMul(dimensions_));
-        std::copy(that.getView().begin(), that.getView().end(), data.get());
-        data_.swap(data);
-
         dimensions_ = that.dimensions_;
+        data_ = that.data_;
         swizzleMask_ = that.swizzleMask_;
         interpolation_ = that.interpolation_;
         wrapping_ = that.wrapping_;
-        auto old = resource::remove(resource::toRAM(data));
-        resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0, 0},
-                                                       .format = DataFormat<T>::id(),
-                                                       .desc = "LayerRAM",
-                                                       .meta = resource::getMeta(old)});
     }
     return *this;
 }
 template <typename T>
-LayerRAMPrecision<T>::~LayerRAMPrecision() {
-    resource::remove(resource::toRAM(data_));
-}
+LayerRAMPrecision<T>::~LayerRAMPrecision() = default;
 
 template <typename T>
 LayerRAMPrecision<T>* LayerRAMPrecision<T>::clone() const {
@@ -358,7 +363,7 @@ const DataFormatBase* LayerRAMPrecision<T>::getDataFormat() const {
 
 template <typename T>
 T* LayerRAMPrecision<T>::getDataTyped() {
-    return data_.get();
+    return editableData();
 }
 
 template <typename T>
@@ -368,7 +373,7 @@ const T* LayerRAMPrecision<T>::getDataTyped() const {
 
 template <typename T>
 std::span<T> LayerRAMPrecision<T>::getView() {
-    return std::span<T>{data_.get(), glm::compMul(dimensions_)};
+    return std::span<T>{editableData(), glm::compMul(dimensions_)};
 }
 
 template <typename T>
@@ -378,7 +383,7 @@ std::span<const T> LayerRAMPrecision<T>::getView() const {
 
 template <typename T>
 void* LayerRAMPrecision<T>::getData() {
-    return data_.get();
+    return editableData();
 }
 template <typename T>
 const void* LayerRAMPrecision<T>::getData() const {
@@ -388,23 +393,43 @@ const void* LayerRAMPrecision<T>::getData() const {
 template <typename T>
 void LayerRAMPrecision<T>::setData(void* d, size2_t dimensions) {
     std::unique_ptr<T[]> data(static_cast<T*>(d));
-    data_.swap(data);
-    std::swap(dimensions_, dimensions);
+    auto meta = takeMeta();
+    dimensions_ = dimensions;
+    data_ = makeData(std::move(data), std::move(meta));
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setDimensions(size2_t dimensions) {
     if (dimensions != dimensions_) {
-        auto data = std::make_unique<T[]>(dimensions.x * dimensions.y);
-        data_.swap(data);
-        std::swap(dimensions, dimensions_);
-
-        auto old = resource::remove(resource::toRAM(data));
-        resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0, 0},
-                                                       .format = DataFormat<T>::id(),
-                                                       .desc = "LayerRAM",
-                                                       .meta = resource::getMeta(old)});
+        auto meta = takeMeta();
+        dimensions_ = dimensions;
+        data_ = makeData(std::make_unique<T[]>(glm::compMul(dimensions_)), std::move(meta));
+    }
+}
+
+template <typename T>
+std::shared_ptr<T[]> LayerRAMPrecision<T>::makeData(std::unique_ptr<T[]> data,
+                                                    std::optional<ResourceMeta> meta) const {
+    return resource::share(std::move(data), Resource{.dims = glm::size4_t{dimensions_, 0, 0},
+                                                     .format = DataFormat<T>::id(),
+                                                     .desc = "LayerRAM",
+                                                     .meta = std::move(meta)});
+}
+
+template <typename T>
+std::shared_ptr<T[]> LayerRAMPrecision<T>::copyData(const T* src) const {
+    const auto size = glm::compMul(dimensions_);
+    auto data = std::make_unique_for_overwrite<T[]>(size);
+    std::copy(src, src + size, data.get());
+    return makeData(std::move(data));
+}
+
+template <typename T>
+std::optional<ResourceMeta> LayerRAMPrecision<T>::takeMeta() {
+    if (data_.use_count() == 1) {
+        return resource::getMeta(resource::remove(resource::toRAM(data_)));
     }
+    return std::nullopt;
 }
 
 template <typename T>
@@ -464,22 +489,22 @@ dvec4 LayerRAMPrecision<T>::getAsDVec4(const size2_t& pos) const {
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromDouble(const size2_t& pos, double val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromDVec2(const size2_t& pos, dvec2 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromDVec3(const size2_t& pos, dvec3 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromDVec4(const size2_t& pos, dvec4 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
@@ -504,22 +529,22 @@ dvec4 LayerRAMPrecision<T>::getAsNormalizedDVec4(const size2_t& pos) const {
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromNormalizedDouble(const size2_t& pos, double val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromNormalizedDVec2(const size2_t& pos, dvec2 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromNormalizedDVec3(const size2_t& pos, dvec3 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void LayerRAMPrecision<T>::setFromNormalizedDVec4(const size2_t& pos, dvec4 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 size_t inline LayerRAM::posToIndex(const size2_t& pos, const size2_t& dim) {
@@ -0,0 +1,136 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace inviwo {
+
+class VolumeRAM;
+
+/**
+ * \ingroup datastructures
+ * \brief A thread safe, memory budgeted, least recently used cache of volume bricks
+ *
+ * Bricks are identified by a source id, unique for each set of bricked data, and the linear
+ * index of the brick within that source. Whenever the total size of the cached bricks exceeds
+ * the budget the least recently used bricks are dropped from the cache. Bricks are handed out as
+ * shared pointers, hence a brick that is in use stays valid even if it is evicted.
+ *
+ * Concurrent requests for a brick that is not resident will only load it once, the other
+ * requests wait for that load to finish.
+ * @see VolumeBricked
+ */
+class IVW_CORE_API BrickCache {
+public:
+    struct Key {
+        size_t source;
+        size_t brick;
+        bool operator==(const Key&) const = default;
+    };
+    using Loader = std::function<std::shared_ptr<const VolumeRAM>()>;
+
+    static constexpr size_t defaultBudget = size_t{1024} * 1024 * 1024;
+
+    explicit BrickCache(size_t budget = defaultBudget);
+    BrickCache(const BrickCache&) = delete;
+    BrickCache& operator=(const BrickCache&) = delete;
+    ~BrickCache();
+
+    /**
+     * Get the brick @p key from the cache, or call @p load to create it and add it to the cache.
+     * Exceptions thrown by @p load are propagated to all callers waiting for the brick.
+     */
+    std::shared_ptr<const VolumeRAM> get(const Key& key, const Loader& load);
+
+    /**
+     * Get the brick @p key if it is resident, nullptr otherwise. Marks the brick as used.
+     */
+    std::shared_ptr<const VolumeRAM> find(const Key& key);
+    bool contains(const Key& key) const;
+
+    /**
+     * Remove all bricks of @p source from the cache.
+     */
+    void erase(size_t source);
+    void clear();
+
+    /**
+     * Set the memory budget in bytes, evicting bricks if the cache is larger than the new budget.
+     */
+    void setBudget(size_t bytes);
+    size_t getBudget() const;
+    /**
+     * The total size in bytes of all resident bricks.
+     */
+    size_t getSize() const;
+    size_t getNumberOfBricks() const;
+
+    /**
+     * The cache shared by all bricked volumes that are not given a cache of their own. The budget
+     * is controlled by the "Brick Cache Size" system setting.
+     */
+    static std::shared_ptr<BrickCache> getDefault();
+    /**
+     * Get a new unique source id.
+     */
+    static size_t newSource();
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const;
+    };
+    struct Entry {
+        Key key;
+        std::shared_ptr<const VolumeRAM> brick;
+        size_t bytes;
+    };
+
+    void insert(const Key& key, std::shared_ptr<const VolumeRAM> brick);
+    void evict();
+
+    mutable std::mutex mutex_;
+    size_t budget_;
+    size_t size_;
+    std::list<Entry> lru_;  // most recently used first
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> entries_;
+    std::unordered_map<Key, std::shared_future<std::shared_ptr<const VolumeRAM>>, KeyHash>
+        loading_;
+};
+
+}  // namespace inviwo
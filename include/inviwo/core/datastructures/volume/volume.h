@@ -39,6 +39,7 @@
 #include <inviwo/core/datastructures/representationtraits.h>
 #include <inviwo/core/datastructures/datasequence.h>
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>
+#include <inviwo/core/datastructures/volume/volumepyramid.h>
 #include <inviwo/core/datastructures/unitsystem.h>
 #include <inviwo/core/metadata/metadataowner.h>
 #include <inviwo/core/util/glmvec.h>
@@ -87,15 +88,29 @@ public:
      */
     Volume(const Volume& rhs, NoData noData, const VolumeConfig& config = {});
 
-    Volume(const Volume&) = default;
+    /**
+     * Copies the representations but not the pyramid, the copy builds its own when requested.
+     */
+    Volume(const Volume& rhs);
     Volume(Volume&&) = default;
-    Volume& operator=(const Volume& that) = default;
+    Volume& operator=(const Volume& that);
     Volume& operator=(Volume&& that) = default;
     virtual ~Volume();
     virtual Volume* clone() const override;
 
     Document getInfo() const;
 
+    /**
+     * Get an editable representation, see Data::getEditableRepresentation. Since the data might
+     * be modified the pyramid is cleared.
+     */
+    template <typename T>
+    T* getEditableRepresentation();
+    /**
+     * See Data::invalidateAllOther, the pyramid is cleared.
+     */
+    void invalidateAllOther(const VolumeRepresentation* repr);
+
     /**
      * Resize to dimension. This is destructive, the data will not be
      * preserved.
@@ -178,6 +193,16 @@ public:
         const std::function<void(const std::vector<Histogram1D>&)>& whenDone) const;
     void discardHistograms();
 
+    /**
+     * Start building the multi-resolution pyramid of this volume in the background, see
+     * VolumePyramid. @p whenLevelDone is called on the main thread for each finished level.
+     */
+    [[nodiscard]] VolumePyramid::Result calculatePyramid(
+        const std::function<VolumePyramid::Callback>& whenLevelDone) const;
+    const VolumePyramid& getPyramid() const;
+    VolumePyramid& getPyramid();
+    void discardPyramid();
+
     VolumeConfig config() const;
 
 protected:
@@ -187,8 +212,15 @@ protected:
     InterpolationType defaultInterpolation_;
     Wrapping3D defaultWrapping_;
     HistogramCache histograms_;
+    VolumePyramid pyramid_;
 };
 
+template <typename T>
+T* Volume::getEditableRepresentation() {
+    pyramid_.clear();
+    return Data<Volume, VolumeRepresentation>::getEditableRepresentation<T>();
+}
+
 template <typename Kind>
 const typename representation_traits<Volume, Kind>::type* Volume::getRep() const {
     static_assert(
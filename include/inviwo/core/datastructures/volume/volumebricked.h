@@ -0,0 +1,270 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/volume/volumerepresentation.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/brickcache.h>
+
+#include <memory>
+#include <optional>
+
+namespace inviwo {
+
+/**
+ * \ingroup datastructures
+ * \brief Interface for providing the bricks of a VolumeBricked
+ *
+ * Implementations have to be thread safe since bricks may be loaded concurrently.
+ */
+class IVW_CORE_API VolumeBrickSource {
+public:
+    virtual ~VolumeBrickSource() = default;
+
+    virtual const size3_t& getDimensions() const = 0;
+    virtual const DataFormatBase* getDataFormat() const = 0;
+
+    /**
+     * Load the voxels in [offset, offset + dims) into a new VolumeRAM with dimensions @p dims.
+     */
+    virtual std::shared_ptr<VolumeRAM> load(size3_t offset, size3_t dims) const = 0;
+
+    /**
+     * The brick size that matches how the source stores its data, e.g. a multiple of the chunk
+     * size of a chunked file. std::nullopt if any brick size is equally good.
+     */
+    virtual std::optional<size3_t> getPreferredBrickSize() const { return std::nullopt; }
+};
+
+/**
+ * \ingroup datastructures
+ * \brief A VolumeBrickSource serving bricks copied from a VolumeRAM
+ */
+class IVW_CORE_API VolumeRAMBrickSource : public VolumeBrickSource {
+public:
+    explicit VolumeRAMBrickSource(std::shared_ptr<const VolumeRAM> volume);
+    virtual ~VolumeRAMBrickSource() = default;
+
+    virtual const size3_t& getDimensions() const override;
+    virtual const DataFormatBase* getDataFormat() const override;
+    virtual std::shared_ptr<VolumeRAM> load(size3_t offset, size3_t dims) const override;
+
+private:
+    std::shared_ptr<const VolumeRAM> volume_;
+};
+
+/**
+ * \ingroup datastructures
+ * \brief Interface for disk representation loaders that can read parts of a volume
+ *
+ * A DiskRepresentationLoader that also implements this interface lets a VolumeDisk be converted
+ * into a VolumeBricked without loading the whole volume into memory.
+ */
+class IVW_CORE_API VolumeBrickSourceProvider {
+public:
+    virtual ~VolumeBrickSourceProvider() = default;
+    virtual std::shared_ptr<const VolumeBrickSource> createBrickSource(
+        const VolumeRepresentation& src) const = 0;
+};
+
+/**
+ * \ingroup datastructures
+ * \brief An out-of-core volume representation split into bricks of a fixed size
+ *
+ * The volume is divided into bricks of getBrickSize() voxels, the bricks at the upper boundaries
+ * are cropped to the volume dimensions. Bricks are loaded on demand from a VolumeBrickSource and
+ * kept in a memory budgeted BrickCache, hence only the parts of the volume that are actually
+ * accessed are ever read and the memory used is bounded by the budget of the cache.
+ *
+ * Algorithms that only touch a part of the volume, like extracting a subset or a slice, should use
+ * getRegion() or forEachBrick() to only load the bricks they need. The representation is read
+ * only, use a VolumeRAM to modify the data.
+ * @see util::getBrickedRepresentation
+ */
+class IVW_CORE_API VolumeBricked : public VolumeRepresentation {
+public:
+    static constexpr size3_t defaultBrickSize{64, 64, 64};
+
+    /**
+     * @param source the source of the bricks, defines the dimensions and format of the volume.
+     * @param brickSize size of each brick in voxels.
+     * @param swizzleMask of the volume.
+     * @param interpolation of the volume.
+     * @param wrapping of the volume.
+     * @param cache to keep loaded bricks in, BrickCache::getDefault() if nullptr.
+     */
+    explicit VolumeBricked(std::shared_ptr<const VolumeBrickSource> source,
+                           size3_t brickSize = defaultBrickSize,
+                           const SwizzleMask& swizzleMask = VolumeConfig::defaultSwizzleMask,
+                           InterpolationType interpolation = VolumeConfig::defaultInterpolation,
+                           const Wrapping3D& wrapping = VolumeConfig::defaultWrapping,
+                           std::shared_ptr<BrickCache> cache = nullptr);
+    VolumeBricked(const VolumeBricked& rhs) = default;
+    VolumeBricked& operator=(const VolumeBricked& that) = default;
+    virtual VolumeBricked* clone() const override;
+    virtual ~VolumeBricked() = default;
+
+    virtual std::type_index getTypeIndex() const override final;
+
+    virtual const DataFormatBase* getDataFormat() const override;
+
+    /**
+     * A bricked volume can not be resized.
+     * @throws Exception
+     */
+    virtual void setDimensions(size3_t dimensions) override;
+    virtual const size3_t& getDimensions() const override;
+
+    virtual void setSwizzleMask(const SwizzleMask& mask) override;
+    virtual SwizzleMask getSwizzleMask() const override;
+
+    virtual void setInterpolation(InterpolationType interpolation) override;
+    virtual InterpolationType getInterpolation() const override;
+
+    virtual void setWrapping(const Wrapping3D& wrapping) override;
+    virtual Wrapping3D getWrapping() const override;
+
+    const size3_t& getBrickSize() const { return brickSize_; }
+    /**
+     * Number of bricks along each axis.
+     */
+    const size3_t& getBrickCount() const { return brickCount_; }
+    /**
+     * The brick containing voxel @p pos.
+     */
+    size3_t getBrick(const size3_t& pos) const { return pos / brickSize_; }
+    size3_t getBrickOffset(const size3_t& brick) const { return brick * brickSize_; }
+    /**
+     * Dimensions of @p brick, smaller than the brick size for bricks at the upper boundaries.
+     */
+    size3_t getBrickDimensions(const size3_t& brick) const;
+
+    /**
+     * Whether @p brick is currently held by the brick cache.
+     */
+    bool isResident(const size3_t& brick) const;
+
+    /**
+     * Get @p brick, loading it if it is not resident. The brick stays valid as long as the
+     * returned pointer is held, even if it is evicted from the cache in the meantime.
+     */
+    std::shared_ptr<const VolumeRAM> getBrickData(const size3_t& brick) const;
+
+    /**
+     * Load all bricks overlapping [offset, offset + dims) using the thread pool.
+     */
+    void prefetch(const size3_t& offset, const size3_t& dims) const;
+
+    /**
+     * Copy the voxels in [offset, offset + dims) into a new VolumeRAM. Only the bricks overlapping
+     * the region are loaded.
+     * @throws RangeException if the region is not inside the volume.
+     */
+    std::shared_ptr<VolumeRAM> getRegion(const size3_t& offset, const size3_t& dims) const;
+
+    /**
+     * Call @p callback for each brick overlapping [offset, offset + dims) as
+     * `callback(const VolumeRAM& brick, const size3_t& brickOffset)` where brickOffset is the
+     * position of the first voxel of the brick within the volume.
+     */
+    template <typename C>
+    void forEachBrick(const size3_t& offset, const size3_t& dims, C callback) const;
+
+    /**
+     * Random access to single voxels, every call goes through the brick cache. Prefer
+     * getBrickData(), getRegion() or forEachBrick() when accessing many voxels.
+     */
+    double getAsDouble(const size3_t& pos) const;
+    dvec2 getAsDVec2(const size3_t& pos) const;
+    dvec3 getAsDVec3(const size3_t& pos) const;
+    dvec4 getAsDVec4(const size3_t& pos) const;
+
+    const VolumeBrickSource& getSource() const;
+    /**
+     * Replace the source of the bricks, this also updates the dimensions and drops all bricks
+     * cached from the previous source. The brick size is replaced by @p brickSize if given.
+     */
+    void setSource(std::shared_ptr<const VolumeBrickSource> source,
+                   std::optional<size3_t> brickSize = std::nullopt);
+    BrickCache& getCache() const;
+
+private:
+    struct Bricks;
+    void checkRegion(const size3_t& offset, const size3_t& dims) const;
+
+    std::shared_ptr<const Bricks> bricks_;
+    size3_t dimensions_;
+    size3_t brickSize_;
+    size3_t brickCount_;
+    SwizzleMask swizzleMask_;
+    InterpolationType interpolation_;
+    Wrapping3D wrapping_;
+};
+
+template <typename C>
+void VolumeBricked::forEachBrick(const size3_t& offset, const size3_t& dims, C callback) const {
+    checkRegion(offset, dims);
+    if (glm::compMul(dims) == 0) return;
+    const auto first = getBrick(offset);
+    const auto last = getBrick(offset + dims - size3_t{1});
+    size3_t brick;
+    for (brick.z = first.z; brick.z <= last.z; ++brick.z) {
+        for (brick.y = first.y; brick.y <= last.y; ++brick.y) {
+            for (brick.x = first.x; brick.x <= last.x; ++brick.x) {
+                const auto data = getBrickData(brick);
+                callback(*data, getBrickOffset(brick));
+            }
+        }
+    }
+}
+
+namespace util {
+
+/**
+ * Copy the region [srcOffset, srcOffset + region) of @p src into @p dst at @p dstOffset, where
+ * both are dense volumes of @p elementSize bytes per voxel with dimensions @p srcDims and
+ * @p dstDims respectively.
+ */
+IVW_CORE_API void copyVoxels(const void* src, const size3_t& srcDims, const size3_t& srcOffset,
+                             void* dst, const size3_t& dstDims, const size3_t& dstOffset,
+                             const size3_t& region, size_t elementSize);
+
+/**
+ * Get a bricked representation of @p volume if the volume should be accessed out-of-core,
+ * otherwise nullptr, in which case the VolumeRAM representation should be used. A bricked
+ * representation is returned if the volume already has one, or if the volume is only available
+ * on disk and is larger than the budget of the default BrickCache.
+ */
+IVW_CORE_API std::shared_ptr<const VolumeBricked> getBrickedRepresentation(const Volume& volume);
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -0,0 +1,186 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/dispatcher.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace inviwo {
+
+class Volume;
+class VolumeRAM;
+class VolumeBricked;
+
+/**
+ * \ingroup datastructures
+ * \brief A lazily built multi-resolution pyramid of a Volume
+ *
+ * Level 0 is the volume itself, each following level halves the dimensions of the previous one,
+ * rounding up, by averaging blocks of 2x2x2 voxels. The last level is the first one where no
+ * dimension is larger than minimumSize. Each level is a Volume of its own with the same basis,
+ * offset, and data mapping as the original, hence it can be used in place of it.
+ *
+ * The pyramid is built in the background on the thread pool the first time it is requested, see
+ * Volume::calculatePyramid. A strided preview of the coarsest level is made available first,
+ * then the levels are computed from fine to coarse and the preview is replaced. The callbacks
+ * are invoked on the main thread each time a level becomes available, such that viewers can
+ * show a coarse level right away and refine progressively.
+ *
+ * A finished pyramid is registered as evictable data with the ResourceManager. If evicted, the
+ * levels are dropped and the next request builds them again.
+ */
+class IVW_CORE_API VolumePyramid {
+public:
+    using Callback = void(size_t level);
+
+    enum class Progress { Done, Building, NoData };
+    struct Result {
+        DispatcherHandle<Callback> handle = nullptr;
+        Progress progress = Progress::NoData;
+    };
+
+    static constexpr size_t minimumSize = 16;
+
+    VolumePyramid();
+    VolumePyramid(const VolumePyramid& rhs);
+    VolumePyramid(VolumePyramid&& rhs) noexcept;
+    VolumePyramid& operator=(const VolumePyramid& that);
+    VolumePyramid& operator=(VolumePyramid&& that) noexcept;
+    ~VolumePyramid() = default;
+
+    /**
+     * Start building the pyramid of @p volume unless it is already built or being built.
+     * @p whenLevelDone is called for each level that becomes available, or once with the
+     * coarsest level if the pyramid is already done.
+     */
+    Result request(const Volume& volume, const std::function<Callback>& whenLevelDone) const;
+
+    /**
+     * Drop all levels, and rebuild them from @p volume if the pyramid had been requested before.
+     */
+    void discard(const Volume& volume);
+    /**
+     * Drop all levels without rebuilding them, the next request builds them again. Callbacks
+     * waiting for levels are kept and invoked once a new build publishes its levels.
+     */
+    void clear();
+
+    /**
+     * Use the already computed @p levels, starting at level 1, for example levels stored together
+     * with the volume in a file. The pyramid is done right away and the callbacks are invoked.
+     * @throws Exception if the number of levels does not match the dimensions of @p volume
+     */
+    void assign(const Volume& volume, std::vector<std::shared_ptr<const Volume>> levels);
+
+    /**
+     * Number of levels including level 0, zero if the pyramid has not been requested.
+     */
+    size_t getNumberOfLevels() const;
+    size3_t getDimensions(size_t level) const;
+    bool isDone() const;
+
+    /**
+     * Get @p level if it is available, nullptr otherwise. Level 0 is the volume itself and is not
+     * stored in the pyramid, hence always nullptr.
+     */
+    std::shared_ptr<const Volume> getLevel(size_t level) const;
+
+    /**
+     * Get the finest available level that is at least as coarse as @p level together with its
+     * index, or nullptr if none of them is available yet.
+     */
+    std::pair<size_t, std::shared_ptr<const Volume>> getAvailable(size_t level) const;
+
+    /**
+     * The coarsest level whose dimensions are at least @p resolution along every axis.
+     */
+    size_t findLevel(const size3_t& resolution) const;
+    /**
+     * The finest level that fits within @p bytes, or the coarsest level if none does.
+     */
+    size_t findLevelForBudget(size_t bytes) const;
+
+private:
+    enum class Status { Valid, Building, NotSet };
+    struct State {
+        ~State();
+        // Recursive since the callbacks are invoked under the lock and may query the pyramid
+        std::recursive_mutex mutex;
+        size3_t dimensions{0};
+        size_t bytesPerVoxel = 0;
+        std::vector<std::shared_ptr<const Volume>> levels;
+        Dispatcher<Callback> callbacks;
+        Status status = Status::NotSet;
+    };
+    /**
+     * Register the levels of a finished pyramid as evictable. Must not be called with the lock
+     * held, since the eviction of other pyramids might be triggered.
+     */
+    static void makeEvictable(const std::shared_ptr<State>& pyramid);
+
+    std::shared_ptr<State> state_;
+};
+
+namespace util {
+
+/**
+ * Dimensions of level @p level of a volume pyramid with base dimensions @p dims.
+ */
+IVW_CORE_API size3_t pyramidLevelDimensions(const size3_t& dims, size_t level);
+
+/**
+ * Number of levels, including level 0, of a volume pyramid with base dimensions @p dims such
+ * that no dimension of the last level is larger than @p minSize.
+ */
+IVW_CORE_API size_t pyramidLevelCount(const size3_t& dims,
+                                      size_t minSize = VolumePyramid::minimumSize);
+
+/**
+ * Halve the dimensions of @p volume, rounding up, by averaging blocks of 2x2x2 voxels. Voxels
+ * outside of the volume are clamped to the border.
+ */
+IVW_CORE_API std::shared_ptr<VolumeRAM> volumeHalve(const VolumeRAM& volume);
+
+/**
+ * Halve the dimensions of @p volume like above, one brick at a time. With an odd brick size
+ * regions of twice the brick size are halved instead, such that only a few bricks are loaded at a
+ * time.
+ */
+IVW_CORE_API std::shared_ptr<VolumeRAM> volumeHalve(const VolumeBricked& volume);
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -39,6 +39,8 @@
 #include <inviwo/core/resourcemanager/resource.h>
 
 #include <glm/gtx/component_wise.hpp>
+#include <memory>
+#include <optional>
 #include <span>
 
 namespace inviwo {
@@ -171,6 +173,11 @@ struct representation_traits<Volume, kind::RAM> {
 
 /**
  * \ingroup datastructures
+ * The voxel data is copy-on-write, clones of the representation share the same data until one of
+ * them is accessed for writing, i.e. through one of the non-const data accessors or setters. Only
+ * then is the data copied. Read-only shared data, like a memory mapped file, is copied the same
+ * way. Copying the representation invalidates all pointers and views obtained earlier from the
+ * non-const accessors, writing through them would modify the data of the copy as well.
  */
 template <typename T>
 class VolumeRAMPrecision : public VolumeRAM {
@@ -186,6 +193,15 @@ public:
                        const SwizzleMask& swizzleMask = VolumeConfig::defaultSwizzleMask,
                        InterpolationType interpolation = VolumeConfig::defaultInterpolation,
                        const Wrapping3D& wrapping = VolumeConfig::defaultWrapping);
+    /**
+     * Create a volume that references read-only shared data, for example a memory mapped file.
+     * The data is shared with all clones of the representation and will only be copied into
+     * memory owned by the representation when it is accessed for writing.
+     */
+    VolumeRAMPrecision(std::shared_ptr<const T> data, size3_t dimensions,
+                       const SwizzleMask& swizzleMask = VolumeConfig::defaultSwizzleMask,
+                       InterpolationType interpolation = VolumeConfig::defaultInterpolation,
+                       const Wrapping3D& wrapping = VolumeConfig::defaultWrapping);
     explicit VolumeRAMPrecision(const VolumeReprConfig& config);
     VolumeRAMPrecision(const VolumeRAMPrecision<T>& rhs);
     VolumeRAMPrecision<T>& operator=(const VolumeRAMPrecision<T>& that);
@@ -194,22 +210,46 @@ public:
 
     virtual const DataFormatBase* getDataFormat() const override;
 
+    /**
+     * Get the voxel data for writing, it is copied first if it is shared. The pointer is
+     * invalidated by copying the representation.
+     */
     T* getDataTyped();
     const T* getDataTyped() const;
 
+    /**
+     * Get a view of the voxel data for writing, it is copied first if it is shared. The view is
+     * invalidated by copying the representation.
+     */
     std::span<T> getView();
     std::span<const T> getView() const;
 
+    /**
+     * @copydoc getDataTyped()
+     */
     virtual void* getData() override;
     virtual const void* getData() const override;
 
-    virtual void* getData(size_t) override;
+    /**
+     * Get a pointer to the voxel at index @p pos for writing, see getDataTyped()
+     */
+    virtual void* getData(size_t pos) override;
     virtual const void* getData(size_t) const override;
 
     virtual void setData(void* data, size3_t dimensions) override;
 
     virtual void removeDataOwnership() override;
 
+    /**
+     * Replace the data with read-only shared data, see the shared data constructor.
+     */
+    void setSharedData(std::shared_ptr<const T> data, size3_t dimensions);
+    /**
+     * Returns true if the data is currently read-only shared data, i.e. it has not been written to
+     * since it was set.
+     */
+    bool hasSharedData() const { return shared_ != nullptr; }
+
     virtual const size3_t& getDimensions() const override;
     virtual void setDimensions(size3_t dimensions) override;
 
@@ -250,13 +290,35 @@ public:
     virtual size_t getNumberOfBytes() const override;
 
     virtual void updateResource(const ResourceMeta& meta) const override {
-        resource::meta(resource::toRAM(data_), meta);
+        if (data_) resource::meta(resource::toRAM(data_), meta);
     }
 
 private:
+    const T* constData() const { return shared_ ? shared_.get() : data_.get(); }
+    T* editableData() {
+        if (shared_ || data_.use_count() > 1) detach();
+        return data_.get();
+    }
+    /**
+     * Make sure the data is owned exclusively by this representation, copying it if it is
+     * shared with a clone or is read-only shared data.
+     */
+    void detach();
+    bool ownsData() const {
+        const auto* deleter = std::get_deleter<resource::RAMDeleter<T>>(data_);
+        return deleter && deleter->owner;
+    }
+    std::shared_ptr<T[]> makeData(std::unique_ptr<T[]> data,
+                                  std::optional<ResourceMeta> meta = std::nullopt) const;
+    std::shared_ptr<T[]> copyData(const T* src) const;
+    /**
+     * Get the resource meta of the current data, if no one else is sharing it.
+     */
+    std::optional<ResourceMeta> takeMeta();
+
     size3_t dimensions_;
-    bool ownsDataPtr_;
-    std::unique_ptr<T[]> data_;
+    std::shared_ptr<T[]> data_;
+    std::shared_ptr<const T> shared_;
     SwizzleMask swizzleMask_;
     InterpolationType interpolation_;
     Wrapping3D wrapping_;
@@ -280,6 +342,25 @@ IVW_CORE_API std::shared_ptr<VolumeRAM> createVolumeRAM(
     InterpolationType interpolation = InterpolationType::Linear,
     const Wrapping3D& wrapping = wrapping3d::clampAll);
 
+/**
+ * Factory for volumes referencing read-only shared data, for example a memory mapped file.
+ * The data will be copied into the volume the first time it is accessed for writing.
+ *
+ * @param dimensions of volume to create.
+ * @param format of volume to create.
+ * @param sharedData data to reference, has to contain at least `compMul(dimensions)` elements
+ * of the given format and be suitably aligned.
+ * @param swizzleMask of volume to create.
+ * @param interpolation of volume to create.
+ * @param wrapping of volume to create.
+ * @see VolumeRAMPrecision::VolumeRAMPrecision(std::shared_ptr<const T>, size3_t, ...)
+ */
+IVW_CORE_API std::shared_ptr<VolumeRAM> createVolumeRAM(
+    const size3_t& dimensions, const DataFormatBase* format, std::shared_ptr<const void> sharedData,
+    const SwizzleMask& swizzleMask = swizzlemasks::rgba,
+    InterpolationType interpolation = InterpolationType::Linear,
+    const Wrapping3D& wrapping = wrapping3d::clampAll);
+
 template <typename T>
 T VolumeRAM::posToIndex(const glm::tvec3<T, glm::defaultp>& pos,
                         const glm::tvec3<T, glm::defaultp>& dim) {
@@ -299,16 +380,10 @@ VolumeRAMPrecision<T>::VolumeRAMPrecision(size3_t dimensions, const SwizzleMask&
                                           const Wrapping3D& wrapping)
     : VolumeRAM{}
     , dimensions_{dimensions}
-    , ownsDataPtr_{true}
-    , data_{std::make_unique<T[]>(glm::compMul(dimensions_))}
+    , data_{makeData(std::make_unique<T[]>(glm::compMul(dimensions_)))}
     , swizzleMask_{swizzleMask}
     , interpolation_{interpolation}
-    , wrapping_{wrapping} {
-
-    resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0},
-                                                   .format = DataFormat<T>::id(),
-                                                   .desc = "VolumeRAM"});
-}
+    , wrapping_{wrapping} {}
 
 template <typename T>
 VolumeRAMPrecision<T>::VolumeRAMPrecision(T* data, size3_t dimensions,
@@ -317,17 +392,27 @@ VolumeRAMPrecision<T>::VolumeRAMPrecision(T* data, size3_t dimensions,
                                           const Wrapping3D& wrapping)
     : VolumeRAM{}
     , dimensions_{dimensions}
-    , ownsDataPtr_{true}
-    , data_{data}
+    , data_{makeData(data ? std::unique_ptr<T[]>(data)
+                          : std::make_unique<T[]>(glm::compMul(dimensions_)))}
+    , swizzleMask_{swizzleMask}
+    , interpolation_{interpolation}
+    , wrapping_{wrapping} {}
+
+template <typename T>
+VolumeRAMPrecision<T>::VolumeRAMPrecision(std::shared_ptr<const T> data, size3_t dimensions,
+                                          const SwizzleMask& swizzleMask,
+                                          InterpolationType interpolation,
+                                          const Wrapping3D& wrapping)
+    : VolumeRAM{}
+    , dimensions_{dimensions}
+    , data_{}
+    , shared_{std::move(data)}
     , swizzleMask_{swizzleMask}
     , interpolation_{interpolation}
     , wrapping_{wrapping} {
-    if (!data_) {
-        data_ = std::make_unique<T[]>(glm::compMul(dimensions_));
+    if (!shared_) {
+        data_ = makeData(std::make_unique<T[]>(glm::compMul(dimensions_)));
     }
-    resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0},
-                                                   .format = DataFormat<T>::id(),
-                                                   .desc = "VolumeRAM"});
 }
 
 template <typename T>
@@ -346,50 +431,38 @@ template <typename T>
 VolumeRAMPrecision<T>::VolumeRAMPrecision(const VolumeRAMPrecision<T>& rhs)
     : VolumeRAM{rhs}
     , dimensions_{rhs.dimensions_}
-    , ownsDataPtr_{true}
-    , data_{std::make_unique<T[]>(glm::compMul(dimensions_))}
+    , data_{rhs.data_}
+    , shared_{rhs.shared_}
     , swizzleMask_{rhs.swizzleMask_}
     , interpolation_{rhs.interpolation_}
     , wrapping_{rhs.wrapping_} {
 
-    std::copy(rhs.getView().begin(), rhs.getView().end(), data_.get());
-
-    resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0},
-                                                   .format = DataFormat<T>::id(),
-                                                   .desc = "VolumeRAM"});
+    // Data we do not own might be deleted by its owner at any time, so it can not be shared.
+    if (data_ && !rhs.ownsData()) {
+        data_ = copyData(rhs.data_.get());
+    }
 }
 
 template <typename T>
 VolumeRAMPrecision<T>& VolumeRAMPrecision<T>::operator=(const VolumeRAMPrecision<T>& that) {
     if (this != &that) {
         VolumeRAM::operator=(that);
-        auto dim = that.dimensions_;
-        auto data = std::make_unique<T[]>(dim.x * dim.y * dim.z);
-        std::copy(that.getView().begin(), that.getView().end(), data.get());
-        data_.swap(data);
-        std::swap(dim, dimensions_);
-        ownsDataPtr_ = true;
+        dimensions_ = that.dimensions_;
+        data_ = that.data_;
+        shared_ = that.shared_;
         swizzleMask_ = that.swizzleMask_;
         interpolation_ = that.interpolation_;
         wrapping_ = that.wrapping_;
 
-        auto old = resource::remove(resource::toRAM(data));
-        resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0},
-                                                       .format = DataFormat<T>::id(),
-                                                       .desc = "VolumeRAM",
-                                                       .meta = resource::getMeta(old)});
+        if (data_ && !that.ownsData()) {
+            data_ = copyData(that.data_.get());
+        }
     }
     return *this;
 }
 
 template <typename T>
-VolumeRAMPrecision<T>::~VolumeRAMPrecision() {
-    if (!ownsDataPtr_) {
-        data_.release();
-    } else {
-        resource::remove(resource::toRAM(data_));
-    }
-}
+VolumeRAMPrecision<T>::~VolumeRAMPrecision() = default;
 
 template <typename T>
 VolumeRAMPrecision<T>* VolumeRAMPrecision<T>::clone() const {
@@ -402,63 +475,105 @@ const DataFormatBase* VolumeRAMPrecision<T>::getDataFormat() const {
 
 template <typename T>
 const T* VolumeRAMPrecision<T>::getDataTyped() const {
-    return data_.get();
+    return constData();
 }
 
 template <typename T>
 T* VolumeRAMPrecision<T>::getDataTyped() {
-    return data_.get();
+    return editableData();
 }
 
 template <typename T>
 std::span<T> VolumeRAMPrecision<T>::getView() {
-    return std::span<T>{data_.get(), glm::compMul(dimensions_)};
+    return std::span<T>{editableData(), glm::compMul(dimensions_)};
 }
 
 template <typename T>
 std::span<const T> VolumeRAMPrecision<T>::getView() const {
-    return std::span<const T>{data_.get(), glm::compMul(dimensions_)};
+    return std::span<const T>{constData(), glm::compMul(dimensions_)};
 }
 
 template <typename T>
 void* VolumeRAMPrecision<T>::getData() {
-    return data_.get();
+    return editableData();
 }
 template <typename T>
 const void* VolumeRAMPrecision<T>::getData() const {
-    return const_cast<const T*>(data_.get());
+    return constData();
 }
 
 template <typename T>
 void* VolumeRAMPrecision<T>::getData(size_t pos) {
-    return data_.get() + pos;
+    return editableData() + pos;
 }
 
 template <typename T>
 const void* VolumeRAMPrecision<T>::getData(size_t pos) const {
-    return const_cast<const T*>(data_.get()) + pos;
+    return constData() + pos;
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setData(void* d, size3_t dimensions) {
     std::unique_ptr<T[]> data(static_cast<T*>(d));
-    data_.swap(data);
-    std::swap(dimensions_, dimensions);
+    auto meta = takeMeta();
+    shared_.reset();
+    dimensions_ = dimensions;
+    data_ = makeData(std::move(data), std::move(meta));
+}
+
+template <typename T>
+void VolumeRAMPrecision<T>::removeDataOwnership() {
+    detach();
+    if (auto* deleter = std::get_deleter<resource::RAMDeleter<T>>(data_)) {
+        deleter->owner = false;
+    }
+}
+
+template <typename T>
+void VolumeRAMPrecision<T>::setSharedData(std::shared_ptr<const T> data, size3_t dimensions) {
+    auto meta = takeMeta();
+    data_.reset();
+    shared_ = std::move(data);
+    dimensions_ = dimensions;
 
-    auto old = resource::remove(resource::toRAM(data));
-    resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0},
-                                                   .format = DataFormat<T>::id(),
-                                                   .desc = "VolumeRAM",
-                                                   .meta = resource::getMeta(old)});
+    if (!shared_) {
+        data_ = makeData(std::make_unique<T[]>(glm::compMul(dimensions_)), std::move(meta));
+    }
+}
 
-    if (!ownsDataPtr_) data.release();
-    ownsDataPtr_ = true;
+template <typename T>
+void VolumeRAMPrecision<T>::detach() {
+    if (shared_) {
+        data_ = copyData(shared_.get());
+        shared_.reset();
+    } else if (data_.use_count() > 1) {
+        data_ = copyData(data_.get());
+    }
 }
 
 template <typename T>
-void VolumeRAMPrecision<T>::removeDataOwnership() {
-    ownsDataPtr_ = false;
-    resource::remove(resource::toRAM(data_));
+std::shared_ptr<T[]> VolumeRAMPrecision<T>::makeData(std::unique_ptr<T[]> data,
+                                                     std::optional<ResourceMeta> meta) const {
+    return resource::share(std::move(data), Resource{.dims = glm::size4_t{dimensions_, 0},
+                                                     .format = DataFormat<T>::id(),
+                                                     .desc = "VolumeRAM",
+                                                     .meta = std::move(meta)});
+}
+
+template <typename T>
+std::shared_ptr<T[]> VolumeRAMPrecision<T>::copyData(const T* src) const {
+    const auto size = glm::compMul(dimensions_);
+    auto data = std::make_unique_for_overwrite<T[]>(size);
+    std::copy(src, src + size, data.get());
+    return makeData(std::move(data));
+}
+
+template <typename T>
+std::optional<ResourceMeta> VolumeRAMPrecision<T>::takeMeta() {
+    if (data_ && data_.use_count() == 1) {
+        return resource::getMeta(resource::remove(resource::toRAM(data_)));
+    }
+    return std::nullopt;
 }
 
 template <typename T>
@@ -474,18 +589,10 @@ size_t VolumeRAMPrecision<T>::getNumberOfBytes() const {
 template <typename T>
 void VolumeRAMPrecision<T>::setDimensions(size3_t dimensions) {
     if (dimensions_ != dimensions) {
-        auto data = std::make_unique<T[]>(dimensions.x * dimensions.y * dimensions.z);
-        data_.swap(data);
+        auto meta = takeMeta();
+        shared_.reset();
         dimensions_ = dimensions;
-
-        auto old = resource::remove(resource::toRAM(data));
-        resource::add(resource::toRAM(data_), Resource{.dims = glm::size4_t{dimensions_, 0},
-                                                       .format = DataFormat<T>::id(),
-                                                       .desc = "VolumeRAM",
-                                                       .meta = resource::getMeta(old)});
-
-        if (!ownsDataPtr_) data.release();
-        ownsDataPtr_ = true;
+        data_ = makeData(std::make_unique<T[]>(glm::compMul(dimensions_)), std::move(meta));
     }
 }
 
@@ -521,82 +628,82 @@ Wrapping3D VolumeRAMPrecision<T>::getWrapping() const {
 
 template <typename T>
 double VolumeRAMPrecision<T>::getAsDouble(const size3_t& pos) const {
-    return util::glm_convert<double>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert<double>(constData()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec2 VolumeRAMPrecision<T>::getAsDVec2(const size3_t& pos) const {
-    return util::glm_convert<dvec2>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert<dvec2>(constData()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec3 VolumeRAMPrecision<T>::getAsDVec3(const size3_t& pos) const {
-    return util::glm_convert<dvec3>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert<dvec3>(constData()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec4 VolumeRAMPrecision<T>::getAsDVec4(const size3_t& pos) const {
-    return util::glm_convert<dvec4>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert<dvec4>(constData()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromDouble(const size3_t& pos, double val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromDVec2(const size3_t& pos, dvec2 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromDVec3(const size3_t& pos, dvec3 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromDVec4(const size3_t& pos, dvec4 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert<T>(val);
 }
 
 template <typename T>
 double VolumeRAMPrecision<T>::getAsNormalizedDouble(const size3_t& pos) const {
-    return util::glm_convert_normalized<double>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert_normalized<double>(constData()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec2 VolumeRAMPrecision<T>::getAsNormalizedDVec2(const size3_t& pos) const {
-    return util::glm_convert_normalized<dvec2>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert_normalized<dvec2>(constData()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec3 VolumeRAMPrecision<T>::getAsNormalizedDVec3(const size3_t& pos) const {
-    return util::glm_convert_normalized<dvec3>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert_normalized<dvec3>(constData()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 dvec4 VolumeRAMPrecision<T>::getAsNormalizedDVec4(const size3_t& pos) const {
-    return util::glm_convert_normalized<dvec4>(data_[posToIndex(pos, dimensions_)]);
+    return util::glm_convert_normalized<dvec4>(constData()[posToIndex(pos, dimensions_)]);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromNormalizedDouble(const size3_t& pos, double val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromNormalizedDVec2(const size3_t& pos, dvec2 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromNormalizedDVec3(const size3_t& pos, dvec3 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename T>
 void VolumeRAMPrecision<T>::setFromNormalizedDVec4(const size3_t& pos, dvec4 val) {
-    data_[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
+    editableData()[posToIndex(pos, dimensions_)] = util::glm_convert_normalized<T>(val);
 }
 
 template <typename Result, template <class> class Predicate, typename Callable, typename... Args>
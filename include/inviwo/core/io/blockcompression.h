@@ -0,0 +1,146 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace inviwo::util {
+
+/**
+ * Block compressed files consist of independently deflate compressed blocks, each stored as a
+ * separate gzip member. The result is a valid gzip file that any gzip reader can decompress.
+ * In addition each member header has an extra field (id "IV") holding the compressed size of the
+ * member and the uncompressed size of the block. That makes it possible to locate the blocks
+ * covering a given range by only reading the member headers, and to decompress the blocks
+ * concurrently.
+ */
+namespace blockcompression {
+
+/**
+ * Default number of uncompressed bytes per block
+ */
+constexpr size_t defaultBlockSize = size_t{1} << 20;
+
+/**
+ * Check if the file at @p path starts with a block compressed gzip member.
+ */
+IVW_CORE_API bool isBlockCompressed(const std::filesystem::path& path);
+
+/**
+ * Compress @p bytes bytes from @p source into the file @p path, blocks are compressed in parallel
+ * using the thread pool.
+ * @throw DataReaderException if the file cannot be created or written to
+ */
+IVW_CORE_API void write(const std::filesystem::path& path, const void* source, size_t bytes,
+                        size_t blockSize = defaultBlockSize);
+
+/**
+ * Decompress @p bytes bytes starting at the uncompressed offset @p offset from the block
+ * compressed file @p path into @p dest. Only the blocks overlapping the requested range are read,
+ * and they are decompressed in parallel using the thread pool.
+ * @throw DataReaderException if the file cannot be read, is not block compressed, is corrupt, or
+ * does not contain the requested range.
+ */
+IVW_CORE_API void read(const std::filesystem::path& path, size_t offset, size_t bytes, void* dest);
+
+/**
+ * The location of every block of a block compressed file. Constructing the index reads all member
+ * headers once, after that any range can be read without walking the headers again. Use it when
+ * reading many small ranges from the same file, e.g. the rows of the bricks of a volume.
+ */
+class IVW_CORE_API Index {
+public:
+    /**
+     * A range of @p bytes uncompressed bytes starting at @p offset, to be decompressed into
+     * @p dest.
+     */
+    struct Range {
+        size_t offset;
+        size_t bytes;
+        void* dest;
+    };
+
+    struct Block {
+        size_t filePos;
+        size_t memberSize;
+        size_t offset;
+        size_t size;
+    };
+
+    /**
+     * @throw DataReaderException if the file cannot be read or is not block compressed
+     */
+    explicit Index(const std::filesystem::path& path);
+
+    /**
+     * Total number of uncompressed bytes in the file
+     */
+    size_t size() const;
+    const std::vector<Block>& blocks() const { return blocks_; }
+
+    /**
+     * Decompress all @p ranges. Only the blocks overlapping any of the ranges are read, each of
+     * them at most once even if it overlaps several ranges, and they are decompressed in parallel
+     * using the thread pool. The ranges must not overlap in their destinations.
+     * @throw DataReaderException if the file cannot be read, is corrupt, or does not contain the
+     * requested ranges.
+     */
+    void read(std::span<const Range> ranges) const;
+    void read(size_t offset, size_t bytes, void* dest) const;
+
+private:
+    std::filesystem::path path_;
+    std::vector<Block> blocks_;
+};
+
+/**
+ * Compress @p source into a sequence of block compressed gzip members in memory, the same layout
+ * as write() produces. Blocks are compressed in parallel using the thread pool.
+ * @throw DataReaderException if the compression fails
+ */
+IVW_CORE_API std::vector<unsigned char> compress(std::span<const unsigned char> source,
+                                                 size_t blockSize = defaultBlockSize);
+
+/**
+ * Decompress the block compressed gzip members in @p source into @p dest. The blocks are
+ * decompressed in parallel using the thread pool.
+ * @throw DataReaderException if @p source is not block compressed, is corrupt, or if the size of
+ * the uncompressed data does not match the size of @p dest.
+ */
+IVW_CORE_API void decompress(std::span<const unsigned char> source, std::span<unsigned char> dest);
+
+}  // namespace blockcompression
+
+}  // namespace inviwo::util
@@ -41,7 +41,20 @@ void IVW_CORE_API readBytesIntoBuffer(const std::filesystem::path& path, size_t
                                       size_t bytes, ByteOrder byteOrder, size_t elementSize,
                                       void* dest);
 
+/**
+ * Read @p bytes bytes starting at the uncompressed offset @p offset from the compressed file
+ * @p path into @p dest. Block compressed files (see util::blockcompression) only decompress the
+ * blocks covering the requested range, in parallel. Other formats are decompressed sequentially
+ * from the start of the file.
+ */
 void IVW_CORE_API readCompressedBytesIntoBuffer(const std::filesystem::path& path, size_t offset,
                                                 size_t bytes, ByteOrder byteOrder,
                                                 size_t elementSize, void* dest);
+
+/**
+ * Swap the byte order of the @p bytes bytes of big endian elements of @p elementSize bytes in
+ * @p dest, in place.
+ */
+void IVW_CORE_API convertToLittleEndian(void* dest, size_t bytes, size_t elementSize);
+
 }  // namespace inviwo::util
@@ -0,0 +1,159 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+
+class DataFormatBase;
+class VolumeRAM;
+class VolumeBrickSource;
+
+/**
+ * \ingroup io
+ * \brief A chunked and compressed volume data file
+ *
+ * The volume is split into chunks of a fixed size, the chunks at the upper boundaries are cropped
+ * to the volume dimensions, and each chunk is compressed independently. An index at the end of
+ * the file holds the position of every chunk together with its per channel min/max and a coarse
+ * histogram. A file can hold several levels of resolution, see VolumePyramid, each one chunked
+ * on its own.
+ *
+ * Chunks are compressed and decompressed in parallel on the thread pool, and reading a region
+ * only decompresses the chunks overlapping it. Voxel data is stored in little endian byte order.
+ *
+ * Layout, all integers are little endian:
+ *     header: "IVWCHUNK", u32 version, u32 codec, u64 index position
+ *     the compressed chunks
+ *     index:  u32 format id, u32 number of levels, u32 histogram bins, f64 x 2 histogram range
+ *             for each level: u64 x 3 dimensions, u64 x 3 chunk size
+ *                 for each chunk: u64 position, u64 stored size, f64 x channels min,
+ *                 f64 x channels max, u32 x (bins * channels) histogram
+ */
+class IVW_CORE_API ChunkedVolumeFile {
+public:
+    enum class Codec : std::uint32_t { None = 0, Deflate = 1 };
+
+    static constexpr std::uint32_t version = 1;
+    static constexpr size3_t defaultChunkSize{64, 64, 64};
+    static constexpr size_t defaultHistogramBins = 32;
+
+    struct Chunk {
+        size_t position = 0;
+        size_t storedSize = 0;
+        dvec4 min{0.0};
+        dvec4 max{0.0};
+        /// The histogram bins of each channel after one another
+        std::vector<std::uint32_t> histogram;
+    };
+
+    struct Level {
+        size3_t dimensions{0};
+        size3_t chunkSize{0};
+        size3_t chunkCount{0};
+        std::vector<Chunk> chunks;
+
+        size3_t chunkOffset(const size3_t& chunk) const;
+        size3_t chunkDimensions(const size3_t& chunk) const;
+        size_t chunkIndex(const size3_t& chunk) const;
+    };
+
+    struct WriteOptions {
+        size3_t chunkSize = defaultChunkSize;
+        Codec codec = Codec::Deflate;
+        /// The zlib compression level, 1 (fastest) to 9 (smallest)
+        int compressionLevel = 6;
+        /// The number of bins of the chunk histograms, at least 1
+        size_t histogramBins = defaultHistogramBins;
+        /// The range covered by the chunk histograms, usually the data range of the volume
+        dvec2 histogramRange{0.0, 1.0};
+    };
+
+    /**
+     * Read the index of the chunked volume file at @p path.
+     * @throw DataReaderException if the file cannot be read or is not a chunked volume file
+     */
+    explicit ChunkedVolumeFile(const std::filesystem::path& path);
+
+    /**
+     * Write the levels given by @p levels into the file at @p path. All levels must have the
+     * same data format. The chunks are read from the sources and compressed in parallel on the
+     * thread pool, in batches to bound the memory used.
+     * @throw DataWriterException if the file cannot be written, or if the chunk size or number of
+     * histogram bins in @p options is zero
+     */
+    static void write(const std::filesystem::path& path,
+                      std::span<const VolumeBrickSource* const> levels,
+                      const WriteOptions& options = {});
+
+    const std::filesystem::path& getPath() const;
+    Codec getCodec() const;
+    const DataFormatBase* getDataFormat() const;
+    size_t getNumberOfLevels() const;
+    const Level& getLevel(size_t level) const;
+    size_t getHistogramBins() const;
+    dvec2 getHistogramRange() const;
+
+    /**
+     * The histogram of @p channel for all of @p level, merged from the chunk histograms.
+     */
+    std::vector<size_t> getHistogram(size_t level, size_t channel) const;
+
+    /**
+     * Read the voxels in [offset, offset + dims) of @p level into @p dest, which has to hold
+     * dims voxels. Only the chunks overlapping the region are read, in parallel.
+     * @throw DataReaderException if the region is outside of the level or the file is corrupt
+     */
+    void read(size_t level, const size3_t& offset, const size3_t& dims, void* dest) const;
+
+    /**
+     * Read the voxels in [offset, offset + dims) of @p level into a new VolumeRAM.
+     */
+    std::shared_ptr<VolumeRAM> read(size_t level, const size3_t& offset,
+                                    const size3_t& dims) const;
+
+private:
+    std::filesystem::path path_;
+    Codec codec_ = Codec::None;
+    const DataFormatBase* format_ = nullptr;
+    size_t histogramBins_ = 0;
+    dvec2 histogramRange_{0.0, 1.0};
+    std::vector<Level> levels_;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,66 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+#include <inviwo/core/datastructures/volume/volumerepresentation.h>
+#include <inviwo/core/io/chunkedvolumefile.h>
+
+#include <memory>
+
+namespace inviwo {
+
+/**
+ * \class ChunkedVolumeRAMLoader
+ * \brief A loader of one level of a ChunkedVolumeFile. Used to create VolumeRAM representations.
+ * Used by the IvfVolumeReader for chunked files. Bricks of the volume are read directly from the
+ * file by decompressing only the overlapping chunks, see VolumeBricked.
+ */
+class IVW_CORE_API ChunkedVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation>,
+                                           public VolumeBrickSourceProvider {
+public:
+    explicit ChunkedVolumeRAMLoader(std::shared_ptr<const ChunkedVolumeFile> file,
+                                    size_t level = 0);
+    virtual ChunkedVolumeRAMLoader* clone() const override;
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override;
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                      const VolumeRepresentation& src) const override;
+    virtual std::shared_ptr<const VolumeBrickSource> createBrickSource(
+        const VolumeRepresentation& src) const override;
+
+private:
+    std::shared_ptr<const ChunkedVolumeFile> file_;
+    size_t level_;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,105 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <span>
+
+namespace inviwo::util {
+
+/**
+ * \class MemoryMappedFile
+ * \brief RAII read-only memory mapping of a file or a part of a file
+ *
+ * The pages are mapped lazily by the operating system, hence creating a mapping of a very large
+ * file is cheap and only the parts that are actually accessed will be read from disk. Several
+ * mappings of the same file will share the same physical pages.
+ *
+ * Note that the file should not be modified while it is mapped. On Windows the file can not be
+ * overwritten or removed while the mapping is alive.
+ */
+class IVW_CORE_API MemoryMappedFile {
+public:
+    /**
+     * Map @p bytes starting at @p offset of the file @p path. If @p bytes is not given the
+     * mapping will extend to the end of the file.
+     * @throws FileException if the file could not be opened or mapped, or if the requested range
+     * is outside of the file.
+     */
+    explicit MemoryMappedFile(const std::filesystem::path& path, size_t offset = 0,
+                              std::optional<size_t> bytes = std::nullopt);
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+    MemoryMappedFile(MemoryMappedFile&& rhs) noexcept;
+    MemoryMappedFile& operator=(MemoryMappedFile&& rhs) noexcept;
+    ~MemoryMappedFile();
+
+    const std::byte* data() const { return data_; }
+    size_t size() const { return size_; }
+    std::span<const std::byte> view() const { return {data_, size_}; }
+    const std::filesystem::path& getPath() const { return path_; }
+
+    /**
+     * Create a shared pointer to the mapped data interpreted as elements of type T. The mapping
+     * will be kept alive as long as the returned pointer, or any copy of it, is alive.
+     */
+    template <typename T>
+    static std::shared_ptr<const T> share(std::shared_ptr<const MemoryMappedFile> file) {
+        const auto* ptr = reinterpret_cast<const T*>(file->data());
+        return std::shared_ptr<const T>{std::move(file), ptr};
+    }
+
+    /**
+     * The granularity of the underlying mapping, the page size on POSIX systems and the
+     * allocation granularity on Windows. The offset is rounded down to a multiple of this value,
+     * hence data() is aligned to the same degree as @p offset is.
+     */
+    static size_t pageSize();
+
+private:
+    void unmap() noexcept;
+
+    std::filesystem::path path_;
+    void* base_ = nullptr;
+    size_t baseSize_ = 0;
+    const std::byte* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef WIN32
+    void* file_ = nullptr;
+    void* mapping_ = nullptr;
+#endif
+};
+
+}  // namespace inviwo::util
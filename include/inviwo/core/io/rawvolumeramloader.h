@@ -35,6 +35,7 @@
 #include <inviwo/core/io/inviwofileformattypes.h>
 #include <inviwo/core/datastructures/diskrepresentation.h>
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
 
 #include <string>
 #include <memory>
@@ -45,9 +46,11 @@ namespace inviwo {
  * \class RawVolumeRAMLoader
  * \brief A loader of raw files. Used to create VolumeRAM representations.
  * This class us used by the DatVolumeSequenceReader, IvfVolumeReader and RawVolumeReader.
+ * It can also read bricks of the volume directly from the file, see VolumeBricked.
  */
 
-class IVW_CORE_API RawVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation> {
+class IVW_CORE_API RawVolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation>,
+                                       public VolumeBrickSourceProvider {
 public:
     RawVolumeRAMLoader(const std::filesystem::path& rawFile, size_t offset,
                        ByteOrder byteOrder, Compression compression);
@@ -56,6 +59,8 @@ public:
         const VolumeRepresentation& src) const override;
     virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
                                       const VolumeRepresentation& src) const override;
+    virtual std::shared_ptr<const VolumeBrickSource> createBrickSource(
+        const VolumeRepresentation& src) const override;
 
 private:
     std::filesystem::path rawFile_;
@@ -35,11 +35,22 @@
 #include <inviwo/core/network/processornetworkevaluationobserver.h>
 #include <inviwo/core/network/evaluationerrorhandler.h>
 
+#include <vector>
+
 namespace inviwo {
 
 class Processor;
 class ProcessorNetwork;
 
+/**
+ * Sequential: all processors are processed one by one in topological order on the main thread.
+ * Parallel: processors are grouped into dependency levels. Within a level, all processors with
+ * ProcessorThreading::Any are processed concurrently on the ThreadPool while the remaining ones
+ * are processed on the main thread. Processors are MainThread unless they opt in, and no
+ * processor of the Inviwo modules does so yet.
+ */
+enum class EvaluationMode { Sequential, Parallel };
+
 class IVW_CORE_API ProcessorNetworkEvaluator : public ProcessorNetworkObserver,
                                                public ProcessorObserver,
                                                public ProcessorNetworkEvaluationObservable {
@@ -50,6 +61,16 @@ public:
     virtual ~ProcessorNetworkEvaluator() = default;
     void setExceptionHandler(EvaluationErrorHandler handler);
 
+    /**
+     * Select how the network should be evaluated, defaults to EvaluationMode::Sequential.
+     * In parallel mode initializeResources, port onChange callbacks, and all observer
+     * notifications still happen on the main thread, only Processor::process of processors
+     * declaring ProcessorThreading::Any is dispatched to the ThreadPool.
+     * @see ProcessorThreadingTraits
+     */
+    void setEvaluationMode(EvaluationMode mode);
+    EvaluationMode getEvaluationMode() const;
+
 private:
     // ProcessorNetworkObserver overrides
     virtual void onProcessorNetworkEvaluateRequest() override;
@@ -65,13 +86,25 @@ private:
 
     void requestEvaluate();
     void evaluate();
+    void evaluateSequential();
+    void evaluateParallel();
+
+    /**
+     * Run initializeResources and inport onChange callbacks if needed.
+     * @return false if any of them threw.
+     */
+    bool prepare(Processor* processor);
+    void notReady(Processor* processor);
 
     ProcessorNetwork* processorNetwork_;
     // the sorted list of processors obtained through topological sorting
     std::vector<Processor*> processorsSorted_;
+    // processorsSorted_ grouped into levels, a processor only depends on earlier levels
+    std::vector<std::vector<Processor*>> processorLevels_;
     bool needsSorting_;
     bool evaluationQueued_;
     EvaluationErrorHandler exceptionHandler_;
+    EvaluationMode mode_;
 };
 
 }  // namespace inviwo
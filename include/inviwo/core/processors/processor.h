@@ -234,6 +234,15 @@ public:
     virtual void setNetwork(ProcessorNetwork* network);
     ProcessorNetwork* getNetwork() const;
 
+    /**
+     * Declares on which thread the ProcessorNetworkEvaluator may call process(). Processors
+     * created by the ProcessorFactory are initialized from ProcessorThreadingTraits, defaults to
+     * ProcessorThreading::MainThread.
+     * @see ProcessorThreadingTraits
+     */
+    void setThreading(ProcessorThreading threading);
+    ProcessorThreading getThreading() const;
+
     /**
      * InitializeResources is called whenever a property with InvalidationLevel::InvalidResources
      * is changes.
@@ -472,12 +481,15 @@ private:
     UnorderedStringMap<std::string> portGroups_;
 
     ProcessorNetwork* network_;
+    ProcessorThreading threading_;
 
     NameDispatcher identifierDispatcher_;
     NameDispatcher displayNameDispatcher_;
 };
 
 inline ProcessorNetwork* Processor::getNetwork() const { return network_; }
+inline void Processor::setThreading(ProcessorThreading threading) { threading_ = threading; }
+inline ProcessorThreading Processor::getThreading() const { return threading_; }
 
 template <typename T, typename std::enable_if_t<std::is_base_of<Inport, T>::value, int>>
 T& Processor::addPort(std::unique_ptr<T> port, std::string_view portGroup) {
@@ -104,6 +104,7 @@ public:
 
         if (p->getIdentifier().empty()) p->setIdentifier(util::stripIdentifier(getDisplayName()));
         if (p->getDisplayName().empty()) p->setDisplayName(getDisplayName());
+        p->setThreading(ProcessorThreadingTraits<T>::threading);
         return p;
     }
 };
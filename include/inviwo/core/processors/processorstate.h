@@ -40,9 +40,24 @@ enum class CodeState { Broken, Experimental, Stable, Deprecated };
 IVW_CORE_API std::string_view enumToStr(CodeState cs);
 IVW_CORE_API std::ostream& operator<<(std::ostream& ss, CodeState cs);
 
+/**
+ * Describes on which thread Processor::process may be called by the ProcessorNetworkEvaluator.
+ * @see ProcessorThreadingTraits
+ */
+enum class ProcessorThreading {
+    MainThread,  ///< process() has to be called on the main (render context) thread
+    Any          ///< process() may be called concurrently on a ThreadPool worker
+};
+
+IVW_CORE_API std::string_view enumToStr(ProcessorThreading pt);
+IVW_CORE_API std::ostream& operator<<(std::ostream& ss, ProcessorThreading pt);
+
 }  // namespace inviwo
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 template <>
 struct fmt::formatter<inviwo::CodeState> : inviwo::FlagFormatter<inviwo::CodeState> {};
+template <>
+struct fmt::formatter<inviwo::ProcessorThreading>
+    : inviwo::FlagFormatter<inviwo::ProcessorThreading> {};
 #endif
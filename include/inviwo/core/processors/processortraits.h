@@ -31,6 +31,9 @@
 
 #include <inviwo/core/common/inviwocoredefine.h>
 #include <inviwo/core/processors/processorinfo.h>
+#include <inviwo/core/processors/processorstate.h>
+
+#include <concepts>
 
 namespace inviwo {
 
@@ -57,6 +60,20 @@ ProcessorInfo processorInfo() {
     return ProcessorInfo(T::CLASS_IDENTIFIER, T::DISPLAY_NAME, T::CATEGORY, T::CODE_STATE, T::TAGS);
 }
 
+template <typename T>
+concept HasProcessorThreading = requires {
+    { T::processorThreading_ } -> std::convertible_to<ProcessorThreading>;
+};
+
+template <typename T>
+constexpr ProcessorThreading processorThreading() {
+    if constexpr (HasProcessorThreading<T>) {
+        return T::processorThreading_;
+    } else {
+        return ProcessorThreading::MainThread;
+    }
+}
+
 }  // namespace detail
 
 /**
@@ -79,4 +96,29 @@ template <typename T>
 struct ProcessorTraits {
     static ProcessorInfo getProcessorInfo() { return detail::processorInfo<T>(); }
 };
+
+/**
+ * \class ProcessorThreadingTraits
+ * \brief A traits class for declaring on which thread Processor::process may be called.
+ * Processors that do not touch any main thread state (OpenGL contexts, widgets, etc.) in
+ * process() can opt in to concurrent evaluation by declaring a static member
+ *\code{.cpp}
+ *     static constexpr ProcessorThreading processorThreading_ = ProcessorThreading::Any;
+ *\endcode
+ * or by specializing the traits:
+ *\code{.cpp}
+ *     template <typename T>
+ *     struct ProcessorThreadingTraits<MyProcessor<T>> {
+ *        static constexpr ProcessorThreading threading = ProcessorThreading::Any;
+ *     };
+ *\endcode
+ * The default is ProcessorThreading::MainThread. The ProcessorFactoryObjectTemplate applies the
+ * trait to every created processor.
+ * @see ProcessorNetworkEvaluator::setEvaluationMode
+ */
+template <typename T>
+struct ProcessorThreadingTraits {
+    static constexpr ProcessorThreading threading = detail::processorThreading<T>();
+};
+
 }  // namespace inviwo
@@ -35,6 +35,8 @@
 #include <glm/gtx/component_wise.hpp>
 #include <string_view>
 #include <cstdint>
+#include <functional>
+#include <memory>
 #include <optional>
 
 namespace inviwo {
@@ -79,6 +81,11 @@ RAM toRAM(const std::unique_ptr<T>& data) {
     return toRAM(static_cast<const void*>(data.get()));
 }
 
+template <typename T>
+RAM toRAM(const std::shared_ptr<T>& data) {
+    return toRAM(static_cast<const void*>(data.get()));
+}
+
 IVW_CORE_API void add(const RAM& key, Resource resource);
 IVW_CORE_API std::optional<Resource> remove(const RAM& key);
 IVW_CORE_API void meta(const RAM& key, const ResourceMeta& meta);
@@ -91,6 +98,16 @@ IVW_CORE_API void add(const PY& key, Resource resource);
 IVW_CORE_API std::optional<Resource> remove(const PY& key);
 IVW_CORE_API void meta(const PY& key, const ResourceMeta& meta);
 
+/**
+ * Register data of @p bytes that can be released, by calling @p release, when the RAM budget for
+ * evictable data is exceeded, and that is recomputed or reloaded when needed again. Unlike the
+ * resources above, evictable data is managed even if resource tracking is disabled.
+ * @see ResourceManager::addEvictable
+ */
+IVW_CORE_API void addEvictable(const RAM& key, size_t bytes, std::function<void()> release);
+IVW_CORE_API void useEvictable(const RAM& key);
+IVW_CORE_API void removeEvictable(const RAM& key);
+
 constexpr auto getMeta(const std::optional<Resource>& r) -> std::optional<ResourceMeta> {
     if (r) return r->meta;
     return std::nullopt;
@@ -100,6 +117,31 @@ constexpr auto getMeta(std::optional<Resource>&& r) -> std::optional<ResourceMet
     return std::nullopt;
 };
 
+/**
+ * Deleter for arrays that are registered as a RAM resource for their whole lifetime. The resource
+ * is removed when the array is deleted. If `owner` is false the array is only unregistered, and
+ * the memory is left to someone else.
+ */
+template <typename T>
+struct RAMDeleter {
+    void operator()(T* ptr) const {
+        remove(toRAM(ptr));
+        if (owner) delete[] ptr;
+    }
+    bool owner = true;
+};
+
+/**
+ * Register an array as a RAM resource and hand it over to a shared pointer. The array can then be
+ * shared, for example between copy-on-write representations, and the resource is removed when the
+ * last owner releases it.
+ */
+template <typename T>
+std::shared_ptr<T[]> share(std::unique_ptr<T[]> data, Resource resource) {
+    add(toRAM(data.get()), std::move(resource));
+    return std::shared_ptr<T[]>{data.release(), RAMDeleter<T>{}};
+}
+
 }  // namespace resource
 
 }  // namespace inviwo
@@ -35,12 +35,29 @@
 #include <inviwo/core/util/foreacharg.h>
 #include <inviwo/core/util/stdextensions.h>
 
+#include <functional>
+#include <list>
+#include <mutex>
 #include <unordered_map>
 #include <tuple>
 #include <variant>
 
 namespace inviwo {
 
+/**
+ * Keeps track of the resources of the application, and manages a RAM budget for evictable data.
+ *
+ * Resources, RAM, GL, and PY, are only recorded when resource tracking is enabled in the system
+ * settings, to get an overview of the memory usage.
+ *
+ * Evictable data is data that can be released and later recomputed or reloaded when needed
+ * again, like the levels of a VolumePyramid, cached histograms, or the items of the RAM caches of
+ * the FileCache processors. Evictable data is always managed, independent of resource tracking.
+ * Whenever the total size of the evictable data exceeds the budget, data is released according to
+ * the EvictionPolicy, the least recently used data first by default. The evictable functions are
+ * thread safe.
+ * @see resource::addEvictable
+ */
 class IVW_CORE_API ResourceManager : public ResourceManagerObservable {
 public:
     using Keys = std::tuple<resource::RAM, resource::GL, resource::PY>;
@@ -51,6 +68,9 @@ public:
                              const std::vector<std::pair<resource::GL, Resource>>*,
                              const std::vector<std::pair<resource::PY, Resource>>*>;
     static constexpr std::array<std::string_view, 3> names = {"RAM", "GL", "PY"};
+    static constexpr size_t defaultBudget = size_t{4096} * 1024 * 1024;
+
+    enum class EvictionPolicy { LeastRecentlyUsed, LeastFrequentlyUsed };
 
     template <typename Key>
     void add(const Key& key, Resource resource) {
@@ -145,7 +165,54 @@ public:
             data_);
     }
 
+    /**
+     * Register evictable data of @p bytes identified by @p key, or update its size and release
+     * function if already registered. The data is marked as used. If the budget is exceeded,
+     * data is released according to the eviction policy, which might be the added data itself.
+     * @param key identifying the data
+     * @param bytes the size of the data
+     * @param release called to release the data when evicted. Is called without any lock held,
+     *        on the thread that exceeded the budget, after the data has been unregistered.
+     */
+    void addEvictable(const resource::RAM& key, size_t bytes, std::function<void()> release);
+    /**
+     * Mark the evictable data @p key as used, to postpone its eviction.
+     */
+    void useEvictable(const resource::RAM& key);
+    /**
+     * Unregister the evictable data @p key without releasing it.
+     * @return true if the data was registered.
+     */
+    bool removeEvictable(const resource::RAM& key);
+
+    /**
+     * Set the budget in bytes for evictable data, releasing data if needed. Controlled by the
+     * "Evictable Data Budget" system setting.
+     */
+    void setBudget(size_t bytes);
+    size_t getBudget() const;
+    /**
+     * Set which data to release first when the budget is exceeded. With
+     * EvictionPolicy::LeastFrequentlyUsed ties are broken by recency. Controlled by the
+     * "Eviction Policy" system setting.
+     */
+    void setEvictionPolicy(EvictionPolicy policy);
+    EvictionPolicy getEvictionPolicy() const;
+    /**
+     * The total size in bytes of all registered evictable data.
+     */
+    size_t getEvictableSize() const;
+    size_t getNumberOfEvictables() const;
+
 private:
+    struct Evictable {
+        resource::RAM key;
+        size_t bytes;
+        size_t uses;
+        std::function<void()> release;
+    };
+    void evict();
+
     auto getGroup(size_t groupIndex) const -> Var {
         Var v{};
         util::for_each_in_tuple(
@@ -174,6 +241,13 @@ private:
     }
 
     Data data_;
+
+    mutable std::mutex evictableMutex_;
+    size_t budget_ = defaultBudget;
+    EvictionPolicy policy_ = EvictionPolicy::LeastRecentlyUsed;
+    size_t evictableSize_ = 0;
+    std::list<Evictable> lru_;  // most recently used first
+    std::unordered_map<resource::RAM, std::list<Evictable>::iterator> evictables_;
 };
 
 }  // namespace inviwo
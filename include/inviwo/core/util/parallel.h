@@ -0,0 +1,239 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/core/common/inviwocoredefine.h>
+#include <inviwo/core/util/glmvec.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+/**
+ * \file parallel.h
+ * Parallel loops and reductions over 1D, 2D and 3D index ranges, running on the Inviwo thread
+ * pool. Everything is built on util::parallelFor, so the calling thread takes part in the work,
+ * the loops can be nested and the number of threads is bounded by the pool size. Use these instead
+ * of OpenMP, which would run its own set of threads next to the pool.
+ *
+ * All functions take an optional grain, the minimum number of indices (rows for 2D, xy-rows for
+ * 3D) handed to one task, and an optional stop token, for example a pool::Stop. The token is
+ * checked before each task is started, once it is set the remaining tasks are skipped.
+ */
+
+namespace inviwo::util {
+
+/**
+ * Stop token that never stops, the default of the parallel algorithms.
+ */
+struct NeverStop {
+    constexpr explicit operator bool() const noexcept { return false; }
+};
+
+template <typename T>
+concept StopToken = requires(const T& stop) {
+    { static_cast<bool>(stop) };
+};
+
+namespace detail {
+
+/**
+ * The number of indices per task. Use @p grain if it is given, otherwise aim for about four tasks
+ * per thread, or one per thread when already inside a parallel loop.
+ */
+inline size_t parallelBlockSize(size_t count, size_t grain) {
+    if (grain != 0) return grain;
+    const size_t threads = getPoolSize() + 1;
+    const size_t tasks = parallelDepth() == 0 ? 4 * threads : threads;
+    return std::max<size_t>(1, (count + tasks - 1) / tasks);
+}
+
+}  // namespace detail
+
+/**
+ * Call `work(begin, end)` for consecutive blocks covering [0, count). Useful when each task needs
+ * some scratch memory of its own.
+ */
+template <typename F, StopToken Stop = NeverStop>
+    requires std::invocable<F&, size_t, size_t>
+void parallelForBlocks(size_t count, F&& work, size_t grain = 0, const Stop& stop = {}) {
+    if (count == 0) return;
+    const auto blockSize = detail::parallelBlockSize(count, grain);
+    const auto blocks = (count + blockSize - 1) / blockSize;
+    parallelFor(blocks, [&](size_t block) {
+        if (static_cast<bool>(stop)) return;
+        work(block * blockSize, std::min(count, (block + 1) * blockSize));
+    });
+}
+
+/**
+ * Call `work(i)` for each i in [begin, end).
+ */
+template <typename F, StopToken Stop = NeverStop>
+    requires std::invocable<F&, size_t>
+void parallelFor(size_t begin, size_t end, F&& work, size_t grain = 0, const Stop& stop = {}) {
+    if (end <= begin) return;
+    parallelForBlocks(
+        end - begin,
+        [&](size_t first, size_t last) {
+            for (size_t i = begin + first; i < begin + last; ++i) work(i);
+        },
+        grain, stop);
+}
+
+/**
+ * Call `work(pos)` for each position in [0, dims). The range is split along y, @p grain is the
+ * minimum number of rows per task.
+ */
+template <typename F, StopToken Stop = NeverStop>
+    requires std::invocable<F&, size2_t>
+void parallelFor(size2_t dims, F&& work, size_t grain = 0, const Stop& stop = {}) {
+    if (dims.x == 0) return;
+    parallelForBlocks(
+        dims.y,
+        [&](size_t first, size_t last) {
+            for (size2_t pos{0, first}; pos.y < last; ++pos.y) {
+                for (pos.x = 0; pos.x < dims.x; ++pos.x) work(pos);
+            }
+        },
+        grain, stop);
+}
+
+/**
+ * Call `work(pos)` for each position in [0, dims). The range is split over the y * z rows, such
+ * that thin volumes are also spread over all threads. @p grain is the minimum number of rows per
+ * task.
+ */
+template <typename F, StopToken Stop = NeverStop>
+    requires std::invocable<F&, size3_t>
+void parallelFor(size3_t dims, F&& work, size_t grain = 0, const Stop& stop = {}) {
+    if (dims.x == 0) return;
+    parallelForBlocks(
+        dims.y * dims.z,
+        [&](size_t first, size_t last) {
+            for (size_t row = first; row < last; ++row) {
+                size3_t pos{0, row % dims.y, row / dims.y};
+                for (; pos.x < dims.x; ++pos.x) work(pos);
+            }
+        },
+        grain, stop);
+}
+
+namespace detail {
+
+template <typename T, typename Combine, typename Block, StopToken Stop>
+T parallelReduce(size_t count, T identity, Combine& combine, Block&& block, size_t grain,
+                 const Stop& stop) {
+    if (count == 0) return identity;
+    const auto blockSize = parallelBlockSize(count, grain);
+    const auto blocks = (count + blockSize - 1) / blockSize;
+    std::vector<std::optional<T>> partials(blocks);
+    parallelFor(blocks, [&](size_t i) {
+        if (static_cast<bool>(stop)) return;
+        T acc = identity;
+        block(i * blockSize, std::min(count, (i + 1) * blockSize), acc);
+        partials[i] = std::move(acc);
+    });
+    // Combine the partial results in order, the result does not depend on the scheduling.
+    T result = std::move(identity);
+    for (auto& partial : partials) {
+        if (partial) result = combine(std::move(result), std::move(*partial));
+    }
+    return result;
+}
+
+}  // namespace detail
+
+/**
+ * Reduce `map(i)` for i in [begin, end) using @p combine. @p combine has to be associative and
+ * @p identity its identity element. Blocks are combined in index order, hence the result is
+ * deterministic also for floating point sums. If the loop was stopped the result only covers the
+ * blocks that were run.
+ */
+template <typename T, typename Map, typename Combine, StopToken Stop = NeverStop>
+    requires std::invocable<Map&, size_t>
+T parallelReduce(size_t begin, size_t end, T identity, Map&& map, Combine&& combine,
+                 size_t grain = 0, const Stop& stop = {}) {
+    if (end <= begin) return identity;
+    return detail::parallelReduce(
+        end - begin, std::move(identity), combine,
+        [&](size_t first, size_t last, T& acc) {
+            for (size_t i = begin + first; i < begin + last; ++i) {
+                acc = combine(std::move(acc), map(i));
+            }
+        },
+        grain, stop);
+}
+
+/**
+ * Reduce `map(pos)` for each position in [0, dims) using @p combine.
+ * @see parallelReduce(size_t, size_t, T, Map&&, Combine&&, size_t, const Stop&)
+ */
+template <typename T, typename Map, typename Combine, StopToken Stop = NeverStop>
+    requires std::invocable<Map&, size2_t>
+T parallelReduce(size2_t dims, T identity, Map&& map, Combine&& combine, size_t grain = 0,
+                 const Stop& stop = {}) {
+    if (dims.x == 0) return identity;
+    return detail::parallelReduce(
+        dims.y, std::move(identity), combine,
+        [&](size_t first, size_t last, T& acc) {
+            for (size2_t pos{0, first}; pos.y < last; ++pos.y) {
+                for (pos.x = 0; pos.x < dims.x; ++pos.x) {
+                    acc = combine(std::move(acc), map(pos));
+                }
+            }
+        },
+        grain, stop);
+}
+
+/**
+ * Reduce `map(pos)` for each position in [0, dims) using @p combine.
+ * @see parallelReduce(size_t, size_t, T, Map&&, Combine&&, size_t, const Stop&)
+ */
+template <typename T, typename Map, typename Combine, StopToken Stop = NeverStop>
+    requires std::invocable<Map&, size3_t>
+T parallelReduce(size3_t dims, T identity, Map&& map, Combine&& combine, size_t grain = 0,
+                 const Stop& stop = {}) {
+    if (dims.x == 0) return identity;
+    return detail::parallelReduce(
+        dims.y * dims.z, std::move(identity), combine,
+        [&](size_t first, size_t last, T& acc) {
+            for (size_t row = first; row < last; ++row) {
+                size3_t pos{0, row % dims.y, row / dims.y};
+                for (; pos.x < dims.x; ++pos.x) acc = combine(std::move(acc), map(pos));
+            }
+        },
+        grain, stop);
+}
+
+}  // namespace inviwo::util
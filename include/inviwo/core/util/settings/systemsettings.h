@@ -35,6 +35,7 @@
 #include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/properties/stringproperty.h>
 #include <inviwo/core/properties/multifileproperty.h>
+#include <inviwo/core/resourcemanager/resourcemanager.h>
 
 namespace inviwo {
 
@@ -63,6 +64,10 @@ public:
     BoolProperty breakOnException_;
     BoolProperty stackTraceInException_;
     BoolProperty enableResourceTracking_;
+    BoolProperty parallelEvaluation_;
+    IntSizeTProperty brickCacheSize_;
+    IntSizeTProperty evictableBudget_;
+    OptionProperty<ResourceManager::EvictionPolicy> evictionPolicy_;
 
     BoolProperty redirectCout_;
     BoolProperty redirectCerr_;
@@ -61,7 +61,7 @@
 #include <warn/push>
 #include <warn/ignore/all>
 #include <vector>
-#include <queue>
+#include <deque>
 #include <memory>
 #include <thread>
 #include <mutex>
@@ -70,12 +70,71 @@
 #include <functional>
 #include <stdexcept>
 #include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
 #include <warn/pop>
 
 namespace inviwo {
 
+/**
+ * A work stealing thread pool.
+ * Each worker has its own task queues. Tasks enqueued from a worker thread end up in the
+ * queues of that worker, tasks enqueued from any other thread are distributed round robin over
+ * all the workers. A worker takes its own most recent task first, if it has none it will try to
+ * steal the oldest task from the other workers. Interactive tasks are always taken before
+ * background tasks.
+ */
 class IVW_CORE_API ThreadPool {
 public:
+    enum class Priority {
+        Interactive,  ///< Work that is blocking the user, e.g. network evaluation
+        Background    ///< Everything else
+    };
+
+    /**
+     * A move only type erased functor `void()`. Small functors are stored inline without any
+     * heap allocation.
+     */
+    class Task {
+    public:
+        static constexpr size_t bufferSize = 6 * sizeof(void*);
+
+        Task() = default;
+        template <typename F>
+            requires(!std::is_same_v<std::decay_t<F>, Task> &&
+                     std::is_invocable_v<std::decay_t<F>&>)
+        Task(F&& f);  // NOLINT
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+        Task(Task&& rhs) noexcept;
+        Task& operator=(Task&& rhs) noexcept;
+        ~Task();
+
+        void operator()() { vtable_->invoke(&buffer_); }
+        explicit operator bool() const { return vtable_ != nullptr; }
+
+    private:
+        struct VTable {
+            void (*invoke)(void*);
+            void (*move)(void* dst, void* src) noexcept;
+            void (*destroy)(void*) noexcept;
+        };
+
+        template <typename F>
+        static constexpr bool isInline = sizeof(F) <= bufferSize &&
+                                         alignof(F) <= alignof(std::max_align_t) &&
+                                         std::is_nothrow_move_constructible_v<F>;
+        template <typename F>
+        static const VTable inlineVTable;
+        template <typename F>
+        static const VTable heapVTable;
+
+        alignas(std::max_align_t) std::byte buffer_[bufferSize];
+        const VTable* vtable_ = nullptr;
+    };
+
     ThreadPool(
         size_t threads, std::function<void()> onThreadStart = []() {},
         std::function<void()> onThreadStop = []() {});
@@ -88,16 +147,33 @@ public:
     template <class F, class... Args>
     auto enqueue(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>>;
 
+    /**
+     * Enqueue function f with arguments args using the given priority.
+     * The function f may throw exceptions.
+     * @return a future to the result of f
+     */
+    template <class F, class... Args>
+    auto enqueue(Priority priority, F&& f, Args&&... args)
+        -> std::future<std::invoke_result_t<F, Args...>>;
+
     /**
      * Enqueue a plain functor. The functor may not throw exceptions.
      */
-    void enqueueRaw(std::function<void()> f);
+    void enqueueRaw(Task task, Priority priority = Priority::Background);
 
     size_t trySetSize(size_t size);
     size_t getSize() const;
 
+    /**
+     * The number of tasks waiting to be picked up by a worker.
+     */
     size_t getQueueSize();
 
+    /**
+     * The maximum number of workers that the pool supports.
+     */
+    static constexpr size_t maxWorkers = 512;
+
 private:
     enum class State {
         Free,     //< Worker is waiting for tasks.
@@ -107,8 +183,25 @@ private:
         Done      //< Worker is waiting to be joined.
     };
 
+    /**
+     * Queues of one worker, one per priority. The owner pushes and pops at the back, thieves
+     * steal from the front. Queues are never destroyed before the pool, when a worker is removed
+     * its queue is handed over to the next new worker and remaining tasks will be stolen.
+     */
+    struct Queue {
+        explicit Queue(size_t index) : index{index} {}
+        void push(Task task, Priority priority);
+        bool tryPop(Task& task, Priority priority);
+        bool trySteal(Task& task, Priority priority);
+
+        const size_t index;
+        std::mutex mutex;
+        std::deque<Task> tasks[2];
+        std::atomic<bool> owned = false;
+    };
+
     struct Worker {
-        Worker(ThreadPool& pool);
+        Worker(ThreadPool& pool, Queue& queue);
         Worker(const Worker&) = delete;
         Worker(Worker&& rhs) = delete;
         Worker& operator=(const Worker&) = delete;
@@ -116,40 +209,116 @@ private:
         ~Worker();
 
         std::atomic<State> state;  //< State of the worker
+        Queue& queue;
         std::thread thread;
     };
+
+    /// The pool and queue of the worker running on the current thread, if any
+    struct Local {
+        const ThreadPool* pool = nullptr;
+        Queue* queue = nullptr;
+    };
+    static Local& local();
+
+    void push(Task task, Priority priority);
+    bool findTask(Queue& own, Task& task);
+    Queue& acquireQueue();
+    void wakeAll();
+
     // need to keep track of threads so we can join them
     std::vector<std::unique_ptr<Worker>> workers;
 
-    // the task queue
-    std::queue<std::function<void()>> tasks;
+    // The task queues, preallocated to maxWorkers such that the workers can safely access the
+    // first nQueues_ without any locking while new queues are added.
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::atomic<size_t> nQueues_;
+    std::atomic<size_t> nextQueue_;
+    std::atomic<size_t> pending_;
 
-    // synchronization
-    std::mutex queue_mutex;
-    std::condition_variable condition;
+    // synchronization for sleeping workers
+    std::mutex sleepMutex_;
+    std::condition_variable condition_;
+    std::atomic<size_t> sleeping_;
 
     // Thread start end exit actions
     std::function<void()> onThreadStart_;
     std::function<void()> onThreadStop_;
 };
 
+template <typename F>
+    requires(!std::is_same_v<std::decay_t<F>, ThreadPool::Task> &&
+             std::is_invocable_v<std::decay_t<F>&>)
+ThreadPool::Task::Task(F&& f) {
+    using Func = std::decay_t<F>;
+    if constexpr (isInline<Func>) {
+        ::new (static_cast<void*>(&buffer_)) Func(std::forward<F>(f));
+        vtable_ = &inlineVTable<Func>;
+    } else {
+        ::new (static_cast<void*>(&buffer_)) Func*(new Func(std::forward<F>(f)));
+        vtable_ = &heapVTable<Func>;
+    }
+}
+
+template <typename F>
+const ThreadPool::Task::VTable ThreadPool::Task::inlineVTable{
+    [](void* self) { std::invoke(*std::launder(static_cast<F*>(self))); },
+    [](void* dst, void* src) noexcept {
+        auto* srcFunc = std::launder(static_cast<F*>(src));
+        ::new (dst) F(std::move(*srcFunc));
+        srcFunc->~F();
+    },
+    [](void* self) noexcept { std::launder(static_cast<F*>(self))->~F(); }};
+
+template <typename F>
+const ThreadPool::Task::VTable ThreadPool::Task::heapVTable{
+    [](void* self) { std::invoke(**std::launder(static_cast<F**>(self))); },
+    [](void* dst, void* src) noexcept { ::new (dst) F*(*std::launder(static_cast<F**>(src))); },
+    [](void* self) noexcept { delete *std::launder(static_cast<F**>(self)); }};
+
+inline ThreadPool::Task::Task(Task&& rhs) noexcept : vtable_{rhs.vtable_} {
+    if (vtable_) {
+        vtable_->move(&buffer_, &rhs.buffer_);
+        rhs.vtable_ = nullptr;
+    }
+}
+
+inline ThreadPool::Task& ThreadPool::Task::operator=(Task&& rhs) noexcept {
+    if (this != &rhs) {
+        if (vtable_) vtable_->destroy(&buffer_);
+        vtable_ = rhs.vtable_;
+        if (vtable_) {
+            vtable_->move(&buffer_, &rhs.buffer_);
+            rhs.vtable_ = nullptr;
+        }
+    }
+    return *this;
+}
+
+inline ThreadPool::Task::~Task() {
+    if (vtable_) vtable_->destroy(&buffer_);
+}
+
 // add new work item to the pool
 template <class F, class... Args>
 auto ThreadPool::enqueue(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>> {
+    return enqueue(Priority::Background, std::forward<F>(f), std::forward<Args>(args)...);
+}
+
+template <class F, class... Args>
+auto ThreadPool::enqueue(Priority priority, F&& f, Args&&... args)
+    -> std::future<std::invoke_result_t<F, Args...>> {
     using return_type = std::invoke_result_t<F, Args...>;
 
-    auto task = std::make_shared<std::packaged_task<return_type()>>(
+    std::packaged_task<return_type()> task(
         std::bind(std::forward<F>(f), std::forward<Args>(args)...));
 
-    std::future<return_type> res = task->get_future();
+    std::future<return_type> res = task.get_future();
 
     if (workers.empty()) {
-        (*task)();  // No worker threads, just run the task.
+        task();  // No worker threads, just run the task.
     } else {
-        std::unique_lock<std::mutex> lock(queue_mutex);
-        tasks.emplace([task]() { (*task)(); });
+        push(Task{std::move(task)}, priority);
     }
-    condition.notify_one();
     return res;
 }
 
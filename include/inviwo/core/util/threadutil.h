@@ -72,6 +72,24 @@ auto dispatchPool(InviwoApplication* app, F&& f, Args&&... args)
     return getThreadPool(app).enqueue(std::forward<F>(f), std::forward<Args>(args)...);
 }
 
+/**
+ * Call @p work for each index in [0, count) using the thread pool. The calling thread takes part in
+ * the work and only waits for items that other threads have already started, hence it is safe to
+ * call from within a pool job. If the pool size is zero everything runs on the calling thread.
+ * The first exception thrown by @p work is rethrown once all items are done.
+ * @param count number of work items.
+ * @param work callable invoked with the index of each item, possibly concurrently.
+ */
+IVW_CORE_API void parallelFor(size_t count, const std::function<void(size_t)>& work);
+
+/**
+ * The number of nested parallelFor loops the calling thread is currently running work for, zero
+ * outside of any parallel loop. A nested loop does not enqueue helpers when the pool already has at
+ * least one waiting task per worker, the work is then run on the calling thread.
+ * @see parallel.h
+ */
+IVW_CORE_API size_t parallelDepth();
+
 IVW_CORE_API void dispatchFrontAndForget(std::function<void()> fun);
 IVW_CORE_API void dispatchFrontAndForget(InviwoApplication* app, std::function<void()> fun);
 
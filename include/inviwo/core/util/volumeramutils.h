@@ -30,11 +30,11 @@
 #pragma once
 
 #include <inviwo/core/common/inviwocoredefine.h>
-#include <inviwo/core/util/threadutil.h>
+#include <inviwo/core/util/parallel.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
 
-#include <vector>
-#include <future>
+#include <type_traits>
 
 namespace inviwo {
 
@@ -57,39 +57,39 @@ void forEachVoxel(const VolumeRAM& v, C callback) {
     forEachVoxel(v.getDimensions(), callback);
 }
 
+/**
+ * Visit all voxels of a bricked volume, one brick at a time, such that only one brick has to be
+ * resident at once. The callback is either called as `callback(pos)`, or, to give direct access
+ * to the voxel data, as `callback(pos, brick, posInBrick)` where brick is the VolumeRAM holding
+ * the voxel.
+ */
 template <typename C>
-void forEachVoxelParallel(const size3_t dims, C callback, size_t jobs = 0) {
-    const size_t poolSize = util::getPoolSize();
-    if (jobs == 0) {
-        jobs = 4 * poolSize;
-    }
-    if ((jobs == 0) || (poolSize == 0)) {
-        // fallback to serial version
-        forEachVoxel(dims, callback);
-        return;
-    }
-
-    std::vector<std::future<void>> futures;
-    for (size_t job = 0; job < jobs; ++job) {
-        size3_t start = size3_t(0, 0, job * dims.z / jobs);
-        size3_t stop = size3_t(dims.x, dims.y, std::min(dims.z, (job + 1) * dims.z / jobs));
-
-        futures.push_back(util::dispatchPool([&callback, start, stop]() {
-            size3_t pos{0};
-
-            for (pos.z = start.z; pos.z < stop.z; ++pos.z) {
-                for (pos.y = start.y; pos.y < stop.y; ++pos.y) {
-                    for (pos.x = start.x; pos.x < stop.x; ++pos.x) {
-                        callback(pos);
-                    }
-                }
-            }
-        }));
-    }
+void forEachVoxel(const VolumeBricked& v, C callback) {
+    v.forEachBrick(size3_t{0}, v.getDimensions(),
+                   [&](const VolumeRAM& brick, const size3_t& offset) {
+                       forEachVoxel(brick.getDimensions(), [&](const size3_t& pos) {
+                           if constexpr (std::is_invocable_v<C, const size3_t&, const VolumeRAM&,
+                                                             const size3_t&>) {
+                               callback(offset + pos, brick, pos);
+                           } else {
+                               callback(offset + pos);
+                           }
+                       });
+                   });
+}
 
-    for (const auto& e : futures) {
-        e.wait();
-    }
+/**
+ * Call @p callback for each voxel position in [0, dims) using the thread pool.
+ * @param dims     dimensions of the volume
+ * @param callback called as `callback(pos)`, possibly concurrently
+ * @param jobs     number of tasks to split the work into, 0 lets util::parallelFor decide
+ * @see parallel.h
+ */
+template <typename C>
+void forEachVoxelParallel(const size3_t dims, C callback, size_t jobs = 0) {
+    const size_t rows = dims.y * dims.z;
+    const size_t grain = jobs == 0 ? 0 : (rows + jobs - 1) / jobs;
+    util::parallelFor(dims, [&](const size3_t& pos) { callback(pos); }, grain);
 }
 template <typename C>
 void forEachVoxelParallel(const VolumeRAM& v, C callback, size_t jobs = 0) {
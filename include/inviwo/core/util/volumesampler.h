@@ -35,13 +35,19 @@
 #include <inviwo/core/util/interpolation.h>
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
 
 #include <inviwo/core/util/spatialsampler.h>
 
+#include <array>
+
 namespace inviwo {
 
 /**
  * \class VolumeSampler
+ * Samples a volume using trilinear interpolation. Volumes that should be accessed out-of-core,
+ * see util::getBrickedRepresentation, are sampled brick by brick through their VolumeBricked
+ * representation, only loading the bricks that are actually sampled.
  */
 template <typename ReturnType = dvec4>
 class VolumeSampler : public SpatialSampler<ReturnType> {
@@ -52,12 +58,24 @@ public:
 
     virtual ~VolumeSampler() = default;
 
+    using SpatialSampler<ReturnType>::sample;
+    using SpatialSampler<ReturnType>::withinBounds;
+    /**
+     * Non-virtual versions of SpatialSampler::sample and SpatialSampler::withinBounds. Code that is
+     * templated on the concrete sampler type calls these, which lets the compiler inline the
+     * sampling instead of going through a virtual call for every sample.
+     */
+    ReturnType sample(const dvec3& pos) const;
+    bool withinBounds(const dvec3& pos) const;
+
 protected:
-    virtual ReturnType sampleDataSpace(const dvec3& pos) const override;
-    virtual bool withinBoundsDataSpace(const dvec3& pos) const override;
+    virtual ReturnType sampleDataSpace(const dvec3& pos) const override final;
+    virtual bool withinBoundsDataSpace(const dvec3& pos) const override final;
     ReturnType getVoxel(const size3_t& pos) const;
+    static ReturnType getVoxel(const VolumeRAM& ram, const size3_t& pos);
 
     std::shared_ptr<const Volume> volume_;
+    std::shared_ptr<const VolumeBricked> bricked_;
     const VolumeRAM* ram_;
     size3_t dims_;
 };
@@ -74,54 +92,95 @@ VolumeSampler<ReturnType>::VolumeSampler(std::shared_ptr<const Volume> vol, Coor
 template <typename ReturnType>
 VolumeSampler<ReturnType>::VolumeSampler(const Volume& vol, CoordinateSpace space)
     : SpatialSampler<ReturnType>(vol, space)
-    , ram_(vol.getRepresentation<VolumeRAM>())
+    , bricked_(util::getBrickedRepresentation(vol))
+    , ram_(bricked_ ? nullptr : vol.getRepresentation<VolumeRAM>())
     , dims_(vol.getDimensions()) {}
 
+template <>
+inline double VolumeSampler<double>::getVoxel(const VolumeRAM& ram, const size3_t& pos) {
+    return ram.getAsDouble(pos);
+}
+
+template <>
+inline dvec2 VolumeSampler<dvec2>::getVoxel(const VolumeRAM& ram, const size3_t& pos) {
+    return ram.getAsDVec2(pos);
+}
+
+template <>
+inline dvec3 VolumeSampler<dvec3>::getVoxel(const VolumeRAM& ram, const size3_t& pos) {
+    return ram.getAsDVec3(pos);
+}
+
+template <>
+inline dvec4 VolumeSampler<dvec4>::getVoxel(const VolumeRAM& ram, const size3_t& pos) {
+    return ram.getAsDVec4(pos);
+}
+
+template <typename ReturnType>
+auto VolumeSampler<ReturnType>::sample(const dvec3& pos) const -> ReturnType {
+    if (this->space_ != CoordinateSpace::Data) {
+        const auto p = this->transform_ * dvec4(pos, 1.0);
+        return VolumeSampler::sampleDataSpace(dvec3(p) / p.w);
+    } else {
+        return VolumeSampler::sampleDataSpace(pos);
+    }
+}
+
+template <typename ReturnType>
+bool VolumeSampler<ReturnType>::withinBounds(const dvec3& pos) const {
+    if (this->space_ != CoordinateSpace::Data) {
+        const auto p = this->transform_ * dvec4(pos, 1.0);
+        return VolumeSampler::withinBoundsDataSpace(dvec3(p) / p.w);
+    } else {
+        return VolumeSampler::withinBoundsDataSpace(pos);
+    }
+}
+
 template <typename ReturnType>
 auto VolumeSampler<ReturnType>::sampleDataSpace(const dvec3& pos) const -> ReturnType {
-    if (!withinBoundsDataSpace(pos)) {
+    if (!VolumeSampler::withinBoundsDataSpace(pos)) {
         return ReturnType(0.0);
     }
     const dvec3 samplePos = pos * dvec3(dims_ - size3_t(1));
     const size3_t indexPos = size3_t(samplePos);
     const dvec3 interpolants = samplePos - dvec3(indexPos);
 
-    ReturnType samples[8];
-    samples[0] = getVoxel(indexPos);
-    samples[1] = getVoxel(indexPos + size3_t(1, 0, 0));
-    samples[2] = getVoxel(indexPos + size3_t(0, 1, 0));
-    samples[3] = getVoxel(indexPos + size3_t(1, 1, 0));
+    static constexpr std::array<size3_t, 8> corners{
+        size3_t(0, 0, 0), size3_t(1, 0, 0), size3_t(0, 1, 0), size3_t(1, 1, 0),
+        size3_t(0, 0, 1), size3_t(1, 0, 1), size3_t(0, 1, 1), size3_t(1, 1, 1)};
+    const auto clamp = [&](const size3_t& p) {
+        return glm::clamp(p, size3_t(0), dims_ - size3_t(1));
+    };
 
-    samples[4] = getVoxel(indexPos + size3_t(0, 0, 1));
-    samples[5] = getVoxel(indexPos + size3_t(1, 0, 1));
-    samples[6] = getVoxel(indexPos + size3_t(0, 1, 1));
-    samples[7] = getVoxel(indexPos + size3_t(1, 1, 1));
+    ReturnType samples[8];
+    if (ram_) {
+        for (size_t i = 0; i < 8; ++i) {
+            samples[i] = getVoxel(*ram_, clamp(indexPos + corners[i]));
+        }
+    } else if (const auto brick = bricked_->getBrick(clamp(indexPos));
+               brick == bricked_->getBrick(clamp(indexPos + size3_t(1)))) {
+        // The whole cell is inside of one brick, only look it up once
+        const auto data = bricked_->getBrickData(brick);
+        const auto offset = bricked_->getBrickOffset(brick);
+        for (size_t i = 0; i < 8; ++i) {
+            samples[i] = getVoxel(*data, clamp(indexPos + corners[i]) - offset);
+        }
+    } else {
+        for (size_t i = 0; i < 8; ++i) {
+            samples[i] = getVoxel(indexPos + corners[i]);
+        }
+    }
 
     return Interpolation<ReturnType, double>::trilinear(samples, interpolants);
 }
 
-template <>
-inline double VolumeSampler<double>::getVoxel(const size3_t& pos) const {
-    const auto p = glm::clamp(pos, size3_t(0), dims_ - size3_t(1));
-    return ram_->getAsDouble(p);
-}
-
-template <>
-inline dvec2 VolumeSampler<dvec2>::getVoxel(const size3_t& pos) const {
-    const auto p = glm::clamp(pos, size3_t(0), dims_ - size3_t(1));
-    return ram_->getAsDVec2(p);
-}
-
-template <>
-inline dvec3 VolumeSampler<dvec3>::getVoxel(const size3_t& pos) const {
+template <typename ReturnType>
+ReturnType VolumeSampler<ReturnType>::getVoxel(const size3_t& pos) const {
     const auto p = glm::clamp(pos, size3_t(0), dims_ - size3_t(1));
-    return ram_->getAsDVec3(p);
-}
+    if (ram_) return getVoxel(*ram_, p);
 
-template <>
-inline dvec4 VolumeSampler<dvec4>::getVoxel(const size3_t& pos) const {
-    const auto p = glm::clamp(pos, size3_t(0), dims_ - size3_t(1));
-    return ram_->getAsDVec4(p);
+    const auto brick = bricked_->getBrick(p);
+    return getVoxel(*bricked_->getBrickData(brick), p - bricked_->getBrickOffset(brick));
 }
 
 template <typename ReturnType>
@@ -44,6 +44,15 @@ namespace inviwo {
 void exposeVolumeWriteMethods(pybind11::module& m) {
     m.def("saveDatVolume", &util::writeDatVolume);
     m.def("saveIvfVolume", &util::writeIvfVolume);
+    m.def(
+        "saveIvfChunkedVolume",
+        [](const Volume& volume, const std::filesystem::path& path, bool writePyramid,
+           bool overwrite) {
+            util::writeIvfChunkedVolume(volume, path, {}, writePyramid,
+                                        overwrite ? Overwrite::Yes : Overwrite::No);
+        },
+        pybind11::arg("volume"), pybind11::arg("path"), pybind11::arg("writePyramid") = true,
+        pybind11::arg("overwrite") = true);
     m.def("saveIvfVolumeSequence", &util::writeIvfVolumeSequence);
     m.def("saveIvfVolumeSequence",
           [](const pybind11::list& list, std::string_view name,
@@ -32,20 +32,22 @@
 #include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
 
 #include <inviwo/core/util/formats.h>                 // for DataFormat
-#include <inviwo/core/util/glm.h>                     // for isfinite
 #include <inviwo/core/util/glmcomp.h>                 // for glmcomp
 #include <inviwo/core/util/glmconvert.h>              // for glm_convert
 #include <inviwo/core/util/glmutils.h>                // for is_floating_point, flat_extent
 #include <inviwo/core/util/glmvec.h>                  // for dvec4
+#include <inviwo/core/util/threadutil.h>              // for parallelFor
 #include <modules/base/algorithm/algorithmoptions.h>  // for IgnoreSpecialValues, IgnoreSpecialV...
 
-#include <algorithm>    // for max, min
+#include <algorithm>    // for max, min, clamp
+#include <array>        // for array
+#include <cmath>        // for abs
 #include <cstddef>      // for size_t
-#include <numeric>      // for accumulate
-#include <type_traits>  // for enable_if
+#include <limits>       // for numeric_limits
+#include <type_traits>  // for is_floating_point_v
 #include <utility>      // for pair
+#include <vector>       // for vector
 
-#include <glm/common.hpp>  // for max, min
 
 namespace inviwo {
 
@@ -78,56 +80,67 @@ IVW_MODULE_BASE_API std::pair<dvec4, dvec4> bufferMinMax(
 
 namespace detail {
 
-// Specialization for double, float, half
-template <typename ValueType,
-          typename std::enable_if<util::is_floating_point<ValueType>::value, int>::type = 0>
-std::pair<dvec4, dvec4> dataMinMax(const ValueType* data, size_t size,
-                                   IgnoreSpecialValues ignore = IgnoreSpecialValues::No) {
-    using Res = std::pair<ValueType, ValueType>;
-    Res minmax{DataFormat<ValueType>::max(), DataFormat<ValueType>::lowest()};
-
-    if (ignore == IgnoreSpecialValues::Yes) {
-        minmax = std::accumulate(
-            data, data + size, minmax, [](const Res& mm, const ValueType& v) -> Res {
-                Res res(mm);
-                for (size_t i = 0; i < util::flat_extent<ValueType>::value; ++i) {
-                    if (util::isfinite(util::glmcomp(v, i))) {
-                        util::glmcomp(res.first, i) =
-                            std::min(util::glmcomp(mm.first, i), util::glmcomp(v, i));
-                        util::glmcomp(res.second, i) =
-                            std::max(util::glmcomp(mm.second, i), util::glmcomp(v, i));
-                    }
-                }
-                return res;
-            });
+/**
+ * Component-wise min and max of @p count values of @p N components each. The values are
+ * processed in interleaved lanes, such that the compiler can vectorize the loop without
+ * reordering the floating point comparisons.
+ */
+template <typename C, size_t N>
+void minMaxKernel(const C* data, size_t count, IgnoreSpecialValues ignore, std::array<C, N>& min,
+                  std::array<C, N>& max) {
+    constexpr size_t lanes = N * 16;
+    std::array<C, lanes> laneMin;
+    std::array<C, lanes> laneMax;
+    for (size_t j = 0; j < lanes; ++j) {
+        laneMin[j] = min[j % N];
+        laneMax[j] = max[j % N];
+    }
+
+    const auto step = [&](auto ignoreSpecial, size_t i, size_t j) {
+        const C v = data[i];
+        if constexpr (decltype(ignoreSpecial)::value) {
+            // false for NaN and infinities
+            const bool finite = std::abs(v) <= std::numeric_limits<C>::max();
+            laneMin[j] = finite && v < laneMin[j] ? v : laneMin[j];
+            laneMax[j] = finite && v > laneMax[j] ? v : laneMax[j];
+        } else {
+            laneMin[j] = v < laneMin[j] ? v : laneMin[j];
+            laneMax[j] = v > laneMax[j] ? v : laneMax[j];
+        }
+    };
+    const auto loop = [&](auto ignoreSpecial) {
+        const size_t total = count * N;
+        size_t i = 0;
+        for (; i + lanes <= total; i += lanes) {
+            for (size_t j = 0; j < lanes; ++j) step(ignoreSpecial, i + j, j);
+        }
+        for (size_t j = 0; i < total; ++i, ++j) step(ignoreSpecial, i, j);
+    };
+
+    if (std::is_floating_point_v<C> && ignore == IgnoreSpecialValues::Yes) {
+        loop(std::bool_constant<std::is_floating_point_v<C>>{});
     } else {
-        minmax = std::accumulate(data, data + size, minmax,
-                                 [](const Res& mm, const ValueType& v) -> Res {
-                                     return {glm::min(mm.first, v), glm::max(mm.second, v)};
-                                 });
+        loop(std::false_type{});
     }
 
-    return {util::glm_convert<dvec4>(minmax.first), util::glm_convert<dvec4>(minmax.second)};
-}
-// Specialization for integer types. They do not have special values
-template <typename ValueType,
-          typename std::enable_if<!util::is_floating_point<ValueType>::value, int>::type = 0>
-std::pair<dvec4, dvec4> dataMinMax(const ValueType* data, size_t size,
-                                   IgnoreSpecialValues = IgnoreSpecialValues::No) {
-    using Res = std::pair<ValueType, ValueType>;
-    Res minmax{DataFormat<ValueType>::max(), DataFormat<ValueType>::lowest()};
-    minmax =
-        std::accumulate(data, data + size, minmax, [](const Res& mm, const ValueType& v) -> Res {
-            return {glm::min(mm.first, v), glm::max(mm.second, v)};
-        });
-
-    return {util::glm_convert<dvec4>(minmax.first), util::glm_convert<dvec4>(minmax.second)};
+    for (size_t j = 0; j < lanes; ++j) {
+        min[j % N] = laneMin[j] < min[j % N] ? laneMin[j] : min[j % N];
+        max[j % N] = laneMax[j] > max[j % N] ? laneMax[j] : max[j % N];
+    }
 }
 
+/**
+ * Number of values per partition for the parallel reductions, the partitioning only depends on
+ * the size of the data
+ */
+constexpr size_t minMaxGrainSize = size_t{1} << 16;
+constexpr size_t minMaxMaxPartitions = 64;
+
 }  // namespace detail
 
 /**
  * Compute component-wise minimum and maximum values scalar and glm::vec types.
+ * Large data is split into partitions that are reduced in parallel using the thread pool.
  *
  * @param data pointer to values
  * @param size of data
@@ -137,7 +150,37 @@ std::pair<dvec4, dvec4> dataMinMax(const ValueType* data, size_t size,
 template <typename ValueType>
 std::pair<dvec4, dvec4> dataMinMax(const ValueType* data, size_t size,
                                    IgnoreSpecialValues ignore = IgnoreSpecialValues::No) {
-    return detail::dataMinMax<ValueType>(data, size, ignore);
+    using C = util::value_type_t<ValueType>;
+    constexpr size_t N = util::flat_extent<ValueType>::value;
+    using Res = std::pair<std::array<C, N>, std::array<C, N>>;
+
+    Res init;
+    init.first.fill(DataFormat<C>::max());
+    init.second.fill(DataFormat<C>::lowest());
+
+    const auto partitions =
+        std::clamp(size / detail::minMaxGrainSize, size_t{1}, detail::minMaxMaxPartitions);
+    std::vector<Res> results(partitions, init);
+    const auto* components = reinterpret_cast<const C*>(data);
+    util::parallelFor(partitions, [&](size_t p) {
+        const auto begin = size * p / partitions;
+        const auto end = size * (p + 1) / partitions;
+        detail::minMaxKernel(components + begin * N, end - begin, ignore, results[p].first,
+                             results[p].second);
+    });
+
+    ValueType min{};
+    ValueType max{};
+    for (size_t c = 0; c < N; ++c) {
+        util::glmcomp(min, c) = init.first[c];
+        util::glmcomp(max, c) = init.second[c];
+        for (const auto& [pmin, pmax] : results) {
+            util::glmcomp(min, c) = std::min(util::glmcomp(min, c), pmin[c]);
+            util::glmcomp(max, c) = std::max(util::glmcomp(max, c), pmax[c]);
+        }
+    }
+
+    return {util::glm_convert<dvec4>(min), util::glm_convert<dvec4>(max)};
 }
 
 }  // namespace util
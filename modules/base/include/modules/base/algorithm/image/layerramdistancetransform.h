@@ -38,6 +38,7 @@
 #include <inviwo/core/util/glmvec.h>                    // for i64vec2, size2_t
 #include <inviwo/core/util/indexmapper.h>               // for IndexMapper
 #include <inviwo/core/util/logcentral.h>                // for LogCentral
+#include <inviwo/core/util/parallel.h>                  // for parallelFor, parallelForBlocks
 #include <inviwo/core/util/stringconversion.h>          // for toString
 
 #include <stdlib.h>   // for size_t, abs
@@ -50,12 +51,6 @@
 #include <glm/matrix.hpp>  // for transpose
 #include <glm/vec2.hpp>    // for vec<>::(anonymous), operator*, opera...
 
-#ifdef IVW_USE_OPENMP
-#include <thread>
-
-#include <omp.h>
-#endif
-
 namespace inviwo {
 
 namespace util {
@@ -112,10 +107,6 @@ void util::layerRAMDistanceTransform(const LayerRAMPrecision<T>* inLayer,
                                      Predicate predicate, ValueTransform valueTransform,
                                      ProgressCallback callback) {
 
-#ifdef IVW_USE_OPENMP
-    omp_set_num_threads(std::thread::hardware_concurrency());
-#endif
-
     using int64 = glm::int64;
 
     auto square = [](auto a) { return a * a; };
@@ -168,12 +159,10 @@ void util::layerRAMDistanceTransform(const LayerRAMPrecision<T>* inLayer,
         return predicate(src[srcInd(x / sm.x, y / sm.y)]);
     };
 
-// first pass, forward and backward scan along x
-// result: min distance in x direction
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int64 y = 0; y < dstDim.y; ++y) {
+    // first pass, forward and backward scan along x
+    // result: min distance in x direction
+    util::parallelFor(0, static_cast<size_t>(dstDim.y), [&](size_t row) {
+        const auto y = static_cast<int64>(row);
         // forward
         U dist = static_cast<U>(dstDim.x);
         for (int64 x = 0; x < dstDim.x; ++x) {
@@ -195,22 +184,16 @@ void util::layerRAMDistanceTransform(const LayerRAMPrecision<T>* inLayer,
             }
             dst[dstInd(x, y)] = std::min<U>(dst[dstInd(x, y)], squareVoxelSize.x * square(dist));
         }
-    }
+    });
 
     // second pass, scan y direction
     // for each voxel v(x,y,z) find min_i(data(x,i,z) + (y - i)^2), 0 <= i < dimY
     // result: min distance in x and y direction
     callback(0.45);
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel
-#endif
-    {
+    util::parallelForBlocks(static_cast<size_t>(dstDim.x), [&](size_t begin, size_t end) {
         std::vector<U> buff;
         buff.resize(dstDim.y);
-#ifdef IVW_USE_OPENMP
-#pragma omp for
-#endif
-        for (int64 x = 0; x < dstDim.x; ++x) {
+        for (auto x = static_cast<int64>(begin); x < static_cast<int64>(end); ++x) {
 
             // cache column data into temporary buffer
             for (int64 y = 0; y < dstDim.y; ++y) {
@@ -231,17 +214,12 @@ void util::layerRAMDistanceTransform(const LayerRAMPrecision<T>* inLayer,
                 dst[dstInd(x, y)] = d;
             }
         }
-    }
+    });
 
     // scale data
     callback(0.9);
-    const int64 layerSize = dstDim.x * dstDim.y;
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int64 i = 0; i < layerSize; ++i) {
-        dst[i] = valueTransform(dst[i]);
-    }
+    const auto layerSize = static_cast<size_t>(dstDim.x * dstDim.y);
+    util::parallelFor(0, layerSize, [&](size_t i) { dst[i] = valueTransform(dst[i]); });
     callback(1.0);
 }
 
@@ -38,6 +38,7 @@
 #include <inviwo/core/util/formatdispatching.h>                         // for PrecisionValueType
 #include <inviwo/core/util/glmconvert.h>                                // for glm_convert_norma...
 #include <inviwo/core/util/glmvec.h>                                    // for ivec2, size2_t
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 
 #include <algorithm>      // for copy, fill
 #include <cstddef>        // for size_t
@@ -110,14 +111,11 @@ std::shared_ptr<LayerRAMPrecision<U>> extractLayerSubSet(const LayerRAMPrecision
         std::fill(dst, dst + dstDim.x * dstDim.y, U(0));
     }
     // memcpy each row to form sub layer
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int j = 0; j < copyExtent.y; j++) {
+    util::parallelFor(0, static_cast<size_t>(std::max(copyExtent.y, 0)), [&](size_t j) {
         size_t srcPos = (j + srcOffset.y) * srcDim.x + srcOffset.x;
         size_t dstPos = (j + dstOffset.y) * dstDim.x + dstOffset.x;
         conversionCopy(src + srcPos, dst + dstPos, static_cast<size_t>(copyExtent.x));
-    }
+    });
 
     return newLayer;
 }
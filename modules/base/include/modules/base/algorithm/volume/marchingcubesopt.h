@@ -53,6 +53,11 @@ namespace util {
  * Note: Shares interface with util::marchingcbes and util::marchingtetrahedron
  * This is an optimized version of util::marchingcubes
  *
+ * The volume is split into z-slabs that are processed concurrently on the thread pool, and then
+ * stitched together without duplicating the vertices on the slab boundaries. The number of slabs
+ * only depends on the volume dimensions, hence the result is deterministic. The calling thread
+ * takes part in the work, so it is safe to call from within a pool job.
+ *
  * @param volume the scalar volume
  * @param iso iso-value for the extracted surface
  * @param color the color of the resulting surface
@@ -60,9 +65,9 @@ namespace util {
  * iso-value is 'outside' of the surface)
  * @param enclose whether to create surface where the iso surface intersects the volume boundaries
  * @param progressCallback if set, will be called will executing with the current progress in the
- * interval [0,1], useful for progress bars
+ * interval [0,1], useful for progress bars. Only called from the calling thread.
  * @param maskingCallback optional callback to test whether current cell should be evaluated or not
- * (return true to include current cell)
+ * (return true to include current cell). Will be called concurrently from several threads.
  */
 
 IVW_MODULE_BASE_API std::shared_ptr<Mesh> marchingCubesOpt(
@@ -35,9 +35,10 @@
 #include <inviwo/core/util/formatdispatching.h>  // for Scalars, PrecisionValueType
 #include <inviwo/core/util/glmconvert.h>         // for glm_convert_normalized
 #include <inviwo/core/util/glmutils.h>           // for Vector, Matrix
-#include <inviwo/core/util/glmvec.h>             // for i64vec3, size3_t
+#include <inviwo/core/util/glmvec.h>             // for i64vec3, size3_t, size2_t
 #include <inviwo/core/util/indexmapper.h>        // for IndexMapper
 #include <inviwo/core/util/logcentral.h>         // for LogCentral
+#include <inviwo/core/util/parallel.h>           // for parallelFor, parallelForBlocks
 #include <inviwo/core/util/stringconversion.h>   // for toString
 
 #include <cstdlib>    // for size_t, abs
@@ -50,12 +51,6 @@
 #include <glm/matrix.hpp>  // for transpose
 #include <glm/vec3.hpp>    // for vec<>::(anonymous), operator*, ope...
 
-#ifdef IVW_USE_OPENMP
-#include <thread>
-
-#include <omp.h>
-#endif
-
 namespace inviwo {
 class VolumeRAM;
 template <typename T>
@@ -116,10 +111,6 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
                                       Predicate predicate, ValueTransform valueTransform,
                                       ProgressCallback progress) {
 
-#ifdef IVW_USE_OPENMP
-    omp_set_num_threads(static_cast<int>(std::thread::hardware_concurrency()));
-#endif
-
     using int64 = glm::int64;
 
     auto square = [](auto a) { return a * a; };
@@ -172,125 +163,108 @@ void util::volumeRAMDistanceTransform(const VolumeRAMPrecision<T>* inVolume,
         return predicate(src[srcInd(x / sm.x, y / sm.y, z / sm.z)]);
     };
 
-// first pass, forward and backward scan along x
-// result: min distance in x direction
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int64 z = 0; z < dstDim.z; ++z) {
-        for (int64 y = 0; y < dstDim.y; ++y) {
-            // forward
-            U dist = static_cast<U>(dstDim.x);
-            for (int64 x = 0; x < dstDim.x; ++x) {
-                if (!is_feature(x, y, z)) {
-                    ++dist;
-                } else {
-                    dist = U(0);
-                }
-                dst[dstInd(x, y, z)] = squareVoxelSize.x * square(dist);
+    // first pass, forward and backward scan along x
+    // result: min distance in x direction
+    const size2_t rows{static_cast<size_t>(dstDim.y), static_cast<size_t>(dstDim.z)};
+    util::parallelFor(rows, [&](const size2_t& row) {
+        const auto y = static_cast<int64>(row.x);
+        const auto z = static_cast<int64>(row.y);
+        // forward
+        U dist = static_cast<U>(dstDim.x);
+        for (int64 x = 0; x < dstDim.x; ++x) {
+            if (!is_feature(x, y, z)) {
+                ++dist;
+            } else {
+                dist = U(0);
             }
+            dst[dstInd(x, y, z)] = squareVoxelSize.x * square(dist);
+        }
 
-            // backward
-            dist = static_cast<U>(dstDim.x);
-            for (int64 x = dstDim.x - 1; x >= 0; --x) {
-                if (!is_feature(x, y, z)) {
-                    ++dist;
-                } else {
-                    dist = U(0);
-                }
-                dst[dstInd(x, y, z)] =
-                    std::min<U>(dst[dstInd(x, y, z)], squareVoxelSize.x * square(dist));
+        // backward
+        dist = static_cast<U>(dstDim.x);
+        for (int64 x = dstDim.x - 1; x >= 0; --x) {
+            if (!is_feature(x, y, z)) {
+                ++dist;
+            } else {
+                dist = U(0);
             }
+            dst[dstInd(x, y, z)] =
+                std::min<U>(dst[dstInd(x, y, z)], squareVoxelSize.x * square(dist));
         }
-    }
+    });
 
     // second pass, scan y direction
     // for each voxel v(x,y,z) find min_i(data(x,i,z) + (y - i)^2), 0 <= i < dimY
     // result: min distance in x and y direction
     progress(0.3);
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel
-#endif
-    {
+    const auto columnsY = static_cast<size_t>(dstDim.x * dstDim.z);
+    util::parallelForBlocks(columnsY, [&](size_t begin, size_t end) {
         std::vector<U> buff;
         buff.resize(dstDim.y);
-#ifdef IVW_USE_OPENMP
-#pragma omp for
-#endif
-        for (int64 z = 0; z < dstDim.z; ++z) {
-            for (int64 x = 0; x < dstDim.x; ++x) {
-
-                // cache column data into temporary buffer
-                for (int64 y = 0; y < dstDim.y; ++y) {
-                    buff[y] = dst[dstInd(x, y, z)];
-                }
+        for (auto column = static_cast<int64>(begin); column < static_cast<int64>(end);
+             ++column) {
+            const int64 x = column % dstDim.x;
+            const int64 z = column / dstDim.x;
+
+            // cache column data into temporary buffer
+            for (int64 y = 0; y < dstDim.y; ++y) {
+                buff[y] = dst[dstInd(x, y, z)];
+            }
 
-                for (int64 y = 0; y < dstDim.y; ++y) {
-                    auto d = buff[y];
-                    if (d != U(0)) {
-                        const auto rMax =
-                            static_cast<int64>(std::sqrt(d * invSquareVoxelSize.y)) + 1;
-                        const auto rStart = std::min(rMax, y - 1);
-                        const auto rEnd = std::min(rMax, dstDim.y - y);
-                        for (int64 n = -rStart; n < rEnd; ++n) {
-                            const auto w = buff[y + n] + squareVoxelSize.y * square(n);
-                            if (w < d) d = w;
-                        }
+            for (int64 y = 0; y < dstDim.y; ++y) {
+                auto d = buff[y];
+                if (d != U(0)) {
+                    const auto rMax = static_cast<int64>(std::sqrt(d * invSquareVoxelSize.y)) + 1;
+                    const auto rStart = std::min(rMax, y - 1);
+                    const auto rEnd = std::min(rMax, dstDim.y - y);
+                    for (int64 n = -rStart; n < rEnd; ++n) {
+                        const auto w = buff[y + n] + squareVoxelSize.y * square(n);
+                        if (w < d) d = w;
                     }
-                    dst[dstInd(x, y, z)] = d;
                 }
+                dst[dstInd(x, y, z)] = d;
             }
         }
-    }
+    });
 
     // third pass, scan z direction
     // for each voxel v(x,y,z) find min_i(data(x,y,i) + (z - i)^2), 0 <= i < dimZ
     // result: min distance in x and y direction
     progress(0.6);
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel
-#endif
-    {
+    const auto columnsZ = static_cast<size_t>(dstDim.x * dstDim.y);
+    util::parallelForBlocks(columnsZ, [&](size_t begin, size_t end) {
         std::vector<U> buff;
         buff.resize(dstDim.z);
-#ifdef IVW_USE_OPENMP
-#pragma omp for
-#endif
-        for (int64 y = 0; y < dstDim.y; ++y) {
-            for (int64 x = 0; x < dstDim.x; ++x) {
-
-                // cache column data into temporary buffer
-                for (int64 z = 0; z < dstDim.z; ++z) {
-                    buff[z] = dst[dstInd(x, y, z)];
-                }
+        for (auto column = static_cast<int64>(begin); column < static_cast<int64>(end);
+             ++column) {
+            const int64 x = column % dstDim.x;
+            const int64 y = column / dstDim.x;
+
+            // cache column data into temporary buffer
+            for (int64 z = 0; z < dstDim.z; ++z) {
+                buff[z] = dst[dstInd(x, y, z)];
+            }
 
-                for (int64 z = 0; z < dstDim.z; ++z) {
-                    auto d = buff[z];
-                    if (d != U(0)) {
-                        const auto rMax =
-                            static_cast<int64>(std::sqrt(d * invSquareVoxelSize.z)) + 1;
-                        const auto rStart = std::min(rMax, z - 1);
-                        const auto rEnd = std::min(rMax, dstDim.z - z);
-                        for (int64 n = -rStart; n < rEnd; ++n) {
-                            const auto w = buff[z + n] + squareVoxelSize.z * square(n);
-                            if (w < d) d = w;
-                        }
+            for (int64 z = 0; z < dstDim.z; ++z) {
+                auto d = buff[z];
+                if (d != U(0)) {
+                    const auto rMax = static_cast<int64>(std::sqrt(d * invSquareVoxelSize.z)) + 1;
+                    const auto rStart = std::min(rMax, z - 1);
+                    const auto rEnd = std::min(rMax, dstDim.z - z);
+                    for (int64 n = -rStart; n < rEnd; ++n) {
+                        const auto w = buff[z + n] + squareVoxelSize.z * square(n);
+                        if (w < d) d = w;
                     }
-                    dst[dstInd(x, y, z)] = d;
                 }
+                dst[dstInd(x, y, z)] = d;
             }
         }
-    }
+    });
 
     // scale data
     progress(0.9);
-    const int64 volSize = dstDim.x * dstDim.y * dstDim.z;
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-    for (int64 i = 0; i < volSize; ++i) {
-        dst[i] = valueTransform(dst[i]);
-    }
+    const auto volSize = static_cast<size_t>(dstDim.x * dstDim.y * dstDim.z);
+    util::parallelFor(0, volSize, [&](size_t i) { dst[i] = valueTransform(dst[i]); });
     progress(1.0);
 }
 // NOLINTEND(readability-function-cognitive-complexity)
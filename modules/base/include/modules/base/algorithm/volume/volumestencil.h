@@ -0,0 +1,202 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
+
+#include <inviwo/core/datastructures/image/imagetypes.h>          // for Wrapping
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>  // for VolumeRAMPrecision
+#include <inviwo/core/util/glmutils.h>                            // for same_extent_t
+#include <inviwo/core/util/glmvec.h>                              // for size3_t
+#include <inviwo/core/util/threadutil.h>                          // for parallelFor
+
+#include <algorithm>    // for min
+#include <array>        // for array
+#include <cstddef>      // for size_t
+#include <type_traits>  // for conditional_t
+#include <vector>       // for vector
+
+namespace inviwo {
+
+namespace util {
+
+/**
+ * The six face neighbors of a voxel, used to compute finite differences along the index axes.
+ * Values are converted to float, or double for double data. Neighbors outside of the volume are
+ * wrapped around for Wrapping::Repeat and otherwise linearly extrapolated from the voxel and its
+ * opposite neighbor. That turns the central difference into a one-sided difference and the second
+ * difference into zero at the border.
+ */
+template <typename T>
+struct VoxelStencil {
+    using type = same_extent_t<
+        T, std::conditional_t<std::is_same_v<value_type_t<T>, double>, double, float>>;
+    using component = value_type_t<type>;
+
+    /// Central difference along index @p axis, per voxel step
+    type difference(size_t axis) const {
+        return (plus[axis] - minus[axis]) * component{0.5};
+    }
+    /// Second difference along index @p axis, per voxel step squared
+    type secondDifference(size_t axis) const {
+        return plus[axis] - center * component{2} + minus[axis];
+    }
+
+    type center;
+    std::array<type, 3> minus;
+    std::array<type, 3> plus;
+};
+
+namespace detail {
+
+/// Number of rows of a z slice processed by each task in forEachVoxelStencil
+constexpr size_t stencilTileRows = 16;
+
+/**
+ * The neighbors of index @p i along an axis of @p size voxels, with flags for neighbors outside
+ * of the volume that have to be extrapolated.
+ */
+struct StencilNeighbors {
+    StencilNeighbors(size_t i, size_t size, Wrapping wrapping)
+        : minus{i}, plus{i}, extrapolateMinus{i == 0}, extrapolatePlus{i + 1 == size} {
+        if (wrapping == Wrapping::Repeat && size > 1) {
+            minus = i == 0 ? size - 1 : i - 1;
+            plus = i + 1 == size ? 0 : i + 1;
+            extrapolateMinus = extrapolatePlus = false;
+        } else {
+            if (!extrapolateMinus) minus = i - 1;
+            if (!extrapolatePlus) plus = i + 1;
+        }
+    }
+    bool border() const { return extrapolateMinus || extrapolatePlus; }
+
+    size_t minus;
+    size_t plus;
+    bool extrapolateMinus;
+    bool extrapolatePlus;
+};
+
+template <typename V>
+void extrapolate(const StencilNeighbors& n, const V& center, V& minus, V& plus) {
+    if (n.extrapolateMinus && n.extrapolatePlus) {
+        minus = plus = center;
+    } else if (n.extrapolateMinus) {
+        minus = center + center - plus;
+    } else if (n.extrapolatePlus) {
+        plus = center + center - minus;
+    }
+}
+
+}  // namespace detail
+
+/**
+ * Call @p op for each voxel of @p volume with the VoxelStencil of that voxel. The volume is split
+ * into tiles of a few rows of a z slice, such that the neighboring rows read by each tile stay in
+ * cache, and the tiles are processed in parallel using the thread pool. The border checks are
+ * only done for the first and last voxel of each row and for rows at the border of the volume,
+ * hence the loop over the interior only consists of loads at fixed offsets and @p op, and can be
+ * vectorized by the compiler once @p op is inlined.
+ *
+ * @param volume the volume to process
+ * @param init   the initial value of the accumulator of each tile
+ * @param op     callable as op(Acc& accumulator, size_t index, const VoxelStencil<T>& stencil),
+ *               where index is the linear index of the voxel. It is called concurrently for
+ *               different tiles, each with its own accumulator.
+ * @return the accumulators of all tiles, to be reduced by the caller
+ */
+template <typename T, typename Acc, typename Op>
+std::vector<Acc> forEachVoxelStencil(const VolumeRAMPrecision<T>& volume, const Acc& init,
+                                     Op&& op) {
+    using Stencil = VoxelStencil<T>;
+    using V = typename Stencil::type;
+
+    const auto dims = volume.getDimensions();
+    const auto wrapping = volume.getWrapping();
+    const T* data = volume.getDataTyped();
+    const size_t dx = dims.x;
+    const size_t dxy = dims.x * dims.y;
+
+    const size_t yTiles = (dims.y + detail::stencilTileRows - 1) / detail::stencilTileRows;
+    std::vector<Acc> results(dims.z * yTiles, init);
+
+    util::parallelFor(results.size(), [&](size_t tile) {
+        Acc& acc = results[tile];
+        const size_t z = tile / yTiles;
+        const size_t yBegin = (tile % yTiles) * detail::stencilTileRows;
+        const size_t yEnd = std::min(yBegin + detail::stencilTileRows, dims.y);
+        const detail::StencilNeighbors zn{z, dims.z, wrapping[2]};
+
+        for (size_t y = yBegin; y < yEnd; ++y) {
+            const detail::StencilNeighbors yn{y, dims.y, wrapping[1]};
+            const T* row = data + y * dx + z * dxy;
+            const T* rowYm = data + yn.minus * dx + z * dxy;
+            const T* rowYp = data + yn.plus * dx + z * dxy;
+            const T* rowZm = data + y * dx + zn.minus * dxy;
+            const T* rowZp = data + y * dx + zn.plus * dxy;
+            const size_t rowIndex = y * dx + z * dxy;
+
+            const auto general = [&](size_t x) {
+                const detail::StencilNeighbors xn{x, dims.x, wrapping[0]};
+                Stencil s;
+                s.center = static_cast<V>(row[x]);
+                s.minus = {static_cast<V>(row[xn.minus]), static_cast<V>(rowYm[x]),
+                           static_cast<V>(rowZm[x])};
+                s.plus = {static_cast<V>(row[xn.plus]), static_cast<V>(rowYp[x]),
+                          static_cast<V>(rowZp[x])};
+                detail::extrapolate(xn, s.center, s.minus[0], s.plus[0]);
+                detail::extrapolate(yn, s.center, s.minus[1], s.plus[1]);
+                detail::extrapolate(zn, s.center, s.minus[2], s.plus[2]);
+                op(acc, rowIndex + x, s);
+            };
+
+            general(0);
+            if (yn.border() || zn.border()) {
+                for (size_t x = 1; x + 1 < dx; ++x) general(x);
+            } else {
+                for (size_t x = 1; x + 1 < dx; ++x) {
+                    Stencil s;
+                    s.center = static_cast<V>(row[x]);
+                    s.minus = {static_cast<V>(row[x - 1]), static_cast<V>(rowYm[x]),
+                               static_cast<V>(rowZm[x])};
+                    s.plus = {static_cast<V>(row[x + 1]), static_cast<V>(rowYp[x]),
+                              static_cast<V>(rowZp[x])};
+                    op(acc, rowIndex + x, s);
+                }
+            }
+            if (dx > 1) general(dx - 1);
+        }
+    });
+
+    return results;
+}
+
+}  // namespace util
+
+}  // namespace inviwo
@@ -45,6 +45,14 @@ class Volume;
 
 namespace util {
 
+enum class VoronoiMethod {
+    /// Compare every voxel against every seed point, O(voxels x seeds)
+    BruteForce,
+    /// Recursively split the volume into blocks and cull the seed points that can not be the
+    /// closest for any voxel in a block. Gives the same result as BruteForce.
+    Hierarchical
+};
+
 /**
  * Implementation of Voronoi segmentation.
  *
@@ -62,12 +70,14 @@ namespace util {
  *     * wrapping the wrapping mode of the volume, @see Wrapping3D.
  *     * weights is an optional vector containing the weights for each seed point. If set the
  *       weighted version of voronoi should be used.
+ *     * method the algorithm to use, @see VoronoiMethod.
  */
 
 IVW_MODULE_BASE_API std::shared_ptr<Volume> voronoiSegmentation(
     const size3_t volumeDimensions, const mat4& indexToDataMatrix, const mat4& dataToModelMatrix,
     const std::vector<std::pair<uint32_t, vec3>>& seedPointsWithIndices, const Wrapping3D& wrapping,
-    const std::optional<std::vector<float>>& weights);
+    const std::optional<std::vector<float>>& weights,
+    VoronoiMethod method = VoronoiMethod::Hierarchical);
 
 }  // namespace util
 }  // namespace inviwo
@@ -32,6 +32,7 @@
 #include <modules/base/basemoduledefine.h>  // for IVW_MODULE_BASE_API
 
 #include <inviwo/core/datastructures/volume/volume.h>  // for DataWriterType
+#include <inviwo/core/io/chunkedvolumefile.h>          // for ChunkedVolumeFile
 #include <inviwo/core/io/datawriter.h>                 // for Overwrite, Overwrite::No, DataWrit...
 
 #include <string_view>  // for string_view
@@ -42,28 +43,24 @@ namespace inviwo {
  * \ingroup dataio
  * \brief Writer for *.ivf volume files
  *
- * Supports writing a single volume to disk. Creates one main file ([name].ivf) and one raw file
- * ([name].raw or [name]xx.raw.gz if zlib compression is available).
+ * Supports writing a single volume to disk. Creates one main file ([name].ivf) and one chunked
+ * data file ([name].ivc) holding the volume and its VolumePyramid levels, see
+ * util::writeIvfChunkedVolume. Use util::writeIvfVolume to write a single raw file instead.
  *
- * The output structure of the ivf file is:
+ * Files with chunked data have version 3, files written by util::writeIvfVolume with a single raw
+ * file have version 2. The output structure of the ivf file is:
  * \verbatim
 <?xml version="1.0" ?>
-<InviwoVolume version="2">
-    <RawFiles>
-        <RawFile content="../data/CLOUDf01.bin.gz">
-            <MetaDataMap>
-                <MetaDataItem type="org.inviwo.DoubleMetaData" key="timestamp">
-                    <MetaData content="1" />
-                </MetaDataItem>
-                <MetaDataItem type="org.inviwo.IntMetaData" key="index">
-                    <MetaData content="1" />
-                </MetaDataItem>
-            </MetaDataMap>
-        </RawFile>
-    </RawFiles>
-    <ByteOrder content="1" />
-    <Compression content="1" />
+<InviwoVolume version="3">
+    <RawFile content="CLOUDf01.ivc">
+        <MetaDataMap>
+            <MetaDataItem type="org.inviwo.DoubleMetaData" key="timestamp">
+                <MetaData content="1" />
+            </MetaDataItem>
+        </MetaDataMap>
+    </RawFile>
     <Format content="FLOAT32" />
+    <Chunked content="1" />
     <BasisAndOffset>
         <col0 x="1941.7" y="0" z="0" w="0" />
         <col1 x="0" y="1996.25" z="0" w="0" />
@@ -154,6 +151,28 @@ namespace util {
 IVW_MODULE_BASE_API void writeIvfVolume(const Volume& data, const std::filesystem::path& filePath,
                                         Overwrite overwrite = Overwrite::Yes);
 
+/**
+ * \brief Writes a volume as a chunked ivf file
+ *
+ * Creates one main file ([name].ivf) and one chunked data file ([name].ivc), see
+ * ChunkedVolumeFile. The chunks are compressed independently and in parallel, and the index
+ * holds per chunk min/max and histograms over the data range of the volume. Chunked files can be
+ * read partially, and volumes larger than the brick cache budget are read brick by brick, see
+ * VolumeBricked.
+ *
+ * @param data         the volume to export
+ * @param filePath     path of the ivf file
+ * @param options      chunk size and compression settings
+ * @param writePyramid also store the levels of the VolumePyramid of @p data, they are computed
+ *                     unless already available
+ * @param overwrite    whether or not to overwrite existing files
+ */
+IVW_MODULE_BASE_API void writeIvfChunkedVolume(const Volume& data,
+                                               const std::filesystem::path& filePath,
+                                               const ChunkedVolumeFile::WriteOptions& options = {},
+                                               bool writePyramid = true,
+                                               Overwrite overwrite = Overwrite::Yes);
+
 /**
  * \brief Writes a volume sequence to disk
  *
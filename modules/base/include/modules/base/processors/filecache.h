@@ -46,25 +46,121 @@
 #include <inviwo/core/io/datareaderfactory.h>
 #include <inviwo/core/network/processornetwork.h>
 #include <inviwo/core/network/processornetworkevaluator.h>
+#include <inviwo/core/resourcemanager/resource.h>
 #include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/util/transparentmaps.h>
 
 #include <fstream>
 #include <ranges>
 
 #include <filesystem>
+#include <memory>
+#include <mutex>
 #include <optional>
 
 #include <fmt/std.h>
 
 namespace inviwo {
 
+class Layer;
+class Image;
+class Mesh;
+
 namespace detail {
 
+/**
+ * Serialize the state of all processors upstream of @p p, and the connections and links between
+ * them, into @p xml and return a hash of it. Cosmetic state, like meta data, display names, and
+ * property visibility, is excluded such that the key only depends on what affects the data. The
+ * hash is stable across sessions and platforms.
+ */
 IVW_MODULE_BASE_API std::string cacheState(Processor* p, ProcessorNetwork& net,
                                            const std::filesystem::path& refPath,
                                            std::pmr::string& xml);
 
+/**
+ * Estimated memory usage in bytes of a cached item. Types without an overload only count their
+ * object size.
+ */
+IVW_MODULE_BASE_API size_t cacheSize(const Volume& volume);
+IVW_MODULE_BASE_API size_t cacheSize(const Layer& layer);
+IVW_MODULE_BASE_API size_t cacheSize(const Image& image);
+IVW_MODULE_BASE_API size_t cacheSize(const Mesh& mesh);
+template <typename T>
+size_t cacheSize(const T&) {
+    return sizeof(T);
+}
+
+/**
+ * Writers run on the thread pool, make sure that a RAM representation exists before dispatching,
+ * since converting from other representations might require the main thread.
+ */
+IVW_MODULE_BASE_API void ensureRAM(const Volume& volume);
+IVW_MODULE_BASE_API void ensureRAM(const Layer& layer);
+IVW_MODULE_BASE_API void ensureRAM(const Image& image);
+IVW_MODULE_BASE_API void ensureRAM(const Mesh& mesh);
+template <typename T>
+void ensureRAM(const T&) {}
+
+IVW_MODULE_BASE_API void writeCacheXML(const std::filesystem::path& file, std::string_view xml);
+
+/**
+ * Keeps track of data that is being written to disk in the background. The state is shared with
+ * the pool jobs, so the owning FileCache can be destroyed while writes are still in flight.
+ */
+template <typename DataType>
+class PendingWrites : public std::enable_shared_from_this<PendingWrites<DataType>> {
+public:
+    bool has(std::string_view key) const {
+        const std::scoped_lock lock{mutex_};
+        return pending_.contains(key);
+    }
+    std::shared_ptr<const DataType> get(std::string_view key) const {
+        const std::scoped_lock lock{mutex_};
+        if (auto it = pending_.find(key); it != pending_.end()) {
+            return it->second;
+        }
+        return nullptr;
+    }
+
+    /**
+     * Write @p data to @p file and then @p xml to @p xmlFile using the thread pool. The xml file
+     * is written last and marks the entry as complete. Errors are logged.
+     */
+    void write(std::string key, std::shared_ptr<const DataType> data,
+               std::shared_ptr<DataWriterType<DataType>> writer, std::filesystem::path file,
+               std::filesystem::path xmlFile, std::string xml) {
+        {
+            const std::scoped_lock lock{mutex_};
+            if (!pending_.try_emplace(key, data).second) return;
+        }
+        ensureRAM(*data);
+        writer->setOverwrite(Overwrite::Yes);
+
+        util::dispatchPool([self = this->shared_from_this(), key = std::move(key),
+                            data = std::move(data), writer = std::move(writer),
+                            file = std::move(file), xmlFile = std::move(xmlFile),
+                            xml = std::move(xml)]() {
+            try {
+                writer->writeData(data.get(), file);
+                writeCacheXML(xmlFile, xml);
+            } catch (const Exception& e) {
+                log::exception(e);
+            } catch (const std::exception& e) {
+                log::exception(e);
+            }
+            const std::scoped_lock lock{self->mutex_};
+            self->pending_.erase(key);
+        });
+    }
+
+private:
+    mutable std::mutex mutex_;
+    UnorderedStringMap<std::shared_ptr<const DataType>> pending_;
+};
+
 template <typename... Types>
 void updateFilenameFilters(const DataReaderFactory& rf, const DataWriterFactory& wf,
                            OptionProperty<FileExtension>& extensions) {
@@ -114,7 +210,7 @@ public:
     virtual bool hasCache(std::string_view key) = 0;
 
 protected:
-    void writeXML() const;
+    std::optional<std::filesystem::path> xmlPathForKey(std::string_view key) const;
 
     BoolProperty enabled_;
     DirectoryProperty cacheDir_;
@@ -157,50 +253,98 @@ private:
     const DataWriterFactory* wf;
 };
 
+/**
+ * An in memory cache. The number of items is limited by the capacity property. The items are
+ * also registered as evictable data with the ResourceManager, so the memory used by all caches
+ * is limited by the evictable data budget, shared with other evictable data like volume pyramids.
+ */
 template <typename DataType>
 struct RAMCache {
     RAMCache()
         : capacity{"capacity", "RAM Cache Capacity",
                    util::ordinalCount(size_t{3}, size_t{100})
                        .set("Max number of items to cache, "
-                            "0 means that no ram caching will be used"_help)} {
+                            "0 means that no ram caching will be used"_help)}
+        , state{std::make_shared<State>()} {
 
         capacity.onChange([this]() { trim(capacity); });
     }
+    RAMCache(const RAMCache&) = delete;
+    RAMCache(RAMCache&&) = delete;
+    RAMCache& operator=(const RAMCache&) = delete;
+    RAMCache& operator=(RAMCache&&) = delete;
+    ~RAMCache() { trim(0); }
 
     struct Item {
         std::chrono::system_clock::time_point used;
         DataType data;
     };
+    /**
+     * Shared with the release functions of the evictable items, which can be called from any
+     * thread. The address of an item is used as its evictable key.
+     */
+    struct State {
+        std::mutex mutex;
+        UnorderedStringMap<Item> cache;
+    };
 
     IntSizeTProperty capacity;
-    UnorderedStringMap<Item> cache;
+    std::shared_ptr<State> state;
 
     void trim(size_t maxSize) {
-        while (cache.size() > maxSize) {
+        const std::scoped_lock lock{state->mutex};
+        while (state->cache.size() > maxSize) {
             const auto it = std::ranges::min_element(
-                cache, std::ranges::less{}, [](const auto& pair) { return pair.second.used; });
-            cache.erase(it);
+                state->cache, std::ranges::less{},
+                [](const auto& pair) { return pair.second.used; });
+            resource::removeEvictable(resource::toRAM(&it->second));
+            state->cache.erase(it);
         }
     }
 
-    void add(std::string_view key, DataType data) {
+    void add(std::string_view key, DataType data, size_t bytes) {
         if (capacity.get() == 0) {
-            cache.clear();
+            trim(0);
             return;
         }
 
         trim(capacity.get() - 1);
 
-        const auto now = std::chrono::system_clock::now();
-        cache.try_emplace(std::string{key}, Item{now, std::move(data)});
+        const Item* item = nullptr;
+        {
+            const std::scoped_lock lock{state->mutex};
+            const auto now = std::chrono::system_clock::now();
+            const auto [it, inserted] =
+                state->cache.try_emplace(std::string{key}, Item{now, std::move(data)});
+            if (!inserted) return;
+            item = &it->second;
+        }
+
+        // Registered without holding the lock, the item might be evicted again right away if it
+        // does not fit in the budget.
+        resource::addEvictable(resource::toRAM(item), bytes,
+                               [weakState = std::weak_ptr<State>(state), key = std::string{key},
+                                item]() {
+                                   if (auto shared = weakState.lock()) {
+                                       const std::scoped_lock lock{shared->mutex};
+                                       auto it = shared->cache.find(key);
+                                       if (it != shared->cache.end() && &it->second == item) {
+                                           shared->cache.erase(it);
+                                       }
+                                   }
+                               });
     }
 
-    bool has(std::string_view key) const { return cache.contains(key); }
+    bool has(std::string_view key) const {
+        const std::scoped_lock lock{state->mutex};
+        return state->cache.contains(key);
+    }
 
     std::optional<DataType> get(std::string_view key) {
-        if (auto it = cache.find(key); it != cache.end()) {
+        const std::scoped_lock lock{state->mutex};
+        if (auto it = state->cache.find(key); it != state->cache.end()) {
             it->second.used = std::chrono::system_clock::now();
+            resource::useEvictable(resource::toRAM(&it->second));
             return it->second.data;
         } else {
             return std::nullopt;
@@ -231,17 +375,20 @@ private:
     }
 
     virtual bool hasCache(std::string_view key) override {
-        return ram_.has(key) || pathForKey(key)
-                                    .transform([](const std::filesystem::path& path) -> bool {
-                                        return std::filesystem::exists(path);
-                                    })
-                                    .value_or(false);
+        if (ram_.has(key) || writes_->has(key)) return true;
+
+        // The xml file is written last, if it exists the data file is complete.
+        const auto path = pathForKey(key);
+        const auto xmlPath = xmlPathForKey(key);
+        return path && xmlPath && std::filesystem::exists(*path) &&
+               std::filesystem::exists(*xmlPath);
     }
 
     InportType inport_;
     OutportType outport_;
     ReaderWriter<DataType> rw_;
     RAMCache<std::shared_ptr<const DataType>> ram_;
+    std::shared_ptr<detail::PendingWrites<DataType>> writes_;
 
     std::string loadedKey_;
 };
@@ -274,7 +421,8 @@ FileCache<DataType, InportType, OutportType>::FileCache(InviwoApplication* app)
     , inport_{"inport", "data to cache"_help}
     , outport_{"outport", "cached data"_help}
     , rw_{app}
-    , ram_{} {
+    , ram_{}
+    , writes_{std::make_shared<detail::PendingWrites<DataType>>()} {
 
     addPorts(inport_, outport_);
     addProperties(enabled_, cacheDir_, refDir_, currentKey_, rw_.extensions, ram_.capacity);
@@ -288,10 +436,14 @@ void FileCache<DataType, InportType, OutportType>::process() {
         if (auto ramData = ram_.get(key_)) {
             outport_.setData(*ramData);
             loadedKey_ = key_;
+        } else if (auto pendingData = writes_->get(key_)) {
+            ram_.add(key_, pendingData, detail::cacheSize(*pendingData));
+            outport_.setData(pendingData);
+            loadedKey_ = key_;
         } else if (auto reader = rw_.getReader()) {
             if (auto maybePath = pathForKey(key_)) {
                 auto diskData = reader->readData(*maybePath);
-                ram_.add(key_, diskData);
+                ram_.add(key_, diskData, detail::cacheSize(*diskData));
                 outport_.setData(diskData);
                 loadedKey_ = key_;
             } else {
@@ -303,13 +455,13 @@ void FileCache<DataType, InportType, OutportType>::process() {
     } else if (auto data = inport_.getData()) {
         if (auto maybePath = pathForKey(key_)) {
             if (auto writer = rw_.getWriter()) {
-                writer->writeData(data.get(), *maybePath);
+                writes_->write(key_, data, std::move(writer), *maybePath, *xmlPathForKey(key_),
+                               std::string{xml_});
             } else {
                 throw Exception("No writer found");
             }
         }
-        writeXML();
-        ram_.add(key_, data);
+        ram_.add(key_, data, detail::cacheSize(*data));
         outport_.setData(data);
         loadedKey_ = key_;
     } else {
@@ -42,14 +42,19 @@
 #include <inviwo/core/util/glmconvert.h>                                // for glm_convert
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t, vec4
 #include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
+#include <inviwo/core/util/parallel.h>                                  // for parallelFor
 #include <inviwo/core/util/stdextensions.h>                             // for make_array, contains
 #include <modules/base/algorithm/volume/surfaceextraction.h>            // for encloseSurfce
 #include <modules/base/datastructures/disjointsets.h>                   // for DisjointSets
 
 #include <algorithm>      // for find_if, transform
+#include <atomic>         // for atomic
 #include <bitset>         // for bitset, __bitset<...
 #include <cstdint>        // for uint32_t
 #include <iterator>       // for distance, back_in...
+#include <limits>         // for numeric_limits
+#include <ranges>         // for sort, lower_bound
+#include <thread>         // for get_id
 #include <type_traits>    // for remove_extent_t
 #include <unordered_set>  // for unordered_set
 #include <utility>        // for pair
@@ -270,7 +275,7 @@ class VCache {
 public:
     enum CacheName { xCacheCurr, xCacheNext, yCacheCurr, yCacheNext, zCacheCurr, zCacheNext };
     enum CachePosName { xCurr0, xCurr1, xNext0, xNext1, yCurr, yNext, zCurr, zNext };
-    VCache(const size2_t& dim) : cIm{dim} {
+    VCache(const size2_t& dim, size_t firstZ) : cIm{dim}, firstZ_{firstZ} {
         cache[xCacheCurr].resize(dim.x * dim.y);
         cache[xCacheNext].resize(dim.x * dim.y);
         cache[yCacheCurr].resize(dim.x * dim.y);
@@ -282,28 +287,28 @@ public:
     std::pair<size_t, bool> find(const size3_t& ind, int edge, const size_t& val) {
         switch (edge) {
             case 0:
-                if (ind.z == 0 && ind.y == 0) {
+                if (ind.z == firstZ_ && ind.y == 0) {
                     cache[xCacheCurr][cIm(pos[xCurr0], ind.y)] = val;
                     return {val, true};
                 } else {
                     return {cache[xCacheCurr][cIm(pos[xCurr0], ind.y)], false};
                 }
             case 1:
-                if (ind.z == 0) {
+                if (ind.z == firstZ_) {
                     cache[yCacheCurr][cIm(pos[yCurr] + 1, ind.y)] = val;
                     return {val, true};
                 } else {
                     return {cache[yCacheCurr][cIm(pos[yCurr] + 1, ind.y)], false};
                 }
             case 2:
-                if (ind.z == 0) {
+                if (ind.z == firstZ_) {
                     cache[xCacheCurr][cIm(pos[xCurr1], ind.y + 1)] = val;
                     return {val, true};
                 } else {
                     return {cache[xCacheCurr][cIm(pos[xCurr1], ind.y + 1)], false};
                 }
             case 3:
-                if (ind.z == 0 && ind.x == 0) {
+                if (ind.z == firstZ_ && ind.x == 0) {
                     cache[yCacheCurr][cIm(pos[yCurr], ind.y)] = val;
                     return {val, true};
                 } else {
@@ -381,6 +386,7 @@ public:
 
 private:
     util::IndexMapper2D cIm;
+    size_t firstZ_;
     std::array<std::vector<size_t>, 6> cache;
     std::array<size_t, 8> pos;
 };
@@ -455,6 +461,49 @@ template <typename T, typename IsoTest>
 const std::array<OffsetIndexMasks, 4> Index<T, IsoTest>::oim_ = {
     {{0, 1, {0, 0, 0}}, {3, 2, {0, 1, 0}}, {4, 5, {0, 0, 1}}, {7, 6, {0, 1, 1}}}};
 
+/**
+ * The output of one z-slab. Vertices on the first and last z-plane of the slab are also recorded
+ * by their edge key so that they can be stitched to the neighboring slabs.
+ */
+struct Slab {
+    using KeyedVertex = std::pair<size_t, std::uint32_t>;
+
+    std::vector<vec3> positions;
+    std::vector<vec3> normals;
+    std::vector<std::uint32_t> indices;
+    std::vector<KeyedVertex> first;
+    std::vector<KeyedVertex> last;
+};
+
+/**
+ * A unique key for a cube edge lying in a z-plane, i.e. edges 0-3 and 8-11.
+ * The key is (y * dimx + x) * 2 + axis for the edge starting at (x, y) along axis x (0) or y (1).
+ */
+constexpr size_t planeEdgeKey(const size3_t& ind, int edge, size_t dimx) {
+    const auto key = [dimx](size_t x, size_t y, size_t axis) { return (y * dimx + x) * 2 + axis; };
+    switch (edge % 8) {
+        case 0:
+            return key(ind.x, ind.y, 0);
+        case 1:
+            return key(ind.x + 1, ind.y, 1);
+        case 2:
+            return key(ind.x, ind.y + 1, 0);
+        case 3:
+        default:
+            return key(ind.x, ind.y, 1);
+    }
+}
+
+/**
+ * The number of z-slabs only depends on the volume size and not on the number of threads, that
+ * way the result is deterministic.
+ */
+constexpr size_t slabCount(size_t zCells) {
+    constexpr size_t minSlabThickness = 16;
+    constexpr size_t maxSlabs = 256;
+    return std::clamp<size_t>(zCells / minSlabThickness, size_t{1}, maxSlabs);
+}
+
 }  // namespace
 
 namespace util {
@@ -510,55 +559,121 @@ std::shared_ptr<Mesh> marchingCubesOpt(std::shared_ptr<const Volume> volume, dou
             return r0 + t * (r1 - r0);
         };
 
-        VCache vcache(size2_t{dim.x, dim.y});
-        Index<T, decltype(isoTest)> index(src, im, isoTest);
-        size3_t ind;
-        dvec3 pos;
-
         const float err =
             static_cast<float>(4.0 * glm::epsilon<double>() * glm::epsilon<double>() * dr.x * dr.y);
 
-        for (ind.z = 0, pos.z = 0.0; ind.z < dim1.z; ++ind.z, pos.z += dr.z) {
-            vcache.incZ();
-            for (ind.y = 0, pos.y = 0.0; ind.y < dim1.y; ++ind.y, pos.y += dr.y) {
-                ind.x = 0;
-                const auto cInd = im(ind);
-                vcache.incY();
-                index.init(cInd);
-                for (pos.x = 0.0; ind.x < dim1.x; ++ind.x, pos.x += dr.x) {
-                    index.update(cInd + ind.x);
-                    if (index == 0 || index == 255) continue;
-                    if (maskingCallback && !maskingCallback(ind)) continue;
-
-                    std::array<size_t, 12> inds;
-                    for (const auto edge : cube.caseEdges[index]) {
-                        const auto c = vcache.find(ind, edge, positions.size());
-                        inds[edge] = c.first;
-                        if (c.second) {
-                            const auto vertex = interpolate(ind, pos, edge);
-                            positions.emplace_back(vertex);
-                            normals.emplace_back(0.0f, 0.0f, 0.0f);
-                        }
-                    }
-                    for (const auto& tri : cube.caseTriangles[index]) {
-                        const auto side0 = positions[inds[tri[1]]] - positions[inds[tri[0]]];
-                        const auto side1 = positions[inds[tri[2]]] - positions[inds[tri[0]]];
-                        auto n = glm::cross(side0, side1);
-                        if (glm::length2(n) < err) {
-                            continue;  // triangle is so small area is 0.
+        const auto nSlabs = slabCount(dim1.z);
+        std::vector<Slab> slabs(nSlabs);
+
+        auto extractSlab = [&](size_t slabIndex) {
+            auto& slab = slabs[slabIndex];
+            const size_t z0 = slabIndex * dim1.z / nSlabs;
+            const size_t z1 = (slabIndex + 1) * dim1.z / nSlabs;
+            const bool recordFirst = slabIndex != 0;
+            const bool recordLast = slabIndex + 1 != nSlabs;
+
+            VCache vcache(size2_t{dim.x, dim.y}, z0);
+            Index<T, decltype(isoTest)> index(src, im, isoTest);
+            size3_t ind;
+            dvec3 pos;
+
+            for (ind.z = z0; ind.z < z1; ++ind.z) {
+                pos.z = static_cast<double>(ind.z) * dr.z;
+                vcache.incZ();
+                for (ind.y = 0, pos.y = 0.0; ind.y < dim1.y; ++ind.y, pos.y += dr.y) {
+                    ind.x = 0;
+                    const auto cInd = im(ind);
+                    vcache.incY();
+                    index.init(cInd);
+                    for (pos.x = 0.0; ind.x < dim1.x; ++ind.x, pos.x += dr.x) {
+                        index.update(cInd + ind.x);
+                        if (index == 0 || index == 255) continue;
+                        if (maskingCallback && !maskingCallback(ind)) continue;
+
+                        std::array<size_t, 12> inds;
+                        for (const auto edge : cube.caseEdges[index]) {
+                            const auto c = vcache.find(ind, edge, slab.positions.size());
+                            inds[edge] = c.first;
+                            if (c.second) {
+                                const auto vertex = interpolate(ind, pos, edge);
+                                slab.positions.emplace_back(vertex);
+                                slab.normals.emplace_back(0.0f, 0.0f, 0.0f);
+
+                                const auto vertexIndex = static_cast<std::uint32_t>(c.first);
+                                if (recordFirst && ind.z == z0 && edge < 4) {
+                                    slab.first.emplace_back(planeEdgeKey(ind, edge, dim.x),
+                                                            vertexIndex);
+                                } else if (recordLast && ind.z + 1 == z1 && edge >= 8) {
+                                    slab.last.emplace_back(planeEdgeKey(ind, edge, dim.x),
+                                                           vertexIndex);
+                                }
+                            }
                         }
-                        n = glm::normalize(n);
-                        for (int v = 0; v < 3; ++v) {
-                            indices.push_back(static_cast<uint32_t>(inds[tri[v]]));
-                            normals[inds[tri[v]]] += n;
+                        for (const auto& tri : cube.caseTriangles[index]) {
+                            const auto& p0 = slab.positions[inds[tri[0]]];
+                            const auto side0 = slab.positions[inds[tri[1]]] - p0;
+                            const auto side1 = slab.positions[inds[tri[2]]] - p0;
+                            auto n = glm::cross(side0, side1);
+                            if (glm::length2(n) < err) {
+                                continue;  // triangle is so small area is 0.
+                            }
+                            n = glm::normalize(n);
+                            for (int v = 0; v < 3; ++v) {
+                                slab.indices.push_back(static_cast<uint32_t>(inds[tri[v]]));
+                                slab.normals[inds[tri[v]]] += n;
+                            }
                         }
+                        vcache.incX(cube.caseIncrements[index]);
                     }
-                    vcache.incX(cube.caseIncrements[index]);
                 }
             }
-            if (progressCallback) {
-                progressCallback(static_cast<float>(ind.z + 1) / static_cast<float>(dim.z - 1));
+            std::ranges::sort(slab.last, {}, &Slab::KeyedVertex::first);
+        };
+
+        // Progress is only reported from the calling thread, which takes part in the work. It
+        // might not run the last slab, so the completion is reported after the loop.
+        const auto caller = std::this_thread::get_id();
+        std::atomic<size_t> slabsDone{0};
+        util::parallelFor(size_t{0}, nSlabs, [&](size_t slabIndex) {
+            extractSlab(slabIndex);
+            const auto done = ++slabsDone;
+            if (progressCallback && std::this_thread::get_id() == caller) {
+                progressCallback(static_cast<float>(done) / static_cast<float>(nSlabs));
             }
+        });
+        if (progressCallback) progressCallback(1.0f);
+
+        // Stitch the slabs together in order. Vertices on the first plane of a slab that were
+        // also generated by the previous slab are replaced by the previous slab's vertex.
+        std::vector<std::uint32_t> previousGlobal;
+        std::vector<std::uint32_t> global;
+        for (size_t i = 0; i < nSlabs; ++i) {
+            auto& slab = slabs[i];
+            global.assign(slab.positions.size(), std::numeric_limits<std::uint32_t>::max());
+
+            if (i != 0) {
+                const auto& last = slabs[i - 1].last;
+                for (const auto& [key, local] : slab.first) {
+                    const auto it = std::ranges::lower_bound(last, key, {},
+                                                             &Slab::KeyedVertex::first);
+                    if (it != last.end() && it->first == key) {
+                        global[local] = previousGlobal[it->second];
+                        normals[global[local]] += slab.normals[local];
+                    }
+                }
+            }
+            for (size_t local = 0; local < slab.positions.size(); ++local) {
+                if (global[local] != std::numeric_limits<std::uint32_t>::max()) continue;
+                global[local] = static_cast<std::uint32_t>(positions.size());
+                positions.push_back(slab.positions[local]);
+                normals.push_back(slab.normals[local]);
+            }
+            std::ranges::transform(slab.indices, std::back_inserter(indices),
+                                   [&](std::uint32_t local) { return global[local]; });
+
+            std::swap(previousGlobal, global);
+            // Keep the last plane of the previous slab for the next iteration only
+            if (i != 0) slabs[i - 1] = Slab{};
         }
 
         if (enclose) {
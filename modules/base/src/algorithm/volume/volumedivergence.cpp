@@ -40,9 +40,8 @@
 #include <inviwo/core/util/formatdispatching.h>                         // for PrecisionValueType
 #include <inviwo/core/util/glmutils.h>                                  // for Vector
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t, dvec2
-#include <inviwo/core/util/indexmapper.h>                               // for IndexMapper, Inde...
-#include <inviwo/core/util/templatesampler.h>                           // for TemplateVolumeSam...
-#include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxel
+#include <inviwo/core/util/glmmat.h>                                    // for mat3
+#include <modules/base/algorithm/volume/volumestencil.h>                // for forEachVoxelStencil
 
 #include <stdlib.h>       // for abs
 #include <algorithm>      // for max, min
@@ -51,9 +50,11 @@
 #include <limits>         // for numeric_limits
 #include <string>         // for string
 #include <type_traits>    // for conditional_t
+#include <utility>        // for pair
 #include <unordered_set>  // for unordered_set
 
 #include <glm/common.hpp>  // for mix
+#include <glm/mat3x3.hpp>  // for operator*, mat
 #include <glm/mat4x4.hpp>  // for operator*, mat
 #include <glm/vec3.hpp>    // for operator/, operator*
 #include <glm/vec4.hpp>    // for operator*, operator+
@@ -70,54 +71,37 @@ std::unique_ptr<Volume> divergenceVolume(const Volume& volume) {
     auto newVolumeRep = std::make_shared<VolumeRAMPrecision<float>>(volume.getDimensions());
     newVolume->addRepresentation(newVolumeRep);
 
-    const auto m = newVolume->getCoordinateTransformer().getDataToWorldMatrix();
-
-    const auto a = m * vec4(0, 0, 0, 1);
-    const auto b = m * vec4(1.0f / vec3(volume.getDimensions() - size3_t(1)), 1);
-    const auto spacing = b - a;
-
-    const vec3 ox(spacing.x, 0, 0);
-    const vec3 oy(0, spacing.y, 0);
-    const vec3 oz(0, 0, spacing.z);
+    // Maps derivatives along the index axes to world space derivatives
+    const mat3 indexToWorld{newVolume->getCoordinateTransformer().getIndexToWorldMatrix()};
+    const mat3 worldToIndex = glm::inverse(indexToWorld);
 
     volume.getRepresentation<VolumeRAM>()->dispatch<void, dispatching::filter::Vec3s>(
-        [&](auto vol) {
-            using DataType = util::PrecisionValueType<decltype(vol)>;
-            using ComponentType = util::value_type_t<DataType>;
-            using SampleType =
-                typename std::conditional_t<std::is_same<float, ComponentType>::value, vec3, dvec3>;
-            using Sampler = TemplateVolumeSampler<SampleType, DataType>;
-            ;
-
-            util::IndexMapper3D index(volume.getDimensions());
-            auto data = newVolumeRep->getDataTyped();
-            float minV = std::numeric_limits<float>::max();
-            float maxV = std::numeric_limits<float>::lowest();
-
-            const Sampler sampler{volume, CoordinateSpace::World};
-
-            util::forEachVoxel(*vol, [&](const size3_t& pos) {
-                const vec3 world{m *
-                                 vec4(vec3(pos) / vec3(volume.getDimensions() - size3_t(1)), 1)};
+        [&]<typename T>(const VolumeRAMPrecision<T>* vol) {
+            using Range = std::pair<float, float>;
+            const Range init{std::numeric_limits<float>::max(),
+                             std::numeric_limits<float>::lowest()};
 
-                const auto Fxp = static_cast<vec3>(sampler.sample(world + ox));
-                const auto Fxm = static_cast<vec3>(sampler.sample(world - ox));
-                const auto Fyp = static_cast<vec3>(sampler.sample(world + oy));
-                const auto Fym = static_cast<vec3>(sampler.sample(world - oy));
-                const auto Fzp = static_cast<vec3>(sampler.sample(world + oz));
-                const auto Fzm = static_cast<vec3>(sampler.sample(world - oz));
-
-                const vec3 Fx = (Fxp - Fxm) / (2.0f * spacing.x);
-                const vec3 Fy = (Fyp - Fym) / (2.0f * spacing.y);
-                const vec3 Fz = (Fzp - Fzm) / (2.0f * spacing.z);
-
-                const float d = Fx.x + Fy.y + Fz.z;
-
-                minV = std::min(minV, d);
-                maxV = std::max(maxV, d);
-
-                data[index(pos)] = d;
-            });
+            auto data = newVolumeRep->getDataTyped();
+            const auto results = util::forEachVoxelStencil(
+                *vol, init, [&](Range& range, size_t index, const VoxelStencil<T>& s) {
+                    // Columns are the derivatives of the field along the world axes
+                    const mat3 D = mat3{vec3(s.difference(0)), vec3(s.difference(1)),
+                                        vec3(s.difference(2))} *
+                                   worldToIndex;
+
+                    const float d = D[0].x + D[1].y + D[2].z;
+
+                    range.first = std::min(range.first, d);
+                    range.second = std::max(range.second, d);
+
+                    data[index] = d;
+                });
+
+            auto [minV, maxV] = init;
+            for (const auto& [tileMin, tileMax] : results) {
+                minV = std::min(minV, tileMin);
+                maxV = std::max(maxV, tileMax);
+            }
 
             auto range = std::max(std::abs(minV), std::abs(maxV));
             newVolume->dataMap.dataRange = dvec2(-range, range);
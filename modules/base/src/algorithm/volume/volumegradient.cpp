@@ -37,13 +37,14 @@
 #include <inviwo/core/datastructures/unitsystem.h>                      // for Axis, Unit
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAMPrecision
+#include <inviwo/core/util/exception.h>                                 // for Exception
+#include <inviwo/core/util/glmcomp.h>                                   // for glmcomp
+#include <inviwo/core/util/glmmat.h>                                    // for mat3
 #include <inviwo/core/util/glmutils.h>                                  // for Vector
 #include <inviwo/core/util/glmvec.h>                                    // for vec3, size3_t, dvec2
-#include <inviwo/core/util/indexmapper.h>                               // for IndexMapper3D
-#include <inviwo/core/util/spatialsampler.h>                            // for SpatialSampler<>:...
-#include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxelParallel
-#include <inviwo/core/util/volumesampler.h>                             // for VolumeDoubleSampler
+#include <modules/base/algorithm/volume/volumestencil.h>                // for forEachVoxelStencil
 
+#include <algorithm>      // for max, max_element
 #include <array>          // for array
 #include <functional>     // for __base
 #include <limits>         // for numeric_limits
@@ -54,6 +55,7 @@
 
 #include <glm/common.hpp>              // for mix, max, abs
 #include <glm/gtx/component_wise.hpp>  // for compMax
+#include <glm/mat3x3.hpp>              // for operator*, mat
 #include <glm/mat4x4.hpp>              // for operator*, mat
 #include <glm/vec3.hpp>                // for operator-, operator/
 #include <glm/vec4.hpp>                // for operator*, operator+
@@ -71,37 +73,32 @@ std::shared_ptr<Volume> gradientVolume(std::shared_ptr<const Volume> volume, int
     auto newVolumeRep = std::make_shared<VolumeRAMPrecision<vec3>>(volume->getDimensions());
     newVolume->addRepresentation(newVolumeRep);
 
-    auto m = newVolume->getCoordinateTransformer().getDataToWorldMatrix();
+    // Maps gradients along the index axes to world space gradients
+    const mat3 indexToWorld{newVolume->getCoordinateTransformer().getIndexToWorldMatrix()};
+    const mat3 toWorld = glm::transpose(glm::inverse(indexToWorld));
 
-    const auto a = m * vec4(0, 0, 0, 1);
-    const auto b = m * vec4(1.0f / vec3(volume->getDimensions() - size3_t(1)), 1);
-    const auto spacing = b - a;
-
-    const vec3 ox(spacing.x, 0, 0);
-    const vec3 oy(0, spacing.y, 0);
-    const vec3 oz(0, 0, spacing.z);
-
-    VolumeSampler sampler{volume, CoordinateSpace::World};
-
-    util::IndexMapper3D index(volume->getDimensions());
     auto data = newVolumeRep->getDataTyped();
-
-    const dvec3 spacing2 = spacing * 2.0;
-    float max = std::numeric_limits<float>::lowest();
-    auto func = [&](const size3_t& pos) {
-        const vec3 world{m * vec4(vec3(pos) / vec3(volume->getDimensions() - size3_t(1)), 1)};
-
-        const auto g = static_cast<vec3>(
-            dvec3{(sampler.sample(world + ox) - sampler.sample(world - ox))[channel],
-                  (sampler.sample(world + oy) - sampler.sample(world - oy))[channel],
-                  (sampler.sample(world + oz) - sampler.sample(world - oz))[channel]} /
-            spacing2);
-
-        data[index(pos)] = g;
-        max = glm::max(max, glm::compMax(glm::abs(g)));
-    };
-
-    util::forEachVoxelParallel(*volume->getRepresentation<VolumeRAM>(), func);
+    const auto c = static_cast<size_t>(channel);
+
+    const auto max = volume->getRepresentation<VolumeRAM>()->dispatch<float>(
+        [&]<typename T>(const VolumeRAMPrecision<T>* vr) {
+            if (c >= util::extent_v<T>) {
+                throw Exception(SourceContext{},
+                                "Channel {} out of range for a volume with {} channels", channel,
+                                util::extent_v<T>);
+            }
+            const auto results = util::forEachVoxelStencil(
+                *vr, 0.0f, [&](float& tileMax, size_t index, const VoxelStencil<T>& s) {
+                    const auto dx = s.difference(0);
+                    const auto dy = s.difference(1);
+                    const auto dz = s.difference(2);
+                    const vec3 g = toWorld * vec3(util::glmcomp(dx, c), util::glmcomp(dy, c),
+                                                  util::glmcomp(dz, c));
+                    data[index] = g;
+                    tileMax = std::max(tileMax, glm::compMax(glm::abs(g)));
+                });
+            return results.empty() ? 0.0f : *std::max_element(results.begin(), results.end());
+        });
 
     newVolume->dataMap.dataRange = dvec2(-max, max);
     newVolume->dataMap.valueRange = dvec2(-max, max);
@@ -43,8 +43,8 @@
 #include <inviwo/core/util/glmutils.h>                                  // for same_extent
 #include <inviwo/core/util/glmvec.h>                                    // for dvec3, dvec2, siz...
 #include <inviwo/core/util/indexmapper.h>                               // for IndexMapper3D
-#include <inviwo/core/util/templatesampler.h>                           // for TemplateVolumeSam...
 #include <inviwo/core/util/volumeramutils.h>                            // for forEachVoxelParallel
+#include <modules/base/algorithm/volume/volumestencil.h>                // for forEachVoxelStencil
 
 #include <functional>     // for __base
 #include <unordered_map>  // for unordered_map
@@ -56,8 +56,10 @@
 #include <memory>         // for shared_ptr, share...
 #include <type_traits>    // for remove_extent_t
 #include <unordered_set>  // for unordered_set
+#include <utility>        // for pair
 
-#include <glm/gtx/matrix_operation.hpp>  // for diagonal3x3
+#include <glm/geometric.hpp>              // for dot
+#include <glm/gtx/component_wise.hpp>    // for compMin, compMax
 #include <glm/mat3x3.hpp>                // for mat
 #include <glm/mat4x4.hpp>                // for operator*, mat
 #include <glm/vec3.hpp>                  // for operator-, operator+
@@ -92,50 +94,42 @@ std::shared_ptr<Volume> util::volumeLaplacian(std::shared_ptr<const Volume> volu
             newVolume->dataMap.valueAxis.unit =
                 volume->dataMap.valueAxis.unit / volume->axes[0].unit / volume->axes[0].unit;
 
-            const dmat4 m{volume->getCoordinateTransformer().getDataToWorldMatrix()};
-            const auto a = m * dvec4(0, 0, 0, 1);
-            const auto b = m * dvec4(dvec3(1.0) / dvec3(volume->getDimensions() - size3_t(1)), 1);
-            const auto spacing = dvec3(b - a);
-
-            const auto o = glm::diagonal3x3(spacing);
-
-            using Sampler = TemplateVolumeSampler<SampleType, DataType>;
-            const Sampler s(volume, CoordinateSpace::World);
-
-            const util::IndexMapper3D index{volume->getDimensions()};
-
-            const auto resDim = dvec3(1.0) / dvec3(volume->getDimensions() - size3_t(1));
-            const auto resSpace2 = dvec3(1.0) / (spacing * spacing);
-
-            auto minval(std::numeric_limits<double>::max());
-            auto maxval(std::numeric_limits<double>::lowest());
-
-            auto newData = dstRAM->getView();
-            auto func = [&](const size3_t& pos) {
-                const dvec3 world{m * dvec4((dvec3(pos) + dvec3(0.5)) * resDim, 1.0)};
-
-                const auto center = 2.0 * s.sample(world);
-                const auto D2x =
-                    (s.sample(world + o[0]) + center - s.sample(world - o[0])) * resSpace2.x;
-                const auto D2y =
-                    (s.sample(world + o[1]) + center - s.sample(world - o[1])) * resSpace2.y;
-                const auto D2z =
-                    (s.sample(world + o[2]) + center - s.sample(world - o[2])) * resSpace2.z;
-                const auto laplacian = center + D2x + D2y + D2z;
-
-                if constexpr (1 < util::extent_v<DataType>) {
-                    minval = glm::min(minval, glm::compMin(laplacian));
-                    maxval = glm::max(maxval, glm::compMax(laplacian));
-                } else {
-                    minval = glm::min(minval, laplacian);
-                    maxval = glm::max(maxval, laplacian);
-                }
-
-                newData[index(pos)] = static_cast<DstType>(laplacian);
-            };
-
-            util::forEachVoxelParallel(dims, func);
+            // Squared world space distance between neighboring voxels along each index axis,
+            // assumes orthogonal axes
+            const dmat3 indexToWorld{volume->getCoordinateTransformer().getIndexToWorldMatrix()};
+            const dvec3 resSpace2{1.0 / glm::dot(indexToWorld[0], indexToWorld[0]),
+                                  1.0 / glm::dot(indexToWorld[1], indexToWorld[1]),
+                                  1.0 / glm::dot(indexToWorld[2], indexToWorld[2])};
+
+            using Range = std::pair<double, double>;
+            const Range init{std::numeric_limits<double>::max(),
+                             std::numeric_limits<double>::lowest()};
+
+            auto newData = dstRAM->getDataTyped();
+            const auto results = util::forEachVoxelStencil(
+                *srcRAM, init, [&](Range& range, size_t index, const VoxelStencil<DataType>& s) {
+                    const auto laplacian = SampleType{s.secondDifference(0)} * resSpace2.x +
+                                           SampleType{s.secondDifference(1)} * resSpace2.y +
+                                           SampleType{s.secondDifference(2)} * resSpace2.z;
+
+                    if constexpr (1 < util::extent_v<DataType>) {
+                        range.first = std::min(range.first, glm::compMin(laplacian));
+                        range.second = std::max(range.second, glm::compMax(laplacian));
+                    } else {
+                        range.first = std::min(range.first, laplacian);
+                        range.second = std::max(range.second, laplacian);
+                    }
+
+                    newData[index] = static_cast<DstType>(laplacian);
+                });
+
+            auto [minval, maxval] = init;
+            for (const auto& [tileMin, tileMax] : results) {
+                minval = std::min(minval, tileMin);
+                maxval = std::max(maxval, tileMax);
+            }
 
+            const util::IndexMapper3D index{dims};
             // Make range symmetric
             auto rangeMax = std::max(std::abs(minval), std::abs(maxval));
 
@@ -34,6 +34,7 @@
 #include <inviwo/core/util/glmutils.h>                    // for same_extent
 #include <inviwo/core/util/glmvec.h>                      // for size3_t
 #include <inviwo/core/util/indexmapper.h>                 // for IndexMapper, IndexMapper3D
+#include <inviwo/core/util/parallel.h>                    // for parallelFor
 
 #include <cstddef>  // for size_t
 
@@ -41,10 +42,6 @@
 #include <glm/vec3.hpp>  // for operator*, vec<>::(anonymous)
 #include <glm/vec4.hpp>  // for operator*
 
-#ifdef IVW_USE_OPENMP
-#include <omp.h>
-#endif
-
 namespace inviwo::util {
 
 std::shared_ptr<VolumeRAM> volumeDownsample(const VolumeRAM* volume, size3_t strides,
@@ -76,21 +73,9 @@ std::shared_ptr<VolumeRAM> volumeStridedDownsample(const VolumeRAM* volume, size
             const util::IndexMapper3D sourceMapper(srcDims);
             const util::IndexMapper3D destMapper(destDims);
 
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-            for (long long z_ = 0; z_ < static_cast<long long>(destDims.z); ++z_) {
-                const auto z = static_cast<size_t>(z_);  // OpenMP requires signed integral type
-                for (size_t y = 0; y < destDims.y; ++y) {
-                    for (size_t x = 0; x < destDims.x; ++x) {
-                        const size_t px{x * strides.x};
-                        const size_t py{y * strides.y};
-                        const size_t pz{z * strides.z};
-
-                        dst[destMapper(x, y, z)] = src[sourceMapper(px, py, pz)];
-                    }
-                }
-            }
+            util::parallelFor(destDims, [&](const size3_t& pos) {
+                dst[destMapper(pos)] = src[sourceMapper(pos * strides)];
+            });
             return destVol;
         });
 }
@@ -116,31 +101,20 @@ std::shared_ptr<VolumeRAM> volumeAveragedDownsample(const VolumeRAM* volume, siz
             const util::IndexMapper3D destMapper(destDims);
             const double samplesInv = 1.0 / static_cast<double>(glm::compMul(strides));
 
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-            for (long long z_ = 0; z_ < static_cast<long long>(destDims.z); ++z_) {
-                const auto z = static_cast<size_t>(z_);  // OpenMP requires signed integral type
-                for (size_t y = 0; y < destDims.y; ++y) {
-                    for (size_t x = 0; x < destDims.x; ++x) {
-                        const size_t px{x * strides.x};
-                        const size_t py{y * strides.y};
-                        const size_t pz{z * strides.z};
-                        P val{0.0};
-
-                        for (size_t oz = 0; oz < strides.z; ++oz) {
-                            for (size_t oy = 0; oy < strides.y; ++oy) {
-                                for (size_t ox = 0; ox < strides.x; ++ox) {
-                                    val += static_cast<P>(
-                                        src[sourceMapper(px + ox, py + oy, pz + oz)]);
-                                }
-                            }
-                        }
+            util::parallelFor(destDims, [&](const size3_t& pos) {
+                const size3_t p{pos * strides};
+                P val{0.0};
 
-                        dst[destMapper(x, y, z)] = static_cast<ValueType>(val * samplesInv);
+                for (size_t oz = 0; oz < strides.z; ++oz) {
+                    for (size_t oy = 0; oy < strides.y; ++oy) {
+                        for (size_t ox = 0; ox < strides.x; ++ox) {
+                            val += static_cast<P>(src[sourceMapper(p.x + ox, p.y + oy, p.z + oz)]);
+                        }
                     }
                 }
-            }
+
+                dst[destMapper(pos)] = static_cast<ValueType>(val * samplesInv);
+            });
 
             return destVol;
         });
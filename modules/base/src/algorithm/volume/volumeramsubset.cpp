@@ -34,17 +34,14 @@
 #include <inviwo/core/datastructures/volume/volumerepresentation.h>  // for VolumeRepresentation
 #include <inviwo/core/util/formatdispatching.h>                      // for dispatch, All
 #include <inviwo/core/util/formats.h>                                // for DataFormatBase
-#include <inviwo/core/util/glmvec.h>                                 // for size3_t, ivec3
+#include <inviwo/core/util/glmvec.h>                                 // for size3_t, ivec3, size2_t
+#include <inviwo/core/util/parallel.h>                               // for parallelFor
 
 #include <cstring>  // for size_t, memcpy
 
 #include <glm/common.hpp>  // for max, min
 #include <glm/vec3.hpp>    // for operator-, operator+
 
-#ifdef IVW_USE_OPENMP
-#include <omp.h>
-#endif
-
 namespace inviwo {
 
 namespace {
@@ -110,19 +107,16 @@ constexpr auto dispatcher = []<typename T>(
     const T* src = static_cast<const T*>(volume->getData());
     T* dst = static_cast<T*>(newVolume->getData());
     // memcpy each row for every slice to form sub volume
-
-    for (int i = 0; i < static_cast<int>(copyDimsWithoutBorder.z); i++) {
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-        for (int j = 0; j < static_cast<int>(copyDimsWithoutBorder.y); j++) {
-            size_t volumePos = (j * dataDims.x) + (i * dataDims.x * dataDims.y);
-            size_t subVolumePos = ((j + trueBorder.llf.y) * dimsWithBorder.x) +
-                                  ((i + trueBorder.llf.z) * dimsWithBorder.x * dimsWithBorder.y) +
-                                  trueBorder.llf.x;
-            std::memcpy(dst + subVolumePos, (src + volumePos + initialStartPos), dataSize);
-        }
-    }
+    const size2_t rows{copyDimsWithoutBorder.y, copyDimsWithoutBorder.z};
+    util::parallelFor(rows, [&](const size2_t& row) {
+        const size_t j = row.x;
+        const size_t i = row.y;
+        size_t volumePos = (j * dataDims.x) + (i * dataDims.x * dataDims.y);
+        size_t subVolumePos = ((j + trueBorder.llf.y) * dimsWithBorder.x) +
+                              ((i + trueBorder.llf.z) * dimsWithBorder.x * dimsWithBorder.y) +
+                              trueBorder.llf.x;
+        std::memcpy(dst + subVolumePos, (src + volumePos + initialStartPos), dataSize);
+    });
 
     return newVolume;
 };
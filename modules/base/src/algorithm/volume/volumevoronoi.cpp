@@ -37,22 +37,27 @@
 #include <inviwo/core/util/glmmat.h>                      // for mat4
 #include <inviwo/core/util/glmvec.h>                      // for vec3, size3_t, vec4, dvec2
 #include <inviwo/core/util/indexmapper.h>                 // for IndexMapper, IndexMapper3D
+#include <inviwo/core/util/threadutil.h>                  // for parallelFor
 #include <inviwo/core/util/volumeramutils.h>              // for forEachVoxelParallel
 #include <inviwo/core/util/zip.h>                         // for zip, zipper
 
 #include <algorithm>    // for max_element, min_element
 #include <array>        // for array<>::value_type, array
+#include <cmath>        // for abs, acos, cos, sqrt
 #include <cstddef>      // for size_t
 #include <functional>   // for __base
+#include <limits>       // for numeric_limits
+#include <numeric>      // for iota
 #include <string>       // for string
 #include <string_view>  // for string_view
 #include <type_traits>  // for remove_extent_t, integral_constant
 
-#include <glm/geometric.hpp>  // for dot
-#include <glm/gtx/norm.hpp>   // for length2
-#include <glm/mat4x4.hpp>     // for operator*
-#include <glm/vec3.hpp>       // for operator-, operator*
-#include <glm/vec4.hpp>       // for operator*, operator+
+#include <glm/geometric.hpp>           // for dot
+#include <glm/gtx/component_wise.hpp>  // for compMul, compMax
+#include <glm/gtx/norm.hpp>            // for length2
+#include <glm/mat4x4.hpp>              // for operator*
+#include <glm/vec3.hpp>                // for operator-, operator*
+#include <glm/vec4.hpp>                // for operator*, operator+
 
 namespace inviwo {
 namespace util {
@@ -80,6 +85,92 @@ auto distance2(const vec3& a, const vec3& b, const mat3& dataToModelMatrix) {
     return glm::length2(dataToModelMatrix * delta);
 }
 
+/**
+ * Lower and upper bound of the magnitude of the delta along one axis, as corrected by distance2,
+ * for all raw deltas in [a, b].
+ */
+template <Wrapping W>
+dvec2 deltaBounds(double a, double b) {
+    const auto contains = [&](double v) { return a <= v && v <= b; };
+    if constexpr (W == Wrapping::Repeat) {
+        // |wrap(d)| is piecewise linear with zeros at -1, 0, 1 and breaks at -0.5 and 0.5
+        const auto wrap = [](double d) {
+            if (d > 0.5) return d - 1.0;
+            if (d < -0.5) return d + 1.0;
+            return d;
+        };
+        double lo = std::min(std::abs(wrap(a)), std::abs(wrap(b)));
+        double hi = std::max(std::abs(wrap(a)), std::abs(wrap(b)));
+        if (contains(-0.5) || contains(0.5)) {
+            lo = std::min(lo, 0.5);
+            hi = std::max(hi, 0.5);
+        }
+        if (contains(-1.0) || contains(0.0) || contains(1.0)) lo = 0.0;
+        return {lo, hi};
+    } else {
+        const double lo = contains(0.0) ? 0.0 : std::min(std::abs(a), std::abs(b));
+        return {lo, std::max(std::abs(a), std::abs(b))};
+    }
+}
+
+/**
+ * Bounds of the squared model space distance, as computed by distance2, between a seed point and
+ * any point within a box in data space. The deltas are scaled by the lengths of the columns of the
+ * data to model matrix, and the remaining rotation and shear is bounded by its smallest and
+ * largest singular values.
+ */
+class DistanceBounds {
+public:
+    explicit DistanceBounds(const mat3& dataToModelMatrix) {
+        const dmat3 m{dataToModelMatrix};
+        for (glm::length_t i = 0; i < 3; ++i) {
+            scale_[i] = glm::length(m[i]);
+        }
+        if (glm::compMin(scale_) <= 0.0) return;
+
+        // Eigenvalues of the symmetric matrix a = n^T n, with n the normalized matrix
+        dmat3 a{1.0};
+        for (glm::length_t i = 0; i < 3; ++i) {
+            for (glm::length_t j = i + 1; j < 3; ++j) {
+                a[i][j] = a[j][i] = glm::dot(m[i], m[j]) / (scale_[i] * scale_[j]);
+            }
+        }
+        const auto p1 = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+        if (p1 == 0.0) {
+            eigen_ = dvec2{1.0};
+        } else {
+            const auto p = std::sqrt(2.0 * p1 / 6.0);
+            const auto r = std::clamp(glm::determinant((a - dmat3{1.0}) / p) / 2.0, -1.0, 1.0);
+            const auto phi = std::acos(r) / 3.0;
+            constexpr auto third = 2.0 * 3.14159265358979323846 / 3.0;
+            eigen_ = dvec2{1.0 + 2.0 * p * std::cos(phi + third), 1.0 + 2.0 * p * std::cos(phi)};
+        }
+        // Be conservative with the rounding errors of the eigenvalues
+        eigen_ *= dvec2{1.0 - 1e-9, 1.0 + 1e-9};
+        valid_ = eigen_.x > 1e-12;
+    }
+
+    bool valid() const { return valid_; }
+
+    template <Wrapping X, Wrapping Y, Wrapping Z>
+    dvec2 range(const dvec3& seed, const dvec3& boxMin, const dvec3& boxMax) const {
+        const std::array<dvec2, 3> deltas{deltaBounds<X>(boxMin.x - seed.x, boxMax.x - seed.x),
+                                          deltaBounds<Y>(boxMin.y - seed.y, boxMax.y - seed.y),
+                                          deltaBounds<Z>(boxMin.z - seed.z, boxMax.z - seed.z)};
+        dvec2 result{0.0};
+        for (glm::length_t i = 0; i < 3; ++i) {
+            const auto scaled = deltas[i] * scale_[i];
+            result += scaled * scaled;
+        }
+        return result * eigen_;
+    }
+
+private:
+    dvec3 scale_{0.0};
+    dvec2 eigen_{0.0};
+    bool valid_ = false;
+};
+
 template <typename Index, typename Functor, Index... Is>
 constexpr auto build_array_impl(Functor&& func, std::integer_sequence<Index, Is...>) noexcept {
     return std::array{func(std::integral_constant<Index, Is>{})...};
@@ -144,10 +235,151 @@ void weightedVoronoiSegmentationImpl(
     });
 }
 
+/**
+ * Hierarchical version of the brute force implementations above. The volume is recursively split
+ * into blocks, and for each block the seed points that can not be the closest one for any voxel
+ * in it are culled, using bounds on the (power) distance between the seed and the block. Culling
+ * is conservative, and the remaining seeds are compared in their original order with the same
+ * expressions as above, hence the result matches the brute force one exactly.
+ */
+template <Wrapping X, Wrapping Y, Wrapping Z>
+void hierarchicalVoronoiSegmentationImpl(
+    const size3_t volumeDimensions, const mat4& indexToDataMatrix, const mat4& dataToModelMatrix,
+    const std::vector<std::pair<unsigned short, vec3>>& seedPointsWithIndices,
+    const std::vector<float>* weights, VolumeRAMPrecision<unsigned short>& voronoiVolumeRep) {
+
+    // We can ignore any translations
+    const auto d2m = mat3{dataToModelMatrix};
+    const detail::DistanceBounds bounds{d2m};
+    if (!bounds.valid()) {
+        if (weights) {
+            weightedVoronoiSegmentationImpl<X, Y, Z>(volumeDimensions, indexToDataMatrix,
+                                                     dataToModelMatrix, seedPointsWithIndices,
+                                                     *weights, voronoiVolumeRep);
+        } else {
+            voronoiSegmentationImpl<X, Y, Z>(volumeDimensions, indexToDataMatrix,
+                                             dataToModelMatrix, seedPointsWithIndices,
+                                             voronoiVolumeRep);
+        }
+        return;
+    }
+
+    auto volumeIndices = voronoiVolumeRep.getDataTyped();
+    util::IndexMapper3D index(volumeDimensions);
+    const dmat4 i2d{indexToDataMatrix};
+
+    const auto less = [&](uint32_t s1, uint32_t s2, const vec3& dataVoxelPos) {
+        const auto& p1 = seedPointsWithIndices[s1].second;
+        const auto& p2 = seedPointsWithIndices[s2].second;
+        if (weights) {
+            const auto w1 = (*weights)[s1];
+            const auto w2 = (*weights)[s2];
+            return detail::distance2<X, Y, Z>(p1, dataVoxelPos, d2m) - w1 * w1 <
+                   detail::distance2<X, Y, Z>(p2, dataVoxelPos, d2m) - w2 * w2;
+        } else {
+            return detail::distance2<X, Y, Z>(p1, dataVoxelPos, d2m) <
+                   detail::distance2<X, Y, Z>(p2, dataVoxelPos, d2m);
+        }
+    };
+
+    double maxWeight2 = 0.0;
+    if (weights) {
+        for (const auto w : *weights) maxWeight2 = std::max(maxWeight2, double{w} * double{w});
+    }
+
+    struct Block {
+        size3_t begin;
+        size3_t end;
+    };
+    constexpr size_t leafSize = 64;
+    constexpr size_t parallelSize = 32 * 32 * 32;
+
+    const auto segment = [&](const Block& block, const std::vector<uint32_t>& candidates,
+                             const auto& self) -> void {
+        // Data space bounds of the voxel centers, padded to cover rounding in the float positions
+        dvec3 boxMin{std::numeric_limits<double>::max()};
+        dvec3 boxMax{std::numeric_limits<double>::lowest()};
+        for (size_t corner = 0; corner < 8; ++corner) {
+            const dvec3 voxel{(corner & 1) ? block.end.x - 1 : block.begin.x,
+                              (corner & 2) ? block.end.y - 1 : block.begin.y,
+                              (corner & 4) ? block.end.z - 1 : block.begin.z};
+            const auto pos = dvec3{i2d * dvec4{voxel, 1.0}};
+            boxMin = glm::min(boxMin, pos);
+            boxMax = glm::max(boxMax, pos);
+        }
+        const auto pad = 1e-5 * (1.0 + glm::compMax(glm::max(glm::abs(boxMin), glm::abs(boxMax))));
+        boxMin -= pad;
+        boxMax += pad;
+
+        std::vector<dvec2> ranges(candidates.size());
+        double upper = std::numeric_limits<double>::max();
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            const auto seed = candidates[i];
+            ranges[i] =
+                bounds.range<X, Y, Z>(dvec3{seedPointsWithIndices[seed].second}, boxMin, boxMax);
+            if (weights) {
+                const auto w = double{(*weights)[seed]};
+                ranges[i] -= w * w;
+            }
+            upper = std::min(upper, ranges[i].y);
+        }
+        const auto tolerance = 1e-4 * (std::abs(upper) + maxWeight2) + 1e-12;
+
+        std::vector<uint32_t> remaining;
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            if (ranges[i].x <= upper + tolerance) remaining.push_back(candidates[i]);
+        }
+
+        const auto dims = block.end - block.begin;
+        if (remaining.size() == 1 || glm::compMul(dims) <= leafSize) {
+            for (size_t z = block.begin.z; z < block.end.z; ++z) {
+                for (size_t y = block.begin.y; y < block.end.y; ++y) {
+                    for (size_t x = block.begin.x; x < block.end.x; ++x) {
+                        const size3_t voxelPos{x, y, z};
+                        const auto dataVoxelPos = vec3{indexToDataMatrix * vec4{voxelPos, 1.0f}};
+                        const auto it = std::min_element(
+                            remaining.begin(), remaining.end(),
+                            [&](uint32_t s1, uint32_t s2) { return less(s1, s2, dataVoxelPos); });
+                        volumeIndices[index(voxelPos)] = seedPointsWithIndices[*it].first;
+                    }
+                }
+            }
+            return;
+        }
+
+        // Split each axis that is more than one voxel wide in half
+        const auto mid = block.begin + (dims + size3_t{1}) / size3_t{2};
+        std::vector<Block> children;
+        for (size_t corner = 0; corner < 8; ++corner) {
+            Block child{block.begin, mid};
+            for (glm::length_t i = 0; i < 3; ++i) {
+                if (corner & (size_t{1} << i)) {
+                    child.begin[i] = mid[i];
+                    child.end[i] = block.end[i];
+                }
+            }
+            if (glm::all(glm::lessThan(child.begin, child.end))) children.push_back(child);
+        }
+
+        if (glm::compMul(dims) > parallelSize) {
+            util::parallelFor(children.size(),
+                              [&](size_t i) { self(children[i], remaining, self); });
+        } else {
+            for (const auto& child : children) self(child, remaining, self);
+        }
+    };
+
+    if (glm::compMul(volumeDimensions) == 0) return;
+
+    std::vector<uint32_t> seeds(seedPointsWithIndices.size());
+    std::iota(seeds.begin(), seeds.end(), uint32_t{0});
+    segment(Block{size3_t{0}, volumeDimensions}, seeds, segment);
+}
+
 std::shared_ptr<Volume> voronoiSegmentation(
     const size3_t volumeDimensions, const mat4& indexToDataMatrix, const mat4& dataToModelMatrix,
     const std::vector<std::pair<uint32_t, vec3>>& seedPointsWithIndices, const Wrapping3D& wrapping,
-    const std::optional<std::vector<float>>& weights) {
+    const std::optional<std::vector<float>>& weights, VoronoiMethod method) {
 
     if (seedPointsWithIndices.size() == 0) {
         throw Exception("No seed points, cannot create volume voronoi segmentation");
@@ -197,7 +429,8 @@ std::shared_ptr<Volume> voronoiSegmentation(
     if (weights.has_value()) {
         using Functor = void (*)(const size3_t, const mat4&, const mat4&,
                                  const std::vector<std::pair<unsigned short, vec3>>&,
-                                 const std::vector<float>&, VolumeRAMPrecision<unsigned short>&);
+                                 const std::vector<float>&, VolumeRAMPrecision<unsigned short>&,
+                                 VoronoiMethod);
 
         constexpr auto table = detail::build_array<3>([&](auto x) constexpr {
             return detail::build_array<3>([&](auto y) constexpr {
@@ -205,14 +438,19 @@ std::shared_ptr<Volume> voronoiSegmentation(
                     return [](const size3_t dim, const mat4& i2d, const mat4& d2m,
                               const std::vector<std::pair<unsigned short, vec3>>& sp,
                               const std::vector<float>& w,
-                              VolumeRAMPrecision<unsigned short>& volRep) {
+                              VolumeRAMPrecision<unsigned short>& volRep, VoronoiMethod m) {
                         using XT = decltype(x);
                         using YT = decltype(y);
                         using ZT = decltype(z);
                         constexpr auto X = static_cast<Wrapping>(XT::value);
                         constexpr auto Y = static_cast<Wrapping>(YT::value);
                         constexpr auto Z = static_cast<Wrapping>(ZT::value);
-                        weightedVoronoiSegmentationImpl<X, Y, Z>(dim, i2d, d2m, sp, w, volRep);
+                        if (m == VoronoiMethod::BruteForce) {
+                            weightedVoronoiSegmentationImpl<X, Y, Z>(dim, i2d, d2m, sp, w, volRep);
+                        } else {
+                            hierarchicalVoronoiSegmentationImpl<X, Y, Z>(dim, i2d, d2m, sp, &w,
+                                                                         volRep);
+                        }
                     };
                 });
             });
@@ -221,26 +459,31 @@ std::shared_ptr<Volume> voronoiSegmentation(
         table[static_cast<size_t>(wrapping[0])][static_cast<size_t>(wrapping[1])]
              [static_cast<size_t>(wrapping[2])](volumeDimensions, indexToDataMatrix,
                                                 dataToModelMatrix, dataSeedPointsWithIndices,
-                                                *weights, *voronoiVolumeRep);
+                                                *weights, *voronoiVolumeRep, method);
 
     } else {
         using Functor = void (*)(const size3_t, const mat4&, const mat4&,
                                  const std::vector<std::pair<unsigned short, vec3>>&,
-                                 VolumeRAMPrecision<unsigned short>&);
+                                 VolumeRAMPrecision<unsigned short>&, VoronoiMethod);
 
         constexpr auto table = detail::build_array<3>([&](auto x) constexpr {
             return detail::build_array<3>([&](auto y) constexpr {
                 return detail::build_array<3>([&](auto z) constexpr -> Functor {
                     return [](const size3_t dim, const mat4& i2d, const mat4& d2m,
                               const std::vector<std::pair<unsigned short, vec3>>& sp,
-                              VolumeRAMPrecision<unsigned short>& volRep) {
+                              VolumeRAMPrecision<unsigned short>& volRep, VoronoiMethod m) {
                         using XT = decltype(x);
                         using YT = decltype(y);
                         using ZT = decltype(z);
                         constexpr auto X = static_cast<Wrapping>(XT::value);
                         constexpr auto Y = static_cast<Wrapping>(YT::value);
                         constexpr auto Z = static_cast<Wrapping>(ZT::value);
-                        voronoiSegmentationImpl<X, Y, Z>(dim, i2d, d2m, sp, volRep);
+                        if (m == VoronoiMethod::BruteForce) {
+                            voronoiSegmentationImpl<X, Y, Z>(dim, i2d, d2m, sp, volRep);
+                        } else {
+                            hierarchicalVoronoiSegmentationImpl<X, Y, Z>(dim, i2d, d2m, sp,
+                                                                         nullptr, volRep);
+                        }
                     };
                 });
             });
@@ -249,7 +492,7 @@ std::shared_ptr<Volume> voronoiSegmentation(
         table[static_cast<size_t>(wrapping[0])][static_cast<size_t>(wrapping[1])]
              [static_cast<size_t>(wrapping[2])](volumeDimensions, indexToDataMatrix,
                                                 dataToModelMatrix, dataSeedPointsWithIndices,
-                                                *voronoiVolumeRep);
+                                                *voronoiVolumeRep, method);
     }
 
     return voronoiVolume;
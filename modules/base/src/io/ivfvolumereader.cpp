@@ -38,6 +38,9 @@
 #include <inviwo/core/datastructures/volume/volumedisk.h>  // for VolumeDisk
 #include <inviwo/core/datastructures/unitsystem.h>
 #include <inviwo/core/io/datareader.h>
+#include <inviwo/core/datastructures/volume/volumepyramid.h>  // for VolumePyramid
+#include <inviwo/core/io/chunkedvolumefile.h>
+#include <inviwo/core/io/chunkedvolumeramloader.h>
 #include <inviwo/core/io/rawvolumeramloader.h>
 #include <inviwo/core/io/inviwofileformattypes.h>
 #include <inviwo/core/io/serialization/deserializer.h>            // for Deserializer
@@ -60,12 +63,15 @@
 #include <memory_resource>
 
 #include <fmt/base.h>
+#include <fmt/std.h>
 
 namespace inviwo {
 
 namespace {
 
 constexpr std::string_view InviwoVolume = "InviwoVolume";
+// Version 3 files store their data in a chunked file, see ChunkedVolumeFile
+constexpr int InviwoChunkedVolumeVersion = 3;
 
 class Converter : public VersionConverter {
 public:
@@ -178,13 +184,52 @@ struct VolumeMetaData {
     MetaDataMap metaData;
 };
 
+std::shared_ptr<VolumeDisk> createChunkedDisk(const Volume& volume,
+                                              std::shared_ptr<const ChunkedVolumeFile> file,
+                                              size_t level) {
+    auto volumeDisk = std::make_shared<VolumeDisk>(
+        file->getPath(), file->getLevel(level).dimensions, volume.getDataFormat(),
+        volume.getSwizzleMask(), volume.getInterpolation(), volume.getWrapping());
+    volumeDisk->setLoader(new ChunkedVolumeRAMLoader(std::move(file), level));
+    return volumeDisk;
+}
+
+/**
+ * Add the chunked data of @p path to @p volume. Stored pyramid levels are handed to the
+ * VolumePyramid of the volume, they are only read when used.
+ */
+void addChunkedData(Volume& volume, const std::filesystem::path& path) {
+    auto file = std::make_shared<const ChunkedVolumeFile>(path);
+    if (file->getDataFormat() != volume.getDataFormat() ||
+        file->getLevel(0).dimensions != volume.getDimensions()) {
+        throw DataReaderException(SourceContext{},
+                                  "Chunked volume file {:?g} does not match the volume format",
+                                  path);
+    }
+    volume.addRepresentation(createChunkedDisk(volume, file, 0));
+
+    const auto nLevels = file->getNumberOfLevels();
+    if (nLevels > 1 && nLevels == util::pyramidLevelCount(volume.getDimensions())) {
+        std::vector<std::shared_ptr<const Volume>> levels;
+        for (size_t level = 1; level < nLevels; ++level) {
+            auto config = volume.config();
+            config.dimensions = file->getLevel(level).dimensions;
+            auto levelVolume = std::make_shared<Volume>(config);
+            levelVolume->addRepresentation(createChunkedDisk(volume, file, level));
+            levels.push_back(std::move(levelVolume));
+        }
+        volume.getPyramid().assign(volume, std::move(levels));
+    }
+}
+
 std::shared_ptr<VolumeSequence> readIvfFile(const std::filesystem::path& filePath) {
     const auto fileDirectory = filePath.parent_path();
 
     std::pmr::monotonic_buffer_resource mbr{1024 * 4};
     Deserializer d{filePath, "InviwoVolume", &mbr};
 
-    Converter converter{d.getVersion()};
+    const auto version = d.getVersion();
+    Converter converter{version};
     d.convertVersion(&converter);
 
     d.registerFactory(util::getMetaDataFactory());
@@ -192,9 +237,14 @@ std::shared_ptr<VolumeSequence> readIvfFile(const std::filesystem::path& filePat
     size_t byteOffset = 0u;
     ByteOrder byteOrder = ByteOrder::LittleEndian;
     Compression compression = Compression::Disabled;
-    d.deserialize("ByteOffset", byteOffset);
-    d.deserialize("ByteOrder", byteOrder);
-    d.deserialize("Compression", compression);
+    bool chunked = false;
+    if (version >= InviwoChunkedVolumeVersion) {
+        d.deserialize("Chunked", chunked);
+    } else {
+        d.deserialize("ByteOffset", byteOffset);
+        d.deserialize("ByteOrder", byteOrder);
+        d.deserialize("Compression", compression);
+    }
 
     std::string formatFlag;
     const DataFormatBase* format = nullptr;
@@ -240,6 +290,11 @@ std::shared_ptr<VolumeSequence> readIvfFile(const std::filesystem::path& filePat
         volume->axes = axes;
         *(volume->getMetaDataMap()) = metaData;
 
+        if (chunked) {
+            addChunkedData(*volume, fileDirectory / path);
+            continue;
+        }
+
         auto volumeDisk = std::make_shared<VolumeDisk>(fileDirectory / path, dimensions, format,
                                                        swizzleMask, interpolation, wrapping);
         auto loader = std::make_unique<RawVolumeRAMLoader>(fileDirectory / path, byteOffset,
@@ -34,6 +34,8 @@
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/datastructures/unitsystem.h>                      // for Axis
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume, DataWrite...
+#include <inviwo/core/datastructures/volume/volumebricked.h>            // for VolumeBricked
+#include <inviwo/core/datastructures/volume/volumepyramid.h>            // for volumeHalve
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
 #include <inviwo/core/datastructures/unitsystem.h>
 #include <inviwo/core/io/inviwofileformattypes.h>
@@ -64,6 +66,9 @@ namespace inviwo {
 
 constexpr std::string_view InviwoVolume = "InviwoVolume";
 constexpr int InviwoVolumeVersion = 2;
+// Version 3 stores the data in a chunked file, see ChunkedVolumeFile. Readers that do not know
+// about the chunked layout would read the chunked file as raw data.
+constexpr int InviwoChunkedVolumeVersion = 3;
 
 IvfVolumeWriter::IvfVolumeWriter() : DataWriterType<Volume>() {
     addExtension(FileExtension("ivf", "Inviwo Volume Format"));
@@ -80,7 +85,7 @@ IvfVolumeWriter& IvfVolumeWriter::operator=(IvfVolumeWriter&& that) noexcept = d
 IvfVolumeWriter* IvfVolumeWriter::clone() const { return new IvfVolumeWriter(*this); }
 
 void IvfVolumeWriter::writeData(const Volume* volume, const std::filesystem::path& filePath) const {
-    util::writeIvfVolume(*volume, filePath, getOverwrite());
+    util::writeIvfChunkedVolume(*volume, filePath, {}, true, getOverwrite());
 }
 
 IvfVolumeSequenceWriter::IvfVolumeSequenceWriter() : DataWriterType<VolumeSequence>() {
@@ -109,30 +114,26 @@ void IvfVolumeSequenceWriter::writeData(const VolumeSequence* volumes,
 
 namespace util {
 
-void writeIvfVolume(const Volume& data, const std::filesystem::path& filePath,
-                    Overwrite overwrite) {
-    const Compression compression = Compression::Enabled;
-    const std::string_view extension = compression == Compression::Enabled ? "raw.gz" : "raw";
-    const auto rawPath = filesystem::replaceFileExtension(filePath, extension);
-
-    DataWriter::checkOverwrite(filePath, overwrite);
-    DataWriter::checkOverwrite(rawPath, overwrite);
-
-    const auto fileName = filePath.stem().string();
-    const VolumeRAM* vr = data.getRepresentation<VolumeRAM>();
+namespace {
 
+void writeIvfHeader(const Volume& data, const std::filesystem::path& filePath,
+                    std::string_view rawFile, Compression compression, bool chunked) {
     std::pmr::monotonic_buffer_resource mbr{1024 * 4};
-    Serializer s{filePath, InviwoVolume, InviwoVolumeVersion, &mbr};
+    Serializer s{filePath, InviwoVolume, chunked ? InviwoChunkedVolumeVersion : InviwoVolumeVersion,
+                 &mbr};
     {
         const auto nodeSwitch = s.switchToNewNode("RawFile");
-        s.serialize("content", fmt::format("{}.{}", fileName, extension),
-                    SerializationTarget::Attribute);
+        s.serialize("content", rawFile, SerializationTarget::Attribute);
         data.getMetaDataMap()->serialize(s);
     }
-    s.serialize("Format", vr->getDataFormatString());
-    s.serialize("ByteOffset", 0u);
-    s.serialize("ByteOrder", ByteOrder::LittleEndian);
-    s.serialize("Compression", compression);
+    s.serialize("Format", data.getDataFormat()->getString());
+    if (chunked) {
+        s.serialize("Chunked", true);
+    } else {
+        s.serialize("ByteOffset", 0u);
+        s.serialize("ByteOrder", ByteOrder::LittleEndian);
+        s.serialize("Compression", compression);
+    }
     s.serialize("BasisAndOffset", data.getModelMatrix());
     s.serialize("WorldTransform", data.getWorldMatrix());
     s.serialize("Dimension", data.getDimensions());
@@ -150,16 +151,82 @@ void writeIvfVolume(const Volume& data, const std::filesystem::path& filePath,
     s.serialize("Axis3Name", data.axes[2].name);
     s.serialize("Axis3Unit", units::to_string(data.axes[2].unit));
 
-    s.serialize("SwizzleMask", vr->getSwizzleMask());
-    s.serialize("Interpolation", vr->getInterpolation());
-    s.serialize("Wrapping", vr->getWrapping());
+    s.serialize("SwizzleMask", data.getSwizzleMask());
+    s.serialize("Interpolation", data.getInterpolation());
+    s.serialize("Wrapping", data.getWrapping());
 
     s.writeFile();
+}
+
+}  // namespace
+
+void writeIvfVolume(const Volume& data, const std::filesystem::path& filePath,
+                    Overwrite overwrite) {
+    const Compression compression = Compression::Enabled;
+    const std::string_view extension = compression == Compression::Enabled ? "raw.gz" : "raw";
+    const auto rawPath = filesystem::replaceFileExtension(filePath, extension);
+
+    DataWriter::checkOverwrite(filePath, overwrite);
+    DataWriter::checkOverwrite(rawPath, overwrite);
+
+    const auto fileName = filePath.stem().string();
+    const VolumeRAM* vr = data.getRepresentation<VolumeRAM>();
+
+    writeIvfHeader(data, filePath, fmt::format("{}.{}", fileName, extension), compression, false);
 
     const size_t bytes = glm::compMul(vr->getDimensions()) * vr->getDataFormat()->getSizeInBytes();
     util::writeBytes(rawPath, vr->getData(), bytes, compression);
 }
 
+void writeIvfChunkedVolume(const Volume& data, const std::filesystem::path& filePath,
+                           const ChunkedVolumeFile::WriteOptions& options, bool writePyramid,
+                           Overwrite overwrite) {
+    const auto chunkPath = filesystem::replaceFileExtension(filePath, "ivc");
+
+    DataWriter::checkOverwrite(filePath, overwrite);
+    DataWriter::checkOverwrite(chunkPath, overwrite);
+
+    // Out-of-core volumes are written straight from their bricks
+    std::vector<std::shared_ptr<const VolumeBrickSource>> sources;
+    std::vector<const VolumeBrickSource*> levels;
+    const auto bricked = util::getBrickedRepresentation(data);
+    if (bricked) {
+        levels.push_back(&bricked->getSource());
+    } else {
+        sources.push_back(
+            std::make_shared<VolumeRAMBrickSource>(data.getRepresentationShared<VolumeRAM>()));
+        levels.push_back(sources.back().get());
+    }
+
+    if (writePyramid) {
+        const auto& pyramid = data.getPyramid();
+        const auto nLevels = util::pyramidLevelCount(data.getDimensions());
+        std::shared_ptr<VolumeRAM> previous;
+        for (size_t level = 1; level < nLevels; ++level) {
+            if (auto computed = pyramid.getLevel(level); computed && pyramid.isDone()) {
+                sources.push_back(std::make_shared<VolumeRAMBrickSource>(
+                    computed->getRepresentationShared<VolumeRAM>()));
+            } else {
+                if (previous) {
+                    previous = util::volumeHalve(*previous);
+                } else if (bricked) {
+                    previous = util::volumeHalve(*bricked);
+                } else {
+                    previous = util::volumeHalve(*data.getRepresentation<VolumeRAM>());
+                }
+                sources.push_back(std::make_shared<VolumeRAMBrickSource>(previous));
+            }
+            levels.push_back(sources.back().get());
+        }
+    }
+
+    auto chunkOptions = options;
+    chunkOptions.histogramRange = data.dataMap.dataRange;
+    ChunkedVolumeFile::write(chunkPath, levels, chunkOptions);
+
+    writeIvfHeader(data, filePath, chunkPath.filename().string(), Compression::Enabled, true);
+}
+
 namespace {
 
 void serializeAllVolumeData(Serializer& s, const Volume& volume) {
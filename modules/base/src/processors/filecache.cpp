@@ -29,15 +29,24 @@
 
 #include <modules/base/processors/filecache.h>
 
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/datastructures/image/image.h>
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerram.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
 #include <inviwo/core/network/networkutils.h>
 #include <inviwo/core/network/portconnection.h>
 #include <inviwo/core/links/propertylink.h>
+#include <inviwo/core/util/constexprhash.h>
 
 #include <inviwo/core/io/serialization/ticpp.h>
 
 #include <unordered_set>
 #include <memory_resource>
 
+#include <glm/gtx/component_wise.hpp>
+
 namespace inviwo {
 
 namespace detail {
@@ -130,6 +139,35 @@ std::string cacheState(Processor* processor, ProcessorNetwork& net,
         },
         remove);
 
+    // remove all remaining meta data, i.e. positions, colors, and other editor state
+    remove(
+        s.doc().RootElement(),
+        [](TiXmlElement* current, TiXmlElement*) -> bool {
+            return current->Value() == "MetaDataMap";
+        },
+        remove);
+
+    // remove cosmetic property state
+    remove(
+        s.doc().RootElement(),
+        [](TiXmlElement* current, TiXmlElement* parent) -> bool {
+            if (parent->Value() != "Property") return false;
+            const auto name = current->Value();
+            return name == "displayName" || name == "semantics" || name == "visible" ||
+                   name == "readonly";
+        },
+        remove);
+
+    // remove processor display names
+    if (auto* network = s.doc().RootElement()->FirstChildElement("ProcessorNetwork")) {
+        if (auto* elems = network->FirstChildElement("Processors")) {
+            for (auto* elem = elems->FirstChildElement("Processor"); elem;
+                 elem = elem->NextSiblingElement("Processor")) {
+                elem->RemoveAttribute("displayName");
+            }
+        }
+    }
+
     if (!refPath.empty()) {
         // remove absolutePath if we have workspaceRelativePaths
         remove(
@@ -150,7 +188,65 @@ std::string cacheState(Processor* processor, ProcessorNetwork& net,
     xml.clear();
     s.write(xml);
 
-    return {fmt::format("{:016X}", std::hash<std::string_view>{}(xml))};
+    return {fmt::format("{:016X}", util::constexpr_hash(xml))};
+}
+
+namespace {
+
+size_t layerSize(const Layer& layer) {
+    return glm::compMul(layer.getDimensions()) * layer.getDataFormat()->getSizeInBytes();
+}
+
+}  // namespace
+
+size_t cacheSize(const Volume& volume) {
+    return glm::compMul(volume.getDimensions()) * volume.getDataFormat()->getSizeInBytes();
+}
+size_t cacheSize(const Layer& layer) { return layerSize(layer); }
+size_t cacheSize(const Image& image) {
+    size_t size = 0;
+    for (size_t i = 0; i < image.getNumberOfColorLayers(); ++i) {
+        size += layerSize(*image.getColorLayer(i));
+    }
+    if (const auto* depth = image.getDepthLayer()) size += layerSize(*depth);
+    if (const auto* picking = image.getPickingLayer()) size += layerSize(*picking);
+    return size;
+}
+size_t cacheSize(const Mesh& mesh) {
+    size_t size = 0;
+    for (const auto& [info, buffer] : mesh.getBuffers()) {
+        size += buffer->getSizeInBytes();
+    }
+    for (const auto& [info, indices] : mesh.getIndexBuffers()) {
+        size += indices->getSizeInBytes();
+    }
+    return size;
+}
+
+void ensureRAM(const Volume& volume) { volume.getRepresentation<VolumeRAM>(); }
+void ensureRAM(const Layer& layer) { layer.getRepresentation<LayerRAM>(); }
+void ensureRAM(const Image& image) {
+    for (size_t i = 0; i < image.getNumberOfColorLayers(); ++i) {
+        ensureRAM(*image.getColorLayer(i));
+    }
+    if (const auto* depth = image.getDepthLayer()) ensureRAM(*depth);
+    if (const auto* picking = image.getPickingLayer()) ensureRAM(*picking);
+}
+void ensureRAM(const Mesh& mesh) {
+    for (const auto& [info, buffer] : mesh.getBuffers()) {
+        buffer->getRepresentation<BufferRAM>();
+    }
+    for (const auto& [info, indices] : mesh.getIndexBuffers()) {
+        indices->getRepresentation<BufferRAM>();
+    }
+}
+
+void writeCacheXML(const std::filesystem::path& file, std::string_view xml) {
+    if (auto f = std::ofstream(file)) {
+        f << xml;
+    } else {
+        throw Exception(SourceContext{}, "Could not write to xml file: {}", file);
+    }
 }
 
 }  // namespace detail
@@ -205,15 +301,9 @@ bool CacheBase::isConnectionActive(Inport* inport, Outport*) const {
     }
 }
 
-void CacheBase::writeXML() const {
-    if (!cacheDir_.get().empty()) {
-        if (auto f = std::ofstream(cacheDir_.get() / fmt::format("{}.inv", key_))) {
-            f << xml_;
-        } else {
-            throw Exception(SourceContext{}, "Could not write to xml file: {}/{}.inv",
-                            cacheDir_.get(), key_);
-        }
-    }
+std::optional<std::filesystem::path> CacheBase::xmlPathForKey(std::string_view key) const {
+    if (cacheDir_.get().empty()) return std::nullopt;
+    return cacheDir_.get() / fmt::format("{}.inv", key);
 }
 
 }  // namespace inviwo
@@ -35,6 +35,7 @@
 #include <inviwo/core/datastructures/image/imagetypes.h>                // for ImageChannel, Ima...
 #include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
+#include <inviwo/core/datastructures/volume/volumebricked.h>            // for getBrickedRepr...
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
 #include <inviwo/core/interaction/events/eventmatcher.h>                // for GestureEventMatcher
 #include <inviwo/core/interaction/events/gestureevent.h>                // for GestureEvent
@@ -187,8 +188,8 @@ size2_t sliceDimensions(const size3_t volumeDims, CartesianCoordinateAxis axis)
     }
 }
 
-Wrapping2D getWrapping(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
-    const auto wrapping = v->getOwner()->getWrapping();
+Wrapping2D getWrapping(const Volume& volume, CartesianCoordinateAxis axis) {
+    const auto wrapping = volume.getWrapping();
     switch (axis) {
         default:
             return {{wrapping[2], wrapping[1]}};
@@ -201,8 +202,8 @@ Wrapping2D getWrapping(const VolumeRepresentation* v, CartesianCoordinateAxis ax
     }
 }
 
-mat2 getBasis(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
-    const mat3 basis = v->getOwner()->getBasis();
+mat2 getBasis(const Volume& volume, CartesianCoordinateAxis axis) {
+    const mat3 basis = volume.getBasis();
     switch (axis) {
         default:
             return mat2(vec2(basis[2][2], basis[2][1]), vec2(basis[1][2], basis[1][1]));
@@ -215,8 +216,8 @@ mat2 getBasis(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
     }
 }
 
-vec2 getOffset(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
-    const vec3 offset = v->getOwner()->getOffset();
+vec2 getOffset(const Volume& volume, CartesianCoordinateAxis axis) {
+    const vec3 offset = volume.getOffset();
     switch (axis) {
         default:
             return vec2(offset.z, offset.y);
@@ -230,6 +231,7 @@ vec2 getOffset(const VolumeRepresentation* v, CartesianCoordinateAxis axis) {
 }
 
 struct SliceState {
+    const Volume* volume;
     CartesianCoordinateAxis axis;
     size_t slice;
     ImageReuseCache* cache;
@@ -252,9 +254,9 @@ std::shared_ptr<Image> extractSliceInternal(const VolumeRAMPrecision<T>* vrpreci
     auto layerrep = res.second;
     auto layerdata = layerrep->getDataTyped();
     layerrep->setSwizzleMask(state.tf ? swizzlemasks::rgba : vrprecision->getSwizzleMask());
-    layerrep->setWrapping(getWrapping(vrprecision, state.axis));
-    sliceImage->getColorLayer()->setBasis(mat3(getBasis(vrprecision, state.axis)));
-    sliceImage->getColorLayer()->setOffset(vec3(getOffset(vrprecision, state.axis), 0.0f));
+    layerrep->setWrapping(getWrapping(*state.volume, state.axis));
+    sliceImage->getColorLayer()->setBasis(mat3(getBasis(*state.volume, state.axis)));
+    sliceImage->getColorLayer()->setOffset(vec3(getOffset(*state.volume, state.axis), 0.0f));
 
     switch (state.axis) {
         case CartesianCoordinateAxis::X: {
@@ -312,7 +314,7 @@ std::shared_ptr<Image> extractSlice(const VolumeRAMPrecision<T>* vrprecision,
 
     if (useTF) {
         using D = glm::vec<4, V>;
-        auto mapData = [&dm = vrprecision->getOwner()->dataMap, tf = state.tf,
+        auto mapData = [&dm = state.volume->dataMap, tf = state.tf,
                         offset = state.alphaOffset](T value) {
             auto sample = tf->sample(
                 glm::clamp(dm.mapFromDataToNormalized(util::glmcomp(value, 0)), 0.0, 1.0));
@@ -322,7 +324,7 @@ std::shared_ptr<Image> extractSlice(const VolumeRAMPrecision<T>* vrprecision,
         return extractSliceInternal<T, D>(vrprecision, state, mapData);
     } else {
         using D = util::same_extent_t<T, V>;
-        auto mapData = [&dm = vrprecision->getOwner()->dataMap](T value) {
+        auto mapData = [&dm = state.volume->dataMap](T value) {
             return util::glm_convert_normalized<D>(glm::clamp(dm.mapFromDataToNormalized(value),
                                                               util::same_extent_t<T, double>(0.0),
                                                               util::same_extent_t<T, double>(1.0)));
@@ -359,40 +361,53 @@ void VolumeSliceExtractor::process() {
             break;
     }
 
-    detail::SliceState state{sliceAlongAxis_,     static_cast<size_t>(sliceNumber_.get() - 1),
-                             &imageCache_,        flipHorizontal_,
-                             flipVertical_,       &transferFunction_.get(),
+    detail::SliceState state{vol.get(),
+                             sliceAlongAxis_,
+                             static_cast<size_t>(sliceNumber_.get() - 1),
+                             &imageCache_,
+                             flipHorizontal_,
+                             flipVertical_,
+                             &transferFunction_.get(),
                              tfAlphaOffset_.get()};
 
+    std::shared_ptr<const VolumeRAM> ram;
+    if (auto bricked = util::getBrickedRepresentation(*vol)) {
+        // Out-of-core volume, only load the bricks intersecting the slice
+        const auto axis = static_cast<int>(sliceAlongAxis_.get());
+        size3_t offset{0};
+        size3_t slab{dims};
+        offset[axis] = glm::clamp(state.slice, size_t{0}, dims[axis] - 1);
+        slab[axis] = 1;
+        ram = bricked->getRegion(offset, slab);
+        state.slice = 0;
+    } else {
+        ram = vol->getRepresentationShared<VolumeRAM>();
+    }
+
     std::shared_ptr<Image> image;
 
     switch (format_.get()) {
         case OutputFormat::UInt8:
-            image = vol->getRepresentation<VolumeRAM>()
-                        ->dispatch<std::shared_ptr<Image>, dispatching::filter::All>(
-                            [&](const auto* vrprecision) {
-                                using T = util::PrecisionValueType<decltype(vrprecision)>;
-                                return detail::extractSlice<T, std::uint8_t>(vrprecision, state,
-                                                                             tfGroup_.isChecked());
-                            });
+            image = ram->dispatch<std::shared_ptr<Image>, dispatching::filter::All>(
+                [&](const auto* vrprecision) {
+                    using T = util::PrecisionValueType<decltype(vrprecision)>;
+                    return detail::extractSlice<T, std::uint8_t>(vrprecision, state,
+                                                                 tfGroup_.isChecked());
+                });
             break;
         case OutputFormat::Float32:
-            image = vol->getRepresentation<VolumeRAM>()
-                        ->dispatch<std::shared_ptr<Image>, dispatching::filter::All>(
-                            [&](const auto* vrprecision) {
-                                using T = util::PrecisionValueType<decltype(vrprecision)>;
-                                return detail::extractSlice<T, float>(vrprecision, state,
-                                                                      tfGroup_.isChecked());
-                            });
+            image = ram->dispatch<std::shared_ptr<Image>, dispatching::filter::All>(
+                [&](const auto* vrprecision) {
+                    using T = util::PrecisionValueType<decltype(vrprecision)>;
+                    return detail::extractSlice<T, float>(vrprecision, state, tfGroup_.isChecked());
+                });
             break;
         case OutputFormat::AsInput:
         default:
-            image =
-                vol->getRepresentation<VolumeRAM>()
-                    ->dispatch<std::shared_ptr<Image>, dispatching::filter::All>(
-                        [&](const auto* vrprecision) {
-                            return detail::extractSlice(vrprecision, state, tfGroup_.isChecked());
-                        });
+            image = ram->dispatch<std::shared_ptr<Image>, dispatching::filter::All>(
+                [&](const auto* vrprecision) {
+                    return detail::extractSlice(vrprecision, state, tfGroup_.isChecked());
+                });
             break;
     }
 
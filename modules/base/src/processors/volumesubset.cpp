@@ -33,6 +33,7 @@
 #include <inviwo/core/datastructures/representationconverter.h>         // for RepresentationCon...
 #include <inviwo/core/datastructures/representationconverterfactory.h>  // for RepresentationCon...
 #include <inviwo/core/datastructures/volume/volume.h>                   // for Volume
+#include <inviwo/core/datastructures/volume/volumebricked.h>            // for getBrickedRepr...
 #include <inviwo/core/datastructures/volume/volumeram.h>                // for VolumeRAM
 #include <inviwo/core/network/networklock.h>                            // for NetworkLock
 #include <inviwo/core/ports/volumeport.h>                               // for VolumeInport, Vol...
@@ -117,8 +118,8 @@ VolumeSubset::~VolumeSubset() = default;
 
 void VolumeSubset::process() {
     if (enabled_.get()) {
-        const auto vol = inport_.getData()->getRepresentation<VolumeRAM>();
-        const size3_t inputDims = vol->getDimensions();
+        const auto input = inport_.getData();
+        const size3_t inputDims = input->getDimensions();
         const size3_t offset{
             glm::min(size3_t{rangeX_.get().x, rangeY_.get().x, rangeZ_.get().x}, inputDims)};
         const size3_t dim = size3_t{rangeX_.get().y, rangeY_.get().y, rangeZ_.get().y} - offset;
@@ -127,7 +128,19 @@ void VolumeSubset::process() {
             outport_.setData(inport_.getData());
         } else {
             auto volume = std::make_shared<Volume>(*inport_.getData(), NoData{});
-            volume->addRepresentation(VolumeRAMSubSet::apply(vol, dim, offset));
+            if (auto bricked = util::getBrickedRepresentation(*input)) {
+                // Out-of-core volume, only load the bricks overlapping the subset
+                auto subset = bricked->getRegion(offset, glm::min(dim, inputDims - offset));
+                Wrapping3D wrapping{subset->getWrapping()};
+                for (int i = 0; i < 3; ++i) {
+                    if (inputDims[i] != dim[i]) wrapping[i] = Wrapping::Clamp;
+                }
+                subset->setWrapping(wrapping);
+                volume->addRepresentation(subset);
+            } else {
+                volume->addRepresentation(
+                    VolumeRAMSubSet::apply(input->getRepresentation<VolumeRAM>(), dim, offset));
+            }
 
             if (adjustBasisAndOffset_.get()) {
                 vec3 volOffset = inport_.getData()->getOffset();
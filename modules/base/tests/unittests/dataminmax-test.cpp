@@ -0,0 +1,81 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/algorithm/dataminmax.h>
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace inviwo {
+
+TEST(DataMinMax, Partitioned) {
+    // more values than fit in one partition, with the extremes in different partitions
+    std::vector<std::uint16_t> data(5 * util::detail::minMaxGrainSize + 3, 100);
+    data[7] = 3;
+    data[data.size() - 1] = 60000;
+
+    const auto [min, max] = util::dataMinMax(data.data(), data.size());
+    EXPECT_EQ(min.x, 3.0);
+    EXPECT_EQ(max.x, 60000.0);
+}
+
+TEST(DataMinMax, Vec3) {
+    std::vector<vec3> data(1001);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = vec3{static_cast<float>(i), -static_cast<float>(i), 1.0f};
+    }
+
+    const auto [min, max] = util::dataMinMax(data.data(), data.size());
+    EXPECT_EQ(min, dvec4(0.0, -1000.0, 1.0, 0.0));
+    EXPECT_EQ(max, dvec4(1000.0, 0.0, 1.0, 0.0));
+}
+
+TEST(DataMinMax, IgnoreSpecialValues) {
+    std::vector<vec2> data(100, vec2{1.0f, 2.0f});
+    data[10].x = std::numeric_limits<float>::infinity();
+    data[20].y = -std::numeric_limits<float>::infinity();
+    data[30].x = std::numeric_limits<float>::quiet_NaN();
+    data[40] = vec2{-5.0f, 5.0f};
+
+    const auto [min, max] = util::dataMinMax(data.data(), data.size(), IgnoreSpecialValues::Yes);
+    EXPECT_EQ(min, dvec4(-5.0, 2.0, 0.0, 0.0));
+    EXPECT_EQ(max, dvec4(1.0, 5.0, 0.0, 0.0));
+
+    const auto [minAll, maxAll] = util::dataMinMax(data.data(), data.size());
+    EXPECT_EQ(maxAll.x, std::numeric_limits<double>::infinity());
+    EXPECT_EQ(minAll.y, -std::numeric_limits<double>::infinity());
+}
+
+}  // namespace inviwo
@@ -0,0 +1,113 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/base/io/ivfvolumereader.h>
+#include <modules/base/io/ivfvolumewriter.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumepyramid.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/util/filesystem.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <string>
+
+namespace inviwo {
+
+namespace {
+
+void expectEqualData(const VolumeRAM& expected, const VolumeRAM& result) {
+    ASSERT_EQ(result.getDimensions(), expected.getDimensions());
+    const auto* a = static_cast<const VolumeRAMPrecision<float>*>(&expected)->getDataTyped();
+    const auto* b = static_cast<const VolumeRAMPrecision<float>*>(&result)->getDataTyped();
+    for (size_t i = 0; i < glm::compMul(expected.getDimensions()); ++i) {
+        ASSERT_FLOAT_EQ(a[i], b[i]) << "index " << i;
+    }
+}
+
+}  // namespace
+
+TEST(IvfVolumeIO, ChunkedRoundTrip) {
+    const size3_t dims{21, 14, 9};
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(dims);
+    auto* data = ram->getDataTyped();
+    std::iota(data, data + glm::compMul(dims), 0.0f);
+
+    Volume volume{ram};
+    volume.dataMap.dataRange = dvec2{0.0, static_cast<double>(glm::compMul(dims) - 1)};
+    volume.dataMap.valueRange = dvec2{-1.0, 1.0};
+    volume.setModelMatrix(glm::scale(vec3{2.0f, 3.0f, 4.0f}));
+
+    const util::TempFileHandle file{"inviwo", ".ivf"};
+    const auto chunkPath = filesystem::replaceFileExtension(file.getFileName(), "ivc");
+    ChunkedVolumeFile::WriteOptions options;
+    options.chunkSize = size3_t{8};
+    util::writeIvfChunkedVolume(volume, file.getFileName(), options, true, Overwrite::Yes);
+
+    // Chunked files must not be readable as raw files by readers of older versions
+    {
+        std::ifstream in{file.getFileName()};
+        const std::string header{std::istreambuf_iterator<char>{in}, {}};
+        EXPECT_NE(header.find("version=\"3\""), std::string::npos);
+    }
+
+    IvfVolumeReader reader;
+    const auto result = reader.readData(file.getFileName());
+    ASSERT_TRUE(result);
+    EXPECT_EQ(result->getDimensions(), dims);
+    EXPECT_EQ(result->getDataFormat(), volume.getDataFormat());
+    EXPECT_EQ(result->getModelMatrix(), volume.getModelMatrix());
+    EXPECT_EQ(result->dataMap.dataRange, volume.dataMap.dataRange);
+    EXPECT_EQ(result->dataMap.valueRange, volume.dataMap.valueRange);
+    EXPECT_TRUE(result->hasRepresentation<VolumeDisk>());
+    expectEqualData(*ram, *result->getRepresentation<VolumeRAM>());
+
+    // The pyramid levels are stored in the chunked file
+    const auto& pyramid = result->getPyramid();
+    ASSERT_TRUE(pyramid.isDone());
+    const auto level1 = pyramid.getLevel(1);
+    ASSERT_TRUE(level1);
+    expectEqualData(*util::volumeHalve(*ram), *level1->getRepresentation<VolumeRAM>());
+
+    std::filesystem::remove(chunkPath);
+}
+
+}  // namespace inviwo
@@ -33,6 +33,9 @@
 #include <warn/pop>
 
 #include <cmath>
+#include <map>
+#include <set>
+#include <tuple>
 
 #include <inviwo/core/datastructures/geometry/mesh.h>
 #include <inviwo/core/datastructures/volume/volume.h>
@@ -336,4 +339,40 @@ TEST(Marchingcubes, sphere) {
     */
 }
 
+TEST(Marchingcubes, slabs) {
+    // Large enough in z to be split into several slabs, the sphere crosses the slab boundaries
+    auto v = std::shared_ptr<Volume>(util::makeSphericalVolume(size3_t{20, 20, 40}));
+    auto mesh = util::marchingCubesOpt(v, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
+
+    auto& pos = getBufferData<vec3>(*mesh, 0);
+    auto& ind = getBufferIndexData(*mesh, 0);
+    ASSERT_FALSE(pos.empty());
+    ASSERT_EQ(ind.size() % 3, 0);
+
+    // No duplicated vertices along the slab boundaries
+    auto order = [](const vec3& a, const vec3& b) {
+        return std::tie(a.x, a.y, a.z) < std::tie(b.x, b.y, b.z);
+    };
+    std::set<vec3, decltype(order)> unique(pos.begin(), pos.end(), order);
+    EXPECT_EQ(unique.size(), pos.size());
+
+    // The surface is closed, i.e. every edge is shared by exactly two triangles
+    std::map<std::pair<uint32_t, uint32_t>, int> edges;
+    for (size_t i = 0; i < ind.size(); i += 3) {
+        for (size_t j = 0; j < 3; ++j) {
+            const auto a = ind[i + j];
+            const auto b = ind[i + (j + 1) % 3];
+            ++edges[{std::min(a, b), std::max(a, b)}];
+        }
+    }
+    for (const auto& [edge, count] : edges) {
+        EXPECT_EQ(count, 2) << "Edge " << edge.first << " - " << edge.second;
+    }
+
+    // The result is deterministic
+    auto mesh2 = util::marchingCubesOpt(v, 0.5, {0.5f, 0.0f, 0.0f, 1.0f}, false, false);
+    EXPECT_EQ(pos, getBufferData<vec3>(*mesh2, 0));
+    EXPECT_EQ(ind, getBufferIndexData(*mesh2, 0));
+}
+
 }  // namespace inviwo
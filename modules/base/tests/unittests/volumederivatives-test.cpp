@@ -0,0 +1,151 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <modules/base/algorithm/volume/volumecurl.h>
+#include <modules/base/algorithm/volume/volumedivergence.h>
+#include <modules/base/algorithm/volume/volumegradient.h>
+#include <modules/base/algorithm/volume/volumelaplacian.h>
+#include <modules/base/algorithm/volume/volumestencil.h>
+
+#include <functional>
+#include <memory>
+
+#include <glm/gtx/transform.hpp>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size3_t dims{37, 20, 6};
+
+template <typename T>
+std::shared_ptr<VolumeRAMPrecision<T>> createField(
+    const std::function<T(const vec3&)>& f, const Wrapping3D& wrapping = wrapping3d::clampAll) {
+    auto ram = std::make_shared<VolumeRAMPrecision<T>>(dims, swizzlemasks::rgba,
+                                                       InterpolationType::Linear, wrapping);
+    const util::IndexMapper3D index{dims};
+    for (size_t i = 0; i < glm::compMul(dims); ++i) {
+        ram->getDataTyped()[i] = f(vec3{index(i)});
+    }
+    return ram;
+}
+
+// A volume where one voxel step is one unit in world space
+std::shared_ptr<Volume> createVolume(std::shared_ptr<VolumeRepresentation> ram) {
+    auto volume = std::make_shared<Volume>(std::move(ram));
+    volume->setModelMatrix(glm::scale(vec3{dims}));
+    return volume;
+}
+
+}  // namespace
+
+TEST(VolumeStencil, LinearFieldIncludingBorders) {
+    const auto ram =
+        createField<float>([](const vec3& p) { return 2.0f * p.x + 3.0f * p.y - p.z; });
+
+    const auto results = util::forEachVoxelStencil(
+        *ram, size_t{0}, [](size_t& count, size_t, const util::VoxelStencil<float>& s) {
+            EXPECT_FLOAT_EQ(s.difference(0), 2.0f);
+            EXPECT_FLOAT_EQ(s.difference(1), 3.0f);
+            EXPECT_FLOAT_EQ(s.difference(2), -1.0f);
+            EXPECT_FLOAT_EQ(s.secondDifference(0), 0.0f);
+            ++count;
+        });
+
+    size_t total = 0;
+    for (auto count : results) total += count;
+    EXPECT_EQ(total, glm::compMul(dims));
+}
+
+TEST(VolumeStencil, RepeatWrapping) {
+    const auto ram = createField<float>([](const vec3& p) { return p.x; }, wrapping3d::repeatAll);
+    const util::IndexMapper3D index{dims};
+
+    util::forEachVoxelStencil(*ram, 0, [&](int&, size_t i, const util::VoxelStencil<float>& s) {
+        const auto x = index(i).x;
+        EXPECT_FLOAT_EQ(s.minus[0], static_cast<float>(x == 0 ? dims.x - 1 : x - 1));
+        EXPECT_FLOAT_EQ(s.plus[0], static_cast<float>(x + 1 == dims.x ? 0 : x + 1));
+    });
+}
+
+TEST(VolumeDerivatives, Gradient) {
+    const auto volume = createVolume(
+        createField<vec2>([](const vec3& p) { return vec2{2.0f * p.x + 3.0f * p.y - p.z, p.x}; }));
+
+    const auto gradient = util::gradientVolume(volume, 0);
+    const auto* ram =
+        static_cast<const VolumeRAMPrecision<vec3>*>(gradient->getRepresentation<VolumeRAM>());
+    for (size_t i = 0; i < glm::compMul(dims); ++i) {
+        ASSERT_NEAR(glm::distance(ram->getDataTyped()[i], vec3(2.0f, 3.0f, -1.0f)), 0.0f, 1e-3f);
+    }
+    EXPECT_NEAR(gradient->dataMap.dataRange.y, 3.0, 1e-3);
+}
+
+TEST(VolumeDerivatives, CurlAndDivergence) {
+    const auto volume = createVolume(
+        createField<vec3>([](const vec3& p) { return vec3{-p.y + p.x, p.x + p.y, p.z}; }));
+
+    const auto curl = util::curlVolume(*volume);
+    const auto* curlRAM =
+        static_cast<const VolumeRAMPrecision<vec3>*>(curl->getRepresentation<VolumeRAM>());
+    const auto divergence = util::divergenceVolume(*volume);
+    const auto* divRAM =
+        static_cast<const VolumeRAMPrecision<float>*>(divergence->getRepresentation<VolumeRAM>());
+
+    for (size_t i = 0; i < glm::compMul(dims); ++i) {
+        ASSERT_NEAR(glm::distance(curlRAM->getDataTyped()[i], vec3(0.0f, 0.0f, 2.0f)), 0.0f,
+                    1e-3f);
+        ASSERT_NEAR(divRAM->getDataTyped()[i], 3.0f, 1e-3f);
+    }
+}
+
+TEST(VolumeDerivatives, Laplacian) {
+    const auto volume =
+        createVolume(createField<double>([](const vec3& p) { return double{p.x * p.x}; }));
+
+    const auto laplacian = util::volumeLaplacian(volume, VolumeLaplacianPostProcessing::None, 1.0);
+    const auto* ram =
+        static_cast<const VolumeRAMPrecision<float>*>(laplacian->getRepresentation<VolumeRAM>());
+    const util::IndexMapper3D index{dims};
+    for (size_t i = 0; i < glm::compMul(dims); ++i) {
+        const auto x = index(i).x;
+        if (x == 0 || x + 1 == dims.x) continue;
+        ASSERT_NEAR(ram->getDataTyped()[i], 2.0f, 1e-3f);
+    }
+}
+
+}  // namespace inviwo
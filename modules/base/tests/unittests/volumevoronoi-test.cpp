@@ -37,6 +37,10 @@
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <inviwo/core/util/indexmapper.h>
 
+#include <random>
+
+#include <glm/gtx/component_wise.hpp>
+
 namespace inviwo {
 
 constexpr auto clamp3D = Wrapping3D{Wrapping::Clamp, Wrapping::Clamp, Wrapping::Clamp};
@@ -246,4 +250,56 @@ TEST(VolumeVoronoi, Voronoi_ThreeSeedPoints_PartitionsVolumeInThree) {
     }
 }
 
+namespace {
+
+void compareMethods(const Wrapping3D& wrapping, bool weighted) {
+    Entity entity{size3_t{23, 17, 19}};
+    const auto& ct = entity.getCoordinateTransformer();
+
+    std::mt19937 rand{static_cast<std::mt19937::result_type>(weighted ? 17 : 42)};
+    std::uniform_real_distribution<float> pos{-0.1f, 1.1f};
+    std::uniform_real_distribution<float> radius{0.0f, 0.1f};
+
+    std::vector<std::pair<uint32_t, vec3>> seedPoints;
+    std::vector<float> weights;
+    for (uint32_t i = 0; i < 200; ++i) {
+        const vec3 dataPos{pos(rand), pos(rand), pos(rand)};
+        seedPoints.emplace_back(i, vec3{ct.getDataToModelMatrix() * vec4{dataPos, 1.0f}});
+        weights.push_back(radius(rand));
+    }
+    const auto maybeWeights = weighted ? std::optional{weights} : std::nullopt;
+
+    const auto bruteForce = util::voronoiSegmentation(
+        entity.getDimensions(), ct.getIndexToDataMatrix(), ct.getDataToModelMatrix(), seedPoints,
+        wrapping, maybeWeights, util::VoronoiMethod::BruteForce);
+    const auto hierarchical = util::voronoiSegmentation(
+        entity.getDimensions(), ct.getIndexToDataMatrix(), ct.getDataToModelMatrix(), seedPoints,
+        wrapping, maybeWeights, util::VoronoiMethod::Hierarchical);
+
+    const auto* expected = static_cast<const VolumeRAMPrecision<unsigned short>*>(
+        bruteForce->getRepresentation<VolumeRAM>());
+    const auto* result = static_cast<const VolumeRAMPrecision<unsigned short>*>(
+        hierarchical->getRepresentation<VolumeRAM>());
+
+    const auto size = glm::compMul(entity.getDimensions());
+    size_t mismatches = 0;
+    for (size_t i = 0; i < size; ++i) {
+        if (expected->getDataTyped()[i] != result->getDataTyped()[i]) ++mismatches;
+    }
+    EXPECT_EQ(mismatches, 0);
+}
+
+}  // namespace
+
+TEST(VolumeVoronoi, Hierarchical_MatchesBruteForce) {
+    compareMethods(clamp3D, false);
+    compareMethods({Wrapping::Repeat, Wrapping::Repeat, Wrapping::Repeat}, false);
+    compareMethods({Wrapping::Repeat, Wrapping::Clamp, Wrapping::Repeat}, false);
+}
+
+TEST(VolumeVoronoi, WeightedHierarchical_MatchesBruteForce) {
+    compareMethods(clamp3D, true);
+    compareMethods({Wrapping::Repeat, Wrapping::Repeat, Wrapping::Repeat}, true);
+}
+
 }  // namespace inviwo
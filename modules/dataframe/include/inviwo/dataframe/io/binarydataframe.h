@@ -0,0 +1,136 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>  // for IVW_MODULE_DATAFRAME_API
+
+#include <inviwo/core/datastructures/unitsystem.h>   // for Unit
+#include <inviwo/core/util/formats.h>                // for DataFormatId
+#include <inviwo/core/util/glmvec.h>                 // for dvec2
+#include <inviwo/dataframe/datastructures/column.h>  // for ColumnType
+
+#include <array>       // for array
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint8_t, uint32_t
+#include <filesystem>  // for path
+#include <optional>    // for optional
+#include <span>        // for span
+#include <string>      // for string
+#include <vector>      // for vector
+
+namespace inviwo {
+
+/**
+ * \brief Inviwo binary columnar DataFrame format (.ivdf)
+ *
+ * The file starts with a fixed header and an index describing all columns, followed by the data
+ * of each column stored as one contiguous block aligned to #alignment bytes:
+ *
+ *     magic "IVWDFRAM" | version (u32) | column count (u32) | index size (u64) | index | data...
+ *
+ * For each column the index holds the header, unit, column type, data format, custom range, the
+ * min/max of the data, the number of rows, the codec, and the offset and size of the data block.
+ * Categorical columns store their dictionary of categories once in the index and the category
+ * ids as data. All numbers in the header and index are little endian, the column data is stored
+ * as in memory, hence the format is only supported on little endian platforms.
+ *
+ * Uncompressed column data can be copied into the column buffers directly from a memory mapped
+ * file without any parsing. Compressed columns use the block compressed layout of
+ * util::blockcompression and are decompressed in parallel.
+ *
+ * @see BinaryDataFrameReader, BinaryDataFrameWriter
+ */
+namespace binarydataframe {
+
+constexpr std::array<char, 8> magic{'I', 'V', 'W', 'D', 'F', 'R', 'A', 'M'};
+constexpr std::uint32_t version = 1;
+constexpr size_t headerSize = magic.size() + 4 + 4 + 8;
+/**
+ * Alignment of the column data blocks in the file
+ */
+constexpr size_t alignment = 64;
+
+enum class Codec : std::uint8_t { None = 0, Deflate = 1 };
+
+/**
+ * Description of a column as stored in the index of a binary DataFrame file
+ */
+struct IVW_MODULE_DATAFRAME_API ColumnInfo {
+    std::string header;
+    ColumnType type = ColumnType::Ordinal;
+    DataFormatId format = DataFormatId::NotSpecialized;
+    Unit unit;
+    std::optional<dvec2> customRange;
+    /**
+     * Min and max of the column data, ignoring NaN and infinity. For categorical columns this is
+     * the range of the category ids. NaN if the column is empty.
+     */
+    dvec2 dataRange{0.0};
+    size_t rows = 0;
+    Codec codec = Codec::None;
+    /**
+     * Offset of the column data from the start of the file
+     */
+    size_t offset = 0;
+    /**
+     * Size in bytes of the column data in the file
+     */
+    size_t storedSize = 0;
+    /**
+     * The categories of a categorical column
+     */
+    std::vector<std::string> categories;
+};
+
+/**
+ * Serialize the file header and the index of @p columns, i.e. everything preceding the column
+ * data in a binary DataFrame file.
+ */
+IVW_MODULE_DATAFRAME_API std::vector<unsigned char> serializeHeader(
+    std::span<const ColumnInfo> columns);
+
+/**
+ * Parse the file header and index at the start of @p bytes.
+ * @throws DataReaderException if @p bytes does not start with a valid header and index.
+ */
+IVW_MODULE_DATAFRAME_API std::vector<ColumnInfo> deserializeHeader(
+    std::span<const unsigned char> bytes);
+
+/**
+ * Read only the header and index of the binary DataFrame file @p path. This gives the columns,
+ * their types and data ranges without loading any column data.
+ * @throws DataReaderException if the file cannot be read or is not a binary DataFrame file.
+ */
+IVW_MODULE_DATAFRAME_API std::vector<ColumnInfo> readColumnInfo(
+    const std::filesystem::path& path);
+
+}  // namespace binarydataframe
+
+}  // namespace inviwo
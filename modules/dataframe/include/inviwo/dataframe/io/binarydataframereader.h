@@ -0,0 +1,73 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>  // for IVW_MODULE_DATAFRAME_API
+
+#include <inviwo/core/io/datareader.h>  // for DataReaderType
+
+#include <memory>  // for shared_ptr
+#include <span>    // for span
+
+namespace inviwo {
+class DataFrame;
+
+/**
+ * \class BinaryDataFrameReader
+ * \ingroup dataio
+ * Reads a DataFrame from the Inviwo binary columnar format (.ivdf), see binarydataframe.h.
+ * The file is memory mapped and each column is copied, or decompressed, straight into its buffer
+ * in parallel. No parsing or type inference is needed, the column types, units, and ranges are
+ * all stored in the file.
+ */
+class IVW_MODULE_DATAFRAME_API BinaryDataFrameReader : public DataReaderType<DataFrame> {
+public:
+    BinaryDataFrameReader();
+    BinaryDataFrameReader(const BinaryDataFrameReader&) = default;
+    BinaryDataFrameReader(BinaryDataFrameReader&&) noexcept = default;
+    BinaryDataFrameReader& operator=(const BinaryDataFrameReader&) = default;
+    BinaryDataFrameReader& operator=(BinaryDataFrameReader&&) noexcept = default;
+    virtual BinaryDataFrameReader* clone() const override;
+    virtual ~BinaryDataFrameReader() = default;
+    using DataReaderType<DataFrame>::readData;
+
+    /**
+     * @throws DataReaderException if the file cannot be read or is not a valid binary DataFrame
+     */
+    virtual std::shared_ptr<DataFrame> readData(const std::filesystem::path& filePath) override;
+
+    /**
+     * Read a DataFrame from the complete contents of a binary DataFrame file
+     * @throws DataReaderException if @p content is not a valid binary DataFrame
+     */
+    std::shared_ptr<DataFrame> readData(std::span<const unsigned char> content) const;
+};
+
+}  // namespace inviwo
@@ -36,7 +36,6 @@
 
 #include <any>          // for any
 #include <cstddef>      // for size_t
-#include <functional>   // for function
 #include <iosfwd>       // for istream
 #include <memory>       // for shared_ptr
 #include <string>       // for string
@@ -54,6 +53,10 @@ class DataFrame;
  * \brief A reader for comma separated value (CSV) files with customizable delimiters and filters.
  * The default delimiter is ',' and headers are included. Floating point values are stored as
  * float32 unless double precision is enabled.
+ *
+ * Files are memory mapped instead of being read into memory. The rows are found and parsed in
+ * parallel chunks using the thread pool, the column types are determined from the first rows, see
+ * setNumberOfExampleRows.
  */
 class IVW_MODULE_DATAFRAME_API CSVReader : public DataReaderType<DataFrame> {
 public:
@@ -130,7 +133,7 @@ public:
     using DataReaderType<DataFrame>::readData;
 
     /**
-     * read a CSV file from a file
+     * read a CSV file from a file, the file is memory mapped if possible
      *
      * @param fileName   name of the input CSV file
      * @return a DataFrame containing the CSV data
@@ -208,6 +211,10 @@ public:
     static constexpr EmptyField defaultEmptyField = EmptyField::NanOrZero;
 
 private:
+    struct ColumnParser;
+
+    std::shared_ptr<DataFrame> readContent(std::string_view content) const;
+
     struct TypeCounts {
         size_t integer = 0;
         size_t real = 0;
@@ -219,9 +226,8 @@ private:
         size_t nCol, const std::vector<std::pair<std::string_view, size_t>>& rows,
         size_t sampleRows) const;
 
-    std::vector<std::function<void(std::string_view, size_t, size_t)>> addColumns(
-        DataFrame& df, const std::vector<TypeCounts>& types,
-        const std::vector<std::string>& headers) const;
+    std::vector<ColumnParser> addColumns(DataFrame& df, const std::vector<TypeCounts>& types,
+                                         const std::vector<std::string>& headers) const;
 
     bool skipRow(std::string_view row, size_t lineNumber, bool filterOnHeader) const;
 
@@ -0,0 +1,94 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>  // for IVW_MODULE_DATAFRAME_API
+
+#include <inviwo/core/processors/processor.h>                  // for Processor
+#include <inviwo/core/processors/processorinfo.h>              // for ProcessorInfo
+#include <inviwo/core/properties/listproperty.h>               // for ListProperty
+#include <inviwo/core/properties/optionproperty.h>             // for OptionProperty
+#include <inviwo/core/properties/ordinalproperty.h>            // for DoubleProperty
+#include <inviwo/core/properties/propertyownerobserver.h>      // for PropertyOwnerObserver
+#include <inviwo/dataframe/datastructures/dataframe.h>         // for DataFrameInport, DataFrame...
+#include <inviwo/dataframe/properties/columnoptionproperty.h>  // for ColumnOptionProperty
+#include <inviwo/dataframe/util/groupby.h>                     // for Aggregation
+
+#include <cstddef>  // for size_t
+
+namespace inviwo {
+class Property;
+class PropertyOwner;
+
+/** \docpage{org.inviwo.DataFrameGroupBy, DataFrame Group By}
+ * ![](org.inviwo.DataFrameGroupBy.png?classIdentifier=org.inviwo.DataFrameGroupBy)
+ * Groups the rows of a DataFrame by one or more key columns and aggregates all other columns for
+ * each group. The output contains one row per distinct key, in the order of the first occurrence
+ * of each key.
+ *
+ * Columns not supporting the selected aggregation, i.e. categorical columns for all aggregations
+ * except Count and columns with more than one component, are skipped.
+ *
+ * ### Inports
+ *   * __inport__  DataFrame to group
+ *
+ * ### Outports
+ *   * __outport__  DataFrame with the keys and aggregated values of each group
+ *
+ * ### Properties
+ *   * __Key Column__             column used as key for grouping
+ *   * __Secondary Key Columns__  additional key columns
+ *   * __Aggregation__            aggregation applied to the non-key columns
+ *   * __Quantile__               quantile in [0, 1] used by the Quantile aggregation
+ */
+class IVW_MODULE_DATAFRAME_API DataFrameGroupBy : public Processor, public PropertyOwnerObserver {
+public:
+    DataFrameGroupBy();
+    virtual ~DataFrameGroupBy() = default;
+
+    virtual void process() override;
+
+    virtual const ProcessorInfo& getProcessorInfo() const override;
+    static const ProcessorInfo processorInfo_;
+
+private:
+    virtual void onDidRemoveProperty(PropertyOwner* owner, Property* property,
+                                     size_t index) override;
+
+    DataFrameInport inport_;
+    DataFrameOutport outport_;
+
+    ColumnOptionProperty key_;
+    ListProperty secondaryKeys_;
+    OptionProperty<dataframe::Aggregation> aggregation_;
+    DoubleProperty quantile_;
+};
+
+}  // namespace inviwo
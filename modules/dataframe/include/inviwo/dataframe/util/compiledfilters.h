@@ -0,0 +1,113 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>  // for IVW_MODULE_DATAFRAME_API
+
+#include <inviwo/dataframe/util/filters.h>  // for Filters, ItemFilter
+
+#include <cstddef>     // for size_t
+#include <cstdint>     // for uint64_t, uint32_t
+#include <functional>  // for function
+#include <memory>      // for shared_ptr
+#include <span>        // for span
+#include <vector>      // for vector
+
+namespace inviwo {
+class Column;
+class DataFrame;
+
+namespace dataframe {
+
+/**
+ * \brief DataFrame filters compiled into typed column kernels
+ *
+ * Each item filter is turned into a kernel for the data type of its column when the
+ * CompiledFilters is created. Number filters created with filters::intMatch, filters::doubleMatch,
+ * filters::intRange, or filters::doubleRange are evaluated with inlined comparisons directly on the
+ * column data, other number filters call their predicate without any conversion of the values.
+ * String filters on categorical columns are evaluated once per category, and each row then only
+ * looks up its category.
+ *
+ * The kernels write one bit per row into a row mask, where bit `i % 64` of word `i / 64`
+ * represents row `i`. The rows are evaluated in parallel chunks, and the include and exclude
+ * masks are combined using word-level operations.
+ *
+ * The columns of the DataFrame are kept alive by the CompiledFilters, they should not be modified
+ * while it is in use.
+ */
+class IVW_MODULE_DATAFRAME_API CompiledFilters {
+public:
+    using Kernel = std::function<void(size_t firstWord, size_t lastWord, std::uint64_t* mask)>;
+
+    /**
+     * Compile @p filters for the columns of @p dataframe. Filters with a column index outside of
+     * @p dataframe are ignored.
+     */
+    CompiledFilters(const DataFrame& dataframe, const dataframefilters::Filters& filters);
+
+    /**
+     * Compile the include @p filters for @p column, ignoring the column index of the filters.
+     * Here @p column is not kept alive and has to outlive the CompiledFilters.
+     */
+    CompiledFilters(const Column& column,
+                    const std::vector<dataframefilters::ItemFilter>& filters);
+
+    /**
+     * Evaluate the filters and return a mask where the rows matching any of the include filters
+     * and none of the exclude filters are set. If there are no filters all rows are set.
+     */
+    std::vector<std::uint64_t> evaluate() const;
+
+    size_t getNumberOfRows() const { return rows_; }
+
+    /**
+     * Create a kernel evaluating @p filter for the values of @p column. Returns an empty kernel if
+     * @p filter does not apply to the type of @p column, i.e. it matches no rows.
+     */
+    static Kernel compile(const Column& column, const dataframefilters::ItemFilter& filter);
+
+private:
+    size_t rows_;
+    bool selectAll_;
+    std::vector<std::shared_ptr<const Column>> columns_;
+    std::vector<Kernel> include_;
+    std::vector<Kernel> exclude_;
+};
+
+/**
+ * Return the indices of the rows set in @p mask, where @p mask has one bit per row
+ * @see CompiledFilters
+ */
+IVW_MODULE_DATAFRAME_API std::vector<std::uint32_t> maskToRows(std::span<const std::uint64_t> mask);
+
+}  // namespace dataframe
+
+}  // namespace inviwo
@@ -95,7 +95,8 @@ IVW_MODULE_DATAFRAME_API std::shared_ptr<DataFrame> appendRows(const DataFrame&
  * \brief create a new DataFrame by using an inner join of DataFrame \p left and DataFrame \p right.
  * That is only rows with matching keys are kept. The row indices of \p left will be reused.
  *
- * It is assumed that the entries in the key columns are unique. Otherwise results are undefined.
+ * Rows are matched using a parallel hash join. If a key occurs more than once in \p right, the
+ * first matching row is used.
  * @param left
  * @param right
  * @param keyColumns   headers of the columns used as keys for the join operation (default: index
@@ -111,7 +112,8 @@ IVW_MODULE_DATAFRAME_API std::shared_ptr<DataFrame> innerJoin(
  * \brief create a new DataFrame by using an inner join of DataFrame \p left and DataFrame \p right.
  * That is only rows with matching keys are kept. The row indices of \p left will be reused.
  *
- * It is assumed that the entries in the key columns are unique. Otherwise results are undefined.
+ * Rows are matched using a parallel hash join. If a key occurs more than once in \p right, the
+ * first matching row is used.
  * @param left
  * @param right
  * @param keyColumns   headers of the columns used as keys for the join operation
@@ -127,8 +129,8 @@ IVW_MODULE_DATAFRAME_API std::shared_ptr<DataFrame> innerJoin(
  * right. That is all rows of \p left are augmented with matching rows from \p right.  The row
  * indices of \p left will be reused.
  *
- * It is assumed that the entries in the key columns of \p right are unique. Otherwise results are
- * undefined.
+ * Rows are matched using a parallel hash join. If a key occurs more than once in \p right, the
+ * first matching row is used.
  *
  * @param left
  * @param right
@@ -146,8 +148,8 @@ IVW_MODULE_DATAFRAME_API std::shared_ptr<DataFrame> leftJoin(
  * right. That is all rows of \p left are augmented with matching rows from \p right.  The row
  * indices of \p left will be reused.
  *
- * It is assumed that the entries in the key columns of \p right are unique. Otherwise results are
- * undefined.
+ * Rows are matched using a parallel hash join. If a key occurs more than once in \p right, the
+ * first matching row is used.
  *
  * @param left
  * @param right
@@ -201,7 +203,7 @@ std::vector<std::uint32_t> selectRows(std::shared_ptr<const Column> col, Pred pr
  * @param col     column containing data for filtering
  * @param filters predicate to check values from \p col
  * @return list of row indices where rows satisfy all \p filters
- * @see selectRows(const DataFrame&, dataframefilters::Filters)
+ * @see selectRows(const DataFrame&, dataframefilters::Filters), CompiledFilters
  */
 IVW_MODULE_DATAFRAME_API std::vector<std::uint32_t> selectRows(
     const Column& col, const std::vector<dataframefilters::ItemFilter>& filters);
@@ -213,7 +215,7 @@ IVW_MODULE_DATAFRAME_API std::vector<std::uint32_t> selectRows(
  * @param dataframe   column containing data for filtering
  * @param filters     predicate to check values from \p col
  * @return list of row indices where rows satisfy all \p filters
- * @see selectRows(const Column&, dataframefilters::Filters)
+ * @see selectRows(const Column&, dataframefilters::Filters), CompiledFilters
  */
 IVW_MODULE_DATAFRAME_API std::vector<std::uint32_t> selectRows(const DataFrame& dataframe,
                                                                dataframefilters::Filters filters);
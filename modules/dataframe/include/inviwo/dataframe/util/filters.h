@@ -48,6 +48,35 @@ enum class StringComp { Equal, NotEqual, Regex, RegexPartial };
 
 enum class NumberComp { Equal, NotEqual, Less, LessEqual, Greater, GreaterEqual };
 
+/**
+ * Comparison of a number against @p value using @p op, @p epsilon is used for equal and not equal
+ * comparisons of doubles.
+ */
+template <typename T>
+struct NumberComparison {
+    NumberComp op;
+    T value;
+    T epsilon;
+};
+
+/**
+ * Comparison of a number against the inclusive range [@p min, @p max]
+ */
+template <typename T>
+struct RangeComparison {
+    T min;
+    T max;
+};
+
+/**
+ * Description of the comparison made by an ItemFilter. This makes it possible to evaluate the
+ * filter for an entire column with a typed kernel instead of calling ItemFilter::filter for each
+ * item, see dataframe::CompiledFilters. Empty for custom predicates.
+ */
+using Comparison =
+    std::variant<std::monostate, NumberComparison<std::int64_t>, NumberComparison<double>,
+                 RangeComparison<std::int64_t>, RangeComparison<double>>;
+
 /**
  * Predicate functor for filtering items in a specific column of a row. Column indices are
  * zero-based.
@@ -68,6 +97,11 @@ struct ItemFilter {
     FilterFunc filter;
     int column;  //!< zero-based column index
     bool filterOnHeader;
+    /**
+     * Description of @c filter for the number filters created by the functions below, matching
+     * the behavior of @c filter.
+     */
+    Comparison comparison = std::monostate{};
 };
 
 /// create an item filter matching strings with @p match based on @p op
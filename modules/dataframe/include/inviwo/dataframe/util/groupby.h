@@ -0,0 +1,95 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>  // for IVW_MODULE_DATAFRAME_API
+
+#include <inviwo/core/util/fmtutils.h>                  // for FlagFormatter
+#include <inviwo/dataframe/datastructures/dataframe.h>  // for DataFrame
+
+#include <iosfwd>       // for ostream
+#include <memory>       // for shared_ptr
+#include <string>       // for string
+#include <string_view>  // for string_view
+#include <vector>       // for vector
+
+namespace inviwo {
+
+namespace dataframe {
+
+enum class Aggregation { Count, Sum, Mean, Min, Max, Median, Quantile };
+IVW_MODULE_DATAFRAME_API std::string_view enumToStr(Aggregation aggregation);
+IVW_MODULE_DATAFRAME_API std::ostream& operator<<(std::ostream& ss, Aggregation aggregation);
+
+/**
+ * \brief Aggregation of the rows of one column for each group
+ * @see groupBy
+ */
+struct Aggregate {
+    std::string column;
+    Aggregation aggregation = Aggregation::Count;
+    /// quantile in [0, 1], only used by Aggregation::Quantile
+    double quantile = 0.5;
+};
+
+/**
+ * \brief group the rows of \p dataframe by the values of \p keyColumns and aggregate each group
+ *
+ * The result contains one row per distinct key, in the order of the first occurrence of each key
+ * in \p dataframe. It holds the key columns followed by one column per aggregate, named
+ * "<column> (<aggregation>)". NaN is not equal to any value, so every row with a NaN key forms a
+ * group of its own.
+ *
+ * Rows are grouped with the same radix-partitioned hash table as the joins, and the groups are
+ * aggregated in parallel. Count returns the number of values per group as uint32. Sum, Mean,
+ * Median, and Quantile are computed in double precision, while Min and Max keep the column type.
+ * NaN values are ignored by all aggregations. Quantiles are linearly interpolated between the
+ * closest values. Categorical columns only support Count.
+ *
+ * @param dataframe
+ * @param keyColumns   headers of the columns used as keys for grouping
+ * @param aggregates   aggregations to compute for each group
+ * @return DataFrame with the key and the aggregated values of each group
+ * @throws Exception if \p keyColumns is empty, a column does not exist, or an aggregation is not
+ *                   supported for its column
+ */
+IVW_MODULE_DATAFRAME_API std::shared_ptr<DataFrame> groupBy(
+    const DataFrame& dataframe, const std::vector<std::string>& keyColumns,
+    const std::vector<Aggregate>& aggregates);
+
+}  // namespace dataframe
+
+}  // namespace inviwo
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+template <>
+struct fmt::formatter<inviwo::dataframe::Aggregation>
+    : inviwo::FlagFormatter<inviwo::dataframe::Aggregation> {};
+#endif
@@ -0,0 +1,161 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/dataframe/dataframemoduledefine.h>  // for IVW_MODULE_DATAFRAME_API
+
+#include <cstddef>  // for size_t
+#include <cstdint>  // for uint32_t, uint64_t
+#include <limits>   // for numeric_limits
+#include <memory>   // for shared_ptr
+#include <span>     // for span
+#include <utility>  // for pair
+#include <vector>   // for vector
+
+namespace inviwo {
+class Column;
+
+namespace dataframe {
+
+/**
+ * \brief Hashed row keys of one or more DataFrame columns
+ *
+ * Each row is reduced to a 64-bit hash combining the values of all key columns. The hash is only
+ * used to find candidate rows, matches are always verified by comparing the values of the key
+ * columns with equal().
+ *
+ * Values of categorical columns are compared by category. Keys for joining two DataFrames are
+ * created together with RowKeys::join(), which maps the categories of the left columns onto the
+ * categories of the right columns.
+ *
+ * The key columns are referenced and must outlive the RowKeys.
+ */
+class IVW_MODULE_DATAFRAME_API RowKeys {
+public:
+    /**
+     * Create keys for the rows of @p columns, which all have to have the same number of rows.
+     */
+    explicit RowKeys(const std::vector<std::shared_ptr<const Column>>& columns);
+    RowKeys(const RowKeys&) = delete;
+    RowKeys(RowKeys&&) = default;
+    RowKeys& operator=(const RowKeys&) = delete;
+    RowKeys& operator=(RowKeys&&) = default;
+
+    /**
+     * Create matching keys for the left and right columns of @p columns. The columns in each pair
+     * have to have the same data format, and either both or none be categorical.
+     */
+    static std::pair<RowKeys, RowKeys> join(
+        const std::vector<std::pair<std::shared_ptr<const Column>, std::shared_ptr<const Column>>>&
+            columns);
+
+    size_t size() const { return hashes_.size(); }
+    std::uint64_t hash(std::uint32_t row) const { return hashes_[row]; }
+    std::span<const std::uint64_t> hashes() const { return hashes_; }
+
+    /**
+     * Compare the key of @p row with the key of @p otherRow in @p other, where @p other has been
+     * created for the same column types.
+     */
+    bool equal(std::uint32_t row, const RowKeys& other, std::uint32_t otherRow) const {
+        for (size_t i = 0; i < keys_.size(); ++i) {
+            if (!keys_[i].equal(keys_[i].data, row, other.keys_[i].data, otherRow)) return false;
+        }
+        return true;
+    }
+
+private:
+    RowKeys() = default;
+    void addKey(const Column& column);
+    void addKey(std::vector<std::uint32_t> categories);
+    void updateHashes();
+
+    struct Key {
+        const void* data;
+        bool (*equal)(const void*, std::uint32_t, const void*, std::uint32_t);
+        void (*hash)(const void*, std::uint64_t*, size_t, size_t);
+    };
+    std::vector<Key> keys_;
+    std::vector<std::vector<std::uint32_t>> categories_;
+    std::vector<std::uint64_t> hashes_;
+};
+
+/**
+ * \brief Flat open-addressing hash table over the rows of a RowKeys
+ *
+ * The table holds the first row of each distinct key. The rows are radix partitioned on the high
+ * bits of their hash, and each partition is a separate linear probing table of row indices which
+ * is built in parallel. Lookups only touch a single partition, and use the hash stored next to
+ * each row before comparing any key values.
+ */
+class IVW_MODULE_DATAFRAME_API RowHashTable {
+public:
+    static constexpr std::uint32_t npos = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * Build the table over all rows of @p keys. @p keys has to outlive the table.
+     */
+    explicit RowHashTable(const RowKeys& keys);
+
+    /**
+     * Return the first row of the table keys matching @p row in @p probe, or npos if there is none.
+     */
+    std::uint32_t find(const RowKeys& probe, std::uint32_t row) const;
+
+    /**
+     * Return the first matching row of the table keys for each row in @p probe, or npos for rows
+     * without a match. The rows are looked up in parallel.
+     */
+    std::vector<std::uint32_t> find(const RowKeys& probe) const;
+
+    /**
+     * Return the number of distinct keys in the table
+     */
+    size_t size() const { return distinct_; }
+
+private:
+    struct Slot {
+        std::uint64_t hash;
+        std::uint32_t row;
+    };
+    size_t partition(std::uint64_t hash) const {
+        return bits_ == 0 ? 0 : static_cast<size_t>(hash >> (64 - bits_));
+    }
+
+    const RowKeys* keys_;
+    int bits_;
+    std::vector<size_t> offsets_;
+    std::vector<Slot> slots_;
+    size_t distinct_;
+};
+
+}  // namespace dataframe
+
+}  // namespace inviwo
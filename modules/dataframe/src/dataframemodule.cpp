@@ -46,6 +46,8 @@
 #include <modules/base/processors/inputselector.h>
 #include <inviwo/dataframe/datastructures/dataframe.h>                // for DataFrame
 #include <inviwo/dataframe/io/json/dataframepropertyjsonconverter.h>  // IWYU pragma: keep
+#include <inviwo/dataframe/io/binarydataframereader.h>                // for BinaryDataFrameReader
+#include <inviwo/dataframe/io/binarydataframewriter.h>                // for BinaryDataFrameWriter
 #include <inviwo/dataframe/io/csvreader.h>                            // for CSVReader
 #include <inviwo/dataframe/io/csvwriter.h>                            // for CSVWriter
 #include <inviwo/dataframe/io/jsondataframereader.h>
@@ -55,6 +57,7 @@
 #include <inviwo/dataframe/processors/dataframeexporter.h>          // for DataFrameExporter
 #include <inviwo/dataframe/processors/dataframefilter.h>            // for DataFrameFilter
 #include <inviwo/dataframe/processors/dataframefloat32converter.h>  // for DataFrameFloat32Conv...
+#include <inviwo/dataframe/processors/dataframegroupby.h>           // for DataFrameGroupBy
 #include <inviwo/dataframe/processors/dataframejoin.h>              // for DataFrameJoin
 #include <inviwo/dataframe/processors/dataframemetadata.h>          // for DataFrameMetaData
 #include <inviwo/dataframe/processors/dataframesource.h>            // for DataFrameSource
@@ -105,6 +108,7 @@ DataFrameModule::DataFrameModule(InviwoApplication* app)
     // Processors
     registerProcessor<CSVSource>();
     registerProcessor<DataFrameFilter>();
+    registerProcessor<DataFrameGroupBy>();
     registerProcessor<DataFrameJoin>();
     registerProcessor<DataFrameSource>();
     registerProcessor<DataFrameExporter>();
@@ -135,11 +139,13 @@ DataFrameModule::DataFrameModule(InviwoApplication* app)
 
     // Readers and writes
     registerDataReader(std::make_unique<CSVReader>());
+    registerDataReader(std::make_unique<BinaryDataFrameReader>());
     registerDataReader(std::make_unique<JSONDataFrameReader>());
 
     registerDataWriter(std::make_unique<CSVWriter>());
     registerDataWriter(std::make_unique<XMLWriter>());
     registerDataWriter(std::make_unique<JSONDataFrameWriter>());
+    registerDataWriter(std::make_unique<BinaryDataFrameWriter>());
 
     // Data converters
     registerPropertyConverter(std::make_unique<OptionToStringConverter<ColumnOptionProperty>>());
@@ -0,0 +1,253 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/io/binarydataframe.h>
+
+#include <inviwo/core/io/datareaderexception.h>  // for DataReaderException
+#include <inviwo/core/util/exception.h>          // for Exception
+#include <inviwo/core/util/formats.h>            // for DataFormatBase
+#include <inviwo/core/util/sourcecontext.h>      // for SourceContext
+
+#include <algorithm>    // for copy, equal
+#include <bit>          // for bit_cast
+#include <fstream>      // for ifstream
+#include <string>       // for string
+#include <type_traits>  // for is_floating_point_v
+
+#include <fmt/format.h>  // for to_string
+#include <fmt/std.h>     // for formatter<path>
+
+namespace inviwo::binarydataframe {
+
+namespace {
+
+class ByteWriter {
+public:
+    template <typename T>
+    void put(T value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            put(std::bit_cast<std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>>(
+                value));
+        } else {
+            for (size_t i = 0; i < sizeof(T); ++i) {
+                bytes.push_back(static_cast<unsigned char>((value >> (8 * i)) & 0xFFu));
+            }
+        }
+    }
+    void put(std::string_view str) {
+        put(static_cast<std::uint32_t>(str.size()));
+        bytes.insert(bytes.end(), str.begin(), str.end());
+    }
+    std::vector<unsigned char> bytes;
+};
+
+class ByteReader {
+public:
+    explicit ByteReader(std::span<const unsigned char> bytes) : bytes_{bytes} {}
+
+    template <typename T>
+    T get() {
+        if constexpr (std::is_floating_point_v<T>) {
+            using U = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+            return std::bit_cast<T>(get<U>());
+        } else {
+            const auto src = take(sizeof(T));
+            T value{0};
+            for (size_t i = 0; i < sizeof(T); ++i) {
+                value |= static_cast<T>(static_cast<T>(src[i]) << (8 * i));
+            }
+            return value;
+        }
+    }
+    size_t remaining() const { return bytes_.size() - pos_; }
+    std::string getString() {
+        const auto src = take(get<std::uint32_t>());
+        return {reinterpret_cast<const char*>(src.data()), src.size()};
+    }
+
+private:
+    std::span<const unsigned char> take(size_t count) {
+        if (count > bytes_.size() - pos_) {
+            throw DataReaderException(SourceContext{}, "Unexpected end of DataFrame index");
+        }
+        const auto res = bytes_.subspan(pos_, count);
+        pos_ += count;
+        return res;
+    }
+
+    std::span<const unsigned char> bytes_;
+    size_t pos_ = 0;
+};
+
+std::uint8_t toCode(ColumnType type) {
+    switch (type) {
+        case ColumnType::Index:
+            return 0;
+        case ColumnType::Ordinal:
+            return 1;
+        case ColumnType::Categorical:
+            return 2;
+    }
+    return 1;
+}
+
+ColumnType toColumnType(std::uint8_t code) {
+    switch (code) {
+        case 0:
+            return ColumnType::Index;
+        case 1:
+            return ColumnType::Ordinal;
+        case 2:
+            return ColumnType::Categorical;
+        default:
+            throw DataReaderException(SourceContext{}, "Invalid column type in DataFrame index");
+    }
+}
+
+Codec toCodec(std::uint8_t code) {
+    if (code > static_cast<std::uint8_t>(Codec::Deflate)) {
+        throw DataReaderException(SourceContext{}, "Unsupported compression in DataFrame index");
+    }
+    return static_cast<Codec>(code);
+}
+
+// Smallest possible size of a column in the index, i.e. with empty strings and no categories
+constexpr size_t minColumnSize = 4 + 4 + 1 + 4 + 1 + 16 + 16 + 8 + 1 + 8 + 8 + 4;
+
+}  // namespace
+
+std::vector<unsigned char> serializeHeader(std::span<const ColumnInfo> columns) {
+    ByteWriter index;
+    for (const auto& col : columns) {
+        index.put(std::string_view{col.header});
+        index.put(std::string_view{fmt::to_string(col.unit)});
+        index.put(toCode(col.type));
+        index.put(std::string_view{DataFormatBase::get(col.format)->getString()});
+        index.put(static_cast<std::uint8_t>(col.customRange.has_value()));
+        index.put(col.customRange.value_or(dvec2{0.0}).x);
+        index.put(col.customRange.value_or(dvec2{0.0}).y);
+        index.put(col.dataRange.x);
+        index.put(col.dataRange.y);
+        index.put(static_cast<std::uint64_t>(col.rows));
+        index.put(static_cast<std::uint8_t>(col.codec));
+        index.put(static_cast<std::uint64_t>(col.offset));
+        index.put(static_cast<std::uint64_t>(col.storedSize));
+        index.put(static_cast<std::uint32_t>(col.categories.size()));
+        for (const auto& category : col.categories) {
+            index.put(std::string_view{category});
+        }
+    }
+
+    ByteWriter header;
+    header.bytes.assign(magic.begin(), magic.end());
+    header.put(version);
+    header.put(static_cast<std::uint32_t>(columns.size()));
+    header.put(static_cast<std::uint64_t>(index.bytes.size()));
+    header.bytes.insert(header.bytes.end(), index.bytes.begin(), index.bytes.end());
+    return std::move(header.bytes);
+}
+
+std::vector<ColumnInfo> deserializeHeader(std::span<const unsigned char> bytes) {
+    if (bytes.size() < headerSize || !std::equal(magic.begin(), magic.end(), bytes.begin())) {
+        throw DataReaderException(SourceContext{}, "Not a binary DataFrame file");
+    }
+    ByteReader header{bytes.subspan(magic.size(), headerSize - magic.size())};
+    if (const auto fileVersion = header.get<std::uint32_t>(); fileVersion != version) {
+        throw DataReaderException(SourceContext{}, "Unsupported binary DataFrame version: {}",
+                                  fileVersion);
+    }
+    const auto nColumns = header.get<std::uint32_t>();
+    const auto indexSize = header.get<std::uint64_t>();
+    if (indexSize > bytes.size() - headerSize) {
+        throw DataReaderException(SourceContext{}, "Unexpected end of DataFrame index");
+    }
+
+    ByteReader index{bytes.subspan(headerSize, static_cast<size_t>(indexSize))};
+    if (nColumns > indexSize / minColumnSize) {
+        throw DataReaderException(SourceContext{}, "Unexpected end of DataFrame index");
+    }
+    std::vector<ColumnInfo> columns(nColumns);
+    for (auto& col : columns) {
+        col.header = index.getString();
+        col.unit = units::unit_from_string(index.getString());
+        col.type = toColumnType(index.get<std::uint8_t>());
+        const auto format = index.getString();
+        try {
+            col.format = DataFormatBase::get(format)->getId();
+        } catch (const Exception&) {
+            throw DataReaderException(SourceContext{}, "Invalid data format in DataFrame index: {}",
+                                      format);
+        }
+        const bool hasCustomRange = index.get<std::uint8_t>() != 0;
+        const dvec2 customRange{index.get<double>(), index.get<double>()};
+        if (hasCustomRange) col.customRange = customRange;
+        col.dataRange.x = index.get<double>();
+        col.dataRange.y = index.get<double>();
+        col.rows = static_cast<size_t>(index.get<std::uint64_t>());
+        col.codec = toCodec(index.get<std::uint8_t>());
+        col.offset = static_cast<size_t>(index.get<std::uint64_t>());
+        col.storedSize = static_cast<size_t>(index.get<std::uint64_t>());
+        const auto nCategories = index.get<std::uint32_t>();
+        if (nCategories > index.remaining() / 4) {
+            throw DataReaderException(SourceContext{}, "Unexpected end of DataFrame index");
+        }
+        col.categories.resize(nCategories);
+        for (auto& category : col.categories) {
+            category = index.getString();
+        }
+    }
+    return columns;
+}
+
+std::vector<ColumnInfo> readColumnInfo(const std::filesystem::path& path) {
+    auto file = std::ifstream(path, std::ios::in | std::ios::binary);
+    if (!file) {
+        throw DataReaderException(SourceContext{}, "Could not open file: {:?g}", path);
+    }
+
+    std::vector<unsigned char> bytes(headerSize);
+    file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(headerSize));
+    if (!file || !std::equal(magic.begin(), magic.end(), bytes.begin())) {
+        throw DataReaderException(SourceContext{}, "Not a binary DataFrame file: {:?g}", path);
+    }
+    const auto indexSize =
+        ByteReader{std::span{bytes}.subspan(headerSize - 8)}.get<std::uint64_t>();
+    if (indexSize > std::filesystem::file_size(path) - headerSize) {
+        throw DataReaderException(SourceContext{}, "Unexpected end of file: {:?g}", path);
+    }
+    bytes.resize(headerSize + static_cast<size_t>(indexSize));
+    file.read(reinterpret_cast<char*>(bytes.data() + headerSize),
+              static_cast<std::streamsize>(indexSize));
+    if (!file) {
+        throw DataReaderException(SourceContext{}, "Unexpected end of file: {:?g}", path);
+    }
+    return deserializeHeader(bytes);
+}
+
+}  // namespace inviwo::binarydataframe
@@ -0,0 +1,206 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/io/binarydataframereader.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>     // for BufferBase
+#include <inviwo/core/datastructures/buffer/bufferram.h>  // for BufferRAM
+#include <inviwo/core/io/blockcompression.h>              // for decompress
+#include <inviwo/core/io/datareaderexception.h>           // for DataReaderException
+#include <inviwo/core/io/memorymappedfile.h>              // for MemoryMappedFile
+#include <inviwo/core/util/exception.h>                   // for FileException
+#include <inviwo/core/util/fileextension.h>               // for FileExtension
+#include <inviwo/core/util/formatdispatching.h>           // for singleDispatch
+#include <inviwo/core/util/formats.h>                     // for DataFormatBase
+#include <inviwo/core/util/sourcecontext.h>               // for SourceContext
+#include <inviwo/core/util/threadutil.h>                  // for parallelFor
+#include <inviwo/dataframe/datastructures/column.h>       // for Column, CategoricalColumn
+#include <inviwo/dataframe/datastructures/dataframe.h>    // for DataFrame
+#include <inviwo/dataframe/io/binarydataframe.h>          // for ColumnInfo, deserializeHeader
+
+#include <algorithm>  // for min
+#include <bit>        // for endian
+#include <cstdint>    // for uint32_t
+#include <cstring>    // for memcpy
+#include <fstream>    // for ifstream
+#include <iterator>   // for istreambuf_iterator
+#include <optional>   // for optional
+#include <span>       // for span
+#include <vector>     // for vector
+
+namespace inviwo {
+
+namespace {
+
+// Uncompressed columns are copied in pieces of this size to spread large columns over threads
+constexpr size_t copyPieceSize = size_t{4} << 20;
+
+std::shared_ptr<Column> createColumn(const binarydataframe::ColumnInfo& info) {
+    const auto invalid = [&]() {
+        return DataReaderException(SourceContext{}, "Invalid format {} for column '{}'",
+                                   DataFormatBase::get(info.format)->getString(), info.header);
+    };
+
+    switch (info.type) {
+        case ColumnType::Index:
+            if (info.format != DataFormatId::UInt32) throw invalid();
+            return std::make_shared<IndexColumn>(info.header,
+                                                 std::vector<std::uint32_t>(info.rows));
+        case ColumnType::Categorical:
+            if (info.format != DataFormatId::UInt32) throw invalid();
+            return std::make_shared<CategoricalColumn>(info.header,
+                                                       std::vector<std::uint32_t>(info.rows),
+                                                       info.categories, info.unit,
+                                                       info.customRange);
+        case ColumnType::Ordinal:
+        default:
+            if (DataFormatBase::get(info.format)->getComponents() != 1) throw invalid();
+            return dispatching::singleDispatch<std::shared_ptr<Column>,
+                                               dispatching::filter::Scalars>(
+                info.format, [&]<typename T>() {
+                    return std::make_shared<TemplateColumn<T>>(info.header, info.rows, info.unit,
+                                                               info.customRange);
+                });
+    }
+}
+
+/**
+ * Make sure that all category ids in @p data refer to a category of the column, pieces are whole
+ * ids since the piece size is a multiple of their size.
+ */
+void checkCategories(const binarydataframe::ColumnInfo& info, std::span<const unsigned char> data) {
+    if (info.type != ColumnType::Categorical) return;
+
+    const auto count = data.size() / sizeof(std::uint32_t);
+    for (size_t i = 0; i < count; ++i) {
+        std::uint32_t id = 0;
+        std::memcpy(&id, data.data() + i * sizeof(std::uint32_t), sizeof(std::uint32_t));
+        if (id >= info.categories.size()) {
+            throw DataReaderException(SourceContext{},
+                                      "Invalid category id {} in column '{}' with {} categories",
+                                      id, info.header, info.categories.size());
+        }
+    }
+}
+
+}  // namespace
+
+BinaryDataFrameReader::BinaryDataFrameReader() {
+    addExtension(FileExtension("ivdf", "Inviwo binary DataFrame"));
+}
+
+BinaryDataFrameReader* BinaryDataFrameReader::clone() const {
+    return new BinaryDataFrameReader(*this);
+}
+
+std::shared_ptr<DataFrame> BinaryDataFrameReader::readData(const std::filesystem::path& filePath) {
+    const auto localPath = downloadAndCacheIfUrl(filePath);
+    checkExists(localPath);
+
+    std::optional<util::MemoryMappedFile> mapped;
+    try {
+        mapped.emplace(localPath);
+    } catch (const FileException&) {
+        // Fall back to reading the file into memory
+        auto file = open(localPath, std::ios_base::in | std::ios_base::binary);
+        const std::vector<unsigned char> content{std::istreambuf_iterator<char>(file),
+                                                 std::istreambuf_iterator<char>()};
+        return readData(content);
+    }
+
+    return readData(std::span{reinterpret_cast<const unsigned char*>(mapped->data()),
+                              mapped->size()});
+}
+
+std::shared_ptr<DataFrame> BinaryDataFrameReader::readData(
+    std::span<const unsigned char> content) const {
+    if constexpr (std::endian::native != std::endian::little) {
+        throw DataReaderException(SourceContext{},
+                                  "Binary DataFrames are only supported on little endian "
+                                  "platforms");
+    }
+
+    const auto infos = binarydataframe::deserializeHeader(content);
+    for (const auto& info : infos) {
+        const auto bytes = info.rows * DataFormatBase::get(info.format)->getSizeInBytes();
+        if (info.offset > content.size() || info.storedSize > content.size() - info.offset ||
+            (info.codec == binarydataframe::Codec::None && info.storedSize != bytes)) {
+            throw DataReaderException(SourceContext{}, "Invalid data block for column '{}'",
+                                      info.header);
+        }
+        if (info.rows != infos.front().rows) {
+            throw DataReaderException(SourceContext{},
+                                      "Columns have different lengths {}: {} rows and {}: {} rows",
+                                      infos.front().header, infos.front().rows, info.header,
+                                      info.rows);
+        }
+    }
+
+    // Allocating the columns touches all the memory, hence do that in parallel as well
+    std::vector<std::shared_ptr<Column>> columns(infos.size());
+    std::vector<unsigned char*> dest(infos.size());
+    util::parallelFor(infos.size(), [&](size_t i) {
+        columns[i] = createColumn(infos[i]);
+        dest[i] = static_cast<unsigned char*>(
+            columns[i]->getBuffer()->getEditableRepresentation<BufferRAM>()->getData());
+    });
+
+    struct Piece {
+        size_t column;
+        size_t begin;
+        size_t size;
+    };
+    std::vector<Piece> pieces;
+    for (size_t i = 0; i < infos.size(); ++i) {
+        if (infos[i].codec == binarydataframe::Codec::Deflate) {
+            pieces.push_back({i, 0, infos[i].storedSize});
+        } else {
+            for (size_t begin = 0; begin < infos[i].storedSize; begin += copyPieceSize) {
+                pieces.push_back({i, begin, std::min(copyPieceSize, infos[i].storedSize - begin)});
+            }
+        }
+    }
+
+    util::parallelFor(pieces.size(), [&](size_t p) {
+        const auto& [i, begin, size] = pieces[p];
+        const auto src = content.subspan(infos[i].offset + begin, size);
+        const auto bytes = infos[i].rows * DataFormatBase::get(infos[i].format)->getSizeInBytes();
+        if (infos[i].codec == binarydataframe::Codec::Deflate) {
+            util::blockcompression::decompress(src, {dest[i], bytes});
+            checkCategories(infos[i], {dest[i], bytes});
+        } else {
+            std::memcpy(dest[i] + begin, src.data(), size);
+            checkCategories(infos[i], {dest[i] + begin, size});
+        }
+    });
+
+    return std::make_shared<DataFrame>(std::move(columns));
+}
+
+}  // namespace inviwo
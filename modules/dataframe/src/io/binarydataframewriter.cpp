@@ -0,0 +1,149 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/io/binarydataframewriter.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>     // for BufferBase
+#include <inviwo/core/datastructures/buffer/bufferram.h>  // for BufferRAM
+#include <inviwo/core/io/blockcompression.h>              // for compress
+#include <inviwo/core/io/datawriterexception.h>           // for DataWriterException
+#include <inviwo/core/util/fileextension.h>               // for FileExtension
+#include <inviwo/core/util/formats.h>                     // for DataFormatBase
+#include <inviwo/core/util/sourcecontext.h>               // for SourceContext
+#include <inviwo/dataframe/datastructures/column.h>       // for Column, CategoricalColumn
+#include <inviwo/dataframe/datastructures/dataframe.h>    // for DataFrame
+#include <inviwo/dataframe/io/binarydataframe.h>          // for ColumnInfo, serializeHeader
+
+#include <array>    // for array
+#include <bit>      // for endian
+#include <limits>   // for numeric_limits
+#include <ostream>  // for ostream
+#include <span>     // for span
+#include <sstream>  // for stringstream
+
+namespace inviwo {
+
+BinaryDataFrameWriter::BinaryDataFrameWriter() {
+    addExtension(FileExtension("ivdf", "Inviwo binary DataFrame"));
+}
+
+BinaryDataFrameWriter* BinaryDataFrameWriter::clone() const {
+    return new BinaryDataFrameWriter(*this);
+}
+
+void BinaryDataFrameWriter::writeData(const DataFrame* data,
+                                      const std::filesystem::path& filePath) const {
+    auto f = open(filePath, std::ios_base::out | std::ios_base::binary);
+    writeData(data, f);
+}
+
+std::unique_ptr<std::vector<unsigned char>> BinaryDataFrameWriter::writeDataToBuffer(
+    const DataFrame* data, std::string_view) const {
+    std::stringstream ss(std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    writeData(data, ss);
+    auto stringData = std::move(ss).str();
+    return std::make_unique<std::vector<unsigned char>>(stringData.begin(), stringData.end());
+}
+
+void BinaryDataFrameWriter::writeData(const DataFrame* data, std::ostream& os) const {
+    if (!data) return;
+
+    if constexpr (std::endian::native != std::endian::little) {
+        throw DataWriterException(SourceContext{},
+                                  "Binary DataFrames are only supported on little endian "
+                                  "platforms");
+    }
+
+    std::vector<binarydataframe::ColumnInfo> columns;
+    std::vector<std::span<const unsigned char>> blocks;
+    for (const auto& col : *data) {
+        const auto* format = col->getBuffer()->getDataFormat();
+        if (format->getComponents() != 1) {
+            throw DataWriterException(SourceContext{}, "Unsupported non-scalar column '{}' ({})",
+                                      col->getHeader(), format->getString());
+        }
+        const auto* ram = col->getBuffer()->getRepresentation<BufferRAM>();
+        const auto rows = ram->getSize();
+
+        auto& info = columns.emplace_back();
+        info.header = col->getHeader();
+        info.type = col->getColumnType();
+        info.format = format->getId();
+        info.unit = col->getUnit();
+        info.customRange = col->getCustomRange();
+        info.dataRange =
+            rows > 0 ? col->getDataRange() : dvec2{std::numeric_limits<double>::quiet_NaN()};
+        info.rows = rows;
+        if (info.type == ColumnType::Categorical) {
+            info.categories = static_cast<const CategoricalColumn&>(*col).getCategories();
+        }
+        blocks.emplace_back(static_cast<const unsigned char*>(ram->getData()),
+                            rows * format->getSizeInBytes());
+    }
+
+    std::vector<std::vector<unsigned char>> compressed(blocks.size());
+    if (compressColumns) {
+        for (size_t i = 0; i < blocks.size(); ++i) {
+            auto deflated = util::blockcompression::compress(blocks[i]);
+            if (deflated.size() < blocks[i].size() - blocks[i].size() / 8) {
+                compressed[i] = std::move(deflated);
+                blocks[i] = compressed[i];
+                columns[i].codec = binarydataframe::Codec::Deflate;
+            }
+        }
+    }
+
+    // The offsets are stored with a fixed width, hence the header size does not depend on them
+    size_t offset = binarydataframe::serializeHeader(columns).size();
+    for (size_t i = 0; i < columns.size(); ++i) {
+        offset = (offset + binarydataframe::alignment - 1) / binarydataframe::alignment *
+                 binarydataframe::alignment;
+        columns[i].offset = offset;
+        columns[i].storedSize = blocks[i].size();
+        offset += blocks[i].size();
+    }
+
+    const auto header = binarydataframe::serializeHeader(columns);
+    os.write(reinterpret_cast<const char*>(header.data()),
+             static_cast<std::streamsize>(header.size()));
+    size_t pos = header.size();
+    static constexpr std::array<char, binarydataframe::alignment> padding{};
+    for (size_t i = 0; i < columns.size(); ++i) {
+        os.write(padding.data(), static_cast<std::streamsize>(columns[i].offset - pos));
+        os.write(reinterpret_cast<const char*>(blocks[i].data()),
+                 static_cast<std::streamsize>(blocks[i].size()));
+        pos = columns[i].offset + blocks[i].size();
+    }
+
+    if (!os) {
+        throw DataWriterException(SourceContext{}, "Could not write binary DataFrame");
+    }
+}
+
+}  // namespace inviwo
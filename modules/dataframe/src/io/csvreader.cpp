@@ -35,7 +35,9 @@
 #include <inviwo/core/datastructures/unitsystem.h>                      // for Unit
 #include <inviwo/core/io/datareader.h>                                  // for DataReaderType
 #include <inviwo/core/io/datareaderexception.h>                         // for DataReaderException
+#include <inviwo/core/io/memorymappedfile.h>                            // for MemoryMappedFile
 #include <inviwo/core/util/detected.h>                                  // for alwaysFalse
+#include <inviwo/core/util/exception.h>                                 // for FileException
 #include <inviwo/core/util/fileextension.h>                             // for FileExtension
 #include <inviwo/core/util/filesystem.h>                                // for skipByteOrderMark
 #include <inviwo/core/util/logcentral.h>                                // for LogCentral
@@ -44,6 +46,7 @@
 #include <inviwo/core/util/sourcecontext.h>                             // for SourceContext
 #include <inviwo/core/util/stdextensions.h>                             // for overloaded
 #include <inviwo/core/util/stringconversion.h>                          // for trim
+#include <inviwo/core/util/threadutil.h>                                // for parallelFor
 #include <inviwo/core/util/zip.h>                                       // for zipIterator, zipper
 #include <inviwo/dataframe/datastructures/column.h>                     // for CategoricalColumn...
 #include <inviwo/dataframe/datastructures/dataframe.h>                  // for DataFrame
@@ -54,12 +57,15 @@
 #include <clocale>        // for setlocale, LC_ALL
 #include <cstdint>        // for int64_t
 #include <cstdlib>        // for size_t, strtod
+#include <cstring>        // for memcpy
 #include <fstream>        // for char_traits, basi...
 #include <functional>     // for function, __base
 #include <iterator>       // for istreambuf_iterator
 #include <limits>         // for numeric_limits
+#include <numeric>        // for partial_sum, transform_reduce
 #include <optional>       // for optional, nullopt
 #include <regex>          // for regex_match, smatch
+#include <span>           // for span
 #include <sstream>        // for basic_stringbuf<>...
 #include <system_error>   // for errc
 #include <type_traits>    // for remove_reference<...
@@ -68,20 +74,13 @@
 #include <variant>        // for visit
 #include <cerrno>         // for errno
 
-#include <fmt/core.h>  // for format
+#include <fast_float/fast_float.h>  // for from_chars
+#include <fmt/core.h>                // for format
 #include <fmt/std.h>
 #include <glm/gtc/type_ptr.hpp>  // for value_ptr
 
 namespace inviwo {
 
-namespace config {
-#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
-constexpr bool charconv = true;
-#else
-constexpr bool charconv = false;
-#endif
-}  // namespace config
-
 CSVReader::CSVReader(std::string_view delim, bool hasHeader, bool doublePrecision)
     : DataReaderType<DataFrame>()
     , delimiters_(delim)
@@ -241,17 +240,27 @@ std::any CSVReader::getOption(std::string_view key) {
 }
 
 std::shared_ptr<DataFrame> CSVReader::readData(const std::filesystem::path& fileName) {
-    auto file = openAndCacheIfUrl(fileName);
-
-    file.seekg(0, std::ios::end);
-    std::streampos len = file.tellg();
-    file.seekg(0, std::ios::beg);
+    const auto localPath = downloadAndCacheIfUrl(fileName);
+    checkExists(localPath);
 
-    if (len == std::streampos(0)) {
+    if (std::filesystem::file_size(localPath) == 0) {
         throw DataReaderException(SourceContext{}, "Emtpy file: {}", fileName);
     }
 
-    return readData(file);
+    std::optional<util::MemoryMappedFile> mapped;
+    try {
+        mapped.emplace(localPath);
+    } catch (const FileException&) {
+        // Fall back to reading the file into memory
+        auto file = openAndCacheIfUrl(fileName);
+        return readData(file);
+    }
+
+    std::string_view content{reinterpret_cast<const char*>(mapped->data()), mapped->size()};
+    if (content.starts_with("\xEF\xBB\xBF")) {
+        content.remove_prefix(3);
+    }
+    return readContent(content);
 }
 
 namespace util {
@@ -399,18 +408,20 @@ std::optional<T> toNumberLocale(std::string_view str) {
 
 template <typename T>
 std::optional<T> toNumber(std::string_view str, bool cLocale) {
-    if constexpr (config::charconv || !std::is_floating_point_v<T>) {
-        if (!cLocale) return toNumberLocale<T>(str);
+    if (!cLocale) return toNumberLocale<T>(str);
 
-        T val;
-        auto res = std::from_chars(str.data(), str.data() + str.size(), val);
-        if (res.ec == std::errc() && res.ptr == (str.data() + str.size())) {
-            return val;
+    T val;
+    const auto res = [&]() {
+        if constexpr (std::is_floating_point_v<T>) {
+            return fast_float::from_chars(str.data(), str.data() + str.size(), val);
         } else {
-            return std::nullopt;
+            return std::from_chars(str.data(), str.data() + str.size(), val);
         }
+    }();
+    if (res.ec == std::errc() && res.ptr == (str.data() + str.size())) {
+        return val;
     } else {
-        return toNumberLocale<T>(str);
+        return std::nullopt;
     }
 }
 
@@ -429,6 +440,221 @@ std::string_view stripQuotes(std::string_view str) {
 
 }  // namespace util
 
+namespace {
+
+/// Number of bytes per work item when splitting the content into rows
+constexpr size_t scanChunkSize = size_t{1} << 20;
+/// Number of rows per work item when parsing the cells
+constexpr size_t parseChunkRows = size_t{1} << 12;
+
+/**
+ * Find the next line break or quote at or after @p pos. Eight bytes are tested at a time, SIMD
+ * within a register, to quickly skip over the bulk of the content.
+ */
+size_t findLineBreakOrQuote(std::string_view str, size_t pos) {
+    constexpr std::uint64_t ones = 0x0101010101010101;
+    constexpr std::uint64_t highs = 0x8080808080808080;
+    constexpr std::uint64_t lineBreaks = ones * '\n';
+    constexpr std::uint64_t quotes = ones * '"';
+    constexpr auto hasZeroByte = [](std::uint64_t word) {
+        return ((word - ones) & ~word & highs) != 0;
+    };
+
+    for (; pos + sizeof(std::uint64_t) <= str.size(); pos += sizeof(std::uint64_t)) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, str.data() + pos, sizeof(word));
+        if (hasZeroByte(word ^ lineBreaks) || hasZeroByte(word ^ quotes)) break;
+    }
+    for (; pos < str.size(); ++pos) {
+        if (str[pos] == '\n' || str[pos] == '"') return pos;
+    }
+    return std::string_view::npos;
+}
+
+/**
+ * Split @p content into trimmed rows at the line breaks that are not within quotes. The content is
+ * scanned in parallel chunks, a first pass counts the quotes and line breaks of each chunk to
+ * find the quote state and line number at the beginning of every chunk.
+ * @return the rows and their line numbers
+ * @throws DataReaderException if there is an unmatched quote
+ */
+std::vector<std::pair<std::string_view, size_t>> splitRows(std::string_view content) {
+    if (content.empty()) return {};
+
+    const size_t nChunks = (content.size() + scanChunkSize - 1) / scanChunkSize;
+    const auto chunk = [&](size_t i) { return content.substr(i * scanChunkSize, scanChunkSize); };
+
+    struct Counts {
+        size_t quotes = 0;
+        size_t lineBreaks = 0;
+    };
+    std::vector<Counts> counts(nChunks + 1);
+    util::parallelFor(nChunks, [&](size_t i) {
+        const auto str = chunk(i);
+        counts[i + 1].quotes = std::ranges::count(str, '"');
+        counts[i + 1].lineBreaks = std::ranges::count(str, '\n');
+    });
+    for (size_t i = 1; i <= nChunks; ++i) {
+        counts[i].quotes += counts[i - 1].quotes;
+        counts[i].lineBreaks += counts[i - 1].lineBreaks;
+    }
+
+    struct LineBreak {
+        size_t pos;
+        size_t nextLine;
+    };
+    std::vector<std::vector<LineBreak>> lineBreaks(nChunks);
+    util::parallelFor(nChunks, [&](size_t i) {
+        const auto str = chunk(i);
+        bool quoted = counts[i].quotes % 2 == 1;
+        size_t line = counts[i].lineBreaks + 1;
+        for (auto pos = findLineBreakOrQuote(str, 0); pos != std::string_view::npos;
+             pos = findLineBreakOrQuote(str, pos + 1)) {
+            if (str[pos] == '"') {
+                quoted = !quoted;
+            } else {
+                ++line;
+                if (!quoted) lineBreaks[i].push_back({i * scanChunkSize + pos, line});
+            }
+        }
+    });
+
+    std::vector<std::pair<std::string_view, size_t>> rows;
+    rows.reserve(std::transform_reduce(lineBreaks.begin(), lineBreaks.end(), size_t{1},
+                                       std::plus<>{}, [](auto& item) { return item.size(); }));
+    size_t begin = 0;
+    size_t line = 1;
+    for (const auto& chunkLineBreaks : lineBreaks) {
+        for (const auto& [pos, nextLine] : chunkLineBreaks) {
+            rows.emplace_back(util::trim(content.substr(begin, pos - begin)), line);
+            begin = pos + 1;
+            line = nextLine;
+        }
+    }
+    if (counts.back().quotes % 2 == 1) {
+        throw DataReaderException(SourceContext{}, "Detected unmatched quote starting on line: {}",
+                                  line);
+    }
+    rows.emplace_back(util::trim(content.substr(begin)), line);
+
+    return rows;
+}
+
+/**
+ * The cells of a block of rows, stored row by row.
+ */
+struct CellBlock {
+    std::span<const std::string_view> cells;
+    std::span<const size_t> lines;
+    size_t nCol;
+
+    size_t rows() const { return lines.size(); }
+    std::string_view cell(size_t row, size_t col) const { return cells[row * nCol + col]; }
+};
+
+template <typename T>
+struct NumberColumn {
+    void resize(size_t rows, [[maybe_unused]] size_t blocks) { data->resize(rows); }
+
+    void parse(const CellBlock& block, size_t col, size_t offset,
+               [[maybe_unused]] size_t blockIndex, bool cLocale) {
+        T* dst = data->data() + offset;
+        for (size_t row = 0; row < block.rows(); ++row) {
+            const auto str = block.cell(row, col);
+            if (str.empty()) {
+                switch (emptyField) {
+                    case CSVReader::EmptyField::Throw:
+                        throw DataReaderException(SourceContext{},
+                                                  "Empty field on line {}, column {}",
+                                                  block.lines[row], col + 1);
+                    case CSVReader::EmptyField::NanOrZero:
+                        if constexpr (std::is_floating_point_v<T>) {
+                            dst[row] = std::numeric_limits<T>::quiet_NaN();
+                        } else {
+                            dst[row] = T{};
+                        }
+                        break;
+                    case CSVReader::EmptyField::EmptyOrZero:
+                    default:
+                        dst[row] = T{};
+                        break;
+                }
+            } else if (auto val = util::toNumber<T>(str, cLocale)) {
+                dst[row] = *val;
+            } else {
+                throw DataReaderException(SourceContext{}, "Invalid format on line {}, column {}",
+                                          block.lines[row], col + 1);
+            }
+        }
+    }
+
+    void finish([[maybe_unused]] std::span<const size_t> offsets) {}
+
+    std::vector<T>* data;
+    CSVReader::EmptyField emptyField;
+};
+
+/**
+ * Each block is parsed using block local category ids, which are mapped to the ids of the column
+ * once all blocks are done. The categories are added to the column in order of appearance, just
+ * as if the rows would have been added one by one.
+ */
+struct CategoryColumn {
+    void resize(size_t rows, size_t blocks) {
+        ids->resize(rows);
+        categories.resize(blocks);
+    }
+
+    void parse(const CellBlock& block, size_t col, size_t offset, size_t blockIndex,
+               [[maybe_unused]] bool cLocale) {
+        std::uint32_t* dst = ids->data() + offset;
+        auto& blockCategories = categories[blockIndex];
+        std::unordered_map<std::string_view, std::uint32_t> lookup;
+        for (size_t row = 0; row < block.rows(); ++row) {
+            const auto str =
+                stripQuotes ? util::stripQuotes(block.cell(row, col)) : block.cell(row, col);
+            const auto [it, inserted] =
+                lookup.try_emplace(str, static_cast<std::uint32_t>(blockCategories.size()));
+            if (inserted) blockCategories.push_back(str);
+            dst[row] = it->second;
+        }
+    }
+
+    void finish(std::span<const size_t> offsets) {
+        std::vector<std::vector<std::uint32_t>> toColumnIds(categories.size());
+        for (auto&& [blockCategories, blockIds] : util::zip(categories, toColumnIds)) {
+            for (const auto& category : blockCategories) {
+                blockIds.push_back(column->addCategory(category));
+            }
+        }
+        util::parallelFor(categories.size(), [&](size_t block) {
+            std::for_each(ids->begin() + offsets[block], ids->begin() + offsets[block + 1],
+                          [&](std::uint32_t& id) { id = toColumnIds[block][id]; });
+        });
+    }
+
+    CategoricalColumn* column;
+    std::vector<std::uint32_t>* ids;
+    bool stripQuotes;
+    std::vector<std::vector<std::string_view>> categories;
+};
+
+template <typename T>
+NumberColumn<T> addNumberColumn(DataFrame& df, std::string_view header, Unit unit,
+                                CSVReader::EmptyField emptyField) {
+    auto col = df.addColumn<T>(header, 0, unit);
+    return {&col->getTypedBuffer()->getEditableRAMRepresentation()->getDataContainer(),
+            emptyField};
+}
+
+}  // namespace
+
+struct CSVReader::ColumnParser {
+    std::variant<NumberColumn<int>, NumberColumn<float>, NumberColumn<double>,
+                 NumberColumn<std::uint32_t>, CategoryColumn>
+        column;
+};
+
 std::vector<CSVReader::TypeCounts> CSVReader::findCellTypes(
     size_t nCol, const std::vector<std::pair<std::string_view, size_t>>& rows,
     size_t sampleRows) const {
@@ -471,64 +697,21 @@ std::vector<CSVReader::TypeCounts> CSVReader::findCellTypes(
     return counts;
 }
 
-template <typename T, bool index = false>
-std::function<void(std::string_view, size_t, size_t)> addColumn(DataFrame& df,
-                                                                std::string_view header, Unit unit,
-                                                                CSVReader::EmptyField emptyField,
-                                                                bool cLocale) {
-    auto& data = [&]() -> decltype(auto) {
-        if constexpr (index && std::is_same_v<T, std::uint32_t>) {
-            df.getIndexColumn()->setHeader(header);
-            df.getIndexColumn()->setUnit(unit);
-            return df.getIndexColumn()
-                ->getTypedBuffer()
-                ->getEditableRAMRepresentation()
-                ->getDataContainer();
-        } else {
-            return df.addColumn<T>(header, 0, unit)
-                ->getTypedBuffer()
-                ->getEditableRAMRepresentation()
-                ->getDataContainer();
-        }
-    }();
-    return [&data, cLocale, emptyField](std::string_view str, size_t line, size_t col) {
-        if (str.empty()) {
-            switch (emptyField) {
-                case CSVReader::EmptyField::Throw:
-                    throw DataReaderException(SourceContext{}, "Empty field on line {}, column {}",
-                                              line, col);
-                case CSVReader::EmptyField::NanOrZero:
-                    if constexpr (std::is_floating_point_v<T>) {
-                        data.push_back(std::numeric_limits<T>::quiet_NaN());
-                    } else {
-                        data.emplace_back();
-                    }
-                    break;
-                case CSVReader::EmptyField::EmptyOrZero:
-                    data.emplace_back();
-                    break;
-                default:
-                    data.emplace_back();
-                    break;
-            }
-        } else if (auto val = util::toNumber<T>(str, cLocale)) {
-            data.push_back(*val);
-        } else {
-            throw DataReaderException(SourceContext{}, "Invalid format on line {}, column {}", line,
-                                      col);
-        }
-    };
-}
-
-std::vector<std::function<void(std::string_view, size_t, size_t)>> CSVReader::addColumns(
+std::vector<CSVReader::ColumnParser> CSVReader::addColumns(
     DataFrame& df, const std::vector<TypeCounts>& typeCounts,
     const std::vector<std::string>& headers) const {
 
-    const bool cLocale = locale_ == "C";
     std::regex re{unitRegexp_};
     std::smatch m;
 
-    std::vector<std::function<void(std::string_view, size_t, size_t)>> appenders;
+    auto categorical = [&](const std::string& header) {
+        auto col = df.addCategoricalColumn(header);
+        return ColumnParser{CategoryColumn{
+            col.get(), &col->getTypedBuffer()->getEditableRAMRepresentation()->getDataContainer(),
+            stripQuotes_, {}}};
+    };
+
+    std::vector<ColumnParser> parsers;
     for (auto&& [counts, header] : util::zip(typeCounts, headers)) {
         auto headerCopy = header;
         Unit unit{};
@@ -541,36 +724,26 @@ std::vector<std::function<void(std::string_view, size_t, size_t)>> CSVReader::ad
         }
 
         if (counts.index) {
-            appenders.push_back(addColumn<std::uint32_t, true>(
-                df, headerCopy, unit, CSVReader::EmptyField::Throw, cLocale));
-        } else if (stripQuotes_ && counts.string > 0) {
-            auto col = df.addCategoricalColumn(header);
-            appenders.emplace_back([f = col->addMany()](std::string_view str, size_t, size_t) {
-                f(util::stripQuotes(str));
-            });
+            auto col = df.getIndexColumn();
+            col->setHeader(headerCopy);
+            col->setUnit(unit);
+            parsers.push_back({NumberColumn<std::uint32_t>{
+                &col->getTypedBuffer()->getEditableRAMRepresentation()->getDataContainer(),
+                EmptyField::Throw}});
         } else if (counts.string > 0) {
-            auto col = df.addCategoricalColumn(header);
-            appenders.emplace_back(
-                [f = col->addMany()](std::string_view str, size_t, size_t) { f(str); });
+            parsers.push_back(categorical(header));
         } else if (doublePrecision_ && counts.real > 0) {
-            appenders.push_back(addColumn<double>(df, headerCopy, unit, emptyField_, cLocale));
+            parsers.push_back({addNumberColumn<double>(df, headerCopy, unit, emptyField_)});
         } else if (!doublePrecision_ && counts.real > 0) {
-            appenders.push_back(addColumn<float>(df, headerCopy, unit, emptyField_, cLocale));
+            parsers.push_back({addNumberColumn<float>(df, headerCopy, unit, emptyField_)});
         } else if (counts.integer > 0) {
-            appenders.push_back(addColumn<int>(df, headerCopy, unit, emptyField_, cLocale));
-        } else if (stripQuotes_) {
-            auto col = df.addCategoricalColumn(header);
-            appenders.emplace_back([f = col->addMany()](std::string_view str, size_t, size_t) {
-                f(util::stripQuotes(str));
-            });
+            parsers.push_back({addNumberColumn<int>(df, headerCopy, unit, emptyField_)});
         } else {
-            auto col = df.addCategoricalColumn(header);
-            appenders.emplace_back(
-                [f = col->addMany()](std::string_view str, size_t, size_t) { f(str); });
+            parsers.push_back(categorical(header));
         }
     }
 
-    return appenders;
+    return parsers;
 }
 
 bool CSVReader::skipRow(std::string_view row, size_t lineNumber, bool filterOnHeader) const {
@@ -642,8 +815,14 @@ bool CSVReader::skipRow(std::string_view row, size_t lineNumber, bool filterOnHe
 std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
     filesystem::skipByteOrderMark(stream);
 
+    const std::string content{std::istreambuf_iterator<char>(stream),
+                              std::istreambuf_iterator<char>()};
+    return readContent(content);
+}
+
+std::shared_ptr<DataFrame> CSVReader::readContent(std::string_view content) const {
     util::OnScopeExit cleanup{nullptr};
-    if (!config::charconv || locale_ != "C") {
+    if (locale_ != "C") {
         // We need to use the C locale here to force use of decimal "."
         auto prevLocale = std::setlocale(LC_ALL, nullptr);
         std::string prev{prevLocale ? prevLocale : ""};
@@ -652,20 +831,33 @@ std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
         }
         cleanup.setAction([prev]() { std::setlocale(LC_ALL, prev.c_str()); });
     }
+    const bool cLocale = locale_ == "C";
 
-    std::string content{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
-    std::string_view trimmed{content};
-    if (auto pos = trimmed.find_last_not_of(" \f\n\r\t\v"); pos != std::string_view::npos) {
-        trimmed = trimmed.substr(0, pos + 1);
+    if (auto pos = content.find_last_not_of(" \f\n\r\t\v"); pos != std::string_view::npos) {
+        content = content.substr(0, pos + 1);
     }
 
-    std::vector<std::pair<std::string_view, size_t>> rows;
-    util::parse(trimmed, "\n", std::nullopt, std::nullopt,
-                [&](std::string_view line, [[maybe_unused]] size_t index, size_t lineNumber) {
-                    if (!skipRow(line, lineNumber, true)) {
-                        rows.emplace_back(line, lineNumber);
-                    }
-                });
+    const auto forEachBlock = [](size_t rows, auto&& func) {
+        util::parallelFor((rows + parseChunkRows - 1) / parseChunkRows, [&](size_t block) {
+            const auto begin = block * parseChunkRows;
+            func(block, begin, std::min(begin + parseChunkRows, rows));
+        });
+    };
+
+    auto rows = splitRows(content);
+    {
+        std::vector<unsigned char> keep(rows.size());
+        forEachBlock(rows.size(), [&](size_t, size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                keep[i] = !skipRow(rows[i].first, rows[i].second, true);
+            }
+        });
+        size_t kept = 0;
+        for (size_t i = 0; i < rows.size(); ++i) {
+            if (keep[i]) rows[kept++] = rows[i];
+        }
+        rows.resize(kept);
+    }
 
     if (rows.empty()) {
         throw DataReaderException("No data");
@@ -698,16 +890,54 @@ std::shared_ptr<DataFrame> CSVReader::readData(std::istream& stream) const {
             throw Exception("Unable to use first column as index, invalid data found");
         }
     }
-    const auto appenders = addColumns(*df, types, headers);
+    auto parsers = addColumns(*df, types, headers);
+    const size_t nCol = headers.size();
+
+    // Apply the row filters and find where the rows of each block end up
+    const size_t nBlocks = (rows.size() + parseChunkRows - 1) / parseChunkRows;
+    std::vector<unsigned char> keep(rows.size());
+    std::vector<size_t> offsets(nBlocks + 1, 0);
+    forEachBlock(rows.size(), [&](size_t block, size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            keep[i] = !skipRow(rows[i].first, rows[i].second, false);
+            offsets[block + 1] += keep[i];
+        }
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
 
-    for (const auto& [row, lineNumber] : rows) {
-        if (!skipRow(row, lineNumber, false)) {
-            util::parse(row, delimiters_, headers.size(), lineNumber,
-                        [&, l = lineNumber](std::string_view cell, size_t index,
-                                            [[maybe_unused]] size_t part) {
-                            appenders[index](cell, l, index + 1);
+    for (auto& parser : parsers) {
+        std::visit([&](auto& column) { column.resize(offsets.back(), nBlocks); }, parser.column);
+    }
+
+    forEachBlock(rows.size(), [&](size_t block, size_t begin, size_t end) {
+        std::vector<std::string_view> cells;
+        std::vector<size_t> lines;
+        cells.reserve((end - begin) * nCol);
+        lines.reserve(end - begin);
+        for (size_t i = begin; i < end; ++i) {
+            if (!keep[i]) continue;
+            const auto& [row, lineNumber] = rows[i];
+            const auto first = cells.size();
+            cells.resize(first + nCol);
+            util::parse(row, delimiters_, nCol, lineNumber,
+                        [&](std::string_view cell, size_t index, [[maybe_unused]] size_t part) {
+                            cells[first + index] = cell;
                         });
+            lines.push_back(lineNumber);
         }
+
+        const CellBlock cellBlock{cells, lines, nCol};
+        for (auto&& [col, parser] : util::enumerate(parsers)) {
+            std::visit(
+                [&](auto& column) {
+                    column.parse(cellBlock, col, offsets[block], block, cLocale);
+                },
+                parser.column);
+        }
+    });
+
+    for (auto& parser : parsers) {
+        std::visit([&](auto& column) { column.finish(offsets); }, parser.column);
     }
 
     if (!firstColIndices_) {
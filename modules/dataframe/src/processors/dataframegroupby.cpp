@@ -0,0 +1,131 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/processors/dataframegroupby.h>
+
+#include <inviwo/core/processors/processor.h>                  // for Processor
+#include <inviwo/core/processors/processorinfo.h>              // for ProcessorInfo
+#include <inviwo/core/processors/processorstate.h>             // for CodeState, CodeState::Expe...
+#include <inviwo/core/processors/processortags.h>              // for Tags
+#include <inviwo/core/properties/invalidationlevel.h>          // for InvalidationLevel
+#include <inviwo/core/properties/listproperty.h>               // for ListProperty
+#include <inviwo/core/properties/optionproperty.h>             // for OptionProperty
+#include <inviwo/core/properties/ordinalproperty.h>            // for DoubleProperty
+#include <inviwo/core/util/stdextensions.h>                    // for contains
+#include <inviwo/dataframe/datastructures/column.h>            // for Column, ColumnType
+#include <inviwo/dataframe/datastructures/dataframe.h>         // for DataFrameInport, DataFrame...
+#include <inviwo/dataframe/properties/columnoptionproperty.h>  // for ColumnOptionProperty
+#include <inviwo/dataframe/util/groupby.h>                     // for groupBy, Aggregate
+
+#include <memory>  // for shared_ptr, make_unique
+#include <string>  // for string
+#include <vector>  // for vector
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo DataFrameGroupBy::processorInfo_{
+    "org.inviwo.DataFrameGroupBy",  // Class identifier
+    "DataFrame Group By",           // Display name
+    "DataFrame",                    // Category
+    CodeState::Experimental,        // Code state
+    "CPU, DataFrame",               // Tags
+};
+const ProcessorInfo& DataFrameGroupBy::getProcessorInfo() const { return processorInfo_; }
+
+DataFrameGroupBy::DataFrameGroupBy()
+    : Processor()
+    , inport_("inport")
+    , outport_("outport")
+    , key_("key", "Key Column", inport_)
+    , secondaryKeys_("secondaryKeys", "Secondary Key Columns",
+                     std::make_unique<ColumnOptionProperty>("key2", "Key Column 2", inport_))
+    , aggregation_("aggregation", "Aggregation",
+                   {{"count", "Count", dataframe::Aggregation::Count},
+                    {"sum", "Sum", dataframe::Aggregation::Sum},
+                    {"mean", "Mean", dataframe::Aggregation::Mean},
+                    {"min", "Min", dataframe::Aggregation::Min},
+                    {"max", "Max", dataframe::Aggregation::Max},
+                    {"median", "Median", dataframe::Aggregation::Median},
+                    {"quantile", "Quantile", dataframe::Aggregation::Quantile}},
+                   2)
+    , quantile_("quantile", "Quantile", 0.5, 0.0, 1.0) {
+
+    addPorts(inport_, outport_);
+
+    quantile_.visibilityDependsOn(
+        aggregation_, [](const auto& p) { return p == dataframe::Aggregation::Quantile; });
+
+    addProperties(key_, secondaryKeys_, aggregation_, quantile_);
+
+    inport_.onChange([&]() {
+        for (auto p : secondaryKeys_) {
+            if (auto keyProp = dynamic_cast<ColumnOptionProperty*>(p)) {
+                if (inport_.hasData()) {
+                    keyProp->setOptions(*inport_.getData());
+                }
+            }
+        }
+    });
+
+    secondaryKeys_.PropertyOwnerObservable::addObserver(this);
+}
+
+void DataFrameGroupBy::process() {
+    auto input = inport_.getData();
+
+    std::vector<std::string> keys{key_.getSelectedColumnHeader()};
+    for (auto p : secondaryKeys_) {
+        if (auto keyProp = dynamic_cast<ColumnOptionProperty*>(p)) {
+            keys.push_back(keyProp->getSelectedColumnHeader());
+        }
+    }
+
+    std::vector<dataframe::Aggregate> aggregates;
+    for (const auto& column : *input) {
+        if (column->getColumnType() == ColumnType::Index ||
+            util::contains(keys, column->getHeader())) {
+            continue;
+        }
+        if (column->getColumnType() == ColumnType::Categorical) {
+            if (aggregation_ != dataframe::Aggregation::Count) continue;
+        } else if (column->getBuffer()->getDataFormat()->getComponents() != 1) {
+            continue;
+        }
+        aggregates.push_back({column->getHeader(), aggregation_, quantile_});
+    }
+
+    outport_.setData(dataframe::groupBy(*input, keys, aggregates));
+}
+
+void DataFrameGroupBy::onDidRemoveProperty(PropertyOwner* owner, Property*, size_t) {
+    owner->invalidate(InvalidationLevel::InvalidOutput, nullptr);
+}
+
+}  // namespace inviwo
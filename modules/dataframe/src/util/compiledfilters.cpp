@@ -0,0 +1,256 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/util/compiledfilters.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>              // for Buffer
+#include <inviwo/core/datastructures/buffer/bufferram.h>           // for BufferRAM
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>  // for BufferRAMPrecision
+#include <inviwo/core/util/formatdispatching.h>                    // for PrecisionValueType
+#include <inviwo/core/util/stdextensions.h>                        // for overloaded
+#include <inviwo/core/util/threadutil.h>                           // for parallelFor
+#include <inviwo/dataframe/datastructures/column.h>                // for CategoricalColumn
+#include <inviwo/dataframe/datastructures/dataframe.h>             // for DataFrame
+
+#include <algorithm>    // for min
+#include <bit>          // for popcount, countr_zero
+#include <cmath>        // for abs
+#include <numeric>      // for partial_sum
+#include <string_view>  // for string_view
+#include <type_traits>  // for is_integral_v, is_floating_point_v
+#include <variant>      // for visit, get_if
+
+namespace inviwo::dataframe {
+
+namespace {
+
+// Number of mask words evaluated per parallel task, i.e. 64k rows
+constexpr size_t chunkWords = 1024;
+
+using Kernel = CompiledFilters::Kernel;
+
+template <typename T, typename Pred>
+Kernel makeKernel(const T* data, size_t size, Pred pred) {
+    return [data, size, pred](size_t firstWord, size_t lastWord, std::uint64_t* mask) {
+        lastWord = std::min(lastWord, (size + 63) / 64);
+        for (size_t w = firstWord; w < lastWord; ++w) {
+            const auto* values = data + w * 64;
+            const auto count = std::min(size_t{64}, size - w * 64);
+            std::uint64_t bits = 0;
+            for (size_t i = 0; i < count; ++i) {
+                bits |= static_cast<std::uint64_t>(pred(values[i])) << i;
+            }
+            mask[w] |= bits;
+        }
+    };
+}
+
+// Mirrors the predicates created by filters::intMatch and filters::doubleMatch
+template <typename T, typename U>
+Kernel numberKernel(const T* data, size_t size, const filters::NumberComparison<U>& comp) {
+    const U v = comp.value;
+    const U eps = comp.epsilon;
+    switch (comp.op) {
+        case filters::NumberComp::NotEqual:
+            if constexpr (std::is_floating_point_v<U>) {
+                return makeKernel(data, size,
+                                  [v, eps](T x) { return std::abs(static_cast<U>(x) - v) > eps; });
+            } else {
+                return makeKernel(data, size, [v](T x) { return static_cast<U>(x) != v; });
+            }
+        case filters::NumberComp::Less:
+            return makeKernel(data, size, [v](T x) { return static_cast<U>(x) < v; });
+        case filters::NumberComp::LessEqual:
+            return makeKernel(data, size, [v](T x) { return static_cast<U>(x) <= v; });
+        case filters::NumberComp::Greater:
+            return makeKernel(data, size, [v](T x) { return static_cast<U>(x) > v; });
+        case filters::NumberComp::GreaterEqual:
+            return makeKernel(data, size, [v](T x) { return static_cast<U>(x) >= v; });
+        case filters::NumberComp::Equal:
+        default:
+            if constexpr (std::is_floating_point_v<U>) {
+                return makeKernel(data, size,
+                                  [v, eps](T x) { return std::abs(static_cast<U>(x) - v) <= eps; });
+            } else {
+                return makeKernel(data, size, [v](T x) { return static_cast<U>(x) == v; });
+            }
+    }
+}
+
+template <typename T, typename U>
+Kernel typedKernel(const std::vector<T>& data, const dataframefilters::ItemFilter& filter) {
+    const auto* func = std::get_if<std::function<bool(U)>>(&filter.filter);
+    if (!func) return {};
+
+    return std::visit(
+        util::overloaded{
+            [&](const filters::NumberComparison<U>& comp) {
+                return numberKernel(data.data(), data.size(), comp);
+            },
+            [&](const filters::RangeComparison<U>& comp) {
+                return makeKernel(data.data(), data.size(), [min = comp.min, max = comp.max](T x) {
+                    return static_cast<U>(x) >= min && static_cast<U>(x) <= max;
+                });
+            },
+            [&](const auto&) {
+                return makeKernel(data.data(), data.size(),
+                                  [f = *func](T x) { return f(static_cast<U>(x)); });
+            }},
+        filter.comparison);
+}
+
+void clearTail(std::vector<std::uint64_t>& mask, size_t rows) {
+    if (const auto tail = rows % 64; tail != 0) {
+        mask.back() &= (std::uint64_t{1} << tail) - 1;
+    }
+}
+
+}  // namespace
+
+CompiledFilters::CompiledFilters(const DataFrame& dataframe,
+                                 const dataframefilters::Filters& filters)
+    : rows_{dataframe.getNumberOfRows()}, selectAll_{true} {
+
+    const int colCount = static_cast<int>(dataframe.getNumberOfColumns());
+    auto add = [&](const std::vector<dataframefilters::ItemFilter>& items,
+                   std::vector<Kernel>& kernels) {
+        for (const auto& filter : items) {
+            if (filter.column < 0 || filter.column >= colCount) continue;
+            selectAll_ = false;
+            auto column = dataframe.getColumn(filter.column);
+            if (auto kernel = compile(*column, filter)) {
+                kernels.push_back(std::move(kernel));
+                columns_.push_back(std::move(column));
+            }
+        }
+    };
+    add(filters.include, include_);
+    add(filters.exclude, exclude_);
+}
+
+CompiledFilters::CompiledFilters(const Column& column,
+                                 const std::vector<dataframefilters::ItemFilter>& filters)
+    : rows_{column.getSize()}, selectAll_{filters.empty()} {
+    for (const auto& filter : filters) {
+        if (auto kernel = compile(column, filter)) {
+            include_.push_back(std::move(kernel));
+        }
+    }
+}
+
+std::vector<std::uint64_t> CompiledFilters::evaluate() const {
+    const auto nWords = (rows_ + 63) / 64;
+    std::vector<std::uint64_t> mask(nWords, selectAll_ ? ~std::uint64_t{0} : std::uint64_t{0});
+
+    if (!selectAll_ && !include_.empty()) {
+        std::vector<std::uint64_t> exclude(exclude_.empty() ? 0 : nWords, 0);
+        const auto nChunks = (nWords + chunkWords - 1) / chunkWords;
+        util::parallelFor(nChunks, [&](size_t chunk) {
+            const auto first = chunk * chunkWords;
+            const auto last = std::min(first + chunkWords, nWords);
+            for (const auto& kernel : include_) {
+                kernel(first, last, mask.data());
+            }
+            if (exclude_.empty()) return;
+            for (const auto& kernel : exclude_) {
+                kernel(first, last, exclude.data());
+            }
+            for (size_t w = first; w < last; ++w) {
+                mask[w] &= ~exclude[w];
+            }
+        });
+    }
+
+    clearTail(mask, rows_);
+    return mask;
+}
+
+Kernel CompiledFilters::compile(const Column& column, const dataframefilters::ItemFilter& filter) {
+    if (column.getColumnType() == ColumnType::Categorical) {
+        const auto* func = std::get_if<std::function<bool(std::string_view)>>(&filter.filter);
+        if (!func) return {};
+
+        const auto& catCol = static_cast<const CategoricalColumn&>(column);
+        std::vector<unsigned char> matches;
+        for (const auto& category : catCol.getCategories()) {
+            matches.push_back((*func)(category) ? 1 : 0);
+        }
+        const auto& ids = catCol.getTypedBuffer()->getRAMRepresentation()->getDataContainer();
+        return makeKernel(ids.data(), ids.size(), [matches = std::move(matches)](std::uint32_t id) {
+            return matches[id] != 0;
+        });
+    }
+
+    return column.getBuffer()
+        ->getRepresentation<BufferRAM>()
+        ->dispatch<Kernel, dispatching::filter::Scalars>([&](auto ram) -> Kernel {
+            using T = util::PrecisionValueType<decltype(ram)>;
+            if constexpr (std::is_integral_v<T>) {
+                return typedKernel<T, std::int64_t>(ram->getDataContainer(), filter);
+            } else if constexpr (std::is_floating_point_v<T>) {
+                return typedKernel<T, double>(ram->getDataContainer(), filter);
+            } else {
+                return {};
+            }
+        });
+}
+
+std::vector<std::uint32_t> maskToRows(std::span<const std::uint64_t> mask) {
+    const auto nChunks = (mask.size() + chunkWords - 1) / chunkWords;
+    auto words = [&](size_t chunk) {
+        return mask.subspan(chunk * chunkWords,
+                            std::min(chunkWords, mask.size() - chunk * chunkWords));
+    };
+
+    std::vector<size_t> offsets(nChunks + 1, 0);
+    util::parallelFor(nChunks, [&](size_t chunk) {
+        size_t count = 0;
+        for (const auto word : words(chunk)) {
+            count += static_cast<size_t>(std::popcount(word));
+        }
+        offsets[chunk + 1] = count;
+    });
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+    std::vector<std::uint32_t> rows(offsets.back());
+    util::parallelFor(nChunks, [&](size_t chunk) {
+        auto* out = rows.data() + offsets[chunk];
+        auto row = static_cast<std::uint32_t>(chunk * chunkWords * 64);
+        for (auto word : words(chunk)) {
+            while (word != 0) {
+                *out++ = row + static_cast<std::uint32_t>(std::countr_zero(word));
+                word &= word - 1;
+            }
+            row += 64;
+        }
+    });
+    return rows;
+}
+
+}  // namespace inviwo::dataframe
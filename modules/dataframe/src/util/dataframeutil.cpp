@@ -29,7 +29,6 @@
 
 #include <inviwo/dataframe/util/dataframeutil.h>
 
-#include <inviwo/core/datastructures/bitset.h>                          // for BitSet
 #include <inviwo/core/datastructures/buffer/buffer.h>                   // for BufferBase, Buffer
 #include <inviwo/core/datastructures/buffer/bufferram.h>                // for BufferRAM
 #include <inviwo/core/datastructures/buffer/bufferramprecision.h>       // for BufferRAMPrecision
@@ -41,7 +40,6 @@
 #include <inviwo/core/util/formatdispatching.h>                         // for PrecisionValueType
 #include <inviwo/core/util/formats.h>                                   // for DataFormatBase
 #include <inviwo/core/util/glmvec.h>                                    // for ivec2
-#include <inviwo/core/util/iterrange.h>                                 // for iter_range, as_range
 #include <inviwo/core/util/sourcecontext.h>                             // for SourceContext
 #include <inviwo/core/util/stdextensions.h>                             // for transform, contains
 #include <inviwo/core/util/stringconversion.h>                          // for toLower
@@ -49,23 +47,19 @@
 #include <inviwo/core/util/zip.h>                                       // for zipper, enumerate
 #include <inviwo/dataframe/datastructures/column.h>                     // for CategoricalColumn
 #include <inviwo/dataframe/datastructures/dataframe.h>                  // for DataFrame
+#include <inviwo/dataframe/util/compiledfilters.h>                      // for CompiledFilters
 #include <inviwo/dataframe/util/filters.h>                              // for ItemFilter, Filters
+#include <inviwo/dataframe/util/rowhashtable.h>                         // for RowHashTable, RowKeys
 
 #include <algorithm>      // for any_of
 #include <functional>     // for function
 #include <iterator>       // for distance
 #include <map>            // for operator==, map
-#include <optional>       // for optional
-#include <string_view>    // for string_view, oper...
+#include <span>           // for span
 #include <unordered_map>  // for operator==, unord...
 #include <utility>        // for move, pair
-#include <variant>        // for visit
 
 #include <fmt/core.h>        // for format, basic_str...
-#include <glm/gtx/hash.hpp>  // for hash<>::operator()
-#include <glm/vec2.hpp>      // for operator==, opera...
-#include <glm/vec3.hpp>      // for operator==, opera...
-#include <glm/vec4.hpp>      // for operator==, opera...
 
 namespace inviwo {
 
@@ -217,97 +211,18 @@ void columnCheck(const DataFrame& left, const DataFrame& right,
     }
 }
 
-template <typename T, bool firstMatchOnly, typename Cont>
-std::vector<std::vector<std::uint32_t>> matchingRows(const Cont& left, const Cont& right) {
-    std::unordered_map<T, std::vector<std::uint32_t>> matches;
-    for (auto&& [r, value] : util::enumerate<std::uint32_t>(right)) {
-        if constexpr (firstMatchOnly) {
-            if (matches.find(value) == matches.end()) {
-                matches[value].push_back(r);
-            }
-        } else {
-            matches[value].push_back(r);
-        }
-    }
-    std::vector<std::vector<std::uint32_t>> rows(std::distance(left.begin(), left.end()));
-    for (auto&& [i, key] : util::enumerate<std::uint32_t>(left)) {
-        rows[i] = matches[key];
-    }
-    return rows;
-}
-
 /**
- * \brief for each row in leftCol return a list of matching row indices in rightCol
+ * \brief for each row in \p left return the first matching row in \p right, or
+ * RowHashTable::npos if there is no matching row
  */
-template <bool firstMatchOnly = false>
-std::vector<std::vector<std::uint32_t>> getMatchingRows(std::shared_ptr<const Column> leftCol,
-                                                        std::shared_ptr<const Column> rightCol) {
-    if (auto catCol1 = dynamic_cast<const CategoricalColumn*>(leftCol.get())) {
-        // need to match values of categorical columns instead of indices stored in buffer
-        auto catCol2 = dynamic_cast<const CategoricalColumn*>(rightCol.get());
-        IVW_ASSERT(catCol2, "right column is not categorical");
-
-        return matchingRows<std::string_view, firstMatchOnly>(*catCol1, *catCol2);
-    } else {
-        using retval = std::vector<std::vector<std::uint32_t>>;
-
-        return leftCol->getBuffer()->getRepresentation<BufferRAM>()->dispatch<retval>(
-            [rightBuffer = rightCol->getBuffer()](auto typedBuf) {
-                using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
-
-                const auto& left = typedBuf->getDataContainer();
-                const auto& right = static_cast<const BufferRAMPrecision<ValueType>*>(
-                                        rightBuffer->getRepresentation<BufferRAM>())
-                                        ->getDataContainer();
-
-                return matchingRows<ValueType, firstMatchOnly>(left, right);
-            });
-    }
-}
-
-std::vector<std::vector<std::uint32_t>> getMatchingRows(
+std::vector<std::uint32_t> getMatchingRows(
     const DataFrame& left, const DataFrame& right,
     const std::vector<std::pair<std::string, std::string>>& keyColumns) {
 
-    auto indexCol1 = left.getColumn(keyColumns.front().first);
-    auto indexCol2 = right.getColumn(keyColumns.front().second);
-
-    auto rows = detail::getMatchingRows(indexCol1, indexCol2);
-    // narrow down row selection by filtering with remaining keys
-    for (auto&& [leftName, rightName] : util::as_range(keyColumns.begin() + 1, keyColumns.end())) {
-        auto leftCol = left.getColumn(leftName);
-        auto rightCol = right.getColumn(rightName);
-
-        if (auto catCol1 = dynamic_cast<const CategoricalColumn*>(leftCol.get())) {
-            auto catCol2 = dynamic_cast<const CategoricalColumn*>(rightCol.get());
-            IVW_ASSERT(catCol2, "right column is not categorical");
-
-            auto valuesLeftIt = catCol1->begin();
-            auto valuesRightIt = catCol2->begin();
-            for (auto&& [i, rowMatches] : util::enumerate<std::uint32_t>(rows)) {
-                std::erase_if(rowMatches, [key = *(valuesLeftIt + i), valuesRightIt](auto row) {
-                    return key != *(valuesRightIt + row);
-                });
-            }
-        } else {
-            leftCol->getBuffer()->getRepresentation<BufferRAM>()->dispatch<void>(
-                [&rows, rightBuffer = rightCol->getBuffer()](auto typedBuf) {
-                    using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
-
-                    const auto& left = typedBuf->getDataContainer();
-                    const auto& right = static_cast<const BufferRAMPrecision<ValueType>*>(
-                                            rightBuffer->getRepresentation<BufferRAM>())
-                                            ->getDataContainer();
-
-                    for (auto&& [i, rowMatches] : util::enumerate(rows)) {
-                        std::erase_if(rowMatches, [key = left[i], &right](auto row) {
-                            return key != right[row];
-                        });
-                    }
-                });
-        }
-    }
-    return rows;
+    auto [leftKeys, rightKeys] = RowKeys::join(util::transform(keyColumns, [&](const auto& item) {
+        return std::pair{left.getColumn(item.first), right.getColumn(item.second)};
+    }));
+    return RowHashTable{rightKeys}.find(leftKeys);
 }
 
 void addColumns(std::shared_ptr<DataFrame> dst, const DataFrame& srcDataFrame,
@@ -321,35 +236,26 @@ void addColumns(std::shared_ptr<DataFrame> dst, const DataFrame& srcDataFrame,
 }
 
 void addColumns(std::shared_ptr<DataFrame> dst, const DataFrame& srcDataFrame,
-                const std::vector<std::uint32_t>& rows, const std::vector<std::string>& keyColumns,
-                bool skipKeyCol) {
+                std::span<const std::uint32_t> rows, const std::vector<std::string>& keyColumns,
+                bool skipKeyCol, bool fillMissingRows) {
     for (auto srcCol : srcDataFrame) {
         if (srcCol->getColumnType() == ColumnType::Index) continue;
         if (skipKeyCol && util::contains(keyColumns, srcCol->getHeader())) continue;
 
-        dst->addColumn(std::shared_ptr<Column>(srcCol->clone(rows)));
-    }
-}
-
-void addColumns(std::shared_ptr<DataFrame> dst, const DataFrame& srcDataFrame,
-                const std::vector<std::optional<std::uint32_t>>& rows,
-                const std::vector<std::string>& keyColumns, bool skipKeyCol) {
-    for (auto srcCol : srcDataFrame) {
-        if (srcCol->getColumnType() == ColumnType::Index) continue;
-        if (skipKeyCol && util::contains(keyColumns, srcCol->getHeader())) continue;
-
-        if (auto c = dynamic_cast<CategoricalColumn*>(srcCol.get())) {
-            auto data = util::transform(rows, [range = c->values()](auto v) {
-                return v.has_value() ? *(range.begin() + v.value()) : "undefined";
+        if (!fillMissingRows) {
+            dst->addColumn(std::shared_ptr<Column>(srcCol->clone(rows)));
+        } else if (auto c = dynamic_cast<CategoricalColumn*>(srcCol.get())) {
+            auto data = util::transform(rows, [range = c->values()](auto row) {
+                return row != RowHashTable::npos ? *(range.begin() + row) : "undefined";
             });
             dst->addCategoricalColumn(c->getHeader(), data);
         } else {
             srcCol->getBuffer()->getRepresentation<BufferRAM>()->dispatch<void>(
-                [dst, srcCol, header = srcCol->getHeader(), rows](auto typedBuf) {
+                [dst, header = srcCol->getHeader(), rows](auto typedBuf) {
                     using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
                     auto dstData =
-                        util::transform(rows, [&src = typedBuf->getDataContainer()](auto v) {
-                            return v.has_value() ? src[v.value()] : ValueType{0};
+                        util::transform(rows, [&src = typedBuf->getDataContainer()](auto row) {
+                            return row != RowHashTable::npos ? src[row] : ValueType{0};
                         });
                     dst->addColumn(header, std::move(dstData));
                 });
@@ -361,30 +267,7 @@ void addColumns(std::shared_ptr<DataFrame> dst, const DataFrame& srcDataFrame,
 
 std::shared_ptr<DataFrame> innerJoin(const DataFrame& left, const DataFrame& right,
                                      const std::pair<std::string, std::string>& keyColumn) {
-    detail::columnCheck(left, right, {keyColumn}, "dataframe::innerJoin"_sl);
-
-    auto indexCol1 = left.getColumn(keyColumn.first);
-    auto indexCol2 = right.getColumn(keyColumn.second);
-
-    std::vector<std::uint32_t> rowsLeft;
-    std::vector<std::uint32_t> rowsRight;
-    for (auto&& [i, rowIndices] :
-         util::enumerate<std::uint32_t>(detail::getMatchingRows<true>(indexCol1, indexCol2))) {
-        if (!rowIndices.empty()) {
-            rowsLeft.push_back(i);
-            rowsRight.push_back(rowIndices.front());
-        }
-    }
-
-    IVW_ASSERT(rowsLeft.size() == rowsRight.size(), "incorrect number of matching row indices");
-
-    auto dataframe = std::make_shared<DataFrame>();
-    dataframe->dropColumn(0);
-    dataframe->addColumn(std::shared_ptr<Column>(left.getIndexColumn()->clone(rowsLeft)));
-    detail::addColumns(dataframe, left, rowsLeft, {keyColumn.first}, false);
-    detail::addColumns(dataframe, right, rowsRight, {keyColumn.second}, true);
-
-    return dataframe;
+    return innerJoin(left, right, std::vector{keyColumn});
 }
 
 std::shared_ptr<DataFrame> innerJoin(
@@ -397,13 +280,13 @@ std::shared_ptr<DataFrame> innerJoin(
 
     detail::columnCheck(left, right, keyColumns, "dataframe::innerJoin"_sl);
 
+    const auto matches = detail::getMatchingRows(left, right, keyColumns);
     std::vector<std::uint32_t> rowsLeft;
     std::vector<std::uint32_t> rowsRight;
-    for (auto&& [i, rowIndices] :
-         util::enumerate<std::uint32_t>(detail::getMatchingRows(left, right, keyColumns))) {
-        if (!rowIndices.empty()) {
+    for (auto&& [i, match] : util::enumerate<std::uint32_t>(matches)) {
+        if (match != RowHashTable::npos) {
             rowsLeft.push_back(i);
-            rowsRight.push_back(rowIndices.front());
+            rowsRight.push_back(match);
         }
     }
 
@@ -419,38 +302,15 @@ std::shared_ptr<DataFrame> innerJoin(
     auto dataframe = std::make_shared<DataFrame>();
     dataframe->dropColumn(0);
     dataframe->addColumn(std::shared_ptr<Column>(left.getIndexColumn()->clone(rowsLeft)));
-    detail::addColumns(dataframe, left, rowsLeft, leftKeys, false);
-    detail::addColumns(dataframe, right, rowsRight, rightKeys, true);
+    detail::addColumns(dataframe, left, rowsLeft, leftKeys, false, false);
+    detail::addColumns(dataframe, right, rowsRight, rightKeys, true, false);
 
     return dataframe;
 }
 
 std::shared_ptr<DataFrame> leftJoin(const DataFrame& left, const DataFrame& right,
                                     const std::pair<std::string, std::string>& keyColumn) {
-    detail::columnCheck(left, right, {keyColumn}, "dataframe::leftJoin"_sl);
-
-    auto indexCol1 = left.getColumn(keyColumn.first);
-    auto indexCol2 = right.getColumn(keyColumn.second);
-
-    auto rows = util::transform(
-        detail::getMatchingRows<true>(indexCol1, indexCol2),
-        [](const std::vector<std::uint32_t>& rowIndices) -> std::optional<std::uint32_t> {
-            if (rowIndices.empty()) {
-                return {};
-            } else {
-                return rowIndices.front();
-            }
-        });
-
-    IVW_ASSERT(indexCol1->getSize() == rows.size(), "incorrect number of matching row indices");
-
-    auto dataframe = std::make_shared<DataFrame>();
-    dataframe->dropColumn(0);
-    dataframe->addColumn(std::shared_ptr<Column>(left.getIndexColumn()->clone()));
-    detail::addColumns(dataframe, left, {keyColumn.first}, false);
-    detail::addColumns(dataframe, right, rows, {keyColumn.second}, true);
-
-    return dataframe;
+    return leftJoin(left, right, std::vector{keyColumn});
 }
 
 std::shared_ptr<DataFrame> leftJoin(
@@ -463,15 +323,7 @@ std::shared_ptr<DataFrame> leftJoin(
 
     detail::columnCheck(left, right, keyColumns, "dataframe::leftJoin"_sl);
 
-    auto rows = util::transform(
-        detail::getMatchingRows(left, right, keyColumns),
-        [](const std::vector<std::uint32_t>& rowIndices) -> std::optional<std::uint32_t> {
-            if (rowIndices.empty()) {
-                return {};
-            } else {
-                return rowIndices.front();
-            }
-        });
+    const auto rows = detail::getMatchingRows(left, right, keyColumns);
 
     std::vector<std::string> leftKeys;
     std::transform(keyColumns.begin(), keyColumns.end(), std::back_inserter(leftKeys),
@@ -484,7 +336,7 @@ std::shared_ptr<DataFrame> leftJoin(
     dataframe->dropColumn(0);
     dataframe->addColumn(std::shared_ptr<Column>(left.getIndexColumn()->clone()));
     detail::addColumns(dataframe, left, leftKeys, false);
-    detail::addColumns(dataframe, right, rows, rightKeys, true);
+    detail::addColumns(dataframe, right, rows, rightKeys, true, true);
 
     return dataframe;
 }
@@ -569,95 +421,15 @@ std::shared_ptr<DataFrame> combineDataFrames(std::vector<std::shared_ptr<DataFra
     return newDataFrame;
 }
 
-#include <warn/push>
-#include <warn/ignore/conversion>
 std::vector<std::uint32_t> selectRows(const Column& col,
                                       const std::vector<dataframefilters::ItemFilter>& filters) {
     if (filters.empty()) return {};
-
-    if (col.getColumnType() == ColumnType::Categorical) {
-        const auto& catCol = dynamic_cast<const CategoricalColumn&>(col);
-        std::vector<std::uint32_t> rows;
-        for (auto&& [row, value] : util::enumerate<std::uint32_t>(catCol.values())) {
-            auto test = util::overloaded{
-                [v = value](const std::function<bool(std::string_view)>& func) { return func(v); },
-                [](const std::function<bool(int64_t)>&) { return false; },
-                [](const std::function<bool(double)>&) { return false; }};
-            auto op = [&](const auto& f) { return std::visit(test, f.filter); };
-            if (std::any_of(filters.begin(), filters.end(), op)) {
-                rows.push_back(row);
-            }
-        }
-        return rows;
-    } else {
-        return col.getBuffer()
-            ->getRepresentation<BufferRAM>()
-            ->dispatch<std::vector<std::uint32_t>, dispatching::filter::Scalars>(
-                [filters](auto typedBuf) {
-                    using ValueType = util::PrecisionValueType<decltype(typedBuf)>;
-                    std::vector<std::uint32_t> rows;
-                    for (auto&& [row, value] :
-                         util::enumerate<std::uint32_t>(typedBuf->getDataContainer())) {
-                        auto test = util::overloaded{
-                            [&v = value](
-                                [[maybe_unused]] const std::function<bool(std::int64_t)>& func) {
-                                if constexpr (std::is_integral_v<ValueType>) {
-                                    return func(static_cast<std::int64_t>(v));
-                                } else {
-                                    (void)v;
-                                    return false;
-                                }
-                            },
-                            [v = value]([[maybe_unused]] const std::function<bool(double)>& func) {
-                                if constexpr (std::is_floating_point_v<ValueType>) {
-                                    return func(v);
-                                } else {
-                                    (void)v;
-                                    return false;
-                                }
-                            },
-                            [](const std::function<bool(std::string_view)>&) { return false; }};
-                        auto op = [&](const auto& f) { return std::visit(test, f.filter); };
-                        if (std::any_of(filters.begin(), filters.end(), op)) {
-                            rows.push_back(row);
-                        }
-                    }
-                    return rows;
-                });
-    }
+    return maskToRows(CompiledFilters(col, filters).evaluate());
 }
-#include <warn/pop>
 
 std::vector<std::uint32_t> selectRows(const DataFrame& dataframe,
                                       dataframefilters::Filters filters) {
-    const int colCount = static_cast<int>(dataframe.getNumberOfColumns());
-    std::unordered_map<int, dataframefilters::Filters> filterCols;
-    for (auto& f : filters.include) {
-        if (f.column >= 0 && f.column < colCount) filterCols[f.column].include.push_back(f);
-    }
-    for (auto& f : filters.exclude) {
-        if (f.column >= 0 && f.column < colCount) filterCols[f.column].exclude.push_back(f);
-    }
-    if (filterCols.empty()) {
-        auto seq = util::sequence<std::uint32_t>(
-            0, static_cast<std::uint32_t>(dataframe.getNumberOfRows()), 1);
-        return {seq.begin(), seq.end()};
-    }
-
-    if (filterCols.size() == 1) {
-        const auto& col = *dataframe.getColumn(filterCols.begin()->first).get();
-        return (BitSet(selectRows(col, filterCols.begin()->second.include)) -
-                BitSet(selectRows(col, filterCols.begin()->second.exclude)))
-            .toVector();
-    }
-    BitSet include;
-    BitSet exclude;
-    for (auto&& [colIndex, f] : filterCols) {
-        const auto& col = *dataframe.getColumn(colIndex).get();
-        include.add(selectRows(col, f.include));
-        exclude.add(selectRows(col, f.exclude));
-    }
-    return (include - exclude).toVector();
+    return maskToRows(CompiledFilters(dataframe, filters).evaluate());
 }
 
 std::string createToolTipForRow(const DataFrame& dataframe, size_t rowId) {
@@ -41,11 +41,15 @@ namespace filters {
 ItemFilter stringMatch(int column, filters::StringComp op, std::string_view match) {
     switch (op) {
         case filters::StringComp::Equal:
-            return ItemFilter{[str = match](std::string_view item) { return item == str; }, column,
-                              false};
+            return ItemFilter{[str = std::string{match}](std::string_view item) {
+                                  return item == str;
+                              },
+                              column, false};
         case filters::StringComp::NotEqual:
-            return ItemFilter{[str = match](std::string_view item) { return item != str; }, column,
-                              false};
+            return ItemFilter{[str = std::string{match}](std::string_view item) {
+                                  return item != str;
+                              },
+                              column, false};
         case filters::StringComp::Regex:
             return ItemFilter{[re = std::regex(std::string{match})](std::string_view item) {
                                   return std::regex_match(item.begin(), item.end(), re);
@@ -57,8 +61,10 @@ ItemFilter stringMatch(int column, filters::StringComp op, std::string_view matc
                               },
                               column, false};
         default:
-            return ItemFilter{[str = match](std::string_view item) { return item == str; }, column,
-                              false};
+            return ItemFilter{[str = std::string{match}](std::string_view item) {
+                                  return item == str;
+                              },
+                              column, false};
     }
 }
 
@@ -102,16 +108,16 @@ template <typename T>
 ItemFilter rangeComparison(int column, T min, T max) {
     return ItemFilter{
         std::function<bool(T)>([min, max](T value) { return (value >= min) && (value <= max); }),
-        column, false};
+        column, false, RangeComparison<T>{min, max}};
 }
 
 }  // namespace detail
 
 ItemFilter intMatch(int column, filters::NumberComp op, std::int64_t value) {
-    auto createFilter = [v = value, column](auto comp) {
+    auto createFilter = [v = value, column, op](auto comp) {
         return ItemFilter{std::function<bool(std::int64_t)>(
                               [v, comp](std::int64_t value) { return comp(value, v); }),
-                          column, false};
+                          column, false, NumberComparison<std::int64_t>{op, v, 0}};
     };
 
     switch (op) {
@@ -133,7 +139,9 @@ ItemFilter intMatch(int column, filters::NumberComp op, std::int64_t value) {
 }
 
 ItemFilter doubleMatch(int column, filters::NumberComp op, double value, double epsilon) {
-    return detail::epsilonComparison(column, op, value, epsilon);
+    auto filter = detail::epsilonComparison(column, op, value, epsilon);
+    filter.comparison = NumberComparison<double>{op, value, epsilon};
+    return filter;
 }
 
 ItemFilter intRange(int column, std::int64_t min, std::int64_t max) {
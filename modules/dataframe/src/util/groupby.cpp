@@ -0,0 +1,317 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/util/groupby.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>              // for BufferBase
+#include <inviwo/core/datastructures/buffer/bufferram.h>           // for BufferRAM
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>  // for BufferRAMPrecision
+#include <inviwo/core/util/exception.h>                            // for Exception
+#include <inviwo/core/util/formatdispatching.h>                    // for PrecisionValueType
+#include <inviwo/core/util/formats.h>                              // for DataFormatBase
+#include <inviwo/core/util/sourcecontext.h>                        // for SourceContext
+#include <inviwo/core/util/stdextensions.h>                        // for transform
+#include <inviwo/core/util/threadutil.h>                           // for parallelFor
+#include <inviwo/dataframe/datastructures/column.h>                // for Column, TemplateColumn
+#include <inviwo/dataframe/util/rowhashtable.h>                    // for RowHashTable, RowKeys
+
+#include <algorithm>  // for min, nth_element, min_element
+#include <cmath>      // for isnan, floor
+#include <cstdint>    // for uint32_t
+#include <limits>     // for numeric_limits
+#include <numeric>    // for partial_sum
+#include <ostream>    // for operator<<, ostream
+#include <span>       // for span
+#include <utility>    // for move
+
+#include <fmt/core.h>  // for format
+
+namespace inviwo {
+
+namespace dataframe {
+
+std::string_view enumToStr(Aggregation aggregation) {
+    switch (aggregation) {
+        case Aggregation::Count:
+            return "Count";
+        case Aggregation::Sum:
+            return "Sum";
+        case Aggregation::Mean:
+            return "Mean";
+        case Aggregation::Min:
+            return "Min";
+        case Aggregation::Max:
+            return "Max";
+        case Aggregation::Median:
+            return "Median";
+        case Aggregation::Quantile:
+            return "Quantile";
+    }
+    throw Exception(SourceContext{}, "Found invalid Aggregation enum value '{}'",
+                    static_cast<int>(aggregation));
+}
+std::ostream& operator<<(std::ostream& ss, Aggregation aggregation) {
+    return ss << enumToStr(aggregation);
+}
+
+namespace {
+
+constexpr size_t chunkGroups = 1024;
+
+/**
+ * Rows of each group stored consecutively, the rows of group `g` are
+ * `rows[offsets[g]]` to `rows[offsets[g + 1] - 1]` in ascending order.
+ */
+struct Groups {
+    std::vector<std::uint32_t> first;
+    std::vector<std::uint32_t> offsets;
+    std::vector<std::uint32_t> rows;
+
+    size_t size() const { return first.size(); }
+    std::span<const std::uint32_t> operator[](size_t group) const {
+        return std::span{rows}.subspan(offsets[group], offsets[group + 1] - offsets[group]);
+    }
+    template <typename F>
+    void forEach(F&& func) const {
+        util::parallelFor((size() + chunkGroups - 1) / chunkGroups, [&](size_t chunk) {
+            const auto last = std::min(size(), (chunk + 1) * chunkGroups);
+            for (auto group = chunk * chunkGroups; group < last; ++group) {
+                func(group, (*this)[group]);
+            }
+        });
+    }
+};
+
+Groups findGroups(const RowKeys& keys) {
+    // for each row the first row with the same key, which is always less or equal to the row.
+    // Keys containing NaN do not match any row, not even their own, and form a group each.
+    const auto firstRows = RowHashTable{keys}.find(keys);
+
+    Groups groups;
+    std::vector<std::uint32_t> groupOf(firstRows.size());
+    for (std::uint32_t row = 0; row < firstRows.size(); ++row) {
+        if (firstRows[row] == row || firstRows[row] == RowHashTable::npos) {
+            groupOf[row] = static_cast<std::uint32_t>(groups.first.size());
+            groups.first.push_back(row);
+        } else {
+            groupOf[row] = groupOf[firstRows[row]];
+        }
+    }
+
+    groups.offsets.resize(groups.first.size() + 1, 0);
+    for (auto group : groupOf) {
+        ++groups.offsets[group + 1];
+    }
+    std::partial_sum(groups.offsets.begin(), groups.offsets.end(), groups.offsets.begin());
+
+    groups.rows.resize(firstRows.size());
+    auto next = groups.offsets;
+    for (std::uint32_t row = 0; row < groupOf.size(); ++row) {
+        groups.rows[next[groupOf[row]]++] = row;
+    }
+    return groups;
+}
+
+std::string aggregateHeader(const Column& column, const Aggregate& aggregate) {
+    if (aggregate.aggregation == Aggregation::Quantile) {
+        return fmt::format("{} ({} {})", column.getHeader(), aggregate.aggregation,
+                           aggregate.quantile);
+    } else {
+        return fmt::format("{} ({})", column.getHeader(), aggregate.aggregation);
+    }
+}
+
+// linearly interpolated quantile of values, values is reordered
+double quantile(std::span<double> values, double q) {
+    if (values.empty()) return std::numeric_limits<double>::quiet_NaN();
+
+    const auto pos = q * static_cast<double>(values.size() - 1);
+    const auto lower = static_cast<size_t>(std::floor(pos));
+    std::nth_element(values.begin(), values.begin() + lower, values.end());
+    const auto low = values[lower];
+    if (lower + 1 == values.size()) return low;
+    // after nth_element all values above lower are greater or equal
+    const auto high = *std::min_element(values.begin() + lower + 1, values.end());
+    return low + (pos - static_cast<double>(lower)) * (high - low);
+}
+
+template <typename T>
+std::shared_ptr<Column> aggregateValues(const Column& column, const std::vector<T>& data,
+                                        const Groups& groups, const Aggregate& aggregate) {
+    const auto isValid = [](const T& value) { return !std::isnan(static_cast<double>(value)); };
+    const auto header = aggregateHeader(column, aggregate);
+    const auto unit = column.getUnit();
+
+    auto reduce = [&](auto&& func) {
+        std::vector<double> result(groups.size());
+        groups.forEach([&](size_t group, std::span<const std::uint32_t> rows) {
+            double sum = 0.0;
+            size_t count = 0;
+            for (auto row : rows) {
+                if (isValid(data[row])) {
+                    sum += static_cast<double>(data[row]);
+                    ++count;
+                }
+            }
+            result[group] = func(sum, count);
+        });
+        return result;
+    };
+
+    auto select = [&](auto&& less) {
+        std::vector<T> result(groups.size());
+        groups.forEach([&](size_t group, std::span<const std::uint32_t> rows) {
+            // all NaN groups keep their first value, which then is NaN
+            auto best = data[rows.front()];
+            bool found = isValid(best);
+            for (auto row : rows.subspan(1)) {
+                if (isValid(data[row]) && (!found || less(data[row], best))) {
+                    best = data[row];
+                    found = true;
+                }
+            }
+            result[group] = best;
+        });
+        return std::make_shared<TemplateColumn<T>>(header, std::move(result), unit);
+    };
+
+    switch (aggregate.aggregation) {
+        case Aggregation::Count: {
+            std::vector<std::uint32_t> result(groups.size());
+            groups.forEach([&](size_t group, std::span<const std::uint32_t> rows) {
+                result[group] = static_cast<std::uint32_t>(
+                    std::count_if(rows.begin(), rows.end(),
+                                  [&](std::uint32_t row) { return isValid(data[row]); }));
+            });
+            return std::make_shared<TemplateColumn<std::uint32_t>>(header, std::move(result));
+        }
+        case Aggregation::Sum:
+            return std::make_shared<TemplateColumn<double>>(
+                header, reduce([](double sum, size_t) { return sum; }), unit);
+        case Aggregation::Mean:
+            return std::make_shared<TemplateColumn<double>>(
+                header, reduce([](double sum, size_t count) {
+                    return count > 0 ? sum / static_cast<double>(count)
+                                     : std::numeric_limits<double>::quiet_NaN();
+                }),
+                unit);
+        case Aggregation::Min:
+            return select([](const T& a, const T& b) { return a < b; });
+        case Aggregation::Max:
+            return select([](const T& a, const T& b) { return b < a; });
+        case Aggregation::Median:
+        case Aggregation::Quantile: {
+            const auto q = aggregate.aggregation == Aggregation::Median ? 0.5 : aggregate.quantile;
+            std::vector<double> result(groups.size());
+            util::parallelFor((groups.size() + chunkGroups - 1) / chunkGroups, [&](size_t chunk) {
+                std::vector<double> values;
+                const auto last = std::min(groups.size(), (chunk + 1) * chunkGroups);
+                for (auto group = chunk * chunkGroups; group < last; ++group) {
+                    values.clear();
+                    for (auto row : groups[group]) {
+                        if (isValid(data[row])) values.push_back(static_cast<double>(data[row]));
+                    }
+                    result[group] = quantile(values, q);
+                }
+            });
+            return std::make_shared<TemplateColumn<double>>(header, std::move(result), unit);
+        }
+    }
+    throw Exception(SourceContext{}, "Found invalid Aggregation enum value '{}'",
+                    static_cast<int>(aggregate.aggregation));
+}
+
+std::shared_ptr<Column> aggregateColumn(const Column& column, const Groups& groups,
+                                        const Aggregate& aggregate) {
+    if (aggregate.aggregation == Aggregation::Quantile &&
+        !(aggregate.quantile >= 0.0 && aggregate.quantile <= 1.0)) {
+        throw Exception(SourceContext{}, "quantile {} for column '{}' is outside of [0, 1]",
+                        aggregate.quantile, column.getHeader());
+    }
+
+    if (column.getColumnType() == ColumnType::Categorical) {
+        if (aggregate.aggregation != Aggregation::Count) {
+            throw Exception(SourceContext{},
+                            "aggregation {} is not supported for categorical column '{}'",
+                            aggregate.aggregation, column.getHeader());
+        }
+        std::vector<std::uint32_t> result(groups.size());
+        for (size_t group = 0; group < groups.size(); ++group) {
+            result[group] = groups.offsets[group + 1] - groups.offsets[group];
+        }
+        return std::make_shared<TemplateColumn<std::uint32_t>>(aggregateHeader(column, aggregate),
+                                                               std::move(result));
+    }
+
+    const auto* format = column.getBuffer()->getDataFormat();
+    if (format->getComponents() != 1) {
+        throw Exception(SourceContext{}, "aggregation {} is not supported for column '{}' ({})",
+                        aggregate.aggregation, column.getHeader(), format->getString());
+    }
+
+    return column.getBuffer()
+        ->getRepresentation<BufferRAM>()
+        ->dispatch<std::shared_ptr<Column>, dispatching::filter::Scalars>([&](auto ram) {
+            return aggregateValues(column, ram->getDataContainer(), groups, aggregate);
+        });
+}
+
+}  // namespace
+
+std::shared_ptr<DataFrame> groupBy(const DataFrame& dataframe,
+                                   const std::vector<std::string>& keyColumns,
+                                   const std::vector<Aggregate>& aggregates) {
+    if (keyColumns.empty()) {
+        throw Exception(SourceContext{}, "no key columns given");
+    }
+
+    const auto getColumn = [&](const std::string& header) {
+        auto column = dataframe.getColumn(header);
+        if (!column) {
+            throw Exception(SourceContext{}, "column '{}' missing in the data frame", header);
+        }
+        return column;
+    };
+
+    const auto keys = util::transform(keyColumns, getColumn);
+    const auto groups = findGroups(RowKeys{keys});
+
+    std::vector<std::shared_ptr<Column>> columns;
+    for (const auto& key : keys) {
+        columns.emplace_back(key->clone(groups.first));
+    }
+    for (const auto& aggregate : aggregates) {
+        columns.push_back(aggregateColumn(*getColumn(aggregate.column), groups, aggregate));
+    }
+    return std::make_shared<DataFrame>(std::move(columns));
+}
+
+}  // namespace dataframe
+
+}  // namespace inviwo
@@ -0,0 +1,278 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/dataframe/util/rowhashtable.h>
+
+#include <inviwo/core/datastructures/buffer/bufferram.h>           // for BufferRAM
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>  // for BufferRAMPrecision
+#include <inviwo/core/util/exception.h>                            // for Exception
+#include <inviwo/core/util/formatdispatching.h>                    // for PrecisionValueType
+#include <inviwo/core/util/sourcecontext.h>                        // for SourceContext
+#include <inviwo/core/util/threadutil.h>                           // for parallelFor
+#include <inviwo/dataframe/datastructures/column.h>                // for CategoricalColumn
+
+#include <algorithm>      // for min
+#include <bit>            // for bit_ceil
+#include <functional>     // for hash
+#include <numeric>        // for accumulate
+#include <string_view>    // for string_view
+#include <unordered_map>  // for unordered_map
+#include <utility>        // for exchange, move
+
+#include <glm/gtx/hash.hpp>  // for hash<>::operator()
+
+namespace inviwo {
+
+namespace dataframe {
+
+namespace {
+
+constexpr size_t chunkRows = size_t{1} << 16;
+constexpr size_t targetPartitionRows = 4096;
+constexpr int maxPartitionBits = 10;
+
+template <typename F>
+void forEachChunk(size_t rows, F&& func) {
+    util::parallelFor((rows + chunkRows - 1) / chunkRows, [&](size_t chunk) {
+        func(chunk, chunk * chunkRows, std::min(rows, (chunk + 1) * chunkRows));
+    });
+}
+
+// splitmix64 finalizer, spreads the std::hash values, which often are the identity, over all bits
+constexpr std::uint64_t mix(std::uint64_t h) {
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ull;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebull;
+    h ^= h >> 31;
+    return h;
+}
+
+template <typename T>
+bool equalValues(const void* a, std::uint32_t i, const void* b, std::uint32_t j) {
+    return static_cast<const T*>(a)[i] == static_cast<const T*>(b)[j];
+}
+
+template <typename T>
+void hashValues(const void* data, std::uint64_t* hashes, size_t first, size_t last) {
+    const auto* values = static_cast<const T*>(data);
+    for (size_t i = first; i < last; ++i) {
+        hashes[i] = mix((hashes[i] * 0x9e3779b97f4a7c15ull) ^
+                        static_cast<std::uint64_t>(std::hash<T>{}(values[i])));
+    }
+}
+
+const std::vector<std::uint32_t>& categoryIds(const Column& column) {
+    return static_cast<const CategoricalColumn&>(column)
+        .getTypedBuffer()
+        ->getRAMRepresentation()
+        ->getDataContainer();
+}
+
+}  // namespace
+
+RowKeys::RowKeys(const std::vector<std::shared_ptr<const Column>>& columns) {
+    for (const auto& column : columns) {
+        addKey(*column);
+    }
+    updateHashes();
+}
+
+std::pair<RowKeys, RowKeys> RowKeys::join(
+    const std::vector<std::pair<std::shared_ptr<const Column>, std::shared_ptr<const Column>>>&
+        columns) {
+    RowKeys left;
+    RowKeys right;
+    for (const auto& [leftCol, rightCol] : columns) {
+        if (leftCol->getColumnType() == ColumnType::Categorical) {
+            // express the left categories as ids of the right column, categories missing in the
+            // right column never match
+            std::unordered_map<std::string_view, std::uint32_t> rightIds;
+            for (auto&& category :
+                 static_cast<const CategoricalColumn&>(*rightCol).getCategories()) {
+                rightIds.try_emplace(category, static_cast<std::uint32_t>(rightIds.size()));
+            }
+            std::vector<std::uint32_t> lookup;
+            for (auto&& category :
+                 static_cast<const CategoricalColumn&>(*leftCol).getCategories()) {
+                auto it = rightIds.find(category);
+                lookup.push_back(it != rightIds.end() ? it->second : RowHashTable::npos);
+            }
+            const auto& ids = categoryIds(*leftCol);
+            std::vector<std::uint32_t> mapped(ids.size());
+            forEachChunk(ids.size(), [&](size_t, size_t first, size_t last) {
+                for (size_t i = first; i < last; ++i) {
+                    mapped[i] = lookup[ids[i]];
+                }
+            });
+            left.addKey(std::move(mapped));
+        } else {
+            left.addKey(*leftCol);
+        }
+        right.addKey(*rightCol);
+    }
+    left.updateHashes();
+    right.updateHashes();
+    return {std::move(left), std::move(right)};
+}
+
+void RowKeys::addKey(const Column& column) {
+    const auto rows = column.getSize();
+    if (!keys_.empty() && rows != hashes_.size()) {
+        throw Exception(SourceContext{}, "key column '{}' has {} rows, expected {}",
+                        column.getHeader(), rows, hashes_.size());
+    }
+    hashes_.resize(rows);
+
+    if (column.getColumnType() == ColumnType::Categorical) {
+        // category ids are unique per category, no need to compare the strings
+        keys_.push_back({categoryIds(column).data(), &equalValues<std::uint32_t>,
+                         &hashValues<std::uint32_t>});
+    } else {
+        column.getBuffer()->getRepresentation<BufferRAM>()->dispatch<void>([&](auto ram) {
+            using ValueType = util::PrecisionValueType<decltype(ram)>;
+            keys_.push_back({ram->getDataContainer().data(), &equalValues<ValueType>,
+                             &hashValues<ValueType>});
+        });
+    }
+}
+
+void RowKeys::addKey(std::vector<std::uint32_t> categories) {
+    hashes_.resize(categories.size());
+    keys_.push_back(
+        {categories.data(), &equalValues<std::uint32_t>, &hashValues<std::uint32_t>});
+    categories_.push_back(std::move(categories));
+}
+
+void RowKeys::updateHashes() {
+    std::fill(hashes_.begin(), hashes_.end(), std::uint64_t{0});
+    forEachChunk(hashes_.size(), [&](size_t, size_t first, size_t last) {
+        for (const auto& key : keys_) {
+            key.hash(key.data, hashes_.data(), first, last);
+        }
+    });
+}
+
+RowHashTable::RowHashTable(const RowKeys& keys)
+    : keys_{&keys}, bits_{0}, offsets_{}, slots_{}, distinct_{0} {
+
+    const auto rows = keys.size();
+    while (bits_ < maxPartitionBits && (rows >> bits_) > targetPartitionRows) {
+        ++bits_;
+    }
+    const size_t nPartitions = size_t{1} << bits_;
+    const size_t nChunks = (rows + chunkRows - 1) / chunkRows;
+
+    // Stable radix partitioning of the rows on the high hash bits. Each chunk first counts its rows
+    // per partition, which is then turned into the write position of the chunk in each partition.
+    std::vector<size_t> next(nChunks * nPartitions, 0);
+    forEachChunk(rows, [&](size_t chunk, size_t first, size_t last) {
+        auto* count = next.data() + chunk * nPartitions;
+        for (size_t row = first; row < last; ++row) {
+            ++count[partition(keys.hash(static_cast<std::uint32_t>(row)))];
+        }
+    });
+    std::vector<size_t> partitionStart(nPartitions + 1, 0);
+    size_t pos = 0;
+    for (size_t p = 0; p < nPartitions; ++p) {
+        partitionStart[p] = pos;
+        for (size_t chunk = 0; chunk < nChunks; ++chunk) {
+            pos += std::exchange(next[chunk * nPartitions + p], pos);
+        }
+    }
+    partitionStart[nPartitions] = pos;
+
+    std::vector<std::uint32_t> order(rows);
+    forEachChunk(rows, [&](size_t chunk, size_t first, size_t last) {
+        auto* dst = next.data() + chunk * nPartitions;
+        for (size_t row = first; row < last; ++row) {
+            order[dst[partition(keys.hash(static_cast<std::uint32_t>(row)))]++] =
+                static_cast<std::uint32_t>(row);
+        }
+    });
+
+    // One linear probing table per partition, at most half full. The rows of a partition are
+    // inserted in ascending order, hence the first row of each key ends up in the table.
+    offsets_.resize(nPartitions + 1, 0);
+    for (size_t p = 0; p < nPartitions; ++p) {
+        offsets_[p + 1] =
+            offsets_[p] + std::bit_ceil(2 * (partitionStart[p + 1] - partitionStart[p]));
+    }
+    slots_.assign(offsets_.back(), Slot{0, npos});
+
+    std::vector<size_t> distinct(nPartitions, 0);
+    util::parallelFor(nPartitions, [&](size_t p) {
+        auto* table = slots_.data() + offsets_[p];
+        const auto mask = offsets_[p + 1] - offsets_[p] - 1;
+        for (size_t i = partitionStart[p]; i < partitionStart[p + 1]; ++i) {
+            const auto row = order[i];
+            const auto hash = keys.hash(row);
+            for (auto s = static_cast<size_t>(hash) & mask;; s = (s + 1) & mask) {
+                auto& slot = table[s];
+                if (slot.row == npos) {
+                    slot = Slot{hash, row};
+                    ++distinct[p];
+                    break;
+                } else if (slot.hash == hash && keys.equal(slot.row, keys, row)) {
+                    break;
+                }
+            }
+        }
+    });
+    distinct_ = std::accumulate(distinct.begin(), distinct.end(), size_t{0});
+}
+
+std::uint32_t RowHashTable::find(const RowKeys& probe, std::uint32_t row) const {
+    const auto hash = probe.hash(row);
+    const auto p = partition(hash);
+    const auto* table = slots_.data() + offsets_[p];
+    const auto mask = offsets_[p + 1] - offsets_[p] - 1;
+    for (auto s = static_cast<size_t>(hash) & mask;; s = (s + 1) & mask) {
+        const auto& slot = table[s];
+        if (slot.row == npos) {
+            return npos;
+        } else if (slot.hash == hash && probe.equal(row, *keys_, slot.row)) {
+            return slot.row;
+        }
+    }
+}
+
+std::vector<std::uint32_t> RowHashTable::find(const RowKeys& probe) const {
+    std::vector<std::uint32_t> matches(probe.size());
+    forEachChunk(probe.size(), [&](size_t, size_t first, size_t last) {
+        for (size_t row = first; row < last; ++row) {
+            matches[row] = find(probe, static_cast<std::uint32_t>(row));
+        }
+    });
+    return matches;
+}
+
+}  // namespace dataframe
+
+}  // namespace inviwo
@@ -45,6 +45,7 @@
 #include <inviwo/dataframe/datastructures/dataframe.h>
 #include <inviwo/dataframe/util/dataframeutil.h>
 #include <inviwo/dataframe/util/filters.h>
+#include <inviwo/dataframe/util/groupby.h>
 
 namespace {
 
@@ -257,6 +258,29 @@ static void SelectRowsDataFrame(benchmark::State& st) {
     }
 }
 
+static void InnerJoinDataFrame(benchmark::State& st) {
+    auto left = createDataFrame(static_cast<int>(st.range(0)), static_cast<int>(st.range(0)));
+    auto right = createDataFrame(static_cast<int>(st.range(0)), static_cast<int>(st.range(0)));
+
+    for (auto _ : st) {
+        auto result = dataframe::innerJoin(
+            *left, *right,
+            std::vector<std::pair<std::string, std::string>>{{"col1", "col1"}, {"col2", "col2"}});
+        benchmark::DoNotOptimize(result);
+    }
+}
+
+static void GroupByDataFrame(benchmark::State& st) {
+    auto df = createDataFrame(static_cast<int>(st.range(0)), 100);
+
+    for (auto _ : st) {
+        auto result = dataframe::groupBy(*df, {"col1", "col2"},
+                                         {{"col3", dataframe::Aggregation::Sum},
+                                          {"col3", dataframe::Aggregation::Median}});
+        benchmark::DoNotOptimize(result);
+    }
+}
+
 }  // namespace
 
 // BENCHMARK(MatchingRowsPrev)->RangeMultiplier(2)->Range(8, lenRight);
@@ -266,5 +290,7 @@ static void SelectRowsDataFrame(benchmark::State& st) {
 
 // BENCHMARK(SelectRows)->RangeMultiplier(2)->Range(64, lenRight);
 BENCHMARK(SelectRowsDataFrame)->RangeMultiplier(2)->Range(64, lenRight);
+BENCHMARK(InnerJoinDataFrame)->RangeMultiplier(8)->Range(64, 1 << 21);
+BENCHMARK(GroupByDataFrame)->RangeMultiplier(8)->Range(64, 1 << 21);
 
 BENCHMARK_MAIN();
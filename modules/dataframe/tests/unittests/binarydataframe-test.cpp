@@ -0,0 +1,162 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/dataframe/io/binarydataframe.h>
+#include <inviwo/dataframe/io/binarydataframereader.h>
+#include <inviwo/dataframe/io/binarydataframewriter.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+
+namespace inviwo {
+
+namespace {
+
+DataFrame testDataFrame(size_t rows) {
+    DataFrame df;
+    std::vector<float> floats(rows);
+    std::iota(floats.begin(), floats.end(), -10.0f);
+    df.addColumn<float>("float", std::move(floats), units::unit_from_string("m"));
+    std::vector<std::int64_t> ints(rows, 7);
+    df.addColumn<std::int64_t>("int", std::move(ints), Unit{}, dvec2{0.0, 100.0});
+    auto cat = df.addCategoricalColumn("category");
+    for (size_t i = 0; i < rows; ++i) {
+        cat->add(i % 3 == 0 ? "a" : "b");
+    }
+    df.updateIndexBuffer();
+    return df;
+}
+
+void expectEqual(const DataFrame& expected, const DataFrame& result) {
+    ASSERT_EQ(expected.getNumberOfColumns(), result.getNumberOfColumns());
+    ASSERT_EQ(expected.getNumberOfRows(), result.getNumberOfRows());
+    for (size_t c = 0; c < expected.getNumberOfColumns(); ++c) {
+        const auto& a = *expected.getColumn(c);
+        const auto& b = *result.getColumn(c);
+        EXPECT_EQ(a.getHeader(), b.getHeader());
+        EXPECT_EQ(a.getColumnType(), b.getColumnType());
+        EXPECT_EQ(a.getBuffer()->getDataFormat(), b.getBuffer()->getDataFormat());
+        for (size_t i = 0; i < a.getSize(); ++i) {
+            ASSERT_EQ(a.getAsString(i), b.getAsString(i)) << a.getHeader() << " row " << i;
+        }
+    }
+}
+
+}  // namespace
+
+TEST(BinaryDataFrame, roundTrip) {
+    const auto df = testDataFrame(1000);
+
+    BinaryDataFrameWriter writer;
+    const auto buffer = writer.writeDataToBuffer(&df, "ivdf");
+
+    BinaryDataFrameReader reader;
+    const auto result = reader.readData(*buffer);
+    expectEqual(df, *result);
+    EXPECT_EQ("m", fmt::to_string(result->getColumn("float")->getUnit()));
+    const auto range = result->getColumn("int")->getCustomRange();
+    ASSERT_TRUE(range.has_value());
+    EXPECT_EQ(dvec2(0.0, 100.0), *range);
+    EXPECT_EQ(std::vector<std::string>({"a", "b"}),
+              result->getCategoricalColumnRef("category").getCategories());
+}
+
+TEST(BinaryDataFrame, compressedFile) {
+    const auto df = testDataFrame(200000);
+    util::TempFileHandle tmpFile("", ".ivdf");
+
+    BinaryDataFrameWriter writer;
+    writer.setOverwrite(Overwrite::Yes);
+    writer.compressColumns = true;
+    writer.writeData(&df, tmpFile.getFileName());
+
+    const auto info = binarydataframe::readColumnInfo(tmpFile.getFileName());
+    ASSERT_EQ(4, info.size());
+    EXPECT_EQ(binarydataframe::Codec::Deflate, info[2].codec);
+    EXPECT_EQ(dvec2(-10.0, 199989.0), info[1].dataRange);
+    EXPECT_EQ(2, info[3].categories.size());
+    for (const auto& col : info) {
+        EXPECT_EQ(0, col.offset % binarydataframe::alignment);
+    }
+
+    BinaryDataFrameReader reader;
+    expectEqual(df, *reader.readData(tmpFile.getFileName()));
+}
+
+TEST(BinaryDataFrame, emptyDataFrame) {
+    const DataFrame df;
+    BinaryDataFrameWriter writer;
+    const auto buffer = writer.writeDataToBuffer(&df, "ivdf");
+
+    BinaryDataFrameReader reader;
+    const auto result = reader.readData(*buffer);
+    EXPECT_EQ(1, result->getNumberOfColumns());
+    EXPECT_EQ(0, result->getNumberOfRows());
+}
+
+TEST(BinaryDataFrame, truncated) {
+    const auto df = testDataFrame(100);
+    BinaryDataFrameWriter writer;
+    auto buffer = writer.writeDataToBuffer(&df, "ivdf");
+
+    BinaryDataFrameReader reader;
+    buffer->resize(buffer->size() - 1);
+    EXPECT_THROW(reader.readData(*buffer), DataReaderException);
+    buffer->resize(20);
+    EXPECT_THROW(reader.readData(*buffer), DataReaderException);
+    (*buffer)[0] = 'X';
+    EXPECT_THROW(reader.readData(*buffer), DataReaderException);
+}
+
+TEST(BinaryDataFrame, invalidCategory) {
+    const auto df = testDataFrame(100);
+    BinaryDataFrameWriter writer;
+    auto buffer = writer.writeDataToBuffer(&df, "ivdf");
+
+    const auto info = binarydataframe::deserializeHeader(*buffer);
+    ASSERT_EQ(4, info.size());
+    ASSERT_EQ(binarydataframe::Codec::None, info[3].codec);
+    const std::uint32_t id = 2;
+    std::memcpy(buffer->data() + info[3].offset + 10 * sizeof(id), &id, sizeof(id));
+
+    BinaryDataFrameReader reader;
+    EXPECT_THROW(reader.readData(*buffer), DataReaderException);
+}
+
+}  // namespace inviwo
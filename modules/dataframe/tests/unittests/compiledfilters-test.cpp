@@ -0,0 +1,159 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/stdextensions.h>
+#include <inviwo/core/util/zip.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/dataframe/util/compiledfilters.h>
+#include <inviwo/dataframe/util/dataframeutil.h>
+
+#include <array>
+#include <random>
+
+namespace inviwo {
+
+namespace {
+
+DataFrame randomDataFrame(size_t rows) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> ints(-50, 50);
+    std::uniform_real_distribution<double> reals(-1.0, 1.0);
+
+    DataFrame df;
+    auto& intCol = df.addColumn<int>("int", rows)->getEditableContainer();
+    auto& floatCol = df.addColumn<float>("float", rows)->getEditableContainer();
+    auto& byteCol = df.addColumn<std::uint8_t>("byte", rows)->getEditableContainer();
+    auto cat = df.addCategoricalColumn("category");
+    const std::array<std::string_view, 4> categories{"alpha", "beta", "gamma", "delta"};
+    for (size_t i = 0; i < rows; ++i) {
+        intCol[i] = ints(gen);
+        floatCol[i] = static_cast<float>(reals(gen));
+        byteCol[i] = static_cast<std::uint8_t>(ints(gen) + 50);
+        cat->add(categories[i % categories.size()]);
+    }
+    df.updateIndexBuffer();
+    return df;
+}
+
+// Evaluates the filter predicates one row at a time
+std::vector<std::uint32_t> reference(const DataFrame& df, dataframefilters::Filters f) {
+    auto invalid = [&](const auto& filter) {
+        return filter.column < 0 || filter.column >= static_cast<int>(df.getNumberOfColumns());
+    };
+    std::erase_if(f.include, invalid);
+    std::erase_if(f.exclude, invalid);
+    const bool all = f.include.empty() && f.exclude.empty();
+
+    auto matches = [&](const std::vector<dataframefilters::ItemFilter>& filters, size_t row) {
+        for (const auto& filter : filters) {
+            const auto& col = *df.getColumn(filter.column);
+            const bool match = std::visit(
+                util::overloaded{
+                    [&](const std::function<bool(std::string_view)>& func) {
+                        return col.getColumnType() == ColumnType::Categorical &&
+                               func(col.getAsString(row));
+                    },
+                    [&](const std::function<bool(std::int64_t)>& func) {
+                        const auto* format = col.getBuffer()->getDataFormat();
+                        return col.getColumnType() != ColumnType::Categorical &&
+                               format->getNumericType() != NumericType::Float &&
+                               func(static_cast<std::int64_t>(col.getAsDouble(row)));
+                    },
+                    [&](const std::function<bool(double)>& func) {
+                        const auto* format = col.getBuffer()->getDataFormat();
+                        return format->getNumericType() == NumericType::Float &&
+                               func(col.getAsDouble(row));
+                    }},
+                filter.filter);
+            if (match) return true;
+        }
+        return false;
+    };
+
+    std::vector<std::uint32_t> rows;
+    for (size_t row = 0; row < df.getNumberOfRows(); ++row) {
+        if (all || (matches(f.include, row) && !matches(f.exclude, row))) {
+            rows.push_back(static_cast<std::uint32_t>(row));
+        }
+    }
+    return rows;
+}
+
+}  // namespace
+
+TEST(CompiledFilters, matchesPredicates) {
+    // Use enough rows for several parallel chunks and a partial last word
+    const auto df = randomDataFrame(200'003);
+
+    using namespace dataframefilters;
+    const std::vector<Filters> cases{
+        {{intMatch(1, NumberComp::Less, -20)}, {}},
+        {{intMatch(1, NumberComp::Equal, 7), intMatch(3, NumberComp::GreaterEqual, 95)}, {}},
+        {{doubleMatch(2, NumberComp::Equal, 0.5, 0.01)}, {}},
+        {{doubleMatch(2, NumberComp::NotEqual, 0.0, 0.5)}, {intRange(1, -10, 10)}},
+        {{doubleRange(2, -0.25, 0.25)}, {stringMatch(4, StringComp::Equal, "beta")}},
+        {{stringMatch(4, StringComp::Regex, "(al|ga).*")}, {intMatch(3, NumberComp::Greater, 50)}},
+        {{intRange(0, 1000, 1100), intMatch(2, NumberComp::Less, 0)}, {}},
+        {{}, {intMatch(1, NumberComp::Less, 0)}},
+        {{doubleRange(42, 0.0, 1.0)}, {}},
+        {{ItemFilter{std::function<bool(std::int64_t)>([](std::int64_t v) { return v % 3 == 0; }),
+                     1, false}},
+         {}},
+    };
+
+    for (auto&& [i, filters] : util::enumerate(cases)) {
+        EXPECT_EQ(reference(df, filters), dataframe::selectRows(df, filters)) << "case " << i;
+    }
+}
+
+TEST(CompiledFilters, noFilters) {
+    const auto df = randomDataFrame(130);
+    const dataframe::CompiledFilters compiled{df, {}};
+    const auto mask = compiled.evaluate();
+    ASSERT_EQ(3, mask.size());
+    EXPECT_EQ(~std::uint64_t{0}, mask[1]);
+    EXPECT_EQ(std::uint64_t{3}, mask[2]);
+    EXPECT_EQ(130, dataframe::maskToRows(mask).size());
+
+    const dataframe::CompiledFilters invalid{df, {{dataframefilters::intRange(42, 0, 1)}, {}}};
+    EXPECT_EQ(130, dataframe::maskToRows(invalid.evaluate()).size());
+}
+
+TEST(CompiledFilters, maskToRows) {
+    const std::vector<std::uint64_t> mask{0b1011, 0, std::uint64_t{1} << 63};
+    const std::vector<std::uint32_t> expected{0, 1, 3, 191};
+    EXPECT_EQ(expected, dataframe::maskToRows(mask));
+}
+
+}  // namespace inviwo
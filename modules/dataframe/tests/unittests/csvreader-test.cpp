@@ -37,8 +37,12 @@
 #include <inviwo/dataframe/datastructures/dataframe.h>
 #include <inviwo/core/io/datareaderexception.h>
 
+#include <cstdio>
+#include <iterator>
 #include <sstream>
 
+#include <fmt/format.h>
+
 namespace inviwo {
 
 TEST(CSVnoData, stream) {
@@ -744,4 +748,72 @@ TEST(CSVItemFilters, doubleRange) {
     EXPECT_EQ(expected, bufferram->getDataContainer()) << "Row contents incorrect";
 }
 
+namespace {
+
+// Enough rows to span several scan and parse chunks, with quoted line breaks in between
+std::string largeCSV(int rows) {
+    std::string csv = "id,value,name\n";
+    for (int i = 0; i < rows; ++i) {
+        if (i % 1000 == 0) {
+            fmt::format_to(std::back_inserter(csv), "{},{},\"multi\nline {}\"\n", i, i * 0.5,
+                           i % 3);
+        } else {
+            fmt::format_to(std::back_inserter(csv), "{},{},name {}\n", i, i * 0.5, i % 3);
+        }
+    }
+    return csv;
+}
+
+}  // namespace
+
+TEST(CSVParallel, manyChunks) {
+    constexpr int rows = 200000;
+    std::istringstream ss(largeCSV(rows));
+
+    CSVReader reader;
+    auto dataframe = reader.readData(ss);
+    ASSERT_EQ(4, dataframe->getNumberOfColumns()) << "column count does not match";
+    ASSERT_EQ(rows, dataframe->getNumberOfRows()) << "row count does not match";
+
+    auto ids = static_cast<const BufferRAMPrecision<int>*>(
+        dataframe->getColumn(1)->getBuffer()->getRepresentation<BufferRAM>());
+    auto values = static_cast<const BufferRAMPrecision<float>*>(
+        dataframe->getColumn(2)->getBuffer()->getRepresentation<BufferRAM>());
+    for (int i = 0; i < rows; ++i) {
+        ASSERT_EQ(i, ids->get(i)) << "row " << i;
+        ASSERT_EQ(static_cast<float>(i * 0.5), values->get(i)) << "row " << i;
+    }
+
+    auto names = std::dynamic_pointer_cast<const CategoricalColumn>(dataframe->getColumn(3));
+    ASSERT_TRUE(names);
+    const std::vector<std::string> categories = {
+        "multi\nline 0", "name 1", "name 2", "name 0", "multi\nline 1", "multi\nline 2"};
+    EXPECT_EQ(categories, names->getCategories()) << "categories not in order of appearance";
+    EXPECT_EQ("multi\nline 1", names->get(1000));
+    EXPECT_EQ("name 2", names->get(rows - 1));
+}
+
+TEST(CSVParallel, invalidValueInLaterChunk) {
+    auto csv = largeCSV(20000);
+    csv += "20000,invalid,name 0\n";
+    std::istringstream ss(csv);
+
+    CSVReader reader;
+    EXPECT_THROW(reader.readData(ss), DataReaderException);
+}
+
+TEST(CSVParallel, mappedFile) {
+    constexpr int rows = 100000;
+    const auto csv = largeCSV(rows);
+    util::TempFileHandle tmpFile("", ".csv");
+    std::fwrite(csv.data(), 1, csv.size(), tmpFile);
+    std::fflush(tmpFile);
+
+    CSVReader reader;
+    auto dataframe = reader.readData(tmpFile.getFileName());
+    ASSERT_EQ(4, dataframe->getNumberOfColumns()) << "column count does not match";
+    ASSERT_EQ(rows, dataframe->getNumberOfRows()) << "row count does not match";
+    EXPECT_EQ("99999", dataframe->getColumn(1)->getAsString(rows - 1));
+}
+
 }  // namespace inviwo
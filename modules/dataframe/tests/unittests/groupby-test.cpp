@@ -0,0 +1,237 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/dataframe/datastructures/column.h>
+#include <inviwo/dataframe/datastructures/dataframe.h>
+#include <inviwo/dataframe/util/groupby.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/util/exception.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <tuple>
+
+#include <fmt/format.h>
+
+namespace inviwo {
+
+namespace {
+
+template <typename T>
+const std::vector<T>& columnContents(const DataFrame& df, std::string_view header) {
+    auto col = df.getColumn(header);
+    EXPECT_TRUE(col) << fmt::format("Column '{}' missing", header);
+    return static_cast<const BufferRAMPrecision<T>*>(
+               col->getBuffer()->getRepresentation<BufferRAM>())
+        ->getDataContainer();
+}
+
+DataFrame sales() {
+    DataFrame df;
+    df.addCategoricalColumn("store", {"b", "a", "b", "c", "a", "b"});
+    df.addColumnFromBuffer("item", util::makeBuffer(std::vector<int>{1, 1, 2, 1, 1, 1}));
+    df.addColumnFromBuffer(
+        "price", util::makeBuffer(std::vector<float>{4.0f, 1.0f, 2.0f, 8.0f, 3.0f,
+                                                     std::numeric_limits<float>::quiet_NaN()}));
+    df.addColumnFromBuffer("amount", util::makeBuffer(std::vector<int>{5, 1, 3, 2, 7, 1}));
+    df.updateIndexBuffer();
+    return df;
+}
+
+}  // namespace
+
+TEST(GroupBy, SingleKey) {
+    const auto df = sales();
+
+    using dataframe::Aggregation;
+    auto result = dataframe::groupBy(df, {"store"},
+                                     {{"amount", Aggregation::Count},
+                                      {"amount", Aggregation::Sum},
+                                      {"amount", Aggregation::Mean},
+                                      {"amount", Aggregation::Min},
+                                      {"amount", Aggregation::Max},
+                                      {"price", Aggregation::Count},
+                                      {"price", Aggregation::Sum},
+                                      {"price", Aggregation::Median}});
+
+    EXPECT_EQ(3, result->getNumberOfRows()) << "one row per store expected";
+    EXPECT_EQ(10, result->getNumberOfColumns()) << "index, key, and 8 aggregates expected";
+
+    auto storeCol = dynamic_cast<const CategoricalColumn*>(result->getColumn("store").get());
+    ASSERT_TRUE(storeCol != nullptr) << "key column 'store' is not categorical";
+    const std::vector<std::string> stores{storeCol->begin(), storeCol->end()};
+    EXPECT_EQ((std::vector<std::string>{"b", "a", "c"}), stores)
+        << "groups should be in order of first occurrence";
+
+    EXPECT_EQ((std::vector<std::uint32_t>{3, 2, 1}),
+              columnContents<std::uint32_t>(*result, "amount (Count)"));
+    EXPECT_EQ((std::vector<double>{9.0, 8.0, 2.0}),
+              columnContents<double>(*result, "amount (Sum)"));
+    EXPECT_EQ((std::vector<double>{3.0, 4.0, 2.0}),
+              columnContents<double>(*result, "amount (Mean)"));
+    EXPECT_EQ((std::vector<int>{1, 1, 2}), columnContents<int>(*result, "amount (Min)"));
+    EXPECT_EQ((std::vector<int>{5, 7, 2}), columnContents<int>(*result, "amount (Max)"));
+
+    // NaN values are ignored
+    EXPECT_EQ((std::vector<std::uint32_t>{2, 2, 1}),
+              columnContents<std::uint32_t>(*result, "price (Count)"));
+    EXPECT_EQ((std::vector<double>{6.0, 4.0, 8.0}), columnContents<double>(*result, "price (Sum)"));
+    EXPECT_EQ((std::vector<double>{3.0, 2.0, 8.0}),
+              columnContents<double>(*result, "price (Median)"));
+}
+
+TEST(GroupBy, MultipleKeys) {
+    const auto df = sales();
+
+    auto result = dataframe::groupBy(df, {"store", "item"},
+                                     {{"store", dataframe::Aggregation::Count},
+                                      {"amount", dataframe::Aggregation::Sum}});
+
+    EXPECT_EQ(4, result->getNumberOfRows()) << "four distinct (store, item) pairs expected";
+    EXPECT_EQ((std::vector<int>{1, 1, 2, 1}), columnContents<int>(*result, "item"));
+    EXPECT_EQ((std::vector<std::uint32_t>{2, 2, 1, 1}),
+              columnContents<std::uint32_t>(*result, "store (Count)"));
+    EXPECT_EQ((std::vector<double>{6.0, 8.0, 3.0, 2.0}),
+              columnContents<double>(*result, "amount (Sum)"));
+}
+
+TEST(GroupBy, NaNKey) {
+    const auto nan = std::numeric_limits<double>::quiet_NaN();
+    DataFrame df;
+    df.addColumnFromBuffer("key", util::makeBuffer(std::vector<double>{1.0, nan, 1.0, nan, 2.0}));
+    df.addColumnFromBuffer("value", util::makeBuffer(std::vector<int>{1, 2, 3, 4, 5}));
+    df.updateIndexBuffer();
+
+    auto result = dataframe::groupBy(df, {"key"}, {{"value", dataframe::Aggregation::Sum}});
+
+    // every row with a NaN key is a group of its own
+    ASSERT_EQ(4, result->getNumberOfRows());
+    const auto& keys = columnContents<double>(*result, "key");
+    EXPECT_EQ(1.0, keys[0]);
+    EXPECT_TRUE(std::isnan(keys[1]));
+    EXPECT_TRUE(std::isnan(keys[2]));
+    EXPECT_EQ(2.0, keys[3]);
+    EXPECT_EQ((std::vector<double>{4.0, 2.0, 4.0, 5.0}),
+              columnContents<double>(*result, "value (Sum)"));
+}
+
+TEST(GroupBy, Quantile) {
+    DataFrame df;
+    df.addColumnFromBuffer("key", util::makeBuffer(std::vector<int>{0, 1, 0, 0, 0, 1}));
+    df.addColumnFromBuffer("value",
+                           util::makeBuffer(std::vector<double>{4.0, 10.0, 1.0, 3.0, 2.0, 20.0}));
+    df.updateIndexBuffer();
+
+    auto result = dataframe::groupBy(df, {"key"},
+                                     {{"value", dataframe::Aggregation::Quantile, 0.0},
+                                      {"value", dataframe::Aggregation::Quantile, 0.25},
+                                      {"value", dataframe::Aggregation::Quantile, 1.0}});
+
+    EXPECT_EQ((std::vector<double>{1.0, 10.0}),
+              columnContents<double>(*result, "value (Quantile 0)"));
+    EXPECT_EQ((std::vector<double>{1.75, 12.5}),
+              columnContents<double>(*result, "value (Quantile 0.25)"));
+    EXPECT_EQ((std::vector<double>{4.0, 20.0}),
+              columnContents<double>(*result, "value (Quantile 1)"));
+
+    EXPECT_THROW(
+        dataframe::groupBy(df, {"key"}, {{"value", dataframe::Aggregation::Quantile, 1.5}}),
+        Exception);
+}
+
+TEST(GroupBy, ManyGroups) {
+    // enough rows and groups to use several hash table partitions and parallel chunks
+    const int rows = 300000;
+    std::vector<int> key(rows);
+    std::vector<std::uint8_t> key2(rows);
+    std::vector<float> value(rows);
+    std::map<std::tuple<int, std::uint8_t>, std::tuple<size_t, double, float>> expected;
+    std::vector<std::tuple<int, std::uint8_t>> order;
+    for (int i = 0; i < rows; ++i) {
+        key[i] = (i * 7919) % 50021;
+        key2[i] = static_cast<std::uint8_t>(i % 3);
+        value[i] = static_cast<float>(i % 101);
+
+        auto [it, inserted] = expected.try_emplace({key[i], key2[i]}, 0, 0.0, value[i]);
+        if (inserted) order.push_back(it->first);
+        auto& [count, sum, max] = it->second;
+        ++count;
+        sum += value[i];
+        max = std::max(max, value[i]);
+    }
+
+    DataFrame df;
+    df.addColumnFromBuffer("key", util::makeBuffer(std::move(key)));
+    df.addColumnFromBuffer("key2", util::makeBuffer(std::move(key2)));
+    df.addColumnFromBuffer("value", util::makeBuffer(std::move(value)));
+    df.updateIndexBuffer();
+
+    auto result = dataframe::groupBy(df, {"key", "key2"},
+                                     {{"value", dataframe::Aggregation::Count},
+                                      {"value", dataframe::Aggregation::Sum},
+                                      {"value", dataframe::Aggregation::Max}});
+    ASSERT_EQ(order.size(), result->getNumberOfRows());
+
+    const auto& keys = columnContents<int>(*result, "key");
+    const auto& keys2 = columnContents<std::uint8_t>(*result, "key2");
+    const auto& counts = columnContents<std::uint32_t>(*result, "value (Count)");
+    const auto& sums = columnContents<double>(*result, "value (Sum)");
+    const auto& maxs = columnContents<float>(*result, "value (Max)");
+    for (size_t group = 0; group < order.size(); ++group) {
+        ASSERT_EQ(order[group], std::make_tuple(keys[group], keys2[group]));
+        const auto& [count, sum, max] = expected[order[group]];
+        EXPECT_EQ(count, counts[group]);
+        EXPECT_EQ(sum, sums[group]);
+        EXPECT_EQ(max, maxs[group]);
+    }
+}
+
+TEST(GroupBy, Exceptions) {
+    const auto df = sales();
+
+    EXPECT_THROW(dataframe::groupBy(df, {}, {}), Exception) << "no key columns";
+    EXPECT_THROW(dataframe::groupBy(df, {"missing"}, {}), Exception) << "missing key column";
+    EXPECT_THROW(dataframe::groupBy(df, {"store"}, {{"missing", dataframe::Aggregation::Sum}}),
+                 Exception)
+        << "missing aggregate column";
+    EXPECT_THROW(dataframe::groupBy(df, {"item"}, {{"store", dataframe::Aggregation::Sum}}),
+                 Exception)
+        << "sum of categorical column";
+}
+
+}  // namespace inviwo
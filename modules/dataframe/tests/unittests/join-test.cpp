@@ -390,4 +390,68 @@ TEST(LeftJoin, MultipleKeyColumns) {
                                {4.0f, 3.0f, 0.0f, 0.0f, 5.0f, 0.0f, 6.0f, 7.0f});
 }
 
+TEST(InnerJoin, DuplicateKeys) {
+    DataFrame left;
+    left.addColumnFromBuffer("key", util::makeBuffer(std::vector<int>{2, 1, 2, 5}));
+    left.updateIndexBuffer();
+
+    DataFrame right;
+    right.addColumnFromBuffer("key", util::makeBuffer(std::vector<int>{1, 2, 1, 2}));
+    right.addColumnFromBuffer("float",
+                              util::makeBuffer(std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f}));
+    right.updateIndexBuffer();
+
+    auto dataframe =
+        dataframe::innerJoin(left, right, std::pair<std::string, std::string>{"key", "key"});
+    EXPECT_EQ(3, dataframe->getNumberOfRows()) << "inner join should result in 3 rows";
+
+    checkColumnContents<std::uint32_t>(*dataframe->getIndexColumn(), {0, 1, 2});
+    checkColumnContents<int>(*dataframe->getColumn("key"), {2, 1, 2});
+    checkColumnContents<float>(*dataframe->getColumn("float"), {2.0f, 1.0f, 2.0f});
+}
+
+TEST(LeftJoin, ManyRows) {
+    // enough rows to use several hash table partitions and parallel chunks
+    const int rows = 200000;
+    std::vector<int> leftKey(rows);
+    std::vector<double> leftKey2(rows);
+    std::vector<int> rightKey(rows);
+    std::vector<double> rightKey2(rows);
+    std::vector<int> rightValue(rows);
+    for (int i = 0; i < rows; ++i) {
+        leftKey[i] = (i * 7919) % rows;
+        leftKey2[i] = static_cast<double>(leftKey[i] % 3);
+        rightKey[i] = i / 2;
+        rightKey2[i] = static_cast<double>(i % 3);
+        rightValue[i] = i;
+    }
+
+    DataFrame left;
+    left.addColumnFromBuffer("key", util::makeBuffer(std::vector<int>(leftKey)));
+    left.addColumnFromBuffer("key2", util::makeBuffer(std::vector<double>(leftKey2)));
+    left.updateIndexBuffer();
+
+    DataFrame right;
+    right.addColumnFromBuffer("key", util::makeBuffer(std::vector<int>(rightKey)));
+    right.addColumnFromBuffer("key2", util::makeBuffer(std::vector<double>(rightKey2)));
+    right.addColumnFromBuffer("value", util::makeBuffer(std::vector<int>(rightValue)));
+    right.updateIndexBuffer();
+
+    std::vector<int> expected(rows, 0);
+    for (int i = 0; i < rows; ++i) {
+        for (int r : {2 * leftKey[i], 2 * leftKey[i] + 1}) {
+            if (r < rows && rightKey2[r] == leftKey2[i]) {
+                expected[i] = rightValue[r];
+                break;
+            }
+        }
+    }
+
+    auto dataframe = dataframe::leftJoin(
+        left, right,
+        std::vector<std::pair<std::string, std::string>>{{"key", "key"}, {"key2", "key2"}});
+    EXPECT_EQ(rows, dataframe->getNumberOfRows()) << "left join should result in all left rows";
+    checkColumnContents<int>(*dataframe->getColumn("value"), expected);
+}
+
 }  // namespace inviwo
@@ -85,6 +85,19 @@ public:
         dataFunction_(destVec, index);
     }
 
+    /**
+     * \brief Range access, evaluates the function directly for each index
+     * @param dest Position to write to, expect write of NumComponents * (end - begin) many T
+     * @param begin First linear index
+     * @param end One past the last linear index
+     */
+    void fillRangeRaw(T* dest, ind begin, ind end) const override {
+        Vec* destVec = reinterpret_cast<Vec*>(dest);
+        for (ind index = begin; index < end; ++index, ++destVec) {
+            dataFunction_(*destVec, index);
+        }
+    }
+
 protected:
     virtual CachedGetter<AnalyticChannel>* newIterator() override {
         return new CachedGetter<AnalyticChannel>(this);
@@ -100,6 +100,17 @@ public:
 
     const std::vector<T>& data() const { return buffer_; }
 
+    /**
+     * \brief Contiguous view of all elements, no copy
+     * @tparam VecNT Element type, needs to match T[NumComponents] in size
+     */
+    template <typename VecNT = DefaultVec>
+    std::span<const VecNT> view() const {
+        static_assert(sizeof(VecNT) == sizeof(T) * N,
+                      "Size and type do not agree with the vector type.");
+        return {reinterpret_cast<const VecNT*>(buffer_.data()), static_cast<size_t>(size())};
+    }
+
     /**
      * \brief Indexed point access
      * @param index Linear point index
@@ -156,6 +167,18 @@ protected:
         memcpy(dest, &buffer_[index * N], sizeof(T) * N);
     }
 
+    /**
+     * \brief Range access, a single copy of the contiguous block
+     * @param dest Position to write to, expect write of NumComponents * (end - begin) many T
+     * @param begin First linear index
+     * @param end One past the last linear index
+     */
+    virtual void fillRangeRaw(T* dest, ind begin, ind end) const override {
+        if (end > begin) {
+            memcpy(dest, &buffer_[begin * N], sizeof(T) * N * (end - begin));
+        }
+    }
+
     /**
      * \brief Vector containing the buffer data
      * Resizeable only by DataSet. Handle with care:
@@ -34,6 +34,9 @@
 #include <modules/discretedata/channels/channel.h>
 #include <modules/discretedata/channels/channelgetter.h>
 #include <modules/discretedata/channels/channeliterator.h>
+#include <inviwo/core/util/assertion.h>
+
+#include <span>
 
 namespace inviwo {
 namespace discretedata {
@@ -47,6 +50,20 @@ public:
 
 protected:
     virtual void fillRaw(T* dest, ind index) const = 0;
+
+    /**
+     * \brief Contiguous range access, one virtual call for the whole range
+     * Overload in channels that can do better than one fillRaw per element.
+     * @param dest Position to write to, expect T[NumComponents * (end - begin)]
+     * @param begin First linear index
+     * @param end One past the last linear index
+     */
+    virtual void fillRangeRaw(T* dest, ind begin, ind end) const {
+        for (ind index = begin; index < end; ++index, dest += N) {
+            fillRaw(dest, index);
+        }
+    }
+
     virtual ChannelGetter<T, N>* newIterator() = 0;
 };
 
@@ -101,6 +118,23 @@ public:
         this->fillRaw(reinterpret_cast<T*>(&dest), index);
     }
 
+    /**
+     * \brief Range access, copy dest.size() consecutive elements starting at begin
+     * Prefer this over per element access in loops, it costs a single virtual call.
+     * Thread safe.
+     * @param begin Linear index of the first element
+     * @param dest Memory to write to
+     */
+    template <typename VecNT, size_t Extent>
+    void fill(ind begin, std::span<VecNT, Extent> dest) const {
+        static_assert(sizeof(VecNT) == sizeof(T) * N,
+                      "Size and type do not agree with the vector type.");
+        IVW_ASSERT(begin >= 0 && begin + static_cast<ind>(dest.size()) <= this->size(),
+                   "Range out of bounds.");
+        this->fillRangeRaw(reinterpret_cast<T*>(dest.data()), begin,
+                           begin + static_cast<ind>(dest.size()));
+    }
+
     template <typename VecNT>
     void operator()(VecNT& dest, ind index) const {
         fill(dest, index);
@@ -247,10 +281,18 @@ void DataChannel<T, N>::computeMinMax() const {
     this->fill(minT, 0);
     this->fill(maxT, 0);
 
-    for (const Vec& val : this->all<Vec>()) {
-        for (ind dim = 0; dim < N; ++dim) {
-            minT[dim] = std::min(minT[dim], val[dim]);
-            maxT[dim] = std::max(maxT[dim], val[dim]);
+    // Sweep the channel in chunks instead of going through the virtual getter per element.
+    constexpr ind chunkSize = 4096;
+    std::vector<Vec> chunk(static_cast<size_t>(std::min(chunkSize, this->size())));
+    for (ind begin = 0; begin < this->size(); begin += chunkSize) {
+        const auto count = std::min(chunkSize, this->size() - begin);
+        const std::span<Vec> values{chunk.data(), static_cast<size_t>(count)};
+        this->fill(begin, values);
+        for (const Vec& val : values) {
+            for (ind dim = 0; dim < N; ++dim) {
+                minT[dim] = std::min(minT[dim], val[dim]);
+                maxT[dim] = std::max(maxT[dim], val[dim]);
+            }
         }
     }
 
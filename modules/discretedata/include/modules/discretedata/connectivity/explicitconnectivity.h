@@ -0,0 +1,137 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/discretedata/discretedatamoduledefine.h>
+#include <inviwo/core/common/inviwo.h>
+
+#include <modules/discretedata/connectivity/connectivity.h>
+
+#include <array>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+namespace discretedata {
+
+/**
+ * \brief An unstructured grid with explicitly stored connectivity
+ *
+ * All relations are stored as compressed sparse row (CSR) tables: the connections of element i
+ * are indices[offsets[i]] to indices[offsets[i + 1]]. The table from the highest dimension to
+ * the vertices is given on construction, further tables can be added explicitly. All other
+ * GridPrimitive pairs are derived in parallel the first time they are accessed and cached:
+ *  - the reverse of an explicit table is its transpose,
+ *  - two elements of the same dimension are neighbors if they share an element of the
+ *    dimension below (vertices share an edge or a cell, cells share at least as many vertices
+ *    as their dimension),
+ *  - other pairs are incident if the vertices of the smaller element are contained in the
+ *    larger one.
+ * The rows of derived tables are sorted. Adding tables is not thread safe, accessing them is.
+ */
+class IVW_MODULE_DISCRETEDATA_API ExplicitConnectivity : public Connectivity {
+public:
+    struct IVW_MODULE_DISCRETEDATA_API CSR {
+        //! Start of each row in indices, size numRows + 1
+        std::vector<ind> offsets{0};
+        std::vector<ind> indices;
+
+        ind size() const { return static_cast<ind>(offsets.size()) - 1; }
+        std::span<const ind> operator[](ind row) const {
+            return {indices.data() + offsets[row],
+                    static_cast<size_t>(offsets[row + 1] - offsets[row])};
+        }
+
+        //! Build a table where each row has the same number of entries, e.g. tetrahedra
+        static CSR uniform(std::vector<ind> indices, ind rowSize);
+    };
+
+    /**
+     * \brief Create an unstructured grid from its cells
+     * @param gridDimension Dimension of the cells
+     * @param numVertices Number of vertices
+     * @param cells Vertices of each cell
+     * @param cellTypes Type of each cell, derived from the number of vertices if empty
+     */
+    ExplicitConnectivity(GridPrimitive gridDimension, ind numVertices, CSR cells,
+                         std::vector<CellType> cellTypes = {});
+    virtual ~ExplicitConnectivity() = default;
+
+    /**
+     * \brief Add an explicit table, e.g. the edges or faces of the grid as vertex lists
+     * Not thread safe, add all tables before accessing the connectivity.
+     */
+    void addConnections(GridPrimitive from, GridPrimitive to, CSR table);
+
+    /**
+     * \brief Get the table between two dimensions, derives it on first access
+     * An empty table is returned if the relation can not be derived from the given tables.
+     */
+    const CSR& getTable(GridPrimitive from, GridPrimitive to) const;
+
+    /**
+     * \brief Connections of a single element without copying or allocating
+     * @see Connectivity::getConnections
+     */
+    std::span<const ind> connections(ind index, GridPrimitive from, GridPrimitive to) const {
+        return getTable(from, to)[index];
+    }
+
+    /**
+     * \brief Derive the tables between all dimensions that have a relation to the vertices
+     * Useful to pay the setup cost up front instead of on first access.
+     */
+    void precompute() const;
+
+    virtual void getConnections(std::vector<ind>& result, ind index, GridPrimitive from,
+                                GridPrimitive to, bool isPosition = false) const override;
+
+    virtual CellType getCellType(GridPrimitive dim, ind index) const override;
+
+    static CSR transpose(const CSR& table, ind numColumns);
+
+protected:
+    static constexpr size_t maxDims = static_cast<size_t>(GridPrimitive::HyperVolume) + 1;
+    size_t key(GridPrimitive from, GridPrimitive to) const {
+        return static_cast<size_t>(from) * maxDims + static_cast<size_t>(to);
+    }
+    bool isKnown(GridPrimitive dim) const;
+    CSR derive(GridPrimitive from, GridPrimitive to) const;
+
+    std::vector<CellType> cellTypes_;
+    std::array<bool, maxDims * maxDims> explicit_{};
+    mutable std::array<std::optional<CSR>, maxDims * maxDims> tables_;
+    mutable std::array<std::once_flag, maxDims * maxDims> derived_;
+};
+
+}  // namespace discretedata
+}  // namespace inviwo
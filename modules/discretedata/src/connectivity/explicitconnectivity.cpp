@@ -0,0 +1,303 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/discretedata/connectivity/explicitconnectivity.h>
+
+#include <inviwo/core/util/assertion.h>
+#include <inviwo/core/util/parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+
+namespace inviwo {
+namespace discretedata {
+
+namespace {
+
+/**
+ * Build a table row by row in parallel. Each block of rows writes to its own buffer, the
+ * buffers are concatenated afterwards.
+ */
+template <typename RowFunc>
+ExplicitConnectivity::CSR buildRows(ind numRows, RowFunc rowFunc) {
+    ExplicitConnectivity::CSR result;
+    if (numRows <= 0) return result;
+
+    const auto rows = static_cast<size_t>(numRows);
+    const auto grain = std::max<size_t>(1024, rows / (4 * (util::getPoolSize() + 1)));
+    struct Block {
+        std::vector<ind> rowSizes;
+        std::vector<ind> indices;
+    };
+    std::vector<Block> blocks((rows + grain - 1) / grain);
+
+    util::parallelForBlocks(
+        rows,
+        [&](size_t begin, size_t end) {
+            auto& block = blocks[begin / grain];
+            block.rowSizes.reserve(end - begin);
+            std::vector<ind> scratch;
+            for (size_t row = begin; row < end; ++row) {
+                const auto before = block.indices.size();
+                rowFunc(static_cast<ind>(row), block.indices, scratch);
+                block.rowSizes.push_back(static_cast<ind>(block.indices.size() - before));
+            }
+        },
+        grain);
+
+    result.offsets.resize(rows + 1);
+    std::vector<size_t> blockStart(blocks.size() + 1, 0);
+    for (size_t b = 0, row = 0; b < blocks.size(); ++b) {
+        for (auto rowSize : blocks[b].rowSizes) {
+            result.offsets[row + 1] = result.offsets[row] + rowSize;
+            ++row;
+        }
+        blockStart[b + 1] = blockStart[b] + blocks[b].indices.size();
+    }
+    result.indices.resize(blockStart.back());
+    util::parallelFor(
+        0, blocks.size(),
+        [&](size_t b) {
+            std::copy(blocks[b].indices.begin(), blocks[b].indices.end(),
+                      result.indices.begin() + blockStart[b]);
+        },
+        1);
+    return result;
+}
+
+/**
+ * Compose two tables: the candidates of a row are all entries of 'second' reachable through the
+ * entries of 'first'. A candidate is kept if keep(row, candidate, count) holds, where count is
+ * the number of paths leading to it.
+ */
+template <typename Keep>
+ExplicitConnectivity::CSR compose(const ExplicitConnectivity::CSR& first,
+                                  const ExplicitConnectivity::CSR& second, Keep keep) {
+    return buildRows(first.size(), [&](ind row, std::vector<ind>& out, std::vector<ind>& scratch) {
+        scratch.clear();
+        for (auto middle : first[row]) {
+            const auto reached = second[middle];
+            scratch.insert(scratch.end(), reached.begin(), reached.end());
+        }
+        std::sort(scratch.begin(), scratch.end());
+        for (auto it = scratch.begin(); it != scratch.end();) {
+            const auto next = std::find_if(it, scratch.end(), [&](ind i) { return i != *it; });
+            if (keep(row, *it, static_cast<ind>(next - it))) out.push_back(*it);
+            it = next;
+        }
+    });
+}
+
+CellType cellTypeFromSize(GridPrimitive dim, size_t numVertices) {
+    switch (dim) {
+        case GridPrimitive::Vertex:
+            return CellType::Vertex;
+        case GridPrimitive::Edge:
+            return numVertices == 2 ? CellType::Line : CellType::PolyLine;
+        case GridPrimitive::Face:
+            switch (numVertices) {
+                case 3:
+                    return CellType::Triangle;
+                case 4:
+                    return CellType::Quad;
+                default:
+                    return CellType::Polygon;
+            }
+        case GridPrimitive::Volume:
+            switch (numVertices) {
+                case 4:
+                    return CellType::Tetra;
+                case 5:
+                    return CellType::Pyramid;
+                case 6:
+                    return CellType::Wedge;
+                case 8:
+                    return CellType::Hexahedron;
+                default:
+                    return CellType::ConvexPointSet;
+            }
+        default:
+            return CellType::EmptyCell;
+    }
+}
+
+}  // namespace
+
+ExplicitConnectivity::CSR ExplicitConnectivity::CSR::uniform(std::vector<ind> indices,
+                                                             ind rowSize) {
+    IVW_ASSERT(rowSize > 0 && static_cast<ind>(indices.size()) % rowSize == 0,
+               "Number of indices is not a multiple of the row size.");
+    CSR result;
+    result.offsets.resize(indices.size() / rowSize + 1);
+    for (size_t row = 0; row < result.offsets.size(); ++row) {
+        result.offsets[row] = static_cast<ind>(row) * rowSize;
+    }
+    result.indices = std::move(indices);
+    return result;
+}
+
+ExplicitConnectivity::ExplicitConnectivity(GridPrimitive gridDimension, ind numVertices, CSR cells,
+                                           std::vector<CellType> cellTypes)
+    : Connectivity(gridDimension), cellTypes_(std::move(cellTypes)) {
+    IVW_ASSERT(gridDimension > GridPrimitive::Vertex && gridDimension <= GridPrimitive::HyperVolume,
+               "Unsupported grid dimension.");
+    IVW_ASSERT(cellTypes_.empty() || static_cast<ind>(cellTypes_.size()) == cells.size(),
+               "Expected one cell type per cell.");
+    numGridPrimitives_[static_cast<ind>(GridPrimitive::Vertex)] = numVertices;
+    addConnections(gridDimension, GridPrimitive::Vertex, std::move(cells));
+}
+
+void ExplicitConnectivity::addConnections(GridPrimitive from, GridPrimitive to, CSR table) {
+    IVW_ASSERT(from > GridPrimitive::Undef && from <= gridDimension_ &&
+                   to > GridPrimitive::Undef && to <= gridDimension_,
+               "GridPrimitive outside of the grid dimension.");
+    numGridPrimitives_[static_cast<ind>(from)] = table.size();
+    if (numGridPrimitives_[static_cast<ind>(to)] == -1) {
+        const auto it = std::max_element(table.indices.begin(), table.indices.end());
+        numGridPrimitives_[static_cast<ind>(to)] = it == table.indices.end() ? 0 : *it + 1;
+    }
+    explicit_[key(from, to)] = true;
+    tables_[key(from, to)] = std::move(table);
+}
+
+const ExplicitConnectivity::CSR& ExplicitConnectivity::getTable(GridPrimitive from,
+                                                                GridPrimitive to) const {
+    const auto k = key(from, to);
+    std::call_once(derived_[k], [&]() {
+        if (!tables_[k]) tables_[k] = derive(from, to);
+    });
+    return *tables_[k];
+}
+
+bool ExplicitConnectivity::isKnown(GridPrimitive dim) const {
+    return dim == GridPrimitive::Vertex || explicit_[key(dim, GridPrimitive::Vertex)] ||
+           explicit_[key(GridPrimitive::Vertex, dim)];
+}
+
+ExplicitConnectivity::CSR ExplicitConnectivity::derive(GridPrimitive from, GridPrimitive to) const {
+    constexpr auto vertex = GridPrimitive::Vertex;
+
+    if (explicit_[key(to, from)]) {
+        return transpose(getTable(to, from), getNumElements(from));
+    }
+    if (!isKnown(from) || !isKnown(to)) {
+        IVW_ASSERT(false, "Connectivity can not be derived from the given tables.");
+        return {};
+    }
+
+    if (from == vertex && to == vertex) {
+        // Vertices are neighbors if they share an edge, or the lowest known dimension above.
+        auto via = GridPrimitive::Edge;
+        while (!isKnown(via)) via = static_cast<GridPrimitive>(static_cast<ind>(via) + 1);
+        return compose(getTable(vertex, via), getTable(via, vertex),
+                       [](ind row, ind vert, ind) { return row != vert; });
+    }
+
+    const auto& fromVerts = getTable(from, vertex);
+    const auto& vertsTo = getTable(vertex, to);
+    if (from == to) {
+        // Neighbors share a facet, i.e. at least as many vertices as their dimension.
+        const auto shared = static_cast<ind>(from);
+        return compose(fromVerts, vertsTo, [shared](ind row, ind other, ind count) {
+            return row != other && count >= shared;
+        });
+    }
+    if (to < from) {
+        // Keep the elements whose vertices all belong to the larger element.
+        const auto& toVerts = getTable(to, vertex);
+        return compose(fromVerts, vertsTo, [&](ind, ind element, ind count) {
+            return count == static_cast<ind>(toVerts[element].size());
+        });
+    }
+    return compose(fromVerts, vertsTo, [&](ind row, ind, ind count) {
+        return count == static_cast<ind>(fromVerts[row].size());
+    });
+}
+
+ExplicitConnectivity::CSR ExplicitConnectivity::transpose(const CSR& table, ind numColumns) {
+    CSR result;
+    result.offsets.assign(static_cast<size_t>(numColumns) + 1, 0);
+    if (numColumns <= 0) return result;
+
+    const auto rows = static_cast<size_t>(table.size());
+    std::vector<std::atomic<ind>> counts(static_cast<size_t>(numColumns));
+    util::parallelFor(0, rows, [&](size_t row) {
+        for (auto column : table[static_cast<ind>(row)]) {
+            counts[column].fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+
+    for (size_t column = 0; column < counts.size(); ++column) {
+        result.offsets[column + 1] = result.offsets[column] + counts[column].load();
+        counts[column].store(result.offsets[column], std::memory_order_relaxed);
+    }
+
+    result.indices.resize(table.indices.size());
+    util::parallelFor(0, rows, [&](size_t row) {
+        for (auto column : table[static_cast<ind>(row)]) {
+            const auto pos = counts[column].fetch_add(1, std::memory_order_relaxed);
+            result.indices[pos] = static_cast<ind>(row);
+        }
+    });
+
+    // The fill order depends on the scheduling, sorting makes the rows deterministic.
+    util::parallelFor(0, static_cast<size_t>(numColumns), [&](size_t column) {
+        std::sort(result.indices.begin() + result.offsets[column],
+                  result.indices.begin() + result.offsets[column + 1]);
+    });
+    return result;
+}
+
+void ExplicitConnectivity::precompute() const {
+    for (ind from = 0; from <= static_cast<ind>(gridDimension_); ++from) {
+        for (ind to = 0; to <= static_cast<ind>(gridDimension_); ++to) {
+            if (isKnown(static_cast<GridPrimitive>(from)) &&
+                isKnown(static_cast<GridPrimitive>(to))) {
+                getTable(static_cast<GridPrimitive>(from), static_cast<GridPrimitive>(to));
+            }
+        }
+    }
+}
+
+void ExplicitConnectivity::getConnections(std::vector<ind>& result, ind index, GridPrimitive from,
+                                          GridPrimitive to, bool) const {
+    const auto row = connections(index, from, to);
+    result.assign(row.begin(), row.end());
+}
+
+CellType ExplicitConnectivity::getCellType(GridPrimitive dim, ind index) const {
+    if (dim == gridDimension_ && !cellTypes_.empty()) return cellTypes_[index];
+    if (dim == GridPrimitive::Vertex) return CellType::Vertex;
+    if (!isKnown(dim)) return Connectivity::getCellType(dim, index);
+    return cellTypeFromSize(dim, connections(index, dim, GridPrimitive::Vertex).size());
+}
+
+}  // namespace discretedata
+}  // namespace inviwo
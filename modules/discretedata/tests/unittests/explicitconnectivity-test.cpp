@@ -0,0 +1,154 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/discretedata/channels/analyticchannel.h>
+#include <modules/discretedata/channels/bufferchannel.h>
+#include <modules/discretedata/connectivity/explicitconnectivity.h>
+
+namespace inviwo {
+namespace discretedata {
+
+namespace {
+
+// Two tetrahedra sharing the face {1, 2, 3}.
+std::shared_ptr<ExplicitConnectivity> twoTetras() {
+    return std::make_shared<ExplicitConnectivity>(
+        GridPrimitive::Volume, 5,
+        ExplicitConnectivity::CSR::uniform({0, 1, 2, 3, 1, 2, 3, 4}, 4));
+}
+
+std::vector<ind> connected(const Connectivity& grid, ind index, GridPrimitive from,
+                           GridPrimitive to) {
+    std::vector<ind> result;
+    grid.getConnections(result, index, from, to);
+    return result;
+}
+
+}  // namespace
+
+TEST(ExplicitConnectivity, DerivedTables) {
+    auto grid = twoTetras();
+    constexpr auto vert = GridPrimitive::Vertex;
+    constexpr auto cell = GridPrimitive::Volume;
+
+    EXPECT_EQ(grid->getNumElements(vert), 5);
+    EXPECT_EQ(grid->getNumElements(cell), 2);
+    EXPECT_EQ(grid->getCellType(cell, 1), CellType::Tetra);
+
+    EXPECT_EQ(connected(*grid, 0, vert, cell), std::vector<ind>({0}));
+    EXPECT_EQ(connected(*grid, 2, vert, cell), std::vector<ind>({0, 1}));
+    EXPECT_EQ(connected(*grid, 4, vert, cell), std::vector<ind>({1}));
+
+    EXPECT_EQ(connected(*grid, 0, cell, cell), std::vector<ind>({1}));
+    EXPECT_EQ(connected(*grid, 1, cell, cell), std::vector<ind>({0}));
+
+    EXPECT_EQ(connected(*grid, 0, vert, vert), std::vector<ind>({1, 2, 3}));
+    EXPECT_EQ(connected(*grid, 1, vert, vert), std::vector<ind>({0, 2, 3, 4}));
+
+    const auto row = grid->connections(1, cell, vert);
+    EXPECT_EQ(std::vector<ind>(row.begin(), row.end()), std::vector<ind>({1, 2, 3, 4}));
+}
+
+TEST(ExplicitConnectivity, IntermediateDimension) {
+    auto grid = twoTetras();
+    constexpr auto vert = GridPrimitive::Vertex;
+    constexpr auto face = GridPrimitive::Face;
+    constexpr auto cell = GridPrimitive::Volume;
+
+    grid->addConnections(face, vert,
+                         ExplicitConnectivity::CSR::uniform(
+                             {1, 2, 3, 0, 2, 3, 0, 1, 3, 0, 1, 2, 2, 3, 4, 1, 3, 4, 1, 2, 4}, 3));
+    grid->precompute();
+
+    EXPECT_EQ(grid->getNumElements(face), 7);
+    EXPECT_EQ(grid->getCellType(face, 0), CellType::Triangle);
+    EXPECT_EQ(connected(*grid, 0, cell, face), std::vector<ind>({0, 1, 2, 3}));
+    EXPECT_EQ(connected(*grid, 1, cell, face), std::vector<ind>({0, 4, 5, 6}));
+    EXPECT_EQ(connected(*grid, 0, face, cell), std::vector<ind>({0, 1}));
+    EXPECT_EQ(connected(*grid, 6, face, cell), std::vector<ind>({1}));
+    EXPECT_EQ(connected(*grid, 0, face, face), std::vector<ind>({1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(connected(*grid, 3, face, face), std::vector<ind>({0, 1, 2, 6}));
+
+    // Without edges, vertices are neighbors through the faces.
+    EXPECT_EQ(connected(*grid, 0, vert, vert), std::vector<ind>({1, 2, 3}));
+    EXPECT_EQ(connected(*grid, 4, vert, vert), std::vector<ind>({1, 2, 3}));
+
+    // Every table is consistent with its reverse.
+    for (auto from : {vert, face, cell}) {
+        for (auto to : {vert, face, cell}) {
+            if (from == to) continue;
+            for (ind i = 0; i < grid->getNumElements(from); ++i) {
+                for (auto j : grid->connections(i, from, to)) {
+                    const auto back = grid->connections(j, to, from);
+                    EXPECT_NE(std::find(back.begin(), back.end(), i), back.end());
+                }
+            }
+        }
+    }
+}
+
+TEST(ExplicitConnectivity, Transpose) {
+    const auto table = ExplicitConnectivity::CSR::uniform({2, 0, 1, 2, 2, 1}, 2);
+    const auto transposed = ExplicitConnectivity::transpose(table, 4);
+
+    EXPECT_EQ(transposed.offsets, std::vector<ind>({0, 1, 3, 6, 6}));
+    EXPECT_EQ(transposed.indices, std::vector<ind>({0, 1, 2, 0, 1, 2}));
+}
+
+TEST(ExplicitConnectivity, ChannelRangeAccess) {
+    BufferChannel<float, 2> buffer(std::vector<float>{0, 1, 2, 3, 4, 5, 6, 7}, "buffer");
+    std::array<std::array<float, 2>, 2> dest;
+    buffer.fill(1, std::span{dest});
+    EXPECT_EQ(dest[0], (std::array<float, 2>{2, 3}));
+    EXPECT_EQ(dest[1], (std::array<float, 2>{4, 5}));
+
+    const auto view = buffer.view<std::array<float, 2>>();
+    ASSERT_EQ(view.size(), 4u);
+    EXPECT_EQ(view[3], (std::array<float, 2>{6, 7}));
+
+    AnalyticChannel<float, 1> analytic([](std::array<float, 1>& val, ind i) { val[0] = 2.0f * i; },
+                                       10, "analytic");
+    std::array<std::array<float, 1>, 3> values;
+    analytic.fill(4, std::span{values});
+    EXPECT_EQ(values[0][0], 8.0f);
+    EXPECT_EQ(values[2][0], 12.0f);
+
+    std::array<float, 1> min, max;
+    analytic.getMinMax(min, max);
+    EXPECT_EQ(min[0], 0.0f);
+    EXPECT_EQ(max[0], 18.0f);
+}
+
+}  // namespace discretedata
+}  // namespace inviwo
@@ -47,6 +47,8 @@
 
 #include <limits>
 #include <functional>
+#include <mutex>
+#include <optional>
 #include <type_traits>
 #include <string>
 #include <vector>
@@ -77,6 +79,10 @@ public:
 
     Document getInfo() const;
 
+    /**
+     * Calls on the group, and the destruction of any objects opened from it, have to hold
+     * hdf5::libraryMutex().
+     */
     const H5::Group& getGroup() const;
 
     Handle* getHandleForPath(const std::string& path) const;
@@ -96,17 +102,23 @@ public:
     static constexpr std::string_view dataName{"HDF"};
 
 private:
+    /**
+     * Open the group at path_ in filename_ under hdf5::libraryMutex(). data_ is optional such that
+     * the destructor can release it while holding the mutex.
+     */
+    void open();
     double getMin(const DataFormatBase* type) const;
     double getMax(const DataFormatBase* type) const;
 
     std::filesystem::path filename_;
     Path path_;
-    H5::Group data_;
+    std::optional<H5::Group> data_;
 };
 
 template <typename T>
 std::vector<T> Handle::getVectorAtPath(const Path& path) const {
-    H5::DataSet ds = data_.openDataSet(path);
+    const std::scoped_lock lock{libraryMutex()};
+    H5::DataSet ds = data_->openDataSet(path);
     size_t rank = ds.getSpace().getSimpleExtentNdims();
 
     hsize_t* dims = new hsize_t[rank];
@@ -129,7 +141,8 @@ std::vector<T> Handle::getVectorAtPath(const Path& path) const {
 
 template <typename T>
 std::vector<glm::tvec3<T, glm::defaultp>> Handle::getVectorOfVec3AtPath(const Path& path) const {
-    H5::DataSet ds = data_.openDataSet(path);
+    const std::scoped_lock lock{libraryMutex()};
+    H5::DataSet ds = data_->openDataSet(path);
     size_t rank = ds.getSpace().getSimpleExtentNdims();
 
     if (rank != 2) throw Exception("Trying to read data with invalid rank");
@@ -62,6 +62,10 @@ struct TypeMap<char> {
     static H5::PredType getType() { return H5::PredType::NATIVE_INT8; }
 };
 template <>
+struct TypeMap<signed char> {
+    static H5::PredType getType() { return H5::PredType::NATIVE_INT8; }
+};
+template <>
 struct TypeMap<short> {
     static H5::PredType getType() { return H5::PredType::NATIVE_INT16; }
 };
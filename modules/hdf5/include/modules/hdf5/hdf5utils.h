@@ -39,6 +39,7 @@
 #include <H5Cpp.h>
 #include <warn/pop>
 
+#include <mutex>
 #include <vector>
 
 namespace inviwo {
@@ -59,6 +60,15 @@ IVW_MODULE_HDF5_API Paths findpaths(const H5::Group& grp, const Path& path,
 IVW_MODULE_HDF5_API bool isOfType(const H5::Group& grp, const std::string& type);
 IVW_MODULE_HDF5_API VolumeInfos getVolumeInfo(const H5::DataSet& ds, const Path& path);
 
+/**
+ * The HDF5 library is in general not built thread safe, and volumes are loaded brick by brick on
+ * the thread pool. Every call into the library, including the destruction of HDF5 objects, has
+ * to hold this mutex. All functions and classes of this module lock it, code using the HDF5
+ * objects they return, like Handle::getGroup(), has to lock it as well. The mutex is recursive
+ * such that those functions can be called while holding it.
+ */
+IVW_MODULE_HDF5_API std::recursive_mutex& libraryMutex();
+
 }  // namespace hdf5
 
 }  // namespace inviwo
@@ -0,0 +1,153 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/hdf5/hdf5moduledefine.h>
+#include <modules/hdf5/datastructures/hdf5handle.h>
+#include <modules/hdf5/datastructures/hdf5path.h>
+
+#include <inviwo/core/datastructures/diskrepresentation.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+#include <inviwo/core/datastructures/volume/volumerepresentation.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace inviwo {
+
+namespace hdf5 {
+
+/**
+ * How the dimensions of a selection holding a single element are mapped to the volume. Dropped
+ * dimensions do not become axes, such that for example a 2D slice of a 3D dataset becomes the x
+ * and y axes of the volume. Kept dimensions become axes of extent one, which preserves the layout
+ * of a dataset with three dimensions.
+ */
+enum class SingleElementDims { Drop, Keep };
+
+/**
+ * \brief A loader of a hyperslab of a HDF5 dataset. Used to create VolumeRAM representations.
+ *
+ * Nothing is read on construction, apart from the layout and attributes of the dataset. Regions
+ * of the volume are read on demand straight from the file, only the requested hyperslab is ever
+ * read. As a VolumeBrickSourceProvider the loader lets a VolumeBricked load single bricks, with a
+ * brick size aligned to the native chunking of the dataset, such that every chunk is decompressed
+ * by a single brick. The alignment holds for selections starting at a chunk boundary with a
+ * stride of one.
+ *
+ * Like all HDF5 calls of this module, reads hold hdf5::libraryMutex() since bricks are loaded
+ * concurrently.
+ * @see Handle::getVolumeAtPathAsType
+ */
+class IVW_MODULE_HDF5_API VolumeRAMLoader : public DiskRepresentationLoader<VolumeRepresentation>,
+                                            public VolumeBrickSourceProvider {
+public:
+    /**
+     * @param filename of the HDF5 file
+     * @param path absolute path of the dataset within the file
+     * @param selection one selection per dimension of the dataset, in column major order. At
+     *     most three dimensions may select more than one element, they become the x, y and z
+     *     axes of the volume in order.
+     * @param format of the resulting volume, the format of the dataset if nullptr. HDF5 converts
+     *     the data while reading.
+     * @param singleElementDims whether dimensions selecting a single element become axes too,
+     *     with SingleElementDims::Keep the selection may have at most three dimensions.
+     * @throws hdf5::Exception if the dataset can not be opened or the selection is invalid
+     */
+    VolumeRAMLoader(const std::filesystem::path& filename, const Path& path,
+                    const std::vector<Handle::Selection>& selection,
+                    const DataFormatBase* format = nullptr,
+                    SingleElementDims singleElementDims = SingleElementDims::Drop);
+    virtual VolumeRAMLoader* clone() const override;
+    virtual ~VolumeRAMLoader() = default;
+
+    virtual std::shared_ptr<VolumeRepresentation> createRepresentation(
+        const VolumeRepresentation& src) const override;
+    virtual void updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                      const VolumeRepresentation& src) const override;
+    virtual std::shared_ptr<const VolumeBrickSource> createBrickSource(
+        const VolumeRepresentation& src) const override;
+
+    const size3_t& getDimensions() const;
+    const DataFormatBase* getDataFormat() const;
+
+    /**
+     * The native chunk size of the dataset along the axes of the volume, std::nullopt if the
+     * dataset is not chunked.
+     */
+    std::optional<size3_t> getChunkSize() const;
+
+    /**
+     * The data range stored as attributes of the dataset. Either a pair in `dataRange`,
+     * `actual_range` or `valid_range`, or scalars in `min`/`max`, `minimum`/`maximum` or
+     * `valid_min`/`valid_max`. std::nullopt if there are none.
+     */
+    std::optional<dvec2> getStoredDataRange() const;
+
+    /**
+     * Compute the data range by reading the selection in slabs aligned to the chunks, the whole
+     * volume is never held in memory.
+     */
+    dvec2 computeDataRange() const;
+
+    /**
+     * Read the voxels in [offset, offset + dims) of the volume into a new VolumeRAM.
+     * @throws hdf5::Exception if the data can not be read
+     */
+    std::shared_ptr<VolumeRAM> read(const size3_t& offset, const size3_t& dims) const;
+
+private:
+    class Source;
+    std::shared_ptr<const Source> source_;
+};
+
+namespace util {
+
+/**
+ * Create a volume of the selection of the dataset at @p path, backed by a VolumeRAMLoader. Only
+ * the layout and attributes of the dataset are read, the voxels are read when first accessed.
+ * The data range is taken from the stored attributes if there are any, otherwise it is computed
+ * by VolumeRAMLoader::computeDataRange.
+ * @see VolumeRAMLoader::VolumeRAMLoader
+ */
+IVW_MODULE_HDF5_API std::shared_ptr<Volume> createVolume(
+    const std::filesystem::path& filename, const Path& path,
+    const std::vector<Handle::Selection>& selection, const DataFormatBase* format = nullptr,
+    SingleElementDims singleElementDims = SingleElementDims::Drop);
+
+}  // namespace util
+
+}  // namespace hdf5
+
+}  // namespace inviwo
@@ -0,0 +1,103 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/hdf5/hdf5moduledefine.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/io/datareader.h>
+
+#include <filesystem>
+#include <memory>
+
+namespace inviwo {
+
+namespace hdf5 {
+
+/**
+ * \ingroup dataio
+ * \brief Reader for HDF5 volume files
+ *
+ * Reads the first volume of the file, see util::readVolumeSequence.
+ * @see hdf5::VolumeWriter
+ */
+class IVW_MODULE_HDF5_API VolumeReader : public DataReaderType<Volume> {
+public:
+    VolumeReader();
+    VolumeReader(const VolumeReader&) = default;
+    VolumeReader(VolumeReader&&) noexcept = default;
+    VolumeReader& operator=(const VolumeReader&) = default;
+    VolumeReader& operator=(VolumeReader&&) noexcept = default;
+    virtual VolumeReader* clone() const override;
+    virtual ~VolumeReader() = default;
+
+    virtual std::shared_ptr<Volume> readData(const std::filesystem::path& filePath) override;
+};
+
+/**
+ * \ingroup dataio
+ * \brief Reader for HDF5 volume sequence files
+ *
+ * Every volume is only read when it is first accessed, e.g. when a single timestep is picked by
+ * a VolumeSequenceElementSelectorProcessor, see util::readVolumeSequence.
+ * @see hdf5::VolumeSequenceWriter
+ */
+class IVW_MODULE_HDF5_API VolumeSequenceReader : public DataReaderType<VolumeSequence> {
+public:
+    VolumeSequenceReader();
+    VolumeSequenceReader(const VolumeSequenceReader&) = default;
+    VolumeSequenceReader(VolumeSequenceReader&&) noexcept = default;
+    VolumeSequenceReader& operator=(const VolumeSequenceReader&) = default;
+    VolumeSequenceReader& operator=(VolumeSequenceReader&&) noexcept = default;
+    virtual VolumeSequenceReader* clone() const override;
+    virtual ~VolumeSequenceReader() = default;
+
+    virtual std::shared_ptr<VolumeSequence> readData(
+        const std::filesystem::path& filePath) override;
+};
+
+namespace util {
+
+/**
+ * Open all three dimensional datasets in the root group of @p filePath as volumes, in the order
+ * of their names. The volumes are backed by a VolumeRAMLoader and nothing but the layout and
+ * attributes of the datasets is read. All three dimensions become axes, also those of extent one
+ * (see SingleElementDims::Keep), and the attributes written by util::writeVolume are applied to
+ * the volumes.
+ * @throws DataReaderException if the file can not be read or holds no volumes
+ */
+IVW_MODULE_HDF5_API std::shared_ptr<VolumeSequence> readVolumeSequence(
+    const std::filesystem::path& filePath);
+
+}  // namespace util
+
+}  // namespace hdf5
+
+}  // namespace inviwo
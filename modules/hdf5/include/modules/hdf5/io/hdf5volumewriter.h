@@ -0,0 +1,129 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/hdf5/hdf5moduledefine.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/io/datawriter.h>
+#include <inviwo/core/util/glmvec.h>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <H5Cpp.h>
+#include <warn/pop>
+
+#include <filesystem>
+#include <string>
+
+namespace inviwo {
+
+namespace hdf5 {
+
+struct IVW_MODULE_HDF5_API WriteOptions {
+    //! Chunk size of the datasets, cropped to the volume dimensions
+    size3_t chunkSize{64, 64, 64};
+    //! Level of the deflate (gzip) filter, 0 to 9, where 0 disables compression
+    int compressionLevel = 4;
+    //! Apply the shuffle filter before compressing, improves the compression of multi byte types
+    bool shuffle = true;
+};
+
+/**
+ * \ingroup dataio
+ * \brief Writer for volumes as HDF5 files
+ *
+ * The volume is stored as a chunked and compressed dataset named `volume` in the root group, see
+ * util::writeVolume. Scalar volumes only.
+ * @see hdf5::VolumeReader
+ */
+class IVW_MODULE_HDF5_API VolumeWriter : public DataWriterType<Volume> {
+public:
+    VolumeWriter();
+    VolumeWriter(const VolumeWriter&) = default;
+    VolumeWriter(VolumeWriter&&) noexcept = default;
+    VolumeWriter& operator=(const VolumeWriter&) = default;
+    VolumeWriter& operator=(VolumeWriter&&) noexcept = default;
+    virtual VolumeWriter* clone() const override;
+    virtual ~VolumeWriter() = default;
+
+    virtual void writeData(const Volume* data,
+                           const std::filesystem::path& filePath) const override;
+};
+
+/**
+ * \ingroup dataio
+ * \brief Writer for volume sequences as a single HDF5 file
+ *
+ * Each volume of the sequence is stored as a dataset `volume0`, `volume1`, ... in the root group,
+ * zero padded such that the names sort in sequence order, see util::writeVolume. Each timestep
+ * can be read independently of the others.
+ * @see hdf5::VolumeSequenceReader
+ */
+class IVW_MODULE_HDF5_API VolumeSequenceWriter : public DataWriterType<VolumeSequence> {
+public:
+    VolumeSequenceWriter();
+    VolumeSequenceWriter(const VolumeSequenceWriter&) = default;
+    VolumeSequenceWriter(VolumeSequenceWriter&&) noexcept = default;
+    VolumeSequenceWriter& operator=(const VolumeSequenceWriter&) = default;
+    VolumeSequenceWriter& operator=(VolumeSequenceWriter&&) noexcept = default;
+    virtual VolumeSequenceWriter* clone() const override;
+    virtual ~VolumeSequenceWriter() = default;
+
+    virtual void writeData(const VolumeSequence* data,
+                           const std::filesystem::path& filePath) const override;
+};
+
+namespace util {
+
+/**
+ * Write @p volume as the dataset @p name of @p group. The dataset is chunked and compressed
+ * according to @p options, and the data range, value range, value name and unit, model and
+ * world matrix, and the timestamp if any, are stored as attributes. Volumes that are only
+ * available out-of-core are written brick by brick, see VolumeBricked.
+ * @throws DataWriterException if the volume is not scalar or the data can not be written
+ */
+IVW_MODULE_HDF5_API void writeVolume(const Volume& volume, H5::Group& group,
+                                     const std::string& name, const WriteOptions& options = {});
+
+IVW_MODULE_HDF5_API void writeVolume(const Volume& volume, const std::filesystem::path& filePath,
+                                     const WriteOptions& options = {},
+                                     Overwrite overwrite = Overwrite::No);
+
+IVW_MODULE_HDF5_API void writeVolumeSequence(const VolumeSequence& sequence,
+                                             const std::filesystem::path& filePath,
+                                             const WriteOptions& options = {},
+                                             Overwrite overwrite = Overwrite::No);
+
+}  // namespace util
+
+}  // namespace hdf5
+
+}  // namespace inviwo
@@ -29,6 +29,8 @@
 
 #include <modules/hdf5/hdf5module.h>
 
+#include <modules/hdf5/io/hdf5volumereader.h>
+#include <modules/hdf5/io/hdf5volumewriter.h>
 #include <modules/hdf5/ports/hdf5port.h>
 #include <modules/hdf5/processors/hdf5source.h>
 #include <modules/hdf5/processors/hdf5volumesource.h>
@@ -43,6 +45,11 @@ HDF5Module::HDF5Module(InviwoApplication* app) : InviwoModule(app, "HDF5") {
     registerProcessor<hdf5::Source>();
     registerProcessor<hdf5::HDF5ToVolume>();
     registerProcessor<hdf5::PathSelection>();
+
+    registerDataReader(std::make_unique<hdf5::VolumeReader>());
+    registerDataReader(std::make_unique<hdf5::VolumeSequenceReader>());
+    registerDataWriter(std::make_unique<hdf5::VolumeWriter>());
+    registerDataWriter(std::make_unique<hdf5::VolumeSequenceWriter>());
 }
 
 }  // namespace inviwo
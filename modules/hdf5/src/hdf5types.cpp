@@ -28,8 +28,11 @@
  *********************************************************************************/
 
 #include <modules/hdf5/hdf5types.h>
+#include <modules/hdf5/hdf5utils.h>
 #include <inviwo/core/util/logcentral.h>
 
+#include <mutex>
+
 namespace inviwo {
 
 namespace hdf5 {
@@ -39,6 +42,7 @@ namespace hdf5 {
 
 IVW_MODULE_HDF5_API const DataFormatBase* util::getDataFormatFromDataSet(
     const H5::DataSet& dataset) {
+    const std::scoped_lock lock{libraryMutex()};
     NumericType numerictype;
     const int components = 1;
     size_t presision = 8;
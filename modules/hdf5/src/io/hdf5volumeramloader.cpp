@@ -0,0 +1,355 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/hdf5/io/hdf5volumeramloader.h>
+#include <modules/hdf5/hdf5types.h>
+#include <modules/hdf5/hdf5utils.h>
+
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/logcentral.h>
+
+#include <modules/base/algorithm/dataminmax.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <mutex>
+#include <utility>
+
+namespace inviwo {
+
+namespace hdf5 {
+
+namespace {
+
+std::vector<double> readAttribute(const H5::DataSet& dataset, const char* name) {
+    if (!dataset.attrExists(name)) return {};
+    const auto attr = dataset.openAttribute(name);
+    const auto typeClass = attr.getTypeClass();
+    if (typeClass != H5T_INTEGER && typeClass != H5T_FLOAT) return {};
+    std::vector<double> values(static_cast<size_t>(attr.getSpace().getSimpleExtentNpoints()));
+    attr.read(H5::PredType::NATIVE_DOUBLE, values.data());
+    return values;
+}
+
+std::optional<dvec2> readStoredRange(const H5::DataSet& dataset) {
+    try {
+        for (auto name : {"dataRange", "actual_range", "valid_range"}) {
+            if (const auto range = readAttribute(dataset, name); range.size() == 2) {
+                return dvec2{range[0], range[1]};
+            }
+        }
+        constexpr std::array<std::pair<const char*, const char*>, 3> pairs{
+            {{"min", "max"}, {"minimum", "maximum"}, {"valid_min", "valid_max"}}};
+        for (const auto& [minName, maxName] : pairs) {
+            const auto min = readAttribute(dataset, minName);
+            const auto max = readAttribute(dataset, maxName);
+            if (min.size() == 1 && max.size() == 1) return dvec2{min[0], max[0]};
+        }
+    } catch (const H5::Exception&) {
+    }
+    return std::nullopt;
+}
+
+}  // namespace
+
+class VolumeRAMLoader::Source : public VolumeBrickSource {
+public:
+    Source(const std::filesystem::path& filename, const Path& path,
+           const std::vector<Handle::Selection>& selection, const DataFormatBase* format,
+           SingleElementDims singleElementDims);
+    Source(const Source&) = delete;
+    Source& operator=(const Source&) = delete;
+    virtual ~Source();
+
+    virtual const size3_t& getDimensions() const override { return dimensions_; }
+    virtual const DataFormatBase* getDataFormat() const override { return format_; }
+    virtual std::shared_ptr<VolumeRAM> load(size3_t offset, size3_t dims) const override;
+    virtual std::optional<size3_t> getPreferredBrickSize() const override;
+
+    void read(const size3_t& offset, const size3_t& dims, void* dest) const;
+
+    std::optional<size3_t> chunkSize;
+    std::optional<dvec2> storedRange;
+
+private:
+    // Destroys the HDF5 objects, only call while holding the library mutex
+    void close();
+
+    // Optional such that they can be destroyed while holding the library mutex
+    std::optional<H5::H5File> file_;
+    std::optional<H5::DataSet> dataset_;
+    // Row major (HDF5 order) start and stride of the selection
+    std::vector<hsize_t> start_;
+    std::vector<hsize_t> stride_;
+    // The row major dimension of the dataset of each volume axis, -1 if the axis is not selected
+    std::array<int, 3> axes_{-1, -1, -1};
+    size3_t dimensions_{1};
+    const DataFormatBase* format_;
+};
+
+VolumeRAMLoader::Source::Source(const std::filesystem::path& filename, const Path& path,
+                                const std::vector<Handle::Selection>& selection,
+                                const DataFormatBase* format,
+                                SingleElementDims singleElementDims) {
+    const std::scoped_lock lock{libraryMutex()};
+    try {
+        file_.emplace(filename.generic_string(), H5F_ACC_RDONLY);
+        dataset_.emplace(file_->openDataSet(path));
+
+        const auto dataSpace = dataset_->getSpace();
+        const auto rank = static_cast<size_t>(dataSpace.getSimpleExtentNdims());
+        if (selection.size() != rank) {
+            throw Exception("Selection not of the same rank as the data");
+        }
+
+        // The selection is column major like Inviwo, while HDF5 is row major. The selected
+        // dimensions become the x, y and z axes of the volume in order, dimensions selecting a
+        // single element are skipped unless they are kept.
+        start_.resize(rank);
+        stride_.resize(rank);
+        size_t nextAxis = 0;
+        for (size_t i = 0; i < rank; ++i) {
+            const auto dim = rank - 1 - i;
+            start_[dim] = selection[i].start;
+            stride_[dim] = std::max<size_t>(1, selection[i].stride);
+            const auto count = (selection[i].end - selection[i].start) / stride_[dim];
+            if (count > 1 || singleElementDims == SingleElementDims::Keep) {
+                if (nextAxis > 2) throw Exception("Invalid selection, resulting rank > 3");
+                axes_[nextAxis] = static_cast<int>(dim);
+                dimensions_[nextAxis] = count;
+                ++nextAxis;
+            }
+        }
+
+        format_ = format ? format : util::getDataFormatFromDataSet(*dataset_);
+        if (!format_ || format_->getComponents() != 1) {
+            throw Exception(SourceContext{}, "Unsupported data type in dataset {}",
+                            path.toString());
+        }
+
+        const auto plist = dataset_->getCreatePlist();
+        if (plist.getLayout() == H5D_CHUNKED) {
+            std::vector<hsize_t> chunk(rank);
+            plist.getChunk(static_cast<int>(rank), chunk.data());
+            size3_t size{1};
+            for (size_t axis = 0; axis < 3; ++axis) {
+                if (axes_[axis] < 0) continue;
+                const auto dim = static_cast<size_t>(axes_[axis]);
+                size[axis] = std::max<size_t>(1, (chunk[dim] + stride_[dim] - 1) / stride_[dim]);
+            }
+            chunkSize = size;
+        }
+        storedRange = readStoredRange(*dataset_);
+    } catch (const H5::Exception& e) {
+        close();
+        throw Exception(SourceContext{}, "HDF: unable to open dataset {} in {}: {}",
+                        path.toString(), filename.generic_string(), e.getDetailMsg());
+    } catch (...) {
+        close();
+        throw;
+    }
+}
+
+VolumeRAMLoader::Source::~Source() {
+    const std::scoped_lock lock{libraryMutex()};
+    close();
+}
+
+void VolumeRAMLoader::Source::close() {
+    dataset_.reset();
+    file_.reset();
+}
+
+std::shared_ptr<VolumeRAM> VolumeRAMLoader::Source::load(size3_t offset, size3_t dims) const {
+    auto volumeRAM = createVolumeRAM(dims, format_);
+    read(offset, dims, volumeRAM->getData());
+    return volumeRAM;
+}
+
+std::optional<size3_t> VolumeRAMLoader::Source::getPreferredBrickSize() const {
+    if (!chunkSize) return std::nullopt;
+    // Bricks of whole chunks, as close to the default brick size as possible
+    size3_t size;
+    for (size_t axis = 0; axis < 3; ++axis) {
+        const auto chunk = (*chunkSize)[axis];
+        const auto target = VolumeBricked::defaultBrickSize[axis];
+        size[axis] = chunk * std::max<size_t>(1, (target + chunk / 2) / chunk);
+    }
+    return size;
+}
+
+void VolumeRAMLoader::Source::read(const size3_t& offset, const size3_t& dims, void* dest) const {
+    auto start = start_;
+    std::vector<hsize_t> count(start_.size(), 1);
+    for (size_t axis = 0; axis < 3; ++axis) {
+        if (axes_[axis] < 0) continue;
+        const auto dim = static_cast<size_t>(axes_[axis]);
+        start[dim] += offset[axis] * stride_[dim];
+        count[dim] = dims[axis];
+    }
+    const std::array<hsize_t, 3> memoryDimensions{dims.z, dims.y, dims.x};
+
+    dispatching::singleDispatch<void, dispatching::filter::Scalars>(
+        format_->getId(), [&]<typename T>() {
+            const std::scoped_lock lock{libraryMutex()};
+            try {
+                auto dataSpace = dataset_->getSpace();
+                dataSpace.selectHyperslab(H5S_SELECT_SET, count.data(), start.data(),
+                                          stride_.data(), nullptr);
+                H5::DataSpace memorySpace(3, memoryDimensions.data());
+                dataset_->read(dest, TypeMap<T>::getType(), memorySpace, dataSpace);
+            } catch (const H5::Exception& e) {
+                throw Exception(SourceContext{}, "HDF: unable to read data: {}",
+                                e.getDetailMsg());
+            }
+        });
+}
+
+VolumeRAMLoader::VolumeRAMLoader(const std::filesystem::path& filename, const Path& path,
+                                 const std::vector<Handle::Selection>& selection,
+                                 const DataFormatBase* format,
+                                 SingleElementDims singleElementDims)
+    : source_{std::make_shared<const Source>(filename, path, selection, format,
+                                             singleElementDims)} {}
+
+VolumeRAMLoader* VolumeRAMLoader::clone() const { return new VolumeRAMLoader(*this); }
+
+namespace {
+
+void checkFormat(const VolumeBrickSource& source, const VolumeRepresentation& src) {
+    if (source.getDataFormat() != src.getDataFormat() ||
+        source.getDimensions() != src.getDimensions()) {
+        throw DataReaderException(SourceContext{},
+                                  "HDF5 dataset does not match the expected format");
+    }
+}
+
+}  // namespace
+
+std::shared_ptr<VolumeRepresentation> VolumeRAMLoader::createRepresentation(
+    const VolumeRepresentation& src) const {
+    checkFormat(*source_, src);
+
+    auto volumeRAM = createVolumeRAM(src.getDimensions(), src.getDataFormat(), nullptr,
+                                     src.getSwizzleMask(), src.getInterpolation(),
+                                     src.getWrapping());
+    source_->read(size3_t{0}, src.getDimensions(), volumeRAM->getData());
+    return volumeRAM;
+}
+
+void VolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                           const VolumeRepresentation& src) const {
+    checkFormat(*source_, src);
+    auto volumeDst = std::static_pointer_cast<VolumeRAM>(dest);
+
+    if (src.getDimensions() != volumeDst->getDimensions()) {
+        volumeDst->setDimensions(src.getDimensions());
+    }
+    source_->read(size3_t{0}, src.getDimensions(), volumeDst->getData());
+
+    volumeDst->setSwizzleMask(src.getSwizzleMask());
+    volumeDst->setInterpolation(src.getInterpolation());
+    volumeDst->setWrapping(src.getWrapping());
+}
+
+std::shared_ptr<const VolumeBrickSource> VolumeRAMLoader::createBrickSource(
+    const VolumeRepresentation& src) const {
+    checkFormat(*source_, src);
+    return source_;
+}
+
+const size3_t& VolumeRAMLoader::getDimensions() const { return source_->getDimensions(); }
+
+const DataFormatBase* VolumeRAMLoader::getDataFormat() const { return source_->getDataFormat(); }
+
+std::optional<size3_t> VolumeRAMLoader::getChunkSize() const { return source_->chunkSize; }
+
+std::optional<dvec2> VolumeRAMLoader::getStoredDataRange() const { return source_->storedRange; }
+
+dvec2 VolumeRAMLoader::computeDataRange() const {
+    const auto& dims = getDimensions();
+    // Slabs of whole chunks along z, or about 64 MB for contiguous datasets
+    const auto sliceBytes =
+        std::max<size_t>(1, dims.x * dims.y * getDataFormat()->getSizeInBytes());
+    const size_t depth = source_->chunkSize ? source_->chunkSize->z
+                                            : std::max<size_t>(1, (size_t{64} << 20) / sliceBytes);
+
+    dvec2 range{std::numeric_limits<double>::max(), std::numeric_limits<double>::lowest()};
+    for (size_t z = 0; z < dims.z; z += depth) {
+        const size3_t slab{dims.x, dims.y, std::min(depth, dims.z - z)};
+        const auto volumeRAM = read(size3_t{0, 0, z}, slab);
+        volumeRAM->dispatch<void, dispatching::filter::Scalars>([&](auto vrprecision) {
+            const auto [min, max] =
+                ::inviwo::util::dataMinMax(vrprecision->getDataTyped(), glm::compMul(slab));
+            range.x = std::min(range.x, min.x);
+            range.y = std::max(range.y, max.x);
+        });
+    }
+    return range;
+}
+
+std::shared_ptr<VolumeRAM> VolumeRAMLoader::read(const size3_t& offset,
+                                                 const size3_t& dims) const {
+    return source_->load(offset, dims);
+}
+
+std::shared_ptr<Volume> util::createVolume(const std::filesystem::path& filename, const Path& path,
+                                           const std::vector<Handle::Selection>& selection,
+                                           const DataFormatBase* format,
+                                           SingleElementDims singleElementDims) {
+    auto loader =
+        std::make_unique<VolumeRAMLoader>(filename, path, selection, format, singleElementDims);
+    const auto dimensions = loader->getDimensions();
+    const auto* dataFormat = loader->getDataFormat();
+
+    const auto storedRange = loader->getStoredDataRange();
+    const auto dataRange = storedRange ? *storedRange : loader->computeDataRange();
+
+    log::info("Opened HDF volume type: {} dims: {} data range: {} ({}) file: {}",
+              dataFormat->getString(), dimensions, dataRange,
+              storedRange ? "stored" : "computed", filename.generic_string());
+
+    auto volumeDisk = std::make_shared<VolumeDisk>(filename, dimensions, dataFormat);
+    volumeDisk->setLoader(loader.release());
+
+    auto volume = std::make_shared<Volume>(volumeDisk);
+    volume->dataMap.dataRange = dataRange;
+    volume->dataMap.valueRange = dataRange;
+    return volume;
+}
+
+}  // namespace hdf5
+
+}  // namespace inviwo
@@ -0,0 +1,193 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/hdf5/io/hdf5volumereader.h>
+#include <modules/hdf5/io/hdf5volumeramloader.h>
+#include <modules/hdf5/hdf5exception.h>
+#include <modules/hdf5/hdf5utils.h>
+
+#include <inviwo/core/datastructures/unitsystem.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/metadata/metadata.h>
+#include <inviwo/core/util/fileextension.h>
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <H5Cpp.h>
+#include <warn/pop>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <array>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace inviwo {
+
+namespace hdf5 {
+
+VolumeReader::VolumeReader() : DataReaderType<Volume>() {
+    addExtension(FileExtension("h5", "HDF5 Volume"));
+    addExtension(FileExtension("hdf5", "HDF5 Volume"));
+}
+
+VolumeReader* VolumeReader::clone() const { return new VolumeReader(*this); }
+
+std::shared_ptr<Volume> VolumeReader::readData(const std::filesystem::path& filePath) {
+    return util::readVolumeSequence(filePath)->front();
+}
+
+VolumeSequenceReader::VolumeSequenceReader() : DataReaderType<VolumeSequence>() {
+    addExtension(FileExtension("h5", "HDF5 Volume Sequence"));
+    addExtension(FileExtension("hdf5", "HDF5 Volume Sequence"));
+}
+
+VolumeSequenceReader* VolumeSequenceReader::clone() const {
+    return new VolumeSequenceReader(*this);
+}
+
+std::shared_ptr<VolumeSequence> VolumeSequenceReader::readData(
+    const std::filesystem::path& filePath) {
+    return util::readVolumeSequence(filePath);
+}
+
+namespace {
+
+struct DataSetInfo {
+    std::string name;
+    std::vector<Handle::Selection> selection;
+    std::optional<dvec2> valueRange;
+    std::optional<mat4> modelMatrix;
+    std::optional<mat4> worldMatrix;
+    std::optional<std::string> valueName;
+    std::optional<std::string> valueUnit;
+    std::optional<double> timestamp;
+};
+
+template <size_t N>
+std::optional<std::array<double, N>> readNumbers(const H5::DataSet& dataset, const char* name) {
+    if (!dataset.attrExists(name)) return std::nullopt;
+    const auto attr = dataset.openAttribute(name);
+    if (attr.getSpace().getSimpleExtentNpoints() != static_cast<hssize_t>(N)) return std::nullopt;
+    std::array<double, N> values;
+    attr.read(H5::PredType::NATIVE_DOUBLE, values.data());
+    return values;
+}
+
+std::optional<mat4> readMatrix(const H5::DataSet& dataset, const char* name) {
+    if (const auto values = readNumbers<16>(dataset, name)) {
+        return mat4{glm::make_mat4(values->data())};
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string> readString(const H5::DataSet& dataset, const char* name) {
+    if (!dataset.attrExists(name)) return std::nullopt;
+    const auto attr = dataset.openAttribute(name);
+    const auto type = attr.getDataType();
+    if (type.getClass() != H5T_STRING) return std::nullopt;
+    std::string value;
+    attr.read(type, value);
+    return value;
+}
+
+std::vector<DataSetInfo> findVolumes(const std::filesystem::path& filePath) {
+    const std::scoped_lock lock{libraryMutex()};
+    std::vector<DataSetInfo> infos;
+
+    const H5::H5File file(filePath.generic_string(), H5F_ACC_RDONLY);
+    const auto root = file.openGroup("/");
+    for (hsize_t i = 0; i < root.getNumObjs(); ++i) {
+        if (root.getObjTypeByIdx(i) != H5G_DATASET) continue;
+        const auto name = root.getObjnameByIdx(i);
+        const auto dataset = root.openDataSet(name);
+        const auto space = dataset.getSpace();
+        if (space.getSimpleExtentNdims() != 3) continue;
+
+        std::array<hsize_t, 3> dims;
+        space.getSimpleExtentDims(dims.data());
+
+        auto& info = infos.emplace_back();
+        info.name = name;
+        // Column major, i.e. the reverse of the row major HDF5 dimensions
+        info.selection = {{0, dims[2], 1}, {0, dims[1], 1}, {0, dims[0], 1}};
+        if (const auto range = readNumbers<2>(dataset, "valueRange")) {
+            info.valueRange = dvec2{(*range)[0], (*range)[1]};
+        }
+        info.modelMatrix = readMatrix(dataset, "modelMatrix");
+        info.worldMatrix = readMatrix(dataset, "worldMatrix");
+        info.valueName = readString(dataset, "valueName");
+        info.valueUnit = readString(dataset, "valueUnit");
+        if (const auto timestamp = readNumbers<1>(dataset, "timestamp")) {
+            info.timestamp = (*timestamp)[0];
+        }
+    }
+    return infos;
+}
+
+}  // namespace
+
+std::shared_ptr<VolumeSequence> util::readVolumeSequence(const std::filesystem::path& filePath) {
+    try {
+        const auto infos = findVolumes(filePath);
+        if (infos.empty()) {
+            throw DataReaderException(SourceContext{}, "HDF: no volumes found in {}",
+                                      filePath.generic_string());
+        }
+
+        auto volumes = std::make_shared<VolumeSequence>();
+        for (const auto& info : infos) {
+            // Keep all axes, also those of extent one, such that the stored matrices match
+            auto volume = createVolume(filePath, Path{info.name}, info.selection, nullptr,
+                                       SingleElementDims::Keep);
+            if (info.valueRange) volume->dataMap.valueRange = *info.valueRange;
+            if (info.modelMatrix) volume->setModelMatrix(*info.modelMatrix);
+            if (info.worldMatrix) volume->setWorldMatrix(*info.worldMatrix);
+            if (info.valueName) volume->dataMap.valueAxis.name = *info.valueName;
+            if (info.valueUnit) {
+                volume->dataMap.valueAxis.unit = units::unit_from_string(*info.valueUnit);
+            }
+            if (info.timestamp) volume->setMetaData<DoubleMetaData>("timestamp", *info.timestamp);
+            volumes->push_back(std::move(volume));
+        }
+        return volumes;
+    } catch (const H5::Exception& e) {
+        throw DataReaderException(SourceContext{}, "HDF: unable to read {}: {}",
+                                  filePath.generic_string(), e.getDetailMsg());
+    } catch (const hdf5::Exception& e) {
+        throw DataReaderException(SourceContext{}, "HDF: unable to read {}: {}",
+                                  filePath.generic_string(), e.getMessage());
+    }
+}
+
+}  // namespace hdf5
+
+}  // namespace inviwo
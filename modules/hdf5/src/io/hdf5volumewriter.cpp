@@ -0,0 +1,247 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/hdf5/io/hdf5volumewriter.h>
+#include <modules/hdf5/hdf5types.h>
+#include <modules/hdf5/hdf5utils.h>
+
+#include <inviwo/core/datastructures/unitsystem.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/metadata/metadata.h>
+#include <inviwo/core/util/fileextension.h>
+#include <inviwo/core/util/formatdispatching.h>
+#include <inviwo/core/util/raiiutils.h>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <mutex>
+#include <optional>
+
+#include <fmt/format.h>
+
+namespace inviwo {
+
+namespace hdf5 {
+
+VolumeWriter::VolumeWriter() : DataWriterType<Volume>() {
+    addExtension(FileExtension("h5", "HDF5 Volume"));
+    addExtension(FileExtension("hdf5", "HDF5 Volume"));
+}
+
+VolumeWriter* VolumeWriter::clone() const { return new VolumeWriter(*this); }
+
+void VolumeWriter::writeData(const Volume* data, const std::filesystem::path& filePath) const {
+    util::writeVolume(*data, filePath, {}, getOverwrite());
+}
+
+VolumeSequenceWriter::VolumeSequenceWriter() : DataWriterType<VolumeSequence>() {
+    addExtension(FileExtension("h5", "HDF5 Volume Sequence"));
+    addExtension(FileExtension("hdf5", "HDF5 Volume Sequence"));
+}
+
+VolumeSequenceWriter* VolumeSequenceWriter::clone() const {
+    return new VolumeSequenceWriter(*this);
+}
+
+void VolumeSequenceWriter::writeData(const VolumeSequence* data,
+                                     const std::filesystem::path& filePath) const {
+    util::writeVolumeSequence(*data, filePath, {}, getOverwrite());
+}
+
+namespace {
+
+// Row major (HDF5 order) version of a column major (Inviwo order) size
+std::array<hsize_t, 3> rowMajor(const size3_t& v) { return {v.z, v.y, v.x}; }
+
+template <size_t N>
+void writeAttribute(H5::DataSet& dataset, const char* name, const std::array<double, N>& values) {
+    const hsize_t size = N;
+    const H5::DataSpace space(1, &size);
+    auto attr = dataset.createAttribute(name, H5::PredType::NATIVE_DOUBLE, space);
+    attr.write(H5::PredType::NATIVE_DOUBLE, values.data());
+}
+
+void writeAttribute(H5::DataSet& dataset, const char* name, const mat4& matrix) {
+    std::array<double, 16> values;
+    std::copy_n(glm::value_ptr(matrix), 16, values.begin());
+    writeAttribute(dataset, name, values);
+}
+
+void writeAttribute(H5::DataSet& dataset, const char* name, const std::string& value) {
+    const H5::StrType type(H5::PredType::C_S1, H5T_VARIABLE);
+    auto attr = dataset.createAttribute(name, type, H5::DataSpace(H5S_SCALAR));
+    attr.write(type, value);
+}
+
+template <typename T>
+void writeDataSet(const Volume& volume, H5::Group& group, const std::string& name,
+                  const WriteOptions& options) {
+    const auto dims = volume.getDimensions();
+    const auto fileDimensions = rowMajor(dims);
+    const auto chunk = rowMajor(glm::max(size3_t{1}, glm::min(options.chunkSize, dims)));
+
+    // Out-of-core volumes are written brick by brick. The representations are fetched before
+    // locking the library since loading them might need it as well.
+    const auto bricked = ::inviwo::util::getBrickedRepresentation(volume);
+    const auto volumeRAM = bricked ? nullptr : volume.getRepresentationShared<VolumeRAM>();
+
+    // The dataset is destroyed while holding the library mutex, also when writing fails
+    std::optional<H5::DataSet> dataset;
+    const ::inviwo::util::OnScopeExit closeDataSet{[&]() {
+        const std::scoped_lock lock{libraryMutex()};
+        dataset.reset();
+    }};
+
+    try {
+        const std::scoped_lock lock{libraryMutex()};
+        const auto type = TypeMap<T>::getType();
+        H5::DSetCreatPropList plist;
+        plist.setChunk(3, chunk.data());
+        if (options.shuffle) plist.setShuffle();
+        if (options.compressionLevel > 0) plist.setDeflate(options.compressionLevel);
+
+        const H5::DataSpace fileSpace(3, fileDimensions.data());
+        dataset.emplace(group.createDataSet(name, type, fileSpace, plist));
+
+        const auto& dataMap = volume.dataMap;
+        writeAttribute(*dataset, "dataRange", std::array{dataMap.dataRange.x, dataMap.dataRange.y});
+        writeAttribute(*dataset, "valueRange",
+                       std::array{dataMap.valueRange.x, dataMap.valueRange.y});
+        writeAttribute(*dataset, "valueName", dataMap.valueAxis.name);
+        writeAttribute(*dataset, "valueUnit", units::to_string(dataMap.valueAxis.unit));
+        writeAttribute(*dataset, "modelMatrix", volume.getModelMatrix());
+        writeAttribute(*dataset, "worldMatrix", volume.getWorldMatrix());
+        if (const auto* timestamp = volume.getMetaData<DoubleMetaData>("timestamp")) {
+            writeAttribute(*dataset, "timestamp", std::array{timestamp->get()});
+        }
+
+        if (volumeRAM) {
+            dataset->write(volumeRAM->getData(), type);
+        }
+    } catch (const H5::Exception& e) {
+        throw DataWriterException(SourceContext{}, "HDF: unable to write dataset {}: {}", name,
+                                  e.getDetailMsg());
+    }
+
+    if (bricked) {
+        bricked->forEachBrick(size3_t{0}, dims, [&](const VolumeRAM& brick, const size3_t& offset) {
+            const auto start = rowMajor(offset);
+            const auto count = rowMajor(brick.getDimensions());
+            const std::scoped_lock lock{libraryMutex()};
+            try {
+                auto fileSpace = dataset->getSpace();
+                fileSpace.selectHyperslab(H5S_SELECT_SET, count.data(), start.data());
+                const H5::DataSpace memorySpace(3, count.data());
+                dataset->write(brick.getData(), TypeMap<T>::getType(), memorySpace, fileSpace);
+            } catch (const H5::Exception& e) {
+                throw DataWriterException(SourceContext{}, "HDF: unable to write dataset {}: {}",
+                                          name, e.getDetailMsg());
+            }
+        });
+    }
+}
+
+/**
+ * A newly created file and its root group. Both are opened and closed while holding the library
+ * mutex, such that they never race concurrent HDF5 calls, e.g. bricks being loaded.
+ */
+class OutputFile {
+public:
+    OutputFile(const std::filesystem::path& filePath, Overwrite overwrite) {
+        DataWriter::checkOverwrite(filePath, overwrite);
+        const std::scoped_lock lock{libraryMutex()};
+        try {
+            file_.emplace(filePath.generic_string(), H5F_ACC_TRUNC);
+            root_.emplace(file_->openGroup("/"));
+        } catch (const H5::Exception& e) {
+            root_.reset();
+            file_.reset();
+            throw DataWriterException(SourceContext{}, "HDF: unable to create {}: {}",
+                                      filePath.generic_string(), e.getDetailMsg());
+        }
+    }
+    OutputFile(const OutputFile&) = delete;
+    OutputFile& operator=(const OutputFile&) = delete;
+    ~OutputFile() {
+        const std::scoped_lock lock{libraryMutex()};
+        root_.reset();
+        file_.reset();
+    }
+
+    H5::Group& root() { return *root_; }
+
+private:
+    std::optional<H5::H5File> file_;
+    std::optional<H5::Group> root_;
+};
+
+}  // namespace
+
+void util::writeVolume(const Volume& volume, H5::Group& group, const std::string& name,
+                       const WriteOptions& options) {
+    const auto* format = volume.getDataFormat();
+    if (format->getComponents() != 1) {
+        throw DataWriterException(SourceContext{}, "HDF: only scalar volumes are supported, got {}",
+                                  format->getString());
+    }
+    dispatching::singleDispatch<void, dispatching::filter::Scalars>(
+        format->getId(), [&]<typename T>() { writeDataSet<T>(volume, group, name, options); });
+}
+
+void util::writeVolume(const Volume& volume, const std::filesystem::path& filePath,
+                       const WriteOptions& options, Overwrite overwrite) {
+    OutputFile file{filePath, overwrite};
+    writeVolume(volume, file.root(), "volume", options);
+}
+
+void util::writeVolumeSequence(const VolumeSequence& sequence,
+                               const std::filesystem::path& filePath, const WriteOptions& options,
+                               Overwrite overwrite) {
+    if (sequence.empty()) {
+        throw DataWriterException(SourceContext{}, "Expected non-empty volume sequence");
+    }
+    OutputFile file{filePath, overwrite};
+
+    // Zero padded names keep the timesteps in sequence order when sorted by name
+    const auto numDigits = static_cast<int>(std::log10(sequence.size())) + 1;
+    size_t index = 0;
+    for (const auto& volume : sequence) {
+        writeVolume(*volume, file.root(), fmt::format("volume{:0{}}", index++, numDigits),
+                    options);
+    }
+}
+
+}  // namespace hdf5
+
+}  // namespace inviwo
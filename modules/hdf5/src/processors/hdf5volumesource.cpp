@@ -36,6 +36,7 @@
 #include <functional>
 #include <numeric>
 #include <limits>
+#include <mutex>
 
 #include <inviwo/core/datastructures/unitsystem.h>
 #include <inviwo/core/util/glm.h>
@@ -197,6 +198,7 @@ mat4 HDF5ToVolume::getBasisFromMeta(MetaData meta) {
 
     if (inport_.hasData()) {
         const auto data = inport_.getData();
+        const std::scoped_lock lock{libraryMutex()};
         H5::DataSet dataset = data->getGroup().openDataSet(meta.path_);
         H5::DataSpace space = dataset.getSpace();
         int rank = space.getSimpleExtentNdims();
@@ -336,9 +338,12 @@ void HDF5ToVolume::makeVolume() {
                 }
             }();
 
-            volume_ = std::shared_ptr<Volume>(
-                data->getVolumeAtPathAsType(Path(data->getGroup().getObjName()) + volumeMeta.path_,
-                                            selection_.getSelection(), format));
+            const auto groupPath = [&]() {
+                const std::scoped_lock lock{libraryMutex()};
+                return Path(data->getGroup().getObjName());
+            }();
+            volume_ = std::shared_ptr<Volume>(data->getVolumeAtPathAsType(
+                groupPath + volumeMeta.path_, selection_.getSelection(), format));
 
             dataRange_.set(volume_->dataMap.dataRange);
             outport_.setData(volume_);
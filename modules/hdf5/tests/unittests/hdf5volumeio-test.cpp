@@ -0,0 +1,193 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/hdf5/io/hdf5volumeramloader.h>
+#include <modules/hdf5/io/hdf5volumereader.h>
+#include <modules/hdf5/io/hdf5volumewriter.h>
+
+#include <inviwo/core/datastructures/unitsystem.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/metadata/metadata.h>
+
+#include <glm/gtx/component_wise.hpp>
+#include <glm/gtx/transform.hpp>
+
+#include <cstdio>
+#include <numeric>
+
+namespace inviwo {
+
+namespace {
+
+std::shared_ptr<Volume> createVolume(const size3_t& dims, float first) {
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(dims);
+    auto* data = ram->getDataTyped();
+    std::iota(data, data + glm::compMul(dims), first);
+
+    auto volume = std::make_shared<Volume>(ram);
+    volume->dataMap.dataRange = dvec2{first, first + static_cast<double>(glm::compMul(dims) - 1)};
+    volume->dataMap.valueRange = dvec2{-1.0, 1.0};
+    return volume;
+}
+
+void expectEqualData(const Volume& expected, const Volume& result) {
+    const auto dims = expected.getDimensions();
+    ASSERT_EQ(result.getDimensions(), dims);
+    const auto* a = static_cast<const VolumeRAMPrecision<float>*>(
+                        expected.getRepresentation<VolumeRAM>())
+                        ->getDataTyped();
+    const auto* b =
+        static_cast<const VolumeRAMPrecision<float>*>(result.getRepresentation<VolumeRAM>())
+            ->getDataTyped();
+    for (size_t i = 0; i < glm::compMul(dims); ++i) {
+        ASSERT_EQ(a[i], b[i]) << "index " << i;
+    }
+}
+
+}  // namespace
+
+TEST(HDF5VolumeIO, RoundTrip) {
+    // An axis of extent one has to survive the round trip
+    const size3_t dims{100, 1, 20};
+    const auto volume = createVolume(dims, 3.0f);
+    volume->setModelMatrix(glm::scale(vec3{2.0f, 3.0f, 4.0f}));
+    volume->setWorldMatrix(glm::translate(vec3{1.0f, 2.0f, 3.0f}));
+    volume->dataMap.valueAxis.name = "density";
+    volume->dataMap.valueAxis.unit = units::unit_from_string("kg/m^3");
+    volume->setMetaData<DoubleMetaData>("timestamp", 1.5);
+
+    const util::TempFileHandle file{"inviwo", ".h5"};
+    hdf5::WriteOptions options;
+    options.chunkSize = size3_t{24, 8, 5};
+    hdf5::util::writeVolume(*volume, file.getFileName(), options, Overwrite::Yes);
+
+    const auto sequence = hdf5::util::readVolumeSequence(file.getFileName());
+    ASSERT_EQ(sequence->size(), 1);
+    const auto result = sequence->front();
+
+    EXPECT_EQ(result->getDimensions(), dims);
+    EXPECT_EQ(result->getDataFormat(), volume->getDataFormat());
+    EXPECT_EQ(result->getModelMatrix(), volume->getModelMatrix());
+    EXPECT_EQ(result->getWorldMatrix(), volume->getWorldMatrix());
+    EXPECT_EQ(result->dataMap.dataRange, volume->dataMap.dataRange);
+    EXPECT_EQ(result->dataMap.valueRange, volume->dataMap.valueRange);
+    EXPECT_EQ(result->dataMap.valueAxis.name, "density");
+    EXPECT_EQ(result->dataMap.valueAxis.unit, volume->dataMap.valueAxis.unit);
+    const auto* timestamp = result->getMetaData<DoubleMetaData>("timestamp");
+    ASSERT_TRUE(timestamp);
+    EXPECT_EQ(timestamp->get(), 1.5);
+
+    // Nothing but the layout and attributes is read until the data is accessed
+    EXPECT_TRUE(result->hasRepresentation<VolumeDisk>());
+    EXPECT_FALSE(result->hasRepresentation<VolumeRAM>());
+
+    // Bricks are whole chunks, as close to the default brick size as possible. The chunk size is
+    // clamped to the dimensions of the volume.
+    const auto* bricked = result->getRepresentation<VolumeBricked>();
+    EXPECT_EQ(bricked->getBrickSize(), size3_t(72, 64, 65));
+    const auto region = bricked->getRegion(size3_t{70, 0, 3}, size3_t{10, 1, 4});
+    EXPECT_EQ(region->getAsDouble(size3_t{0}), 3.0 + 70 + dims.x * 3);
+
+    expectEqualData(*volume, *result);
+}
+
+TEST(HDF5VolumeIO, ComputedDataRange) {
+    const size3_t dims{7, 6, 5};
+    const auto volume = createVolume(dims, -4.0f);
+
+    const util::TempFileHandle file{"inviwo", ".h5"};
+    hdf5::util::writeVolume(*volume, file.getFileName(), {}, Overwrite::Yes);
+
+    const hdf5::VolumeRAMLoader loader{file.getFileName(), hdf5::Path{"/volume"},
+                                       {{0, dims.x, 1}, {0, dims.y, 1}, {0, dims.z, 1}}};
+    EXPECT_EQ(loader.getDimensions(), dims);
+    EXPECT_EQ(loader.getChunkSize(), dims);
+    EXPECT_EQ(loader.getStoredDataRange(), volume->dataMap.dataRange);
+    EXPECT_EQ(loader.computeDataRange(), volume->dataMap.dataRange);
+
+    // A selection of a single element drops the axis unless it is kept
+    const std::vector<hdf5::Handle::Selection> slice{{0, dims.x, 1}, {2, 3, 1}, {0, dims.z, 1}};
+    const hdf5::VolumeRAMLoader dropped{file.getFileName(), hdf5::Path{"/volume"}, slice};
+    EXPECT_EQ(dropped.getDimensions(), size3_t(dims.x, dims.z, 1));
+    const hdf5::VolumeRAMLoader kept{file.getFileName(), hdf5::Path{"/volume"}, slice, nullptr,
+                                     hdf5::SingleElementDims::Keep};
+    EXPECT_EQ(kept.getDimensions(), size3_t(dims.x, 1, dims.z));
+    EXPECT_EQ(kept.read(size3_t{1, 0, 3}, size3_t{1})->getAsDouble(size3_t{0}),
+              -4.0 + 1 + dims.x * (2 + dims.y * 3));
+}
+
+TEST(HDF5VolumeIO, Sequence) {
+    const size3_t dims{5, 4, 3};
+    VolumeSequence sequence;
+    for (size_t i = 0; i < 11; ++i) {
+        auto volume = createVolume(dims, 100.0f * static_cast<float>(i));
+        volume->setMetaData<DoubleMetaData>("timestamp", 0.5 * static_cast<double>(i));
+        sequence.push_back(std::move(volume));
+    }
+
+    const util::TempFileHandle file{"inviwo", ".h5"};
+    hdf5::util::writeVolumeSequence(sequence, file.getFileName(), {}, Overwrite::Yes);
+
+    // Sorted by name, the zero padded names keep the sequence order
+    const auto result = hdf5::util::readVolumeSequence(file.getFileName());
+    ASSERT_EQ(result->size(), sequence.size());
+    for (size_t i = 0; i < sequence.size(); ++i) {
+        const auto volume = (*result)[i];
+        const auto* timestamp = volume->getMetaData<DoubleMetaData>("timestamp");
+        ASSERT_TRUE(timestamp);
+        EXPECT_EQ(timestamp->get(), 0.5 * static_cast<double>(i));
+        expectEqualData(*sequence[i], *volume);
+    }
+}
+
+TEST(HDF5VolumeIO, Errors) {
+    util::TempFileHandle file{"inviwo", ".h5"};
+    std::fputs("not a HDF5 file", file);
+    std::fflush(file);
+    EXPECT_THROW(hdf5::util::readVolumeSequence(file.getFileName()), DataReaderException);
+
+    const Volume vector{size3_t{4}, DataVec3Float32::get()};
+    EXPECT_THROW(hdf5::util::writeVolume(vector, file.getFileName(), {}, Overwrite::Yes),
+                 DataWriterException);
+    EXPECT_THROW(hdf5::util::writeVolumeSequence({}, file.getFileName(), {}, Overwrite::Yes),
+                 DataWriterException);
+}
+
+}  // namespace inviwo
@@ -37,8 +37,13 @@
 
 #include <fmt/format.h>
 
+#include <memory>
+#include <mutex>
+
 namespace inviwo {
 
+class TetraMeshLocator;
+
 /**
  * \ingroup datastructures
  * \brief Data required to render tetrahedral meshes
@@ -57,6 +62,8 @@ namespace inviwo {
 class IVW_MODULE_TETRAMESH_API TetraMesh : public SpatialEntity {
 public:
     TetraMesh() = default;
+    TetraMesh(const TetraMesh& rhs);
+    TetraMesh& operator=(const TetraMesh& that);
     virtual TetraMesh* clone() const = 0;
     virtual ~TetraMesh() = default;
 
@@ -86,6 +93,26 @@ public:
      * @return scalar value range
      */
     virtual dvec2 getDataRange() const = 0;
+
+    /**
+     * Return a point location index for the tetrahedra, used for sampling the mesh on the CPU. The
+     * index is built on first use and then cached, copies of the mesh share it.
+     *
+     * @return point location index in Data space
+     * \see TetraMeshLocator
+     */
+    std::shared_ptr<const TetraMeshLocator> getLocator() const;
+
+protected:
+    /**
+     * Drop the cached point location index, derived classes have to call this whenever the nodes or
+     * tetrahedra change.
+     */
+    void invalidateLocator();
+
+private:
+    mutable std::mutex locatorMutex_;
+    mutable std::shared_ptr<const TetraMeshLocator> locator_;
 };
 
 template <>
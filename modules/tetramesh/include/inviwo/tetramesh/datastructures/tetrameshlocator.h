@@ -0,0 +1,124 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/tetramesh/tetrameshmoduledefine.h>
+
+#include <inviwo/core/util/glmvec.h>
+
+#include <optional>
+#include <vector>
+
+namespace inviwo {
+
+class TetraMesh;
+
+/**
+ * \ingroup datastructures
+ * \brief Point location in a tetrahedral mesh
+ *
+ * A bounding volume hierarchy over the tetrahedra of a TetraMesh, used to find the tetrahedron
+ * containing a point and to interpolate the node scalars there. The hierarchy is built by
+ * splitting the tetrahedra at the median of their centroids along the longest axis, the top levels
+ * are built in parallel on the thread pool. All positions are given in Data space, i.e. in the
+ * same coordinates as the nodes returned by TetraMesh::get.
+ *
+ * \see TetraMesh::getLocator
+ */
+class IVW_MODULE_TETRAMESH_API TetraMeshLocator {
+public:
+    struct Location {
+        int tetra;          //!< index of the tetrahedron containing the position
+        dvec4 barycentric;  //!< barycentric coordinates with respect to the four tetra nodes
+    };
+
+    explicit TetraMeshLocator(const TetraMesh& mesh);
+    TetraMeshLocator(std::vector<vec4> nodes, std::vector<ivec4> nodeIds);
+
+    /**
+     * Find the tetrahedron containing @p pos. Points on a shared face or within a small tolerance
+     * of the mesh boundary are assigned to one of the adjacent tetrahedra.
+     * @return the location or std::nullopt if @p pos is outside of the mesh
+     */
+    std::optional<Location> locate(const dvec3& pos) const;
+
+    /**
+     * Linearly interpolate the node scalars at @p pos.
+     * @return the interpolated value or std::nullopt if @p pos is outside of the mesh
+     */
+    std::optional<double> interpolate(const dvec3& pos) const;
+    double interpolate(const Location& location) const;
+
+    /**
+     * The gradient of the linearly interpolated node scalars, which is constant within each
+     * tetrahedron.
+     */
+    dvec3 gradient(int tetra) const;
+
+    const dvec3& getMin() const { return min_; }
+    const dvec3& getMax() const { return max_; }
+
+    const std::vector<vec4>& getNodes() const { return nodes_; }
+    const std::vector<ivec4>& getNodeIds() const { return nodeIds_; }
+
+private:
+    /**
+     * A node of the hierarchy. Inner nodes have count zero, their left child follows directly
+     * after them and @p index points to the right child. For leaves @p index is the first entry
+     * in tetras_ and @p count the number of tetrahedra.
+     */
+    struct Node {
+        vec3 min;
+        int index;
+        vec3 max;
+        int count;
+    };
+    static constexpr int leafSize = 4;
+
+    struct Bounds {
+        std::vector<vec3> min;
+        std::vector<vec3> max;
+        std::vector<vec3> centroid;
+    };
+
+    void initialize();
+    void build(std::vector<Node>& out, int begin, int end, const Bounds& bounds);
+    std::optional<dvec4> barycentric(int tetra, const dvec3& pos) const;
+
+    std::vector<vec4> nodes_;
+    std::vector<ivec4> nodeIds_;
+    std::vector<int> tetras_;
+    std::vector<Node> hierarchy_;
+    dvec3 min_;
+    dvec3 max_;
+    double tolerance_;
+};
+
+}  // namespace inviwo
@@ -0,0 +1,87 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <inviwo/tetramesh/tetrameshmoduledefine.h>
+
+#include <inviwo/core/util/glmvec.h>
+#include <inviwo/core/util/spatialsampler.h>
+
+#include <memory>
+
+namespace inviwo {
+
+class TetraMesh;
+class TetraMeshLocator;
+
+/**
+ * \brief Samples the node scalars of a TetraMesh
+ *
+ * The scalars are linearly interpolated within the tetrahedron containing the sample position,
+ * positions outside of the mesh return 0. Uses the cached TetraMesh::getLocator.
+ */
+class IVW_MODULE_TETRAMESH_API TetraMeshSampler : public SpatialSampler<double> {
+public:
+    explicit TetraMeshSampler(std::shared_ptr<const TetraMesh> mesh,
+                              CoordinateSpace space = CoordinateSpace::Data);
+    virtual ~TetraMeshSampler() = default;
+
+protected:
+    virtual double sampleDataSpace(const dvec3& pos) const override;
+    virtual bool withinBoundsDataSpace(const dvec3& pos) const override;
+
+private:
+    std::shared_ptr<const TetraMesh> mesh_;
+    std::shared_ptr<const TetraMeshLocator> locator_;
+};
+
+/**
+ * \brief Samples the gradient of the node scalars of a TetraMesh
+ *
+ * The gradient of the linear interpolant is constant within each tetrahedron, positions outside of
+ * the mesh return a zero vector. The gradient is given with respect to Data space. This makes it
+ * possible to trace integral lines through the scalar field of a tetrahedral mesh.
+ */
+class IVW_MODULE_TETRAMESH_API TetraMeshGradientSampler : public SpatialSampler<dvec3> {
+public:
+    explicit TetraMeshGradientSampler(std::shared_ptr<const TetraMesh> mesh,
+                                      CoordinateSpace space = CoordinateSpace::Data);
+    virtual ~TetraMeshGradientSampler() = default;
+
+protected:
+    virtual dvec3 sampleDataSpace(const dvec3& pos) const override;
+    virtual bool withinBoundsDataSpace(const dvec3& pos) const override;
+
+private:
+    std::shared_ptr<const TetraMesh> mesh_;
+    std::shared_ptr<const TetraMeshLocator> locator_;
+};
+
+}  // namespace inviwo
@@ -28,5 +28,33 @@
  *********************************************************************************/
 
 #include <inviwo/tetramesh/datastructures/tetramesh.h>
+#include <inviwo/tetramesh/datastructures/tetrameshlocator.h>
 
-namespace inviwo {}  // namespace inviwo
+namespace inviwo {
+
+TetraMesh::TetraMesh(const TetraMesh& rhs) : SpatialEntity(rhs) {
+    const std::scoped_lock lock{rhs.locatorMutex_};
+    locator_ = rhs.locator_;
+}
+
+TetraMesh& TetraMesh::operator=(const TetraMesh& that) {
+    if (this != &that) {
+        SpatialEntity::operator=(that);
+        const std::scoped_lock lock{locatorMutex_, that.locatorMutex_};
+        locator_ = that.locator_;
+    }
+    return *this;
+}
+
+std::shared_ptr<const TetraMeshLocator> TetraMesh::getLocator() const {
+    const std::scoped_lock lock{locatorMutex_};
+    if (!locator_) locator_ = std::make_shared<TetraMeshLocator>(*this);
+    return locator_;
+}
+
+void TetraMesh::invalidateLocator() {
+    const std::scoped_lock lock{locatorMutex_};
+    locator_.reset();
+}
+
+}  // namespace inviwo
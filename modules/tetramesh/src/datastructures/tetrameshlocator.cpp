@@ -0,0 +1,224 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tetramesh/datastructures/tetrameshlocator.h>
+#include <inviwo/tetramesh/datastructures/tetramesh.h>
+
+#include <inviwo/core/util/glmmat.h>
+#include <inviwo/core/util/parallel.h>
+
+#include <glm/geometric.hpp>
+#include <glm/gtx/component_wise.hpp>
+#include <glm/matrix.hpp>
+#include <glm/vector_relational.hpp>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <numeric>
+
+namespace inviwo {
+
+namespace {
+
+// subtrees with more tetrahedra than this are built in parallel
+constexpr int parallelBuildSize = 1 << 15;
+// tolerance for barycentric coordinates when testing if a point is inside a tetrahedron
+constexpr double baryTolerance = 1.0e-7;
+
+}  // namespace
+
+TetraMeshLocator::TetraMeshLocator(const TetraMesh& mesh) {
+    mesh.get(nodes_, nodeIds_);
+    initialize();
+}
+
+TetraMeshLocator::TetraMeshLocator(std::vector<vec4> nodes, std::vector<ivec4> nodeIds)
+    : nodes_{std::move(nodes)}, nodeIds_{std::move(nodeIds)} {
+    initialize();
+}
+
+void TetraMeshLocator::initialize() {
+    const auto count = nodeIds_.size();
+    tetras_.resize(count);
+    std::iota(tetras_.begin(), tetras_.end(), 0);
+
+    min_ = dvec3{std::numeric_limits<double>::max()};
+    max_ = dvec3{std::numeric_limits<double>::lowest()};
+    for (const auto& node : nodes_) {
+        min_ = glm::min(min_, dvec3{node});
+        max_ = glm::max(max_, dvec3{node});
+    }
+    if (count == 0 || nodes_.empty()) {
+        min_ = max_ = dvec3{0.0};
+        tolerance_ = 0.0;
+        return;
+    }
+    tolerance_ = 1.0e-6 * glm::length(max_ - min_);
+
+    Bounds bounds{std::vector<vec3>(count), std::vector<vec3>(count), std::vector<vec3>(count)};
+    util::parallelFor(0, count, [&](size_t tetra) {
+        const auto& ids = nodeIds_[tetra];
+        vec3 lo{nodes_[ids[0]]};
+        vec3 hi{lo};
+        for (int i = 1; i < 4; ++i) {
+            lo = glm::min(lo, vec3{nodes_[ids[i]]});
+            hi = glm::max(hi, vec3{nodes_[ids[i]]});
+        }
+        bounds.min[tetra] = lo;
+        bounds.max[tetra] = hi;
+        bounds.centroid[tetra] = 0.5f * (lo + hi);
+    });
+
+    hierarchy_.clear();
+    build(hierarchy_, 0, static_cast<int>(count), bounds);
+}
+
+void TetraMeshLocator::build(std::vector<Node>& out, int begin, int end, const Bounds& bounds) {
+    vec3 lo{std::numeric_limits<float>::max()};
+    vec3 hi{std::numeric_limits<float>::lowest()};
+    vec3 centroidMin{lo};
+    vec3 centroidMax{hi};
+    for (int i = begin; i < end; ++i) {
+        const auto tetra = tetras_[i];
+        lo = glm::min(lo, bounds.min[tetra]);
+        hi = glm::max(hi, bounds.max[tetra]);
+        centroidMin = glm::min(centroidMin, bounds.centroid[tetra]);
+        centroidMax = glm::max(centroidMax, bounds.centroid[tetra]);
+    }
+
+    const auto self = out.size();
+    // tetrahedra with coinciding centroids cannot be split further
+    if (end - begin <= leafSize || centroidMin == centroidMax) {
+        out.push_back(Node{lo, begin, hi, end - begin});
+        return;
+    }
+    out.push_back(Node{lo, 0, hi, 0});
+
+    const auto extent = centroidMax - centroidMin;
+    const int axis = extent.x >= extent.y ? (extent.x >= extent.z ? 0 : 2)
+                                          : (extent.y >= extent.z ? 1 : 2);
+    const int mid = begin + (end - begin) / 2;
+    const auto& centroid = bounds.centroid;
+    std::nth_element(tetras_.begin() + begin, tetras_.begin() + mid, tetras_.begin() + end,
+                     [&](int a, int b) { return centroid[a][axis] < centroid[b][axis]; });
+
+    if (end - begin > parallelBuildSize) {
+        // build both halves separately and append them with their child indices offset
+        std::array<std::vector<Node>, 2> children;
+        util::parallelFor(2, [&](size_t i) {
+            build(children[i], i == 0 ? begin : mid, i == 0 ? mid : end, bounds);
+        });
+        const auto append = [&](const std::vector<Node>& nodes) {
+            const auto offset = static_cast<int>(out.size());
+            for (auto node : nodes) {
+                if (node.count == 0) node.index += offset;
+                out.push_back(node);
+            }
+        };
+        append(children[0]);
+        out[self].index = static_cast<int>(out.size());
+        append(children[1]);
+    } else {
+        build(out, begin, mid, bounds);
+        out[self].index = static_cast<int>(out.size());
+        build(out, mid, end, bounds);
+    }
+}
+
+std::optional<dvec4> TetraMeshLocator::barycentric(int tetra, const dvec3& pos) const {
+    const auto& ids = nodeIds_[tetra];
+    const dvec3 p0{nodes_[ids[0]]};
+    const dmat3 m{dvec3{nodes_[ids[1]]} - p0, dvec3{nodes_[ids[2]]} - p0,
+                  dvec3{nodes_[ids[3]]} - p0};
+    if (glm::determinant(m) == 0.0) return std::nullopt;
+
+    const dvec3 l = glm::inverse(m) * (pos - p0);
+    const dvec4 b{1.0 - l.x - l.y - l.z, l};
+    if (glm::compMin(b) < -baryTolerance) return std::nullopt;
+    return b;
+}
+
+auto TetraMeshLocator::locate(const dvec3& pos) const -> std::optional<Location> {
+    if (hierarchy_.empty()) return std::nullopt;
+
+    const auto contains = [&](const Node& node) {
+        return glm::all(glm::greaterThanEqual(pos, dvec3{node.min} - tolerance_)) &&
+               glm::all(glm::lessThanEqual(pos, dvec3{node.max} + tolerance_));
+    };
+
+    // the hierarchy is balanced, hence its depth is at most log2 of the number of tetrahedra
+    std::array<int, 64> stack;
+    size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const int index = stack[--top];
+        const auto& node = hierarchy_[index];
+        if (!contains(node)) continue;
+
+        if (node.count > 0) {
+            for (int i = node.index; i < node.index + node.count; ++i) {
+                if (auto b = barycentric(tetras_[i], pos)) return Location{tetras_[i], *b};
+            }
+        } else {
+            stack[top++] = node.index;
+            stack[top++] = index + 1;
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<double> TetraMeshLocator::interpolate(const dvec3& pos) const {
+    if (auto location = locate(pos)) return interpolate(*location);
+    return std::nullopt;
+}
+
+double TetraMeshLocator::interpolate(const Location& location) const {
+    const auto& ids = nodeIds_[location.tetra];
+    double value = 0.0;
+    for (int i = 0; i < 4; ++i) {
+        value += location.barycentric[i] * static_cast<double>(nodes_[ids[i]].w);
+    }
+    return value;
+}
+
+dvec3 TetraMeshLocator::gradient(int tetra) const {
+    const auto& ids = nodeIds_[tetra];
+    const dvec4 p0{nodes_[ids[0]]};
+    const dvec4 d1 = dvec4{nodes_[ids[1]]} - p0;
+    const dvec4 d2 = dvec4{nodes_[ids[2]]} - p0;
+    const dvec4 d3 = dvec4{nodes_[ids[3]]} - p0;
+    const dmat3 m{dvec3{d1}, dvec3{d2}, dvec3{d3}};
+    if (glm::determinant(m) == 0.0) return dvec3{0.0};
+
+    // the scalar is s0 + (ds1, ds2, ds3) . inverse(m) * (x - p0)
+    return glm::transpose(glm::inverse(m)) * dvec3{d1.w, d2.w, d3.w};
+}
+
+}  // namespace inviwo
@@ -0,0 +1,63 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tetramesh/processors/tetrameshtospatialsampler.h>
+#include <inviwo/tetramesh/util/tetrameshsampler.h>
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo TetraMeshToSpatialSampler::processorInfo_{
+    "org.inviwo.TetraMeshToSpatialSampler",  // Class identifier
+    "TetraMesh To Spatial Sampler",          // Display name
+    "Spatial Sampler",                       // Category
+    CodeState::Experimental,                 // Code state
+    Tags::CPU | Tag{"Unstructured"},         // Tags
+    R"(Provides CPU samplers for a TetraMesh, for example for integral line tracing. The point
+    location index of the mesh is built on first use.)"_unindentHelp};
+
+const ProcessorInfo& TetraMeshToSpatialSampler::getProcessorInfo() const { return processorInfo_; }
+
+TetraMeshToSpatialSampler::TetraMeshToSpatialSampler()
+    : Processor{}
+    , inport_{"tetramesh", "Tetrahedral mesh to be sampled"_help}
+    , sampler_{"sampler", "Linearly interpolated scalar values of the mesh"_help}
+    , gradientSampler_{"gradient",
+                       "Gradient of the scalar values, constant within each tetrahedron"_help} {
+
+    addPorts(inport_, sampler_, gradientSampler_);
+}
+
+void TetraMeshToSpatialSampler::process() {
+    const auto mesh = inport_.getData();
+    sampler_.setData(std::make_shared<TetraMeshSampler>(mesh));
+    gradientSampler_.setData(std::make_shared<TetraMeshGradientSampler>(mesh));
+}
+
+}  // namespace inviwo
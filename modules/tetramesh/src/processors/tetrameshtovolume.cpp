@@ -0,0 +1,99 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tetramesh/processors/tetrameshtovolume.h>
+#include <inviwo/tetramesh/datastructures/tetrameshlocator.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/parallel.h>
+
+#include <glm/gtx/transform.hpp>
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo TetraMeshToVolume::processorInfo_{
+    "org.inviwo.TetraMeshToVolume",                   // Class identifier
+    "TetraMesh To Volume",                            // Display name
+    "Unstructured Grids",                             // Category
+    CodeState::Experimental,                          // Code state
+    Tags::CPU | Tag{"Volume"} | Tag{"Unstructured"},  // Tags
+    R"(Resamples the scalar values of a TetraMesh onto a regular grid covering the bounding box
+    of its nodes. Each voxel is linearly interpolated within the tetrahedron containing the voxel
+    center.)"_unindentHelp};
+
+const ProcessorInfo& TetraMeshToVolume::getProcessorInfo() const { return processorInfo_; }
+
+TetraMeshToVolume::TetraMeshToVolume()
+    : Processor{}
+    , inport_{"tetramesh", "Tetrahedral mesh to be resampled"_help}
+    , outport_{"volume", "Resampled scalar values, a single float channel"_help}
+    , dimensions_{"dimensions", "Dimensions",
+                  util::ordinalCount(size3_t{64}, size3_t{1024})
+                      .setMin(size3_t{1})
+                      .set("Dimensions of the output volume"_help)}
+    , outsideValue_{"outsideValue", "Outside Value",
+                    util::ordinalSymmetricVector(0.0f, 1000.0f)
+                        .set("Value of voxels outside of the tetrahedral mesh"_help)} {
+
+    addPorts(inport_, outport_);
+    addProperties(dimensions_, outsideValue_);
+}
+
+void TetraMeshToVolume::process() {
+    const auto mesh = inport_.getData();
+    const auto locator = mesh->getLocator();
+
+    const size3_t dims{dimensions_.get()};
+    const dvec3 origin{locator->getMin()};
+    const dvec3 extent{locator->getMax() - locator->getMin()};
+    const auto outside = static_cast<double>(outsideValue_.get());
+
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(dims);
+    auto* data = ram->getDataTyped();
+    const util::IndexMapper3D index(dims);
+    util::parallelFor(dims, [&](const size3_t& pos) {
+        const dvec3 p = origin + (dvec3{pos} + 0.5) / dvec3{dims} * extent;
+        data[index(pos)] = static_cast<float>(locator->interpolate(p).value_or(outside));
+    });
+
+    auto volume = std::make_shared<Volume>(ram);
+    volume->setModelMatrix(mesh->getModelMatrix() * glm::translate(vec3{origin}) *
+                           glm::scale(vec3{extent}));
+    volume->setWorldMatrix(mesh->getWorldMatrix());
+    const auto range = mesh->getDataRange();
+    volume->dataMap.dataRange = range;
+    volume->dataMap.valueRange = range;
+
+    outport_.setData(volume);
+}
+
+}  // namespace inviwo
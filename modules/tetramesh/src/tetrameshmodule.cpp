@@ -31,6 +31,8 @@
 
 #include <inviwo/tetramesh/datastructures/tetramesh.h>
 #include <inviwo/tetramesh/processors/tetrameshboundingbox.h>
+#include <inviwo/tetramesh/processors/tetrameshtospatialsampler.h>
+#include <inviwo/tetramesh/processors/tetrameshtovolume.h>
 #include <inviwo/tetramesh/processors/tetrameshvolumeraycaster.h>
 #include <inviwo/tetramesh/processors/tetrameshboundaryextractor.h>
 #include <inviwo/tetramesh/processors/transformtetramesh.h>
@@ -48,6 +50,8 @@ TetraMeshModule::TetraMeshModule(InviwoApplication* app) : InviwoModule(app, "Te
 
     registerProcessor<TetraMeshBoundaryExtractor>();
     registerProcessor<TetraMeshBoundingBox>();
+    registerProcessor<TetraMeshToSpatialSampler>();
+    registerProcessor<TetraMeshToVolume>();
     registerProcessor<TetraMeshVolumeRaycaster>();
     registerProcessor<TransformTetraMesh>();
     registerProcessor<VolumeToTetraMesh>();
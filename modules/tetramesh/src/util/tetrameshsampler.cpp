@@ -0,0 +1,64 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/tetramesh/util/tetrameshsampler.h>
+#include <inviwo/tetramesh/datastructures/tetramesh.h>
+#include <inviwo/tetramesh/datastructures/tetrameshlocator.h>
+
+namespace inviwo {
+
+TetraMeshSampler::TetraMeshSampler(std::shared_ptr<const TetraMesh> mesh, CoordinateSpace space)
+    : SpatialSampler<double>(*mesh, space)
+    , mesh_{std::move(mesh)}
+    , locator_{mesh_->getLocator()} {}
+
+double TetraMeshSampler::sampleDataSpace(const dvec3& pos) const {
+    return locator_->interpolate(pos).value_or(0.0);
+}
+
+bool TetraMeshSampler::withinBoundsDataSpace(const dvec3& pos) const {
+    return locator_->locate(pos).has_value();
+}
+
+TetraMeshGradientSampler::TetraMeshGradientSampler(std::shared_ptr<const TetraMesh> mesh,
+                                                   CoordinateSpace space)
+    : SpatialSampler<dvec3>(*mesh, space)
+    , mesh_{std::move(mesh)}
+    , locator_{mesh_->getLocator()} {}
+
+dvec3 TetraMeshGradientSampler::sampleDataSpace(const dvec3& pos) const {
+    if (auto location = locator_->locate(pos)) return locator_->gradient(location->tetra);
+    return dvec3{0.0};
+}
+
+bool TetraMeshGradientSampler::withinBoundsDataSpace(const dvec3& pos) const {
+    return locator_->locate(pos).has_value();
+}
+
+}  // namespace inviwo
@@ -32,13 +32,14 @@
 
 #include <inviwo/core/datastructures/geometry/mesh.h>
 #include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/util/parallel.h>
 #include <inviwo/core/util/zip.h>
 
 #include <glm/gtx/transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
 #include <algorithm>
-#include <unordered_map>
+#include <tuple>
 
 namespace inviwo {
 
@@ -46,61 +47,92 @@ namespace utiltetra {
 
 namespace detail {
 
-struct TriangleKey {
-    TriangleKey(const ivec3& indices) : tri{indices} {
-        std::sort(glm::value_ptr(tri), glm::value_ptr(tri) + 3);
-    }
-    TriangleKey(int a, int b, int c) : tri{a, b, c} {
-        std::sort(glm::value_ptr(tri), glm::value_ptr(tri) + 3);
-    }
-
-    bool operator==(const TriangleKey& rhs) const { return tri == rhs.tri; }
+int globalFaceId(int tetra, int face) { return tetra * 4 + face; }
 
+/**
+ * A half face of a tetrahedron, identified by its sorted node IDs.
+ */
+struct HalfFace {
     ivec3 tri;
-};
+    int faceId;
 
-struct TriangleHash {
-    size_t operator()(const TriangleKey& key) const {
-        size_t seed = 0;
-        inviwo::util::hash_combine(seed, key.tri[0]);
-        inviwo::util::hash_combine(seed, key.tri[1]);
-        inviwo::util::hash_combine(seed, key.tri[2]);
-        return seed;
+    bool sameFace(const HalfFace& rhs) const { return tri == rhs.tri; }
+    bool operator<(const HalfFace& rhs) const {
+        return std::tie(tri.x, tri.y, tri.z, faceId) <
+               std::tie(rhs.tri.x, rhs.tri.y, rhs.tri.z, rhs.faceId);
     }
 };
 
-int globalFaceId(int tetra, int face) { return tetra * 4 + face; }
+/**
+ * Sort @p data by sorting chunks on the thread pool and merging them pairwise.
+ */
+template <typename T>
+void parallelSort(std::vector<T>& data) {
+    constexpr size_t minChunkSize = 1 << 16;
+    const size_t threads = util::getPoolSize() + 1;
+    size_t chunks = 1;
+    while (chunks < 2 * threads && data.size() / (2 * chunks) >= minChunkSize) chunks *= 2;
+
+    std::vector<size_t> bounds(chunks + 1);
+    for (size_t i = 0; i <= chunks; ++i) bounds[i] = i * data.size() / chunks;
+
+    util::parallelFor(chunks, [&](size_t i) {
+        std::sort(data.begin() + bounds[i], data.begin() + bounds[i + 1]);
+    });
+    if (chunks == 1) return;
+
+    std::vector<T> buffer(data.size());
+    auto* src = &data;
+    auto* dst = &buffer;
+    for (size_t width = 1; width < chunks; width *= 2) {
+        util::parallelFor(chunks / (2 * width), [&](size_t pair) {
+            const auto begin = src->begin() + bounds[2 * pair * width];
+            const auto mid = src->begin() + bounds[(2 * pair + 1) * width];
+            const auto end = src->begin() + bounds[(2 * pair + 2) * width];
+            std::merge(begin, mid, mid, end, dst->begin() + bounds[2 * pair * width]);
+        });
+        std::swap(src, dst);
+    }
+    if (src != &data) data.swap(buffer);
+}
 
 }  // namespace detail
 
 std::vector<ivec4> getOpposingFaces(const std::vector<ivec4>& nodeIds) {
-    using TetraId = int;
-    using FaceId = int;
+    // Collect all half faces, sort them by their nodes and match neighboring equal faces. Compared
+    // to a hash map this needs a fraction of the memory and all steps run in parallel.
+    std::vector<detail::HalfFace> halfFaces(nodeIds.size() * 4);
+    util::parallelFor(0, nodeIds.size(), [&](size_t tetra) {
+        for (int face = 0; face < 4; ++face) {
+            // node indices of the half face opposing node face
+            ivec3 tri{nodeIds[tetra][(face + 1) % 4], nodeIds[tetra][(face + 2) % 4],
+                      nodeIds[tetra][(face + 3) % 4]};
+            std::sort(glm::value_ptr(tri), glm::value_ptr(tri) + 3);
+            halfFaces[tetra * 4 + face] = {
+                tri, detail::globalFaceId(static_cast<int>(tetra), face)};
+        }
+    });
+    detail::parallelSort(halfFaces);
 
-    std::unordered_map<detail::TriangleKey, std::pair<TetraId, FaceId>, detail::TriangleHash>
-        adjacency;
     std::vector<ivec4> opposingFaces(nodeIds.size(), ivec4(-1));
-
-    for (int tetra = 0; tetra < std::ssize(nodeIds); ++tetra) {
-        for (int face = 0; face < 4; ++face) {
-            // determine indices of half face opposing the current one
-            int nextHf = (face + 1) % 4;
-            int midHf = (face + 2) % 4;
-            int prevHf = (face + 3) % 4;
-
-            detail::TriangleKey tri{nodeIds[tetra][nextHf], nodeIds[tetra][midHf],
-                                    nodeIds[tetra][prevHf]};
-
-            if (auto adjIt = adjacency.find(tri); adjIt != adjacency.end()) {
-                auto&& [opposingTetra, opposingFace] = adjIt->second;
-                opposingFaces[tetra][face] = detail::globalFaceId(opposingTetra, opposingFace);
-                opposingFaces[opposingTetra][opposingFace] = detail::globalFaceId(tetra, face);
-                adjacency.erase(adjIt);
-            } else {
-                adjacency.insert({tri, {tetra, face}});
+    const auto link = [&](int faceId, int opposingFaceId) {
+        opposingFaces[faceId / 4][faceId % 4] = opposingFaceId;
+    };
+    util::parallelForBlocks(halfFaces.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            // each run of equal faces is handled by the block in which it starts
+            if (i > 0 && halfFaces[i - 1].sameFace(halfFaces[i])) continue;
+
+            // Pair the faces of a run in order of their IDs. More than two faces only occur in
+            // non-manifold meshes, then the first and second, third and fourth, ... are matched.
+            for (size_t k = i; k + 1 < halfFaces.size() && halfFaces[k].sameFace(halfFaces[i]) &&
+                               halfFaces[k + 1].sameFace(halfFaces[i]);
+                 k += 2) {
+                link(halfFaces[k].faceId, halfFaces[k + 1].faceId);
+                link(halfFaces[k + 1].faceId, halfFaces[k].faceId);
             }
         }
-    }
+    });
     return opposingFaces;
 }
 
@@ -0,0 +1,218 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/tetramesh/datastructures/tetrameshlocator.h>
+#include <inviwo/tetramesh/util/tetrameshutils.h>
+
+#include <glm/gtx/component_wise.hpp>
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+/**
+ * Reference implementation of utiltetra::getOpposingFaces, matching the faces one tetrahedron at a
+ * time with a map of the unmatched faces.
+ */
+std::vector<ivec4> bruteForceOpposingFaces(const std::vector<ivec4>& nodeIds) {
+    std::map<std::array<int, 3>, int> unmatched;
+    std::vector<ivec4> opposingFaces(nodeIds.size(), ivec4(-1));
+    for (int tetra = 0; tetra < static_cast<int>(nodeIds.size()); ++tetra) {
+        for (int face = 0; face < 4; ++face) {
+            std::array<int, 3> tri{nodeIds[tetra][(face + 1) % 4], nodeIds[tetra][(face + 2) % 4],
+                                   nodeIds[tetra][(face + 3) % 4]};
+            std::sort(tri.begin(), tri.end());
+            if (auto it = unmatched.find(tri); it != unmatched.end()) {
+                const auto other = it->second;
+                opposingFaces[tetra][face] = other;
+                opposingFaces[other / 4][other % 4] = tetra * 4 + face;
+                unmatched.erase(it);
+            } else {
+                unmatched.emplace(tri, tetra * 4 + face);
+            }
+        }
+    }
+    return opposingFaces;
+}
+
+/**
+ * A grid of n^3 unit cubes, each split into six tetrahedra along its main diagonal (Kuhn
+ * subdivision), which gives a conforming mesh. The node scalars are the linear function f.
+ */
+struct Grid {
+    static double f(const dvec3& p) { return 1.0 + 2.0 * p.x + 3.0 * p.y - p.z; }
+
+    explicit Grid(int n) {
+        const auto node = [n](int x, int y, int z) { return x + (n + 1) * (y + (n + 1) * z); };
+        for (int z = 0; z <= n; ++z) {
+            for (int y = 0; y <= n; ++y) {
+                for (int x = 0; x <= n; ++x) {
+                    const dvec3 p{x, y, z};
+                    nodes.emplace_back(vec3{p}, static_cast<float>(f(p)));
+                }
+            }
+        }
+        constexpr std::array<std::array<int, 3>, 6> permutations{
+            {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}}};
+        for (int z = 0; z < n; ++z) {
+            for (int y = 0; y < n; ++y) {
+                for (int x = 0; x < n; ++x) {
+                    for (const auto& perm : permutations) {
+                        ivec3 p{x, y, z};
+                        ivec4 tetra;
+                        tetra[0] = node(p.x, p.y, p.z);
+                        for (int i = 0; i < 3; ++i) {
+                            p[perm[i]] += 1;
+                            tetra[i + 1] = node(p.x, p.y, p.z);
+                        }
+                        nodeIds.push_back(tetra);
+                    }
+                }
+            }
+        }
+    }
+
+    std::vector<vec4> nodes;
+    std::vector<ivec4> nodeIds;
+};
+
+}  // namespace
+
+TEST(TetraMeshUtils, OpposingFacesGrid) {
+    const Grid grid{3};
+    const auto opposing = utiltetra::getOpposingFaces(grid.nodeIds);
+    EXPECT_EQ(opposing, bruteForceOpposingFaces(grid.nodeIds));
+
+    // Each boundary face of the cube is split into two triangles
+    EXPECT_EQ(utiltetra::getBoundaryFaces(opposing).size(), 6 * 3 * 3 * 2);
+    for (int tetra = 0; tetra < static_cast<int>(opposing.size()); ++tetra) {
+        for (int face = 0; face < 4; ++face) {
+            if (const auto other = opposing[tetra][face]; other >= 0) {
+                EXPECT_EQ(opposing[other / 4][other % 4], tetra * 4 + face);
+            }
+        }
+    }
+}
+
+TEST(TetraMeshUtils, OpposingFacesNonManifold) {
+    // Four tetrahedra sharing the face {0, 1, 2}, and one sharing the face {1, 2, 6} with the last
+    // of them
+    const std::vector<ivec4> nodeIds{
+        {0, 1, 2, 3}, {4, 0, 1, 2}, {2, 5, 1, 0}, {0, 2, 6, 1}, {6, 2, 1, 7}, {8, 9, 10, 11}};
+    const auto opposing = utiltetra::getOpposingFaces(nodeIds);
+    EXPECT_EQ(opposing, bruteForceOpposingFaces(nodeIds));
+
+    // The shared faces are matched in pairs in the order of the tetrahedra
+    EXPECT_EQ(opposing[0][3], 1 * 4 + 0);
+    EXPECT_EQ(opposing[1][0], 0 * 4 + 3);
+    EXPECT_EQ(opposing[2][1], 3 * 4 + 2);
+    EXPECT_EQ(opposing[3][2], 2 * 4 + 1);
+    EXPECT_EQ(opposing[3][0], 4 * 4 + 3);
+    EXPECT_EQ(opposing[4][3], 3 * 4 + 0);
+    // An isolated tetrahedron only has boundary faces
+    EXPECT_EQ(opposing[5], ivec4(-1));
+}
+
+TEST(TetraMeshUtils, OpposingFacesRandom) {
+    // Many tetrahedra on few nodes, most faces are shared by more than two tetrahedra. The number
+    // of half faces is large enough for the sort to be split into chunks.
+    std::mt19937 gen{42};
+    std::vector<int> nodes(10);
+    std::vector<ivec4> nodeIds;
+    for (int i = 0; i < 40000; ++i) {
+        std::iota(nodes.begin(), nodes.end(), 0);
+        std::shuffle(nodes.begin(), nodes.end(), gen);
+        nodeIds.emplace_back(nodes[0], nodes[1], nodes[2], nodes[3]);
+    }
+    EXPECT_EQ(utiltetra::getOpposingFaces(nodeIds), bruteForceOpposingFaces(nodeIds));
+}
+
+TEST(TetraMeshLocator, Locate) {
+    const Grid grid{4};
+    const TetraMeshLocator locator{grid.nodes, grid.nodeIds};
+    EXPECT_EQ(locator.getMin(), dvec3{0.0});
+    EXPECT_EQ(locator.getMax(), dvec3{4.0});
+
+    std::mt19937 gen{7};
+    std::uniform_real_distribution<double> dist{0.01, 3.99};
+    for (int i = 0; i < 1000; ++i) {
+        const dvec3 pos{dist(gen), dist(gen), dist(gen)};
+        const auto location = locator.locate(pos);
+        ASSERT_TRUE(location) << "position " << pos.x << ", " << pos.y << ", " << pos.z;
+
+        // The barycentric coordinates are within the tetrahedron and reproduce the position
+        const auto& b = location->barycentric;
+        EXPECT_NEAR(b.x + b.y + b.z + b.w, 1.0, 1.0e-9);
+        EXPECT_GE(glm::compMin(b), -1.0e-7);
+        const auto& ids = grid.nodeIds[location->tetra];
+        dvec3 p{0.0};
+        for (int k = 0; k < 4; ++k) {
+            p += b[k] * dvec3{grid.nodes[ids[k]]};
+        }
+        EXPECT_NEAR(glm::distance(p, pos), 0.0, 1.0e-6);
+
+        // The position is in the cube of the tetrahedron
+        const auto cube = ivec3{glm::floor(pos)};
+        EXPECT_EQ(location->tetra / 6, cube.x + 4 * (cube.y + 4 * cube.z));
+
+        // The node scalars are linear, hence interpolated exactly
+        EXPECT_NEAR(locator.interpolate(*location), Grid::f(pos), 1.0e-5);
+        EXPECT_NEAR(*locator.interpolate(pos), Grid::f(pos), 1.0e-5);
+        const auto gradient = locator.gradient(location->tetra);
+        EXPECT_NEAR(glm::distance(gradient, dvec3{2.0, 3.0, -1.0}), 0.0, 1.0e-5);
+    }
+
+    // Nodes and points on shared faces are found as well
+    EXPECT_TRUE(locator.locate(dvec3{0.0}));
+    EXPECT_TRUE(locator.locate(dvec3{2.0, 2.0, 2.0}));
+    EXPECT_TRUE(locator.locate(dvec3{1.5, 1.5, 1.0}));
+
+    EXPECT_FALSE(locator.locate(dvec3{-0.1, 1.0, 1.0}));
+    EXPECT_FALSE(locator.locate(dvec3{2.0, 4.5, 1.0}));
+    EXPECT_FALSE(locator.interpolate(dvec3{5.0}));
+}
+
+TEST(TetraMeshLocator, Empty) {
+    const TetraMeshLocator locator{{}, {}};
+    EXPECT_FALSE(locator.locate(dvec3{0.0}));
+}
+
+}  // namespace inviwo
@@ -0,0 +1,228 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/vectorfieldvisualization/vectorfieldvisualizationmoduledefine.h>  // for IVW_M...
+
+#include <inviwo/core/datastructures/buffer/buffer.h>                         // for Buffer
+#include <inviwo/core/datastructures/datatraits.h>                            // for DataT...
+#include <inviwo/core/ports/datainport.h>                                     // for DataI...
+#include <inviwo/core/ports/dataoutport.h>                                    // for DataO...
+#include <inviwo/core/util/document.h>                                        // for Document
+#include <inviwo/core/util/exception.h>                                       // for Excep...
+#include <inviwo/core/util/formats.h>                                         // for DataF...
+#include <inviwo/core/util/glmmat.h>                                          // for mat4
+#include <inviwo/core/util/glmvec.h>                                          // for dvec3
+#include <inviwo/core/util/sourcecontext.h>                                   // for IVW_C...
+#include <modules/vectorfieldvisualization/datastructures/integralline.h>     // for Integ...
+#include <modules/vectorfieldvisualization/datastructures/integrallineset.h>  // for Integ...
+
+#include <cstddef>      // for size_t
+#include <cstdint>      // for uint32_t
+#include <functional>   // for less
+#include <map>          // for map
+#include <memory>       // for share...
+#include <span>         // for span
+#include <sstream>      // for opera...
+#include <string>       // for string
+#include <string_view>  // for strin...
+#include <vector>       // for vector
+
+namespace inviwo {
+
+class Mesh;
+
+/**
+ * \brief A set of integral lines stored as a structure of arrays
+ *
+ * All positions are stored in one contiguous buffer and the points of line `i` are the range
+ * `[offsets[i], offsets[i + 1])` of that buffer. Every meta data channel is likewise stored in one
+ * contiguous buffer, using the same offsets. Hence the data can be handed to a Mesh without
+ * any per line work, see
+ * util::toMesh(const FlatIntegralLineSet&, FlatIntegralLineSet::Precision, int)
+ *
+ * All lines in the set must have the same meta data channels with the same formats.
+ * @see IntegralLineSet
+ */
+class IVW_MODULE_VECTORFIELDVISUALIZATION_API FlatIntegralLineSet {
+public:
+    using TerminationReason = IntegralLine::TerminationReason;
+    enum class Precision { Float, Double };
+    /**
+     * Attribute location of the first meta data channel in util::toMesh, the first location after
+     * the attributes PositionAttrib to IntMetaAttrib of BufferType.
+     */
+    static constexpr int metaDataLocation = 10;
+
+    FlatIntegralLineSet(mat4 modelMatrix, mat4 worldMatrix = mat4(1));
+    /**
+     * Flatten the lines of \p lines, the copying is done in parallel.
+     * @throw Exception if the lines do not have the same meta data channels and formats
+     */
+    explicit FlatIntegralLineSet(const IntegralLineSet& lines);
+    FlatIntegralLineSet(const FlatIntegralLineSet& rhs);
+    FlatIntegralLineSet(FlatIntegralLineSet&& rhs) noexcept = default;
+    FlatIntegralLineSet& operator=(const FlatIntegralLineSet& that);
+    FlatIntegralLineSet& operator=(FlatIntegralLineSet&& that) noexcept = default;
+    ~FlatIntegralLineSet();
+
+    mat4 getModelMatrix() const;
+    mat4 getWorldMatrix() const;
+
+    /**
+     * Number of lines in the set
+     */
+    size_t size() const;
+    bool empty() const;
+    /**
+     * Total number of points of all lines
+     */
+    size_t getNumberOfPoints() const;
+
+    /**
+     * Append \p line to the set, keeping its index.
+     * @throw Exception if the meta data of \p line does not match the channels of the set
+     */
+    void push_back(const IntegralLine& line);
+    /**
+     * Materialize line \p idx as an IntegralLine
+     */
+    IntegralLine getLine(size_t idx) const;
+    IntegralLineSet toIntegralLineSet() const;
+
+    /**
+     * Offsets into the point arrays, line `i` covers `[offsets[i], offsets[i + 1])`.
+     * Holds size() + 1 elements.
+     */
+    std::span<const std::uint32_t> getOffsets() const;
+    std::span<const dvec3> getPositions() const;
+    std::span<const dvec3> getPositions(size_t line) const;
+    std::shared_ptr<const Buffer<dvec3>> getPositionBuffer() const;
+
+    std::uint32_t getIndex(size_t line) const;
+    TerminationReason getForwardTerminationReason(size_t line) const;
+    TerminationReason getBackwardTerminationReason(size_t line) const;
+
+    bool hasMetaData(std::string_view name) const;
+    std::vector<std::string> getMetaDataKeys() const;
+    const std::map<std::string, std::shared_ptr<BufferBase>, std::less<>>& getMetaDataBuffers()
+        const;
+    std::shared_ptr<const BufferBase> getMetaDataBuffer(std::string_view name) const;
+
+    /**
+     * Add a meta data channel of type T with one value per point, initialized to T{0}.
+     * @throw Exception if a channel named \p name already exists
+     */
+    template <typename T>
+    std::span<T> createMetaData(std::string_view name);
+    /**
+     * The values of meta data channel \p name for all points
+     * @throw Exception if there is no channel \p name of type T
+     */
+    template <typename T>
+    std::span<const T> getMetaData(std::string_view name) const;
+    /**
+     * The values of meta data channel \p name for the points of \p line
+     */
+    template <typename T>
+    std::span<const T> getMetaData(std::string_view name, size_t line) const;
+
+private:
+    const BufferBase& metaData(std::string_view name, const DataFormatBase* format) const;
+
+    std::shared_ptr<Buffer<dvec3>> positions_;
+    std::vector<std::uint32_t> offsets_;
+    std::vector<std::uint32_t> indices_;
+    std::vector<TerminationReason> forwardTerminationReasons_;
+    std::vector<TerminationReason> backwardTerminationReasons_;
+    std::map<std::string, std::shared_ptr<BufferBase>, std::less<>> metaData_;
+    mat4 modelMatrix_;
+    mat4 worldMatrix_;
+};
+
+template <typename T>
+std::span<T> FlatIntegralLineSet::createMetaData(std::string_view name) {
+    if (hasMetaData(name)) {
+        throw Exception(SourceContext{}, "Meta data with name {} already exists", name);
+    }
+    auto md = std::make_shared<Buffer<T>>(getNumberOfPoints());
+    metaData_.emplace(name, md);
+    return md->getEditableRAMRepresentation()->getDataContainer();
+}
+
+template <typename T>
+std::span<const T> FlatIntegralLineSet::getMetaData(std::string_view name) const {
+    return static_cast<const Buffer<T>&>(metaData(name, DataFormat<T>::get()))
+        .getRAMRepresentation()
+        ->getDataContainer();
+}
+
+template <typename T>
+std::span<const T> FlatIntegralLineSet::getMetaData(std::string_view name, size_t line) const {
+    return getMetaData<T>(name).subspan(offsets_[line], offsets_[line + 1] - offsets_[line]);
+}
+
+using FlatIntegralLineSetInport = DataInport<FlatIntegralLineSet>;
+using FlatIntegralLineSetOutport = DataOutport<FlatIntegralLineSet>;
+
+namespace util {
+
+/**
+ * Create a line mesh of \p lines with one index buffer of line segments.
+ * The positions are added as BufferType::PositionAttrib and the meta data channels, in key order,
+ * as BufferType::Unknown at the consecutive locations `metaDataLocation`, `metaDataLocation + 1`,
+ * and so on. With Precision::Double all buffers are shared with \p lines without copying, with
+ * Precision::Float double precision buffers are converted to single precision.
+ */
+IVW_MODULE_VECTORFIELDVISUALIZATION_API std::shared_ptr<Mesh> toMesh(
+    const FlatIntegralLineSet& lines,
+    FlatIntegralLineSet::Precision precision = FlatIntegralLineSet::Precision::Double,
+    int metaDataLocation = FlatIntegralLineSet::metaDataLocation);
+
+}  // namespace util
+
+template <>
+struct DataTraits<FlatIntegralLineSet> {
+    static constexpr std::string_view classIdentifier() {
+        return "org.inviwo.FlatIntegralLineSet";
+    }
+    static constexpr std::string_view dataName() { return "FlatIntegralLineSet"; }
+    static constexpr uvec3 colorCode() { return {255, 180, 60}; }
+    static Document info(const FlatIntegralLineSet& data) {
+        std::ostringstream oss;
+        oss << "Flat Integral Line Set with " << data.size() << " lines and "
+            << data.getNumberOfPoints() << " points";
+        Document doc;
+        doc.append("p", oss.str());
+        return doc;
+    }
+};
+
+}  // namespace inviwo
@@ -35,19 +35,28 @@
 #include <inviwo/core/util/spatialsampler.h>    // IWUY pragma: keep
 #include <inviwo/core/util/spatial4dsampler.h>  // IWUY pragma: keep
 #include <inviwo/core/util/typetraits.h>
+#include <inviwo/core/util/volumesampler.h>     // for VolumeDoubleSampler
 #include <modules/vectorfieldvisualization/datastructures/integralline.h>        // for Integral...
 #include <modules/vectorfieldvisualization/properties/integrallineproperties.h>  // for Integral...
 
+#include <algorithm>      // for min, max
+#include <cmath>          // for pow, sqrt
 #include <cstddef>        // for size_t
 #include <limits>         // for numeric_...
 #include <memory>         // for shared_ptr
 #include <string>         // for string
+#include <type_traits>    // for conditio...
 #include <unordered_map>  // for unordere...
 #include <utility>        // for pair
 #include <vector>         // for vector
 
 namespace inviwo {
 
+/**
+ * Traces integral lines through the vector field of a sampler. The tracer calls the sampler through
+ * the type it is instantiated with, hence instantiating it with a concrete sampler type, like
+ * VolumeDoubleSampler<3>, avoids the virtual calls of the generic SpatialSampler interface.
+ */
 template <typename SpatialSampler, bool TimeDependent>
 class IntegralLineTracer {
 public:
@@ -74,12 +83,20 @@ public:
     using DataMatrix = Matrix<SampleDim, double>;
     using DataHomogeneousSpatialMatrix = Matrix<SampleDim + 1, double>;
 
+    /**
+     * Meta data samplers are always used through the generic sampler interface
+     */
+    using MetaDataSampler =
+        std::conditional_t<std::is_base_of_v<inviwo::SpatialSampler<SampleType>, Sampler>,
+                           inviwo::SpatialSampler<SampleType>, Sampler>;
+
     IntegralLineTracer(std::shared_ptr<const Sampler> sampler,
                        const IntegralLineProperties& properties);
 
     Result traceFrom(const SpatialVector& pIn) const;
 
-    void addMetaDataSampler(const std::string& name, std::shared_ptr<const Sampler> sampler);
+    void addMetaDataSampler(const std::string& name,
+                            std::shared_ptr<const MetaDataSampler> sampler);
 
     const DataHomogeneousSpatialMatrix& getSeedTransformationMatrix() const;
 
@@ -92,6 +109,12 @@ private:
 
     inline SpatialVector seedTransform(const SpatialVector& seed) const;
 
+    /**
+     * The derivative of the position for the velocity \p v, i.e. the velocity in the coordinate
+     * space of the positions, normalized if normalizeSamples_ is set.
+     */
+    SpatialVector derivative(DataVector v) const;
+
     StepResult step(const SpatialVector& oldPos, double stepSize) const;
 
     bool addPoint(IntegralLine& line, const SpatialVector& pos) const;
@@ -100,16 +123,19 @@ private:
 
     IntegralLine::TerminationReason integrate(size_t steps, SpatialVector pos, IntegralLine& line,
                                               bool fwd) const;
+    IntegralLine::TerminationReason integrateAdaptive(size_t steps, SpatialVector pos,
+                                                      IntegralLine& line, bool fwd) const;
 
     IntegralLineProperties::IntegrationScheme integrationScheme_;
 
     int steps_;
     double stepSize_;
+    double tolerance_;
     IntegralLineProperties::Direction dir_;
     bool normalizeSamples_;
 
     std::shared_ptr<const Sampler> sampler_;
-    std::unordered_map<std::string, std::shared_ptr<const Sampler>> metaSamplers_;
+    std::unordered_map<std::string, std::shared_ptr<const MetaDataSampler>> metaSamplers_;
 
     DataMatrix invBasis_;
     DataHomogeneousSpatialMatrix seedTransformation_;
@@ -121,6 +147,7 @@ IntegralLineTracer<SpatialSampler, TimeDependent>::IntegralLineTracer(
     : integrationScheme_(properties.getIntegrationScheme())
     , steps_(properties.getNumberOfSteps())
     , stepSize_(properties.getStepSize())
+    , tolerance_(properties.getTolerance())
     , dir_(properties.getStepDirection())
     , normalizeSamples_(properties.getNormalizeSamples())
     , sampler_(sampler)
@@ -179,7 +206,7 @@ IntegralLineTracer<SpatialSampler, TimeDependent>::traceFrom(const SpatialVector
 
 template <typename SpatialSampler, bool TimeDependent>
 void IntegralLineTracer<SpatialSampler, TimeDependent>::addMetaDataSampler(
-    const std::string& name, std::shared_ptr<const Sampler> sampler) {
+    const std::string& name, std::shared_ptr<const MetaDataSampler> sampler) {
     metaSamplers_[name] = sampler;
 }
 
@@ -201,6 +228,25 @@ inline auto IntegralLineTracer<SpatialSampler, TimeDependent>::seedTransform(
     }
 }
 
+template <typename SpatialSampler, bool TimeDependent>
+auto IntegralLineTracer<SpatialSampler, TimeDependent>::derivative(DataVector v) const
+    -> SpatialVector {
+    if (normalizeSamples_) {
+        const auto l = glm::length(v);
+        if (l != 0) v /= l;
+    }
+    const DataVector offset = invBasis_ * v;
+    if constexpr (TimeDependent) {
+        return SpatialVector(offset, 1.0);
+    } else if constexpr (SampleDim == 3) {
+        return offset;
+    } else if constexpr (SampleDim == 2) {
+        return SpatialVector(offset, 0.0);
+    } else {
+        static_assert(util::alwaysFalse<SpatialSampler>(), "Unsupported number of DataDimensions");
+    }
+}
+
 template <typename SpatialSampler, bool TimeDependent>
 auto IntegralLineTracer<SpatialSampler, TimeDependent>::step(const SpatialVector& oldPos,
                                                              double stepSize) const -> StepResult {
@@ -234,7 +280,8 @@ auto IntegralLineTracer<SpatialSampler, TimeDependent>::step(const SpatialVector
             return {move(oldPos, k1, stepSize), k1, false};
         default:
             [[fallthrough]];
-        case inviwo::IntegralLineProperties::IntegrationScheme::RK4: {
+        case inviwo::IntegralLineProperties::IntegrationScheme::RK4:
+        case inviwo::IntegralLineProperties::IntegrationScheme::RK45: {
             SpatialVector pos = move(oldPos, k1, stepSize / 2);
             if (!sampler_->withinBounds(pos)) {
                 return {oldPos, k1, true};
@@ -297,6 +344,9 @@ template <typename SpatialSampler, bool TimeDependent>
 IntegralLine::TerminationReason IntegralLineTracer<SpatialSampler, TimeDependent>::integrate(
     size_t steps, SpatialVector pos, IntegralLine& line, bool fwd) const {
     if (steps == 0) return IntegralLine::TerminationReason::StartPoint;
+    if (integrationScheme_ == IntegralLineProperties::IntegrationScheme::RK45) {
+        return integrateAdaptive(steps, pos, line, fwd);
+    }
     for (size_t i = 0; i < steps; i++) {
         if (!sampler_->withinBounds(pos)) {
             return IntegralLine::TerminationReason::OutOfBounds;
@@ -314,8 +364,122 @@ IntegralLine::TerminationReason IntegralLineTracer<SpatialSampler, TimeDependent
     return IntegralLine::TerminationReason::Steps;
 }
 
+template <typename SpatialSampler, bool TimeDependent>
+IntegralLine::TerminationReason
+IntegralLineTracer<SpatialSampler, TimeDependent>::integrateAdaptive(size_t steps,
+                                                                     SpatialVector pos,
+                                                                     IntegralLine& line,
+                                                                     bool fwd) const {
+    // Dormand-Prince 5(4) coefficients, including the continuous extension, see Hairer, Norsett,
+    // and Wanner, "Solving Ordinary Differential Equations I".
+    static constexpr double a21 = 1.0 / 5.0;
+    static constexpr double a31 = 3.0 / 40.0, a32 = 9.0 / 40.0;
+    static constexpr double a41 = 44.0 / 45.0, a42 = -56.0 / 15.0, a43 = 32.0 / 9.0;
+    static constexpr double a51 = 19372.0 / 6561.0, a52 = -25360.0 / 2187.0,
+                            a53 = 64448.0 / 6561.0, a54 = -212.0 / 729.0;
+    static constexpr double a61 = 9017.0 / 3168.0, a62 = -355.0 / 33.0, a63 = 46732.0 / 5247.0,
+                            a64 = 49.0 / 176.0, a65 = -5103.0 / 18656.0;
+    static constexpr double b1 = 35.0 / 384.0, b3 = 500.0 / 1113.0, b4 = 125.0 / 192.0,
+                            b5 = -2187.0 / 6784.0, b6 = 11.0 / 84.0;
+    static constexpr double e1 = 71.0 / 57600.0, e3 = -71.0 / 16695.0, e4 = 71.0 / 1920.0,
+                            e5 = -17253.0 / 339200.0, e6 = 22.0 / 525.0, e7 = -1.0 / 40.0;
+    static constexpr double d1 = -12715105075.0 / 11282082432.0,
+                            d3 = 87487479700.0 / 32700410799.0,
+                            d4 = -10690763975.0 / 1880347072.0,
+                            d5 = 701980252875.0 / 199316789632.0,
+                            d6 = -1453857185.0 / 822651844.0, d7 = 69997945.0 / 29380423.0;
+
+    if (!sampler_->withinBounds(pos)) {
+        return IntegralLine::TerminationReason::OutOfBounds;
+    }
+
+    const auto stage = [&](const SpatialVector& p, SpatialVector& k) {
+        if (!sampler_->withinBounds(p)) return false;
+        k = derivative(sampler_->sample(p));
+        return true;
+    };
+    const auto factor = [](double error) {
+        if (error == 0.0) return 5.0;
+        return std::clamp(0.9 * std::pow(error, -0.2), 0.2, 5.0);
+    };
+
+    // The integration steps are chosen by the error control, while the points are placed at
+    // multiples of the step size using the continuous extension. Hence the lines look the same as
+    // for the fixed step schemes, but a smooth field needs far fewer samples.
+    const double dir = fwd ? 1.0 : -1.0;
+    const double end = static_cast<double>(steps) * stepSize_;
+    const double eps = 1.0e-9 * stepSize_;
+    const double minStep = 1.0e-6 * stepSize_;
+
+    size_t added = 0;
+    double t = 0.0;
+    double h = stepSize_;
+    SpatialVector k1 = derivative(sampler_->sample(pos));
+
+    while (added < steps) {
+        h = std::max(std::min(h, end - t), minStep);
+        const double H = dir * h;
+
+        SpatialVector k2, k3, k4, k5, k6, k7, next;
+        bool inside = stage(pos + H * (a21 * k1), k2) &&
+                      stage(pos + H * (a31 * k1 + a32 * k2), k3) &&
+                      stage(pos + H * (a41 * k1 + a42 * k2 + a43 * k3), k4) &&
+                      stage(pos + H * (a51 * k1 + a52 * k2 + a53 * k3 + a54 * k4), k5) &&
+                      stage(pos + H * (a61 * k1 + a62 * k2 + a63 * k3 + a64 * k4 + a65 * k5), k6);
+        if (inside) {
+            next = pos + H * (b1 * k1 + b3 * k3 + b4 * k4 + b5 * k5 + b6 * k6);
+            inside = stage(next, k7);
+        }
+        if (!inside) {
+            // Approach the boundary with shorter steps, until closer than one point
+            if (0.5 * h < stepSize_) return IntegralLine::TerminationReason::OutOfBounds;
+            h *= 0.5;
+            continue;
+        }
+
+        const SpatialVector errorEstimate =
+            H * (e1 * k1 + e3 * k3 + e4 * k4 + e5 * k5 + e6 * k6 + e7 * k7);
+        const SpatialVector scale = tolerance_ * (1.0 + glm::max(glm::abs(pos), glm::abs(next)));
+        const SpatialVector ratio = errorEstimate / scale;
+        const double error = std::sqrt(glm::dot(ratio, ratio) /
+                                       static_cast<double>(Sampler::SpatialDimensions));
+        if (error > 1.0 && h > minStep) {
+            h *= factor(error);
+            continue;
+        }
+
+        const SpatialVector r2 = next - pos;
+        const SpatialVector r3 = H * k1 - r2;
+        const SpatialVector r4 = r2 - H * k7 - r3;
+        const SpatialVector r5 = H * (d1 * k1 + d3 * k3 + d4 * k4 + d5 * k5 + d6 * k6 + d7 * k7);
+        for (; added < steps && static_cast<double>(added + 1) * stepSize_ <= t + h + eps;
+             ++added) {
+            const double theta = (static_cast<double>(added + 1) * stepSize_ - t) / h;
+            const double theta1 = 1.0 - theta;
+            const SpatialVector p =
+                pos + theta * (r2 + theta1 * (r3 + theta * (r4 + theta1 * r5)));
+            if (!sampler_->withinBounds(p)) {
+                return IntegralLine::TerminationReason::OutOfBounds;
+            }
+            if (!addPoint(line, p)) {
+                return IntegralLine::TerminationReason::ZeroVelocity;
+            }
+        }
+
+        t += h;
+        pos = next;
+        k1 = k7;
+        h *= factor(error);
+    }
+    return IntegralLine::TerminationReason::Steps;
+}
+
 using StreamLine2DTracer = IntegralLineTracer<SpatialSampler<dvec2>, false>;
 using StreamLine3DTracer = IntegralLineTracer<SpatialSampler<dvec3>, false>;
 using PathLine3DTracer = IntegralLineTracer<Spatial4DSampler<dvec3>, true>;
+/**
+ * Stream line tracer using a VolumeDoubleSampler<3> directly, without virtual sampling calls
+ */
+using VolumeStreamLine3DTracer = IntegralLineTracer<VolumeDoubleSampler<3>, false>;
 
 }  // namespace inviwo
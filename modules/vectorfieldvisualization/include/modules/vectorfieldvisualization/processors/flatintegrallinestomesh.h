@@ -0,0 +1,63 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#pragma once
+
+#include <modules/vectorfieldvisualization/vectorfieldvisualizationmoduledefine.h>  // for IVW_M...
+
+#include <inviwo/core/ports/meshport.h>                                           // for MeshO...
+#include <inviwo/core/processors/processor.h>                                     // for Proce...
+#include <inviwo/core/processors/processorinfo.h>                                 // for Proce...
+#include <inviwo/core/properties/optionproperty.h>                                // for Optio...
+#include <modules/vectorfieldvisualization/datastructures/flatintegrallineset.h>  // for FlatI...
+
+namespace inviwo {
+
+/**
+ * Converts a FlatIntegralLineSet into a line mesh, see util::toMesh. The positions and meta data
+ * channels are passed on as whole buffers without any per line work.
+ */
+class IVW_MODULE_VECTORFIELDVISUALIZATION_API FlatIntegralLinesToMesh : public Processor {
+public:
+    FlatIntegralLinesToMesh();
+    virtual ~FlatIntegralLinesToMesh() = default;
+
+    virtual void process() override;
+
+    virtual const ProcessorInfo& getProcessorInfo() const override;
+    static const ProcessorInfo processorInfo_;
+
+private:
+    FlatIntegralLineSetInport lines_;
+    MeshOutport mesh_;
+
+    OptionProperty<FlatIntegralLineSet::Precision> precision_;
+};
+
+}  // namespace inviwo
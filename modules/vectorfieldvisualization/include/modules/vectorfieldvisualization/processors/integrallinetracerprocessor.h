@@ -30,7 +30,7 @@
 #pragma once
 
 #include <modules/vectorfieldvisualization/vectorfieldvisualizationmoduledefine.h>
-#include <inviwo/core/processors/processor.h>
+#include <inviwo/core/processors/poolprocessor.h>
 #include <inviwo/core/processors/processortraits.h>
 #include <inviwo/core/properties/ordinalproperty.h>
 #include <inviwo/core/properties/compositeproperty.h>
@@ -38,16 +38,32 @@
 #include <inviwo/core/ports/datainport.h>
 #include <inviwo/core/ports/imageport.h>
 #include <inviwo/core/util/utilities.h>
-#include <inviwo/core/util/foreach.h>
+#include <inviwo/core/util/threadutil.h>
 #include <modules/vectorfieldvisualization/algorithms/integrallineoperations.h>
+#include <modules/vectorfieldvisualization/datastructures/flatintegrallineset.h>
 #include <modules/vectorfieldvisualization/integrallinetracer.h>
 #include <modules/vectorfieldvisualization/ports/seedpointsport.h>
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+
 namespace inviwo {
 
+/**
+ * Traces integral lines from all seed points on the thread pool. The seeds are traced in parallel
+ * blocks, where each block collects its lines in its own buffer. The buffers are merged in seed
+ * order, hence the resulting lines do not depend on the thread timing. When the flat lines outport
+ * is connected the lines are also provided as a FlatIntegralLineSet. Stream lines in a volume
+ * sampler are traced with VolumeStreamLine3DTracer, which samples the volume without virtual calls.
+ */
 template <typename Tracer>
-class IntegralLineTracerProcessor : public Processor {
+class IntegralLineTracerProcessor : public PoolProcessor {
 public:
+    using Seeds = SeedPointVector<Tracer::Sampler::SpatialDimensions>;
+
     IntegralLineTracerProcessor();
     virtual ~IntegralLineTracerProcessor();
 
@@ -55,12 +71,31 @@ public:
 
     virtual const ProcessorInfo& getProcessorInfo() const override;
 
+    /**
+     * Trace lines from all points in @p seeds, lines with less than two points are discarded.
+     * Each line gets the index of its seed, counting through all the seed vectors, as index.
+     * The lines are in seed order, independent of the number of threads.
+     * @param stop     converts to true when the tracing should be aborted, e.g. a pool::Stop
+     * @param progress called as `progress(traced, total)`, e.g. a pool::Progress. The calls are
+     *                 serialized but can come from any thread of the pool.
+     * Returns nullptr if @p stop is set before all seeds are traced.
+     */
+    template <typename LineTracer, typename Stop, typename Progress>
+    static std::shared_ptr<IntegralLineSet> trace(
+        const LineTracer& tracer, const std::vector<std::shared_ptr<const Seeds>>& seeds,
+        const mat4& modelMatrix, const mat4& worldMatrix, const Stop& stop,
+        const Progress& progress);
+
 private:
+    template <typename LineTracer>
+    void dispatchTrace(LineTracer tracer);
+
     DataInport<typename Tracer::Sampler> sampler_;
     SeedPointsInport<Tracer::Sampler::SpatialDimensions> seeds_;
     DataInport<typename Tracer::Sampler, 0> annotationSamplers_;
 
     IntegralLineSetOutport lines_;
+    FlatIntegralLineSetOutport flatLines_;
 
     IntegralLineProperties properties_;
 
@@ -71,10 +106,12 @@ private:
 
 template <typename Tracer>
 IntegralLineTracerProcessor<Tracer>::IntegralLineTracerProcessor()
-    : sampler_("sampler")
+    : PoolProcessor()
+    , sampler_("sampler")
     , seeds_("seeds")
     , annotationSamplers_("annotationSamplers")
     , lines_("lines")
+    , flatLines_("flatLines")
     , properties_("properties", "Properties")
 
     , metaData_("metaData", "Meta Data")
@@ -84,6 +121,7 @@ IntegralLineTracerProcessor<Tracer>::IntegralLineTracerProcessor()
     addPort(seeds_);
     addPort(annotationSamplers_);
     addPort(lines_);
+    addPort(flatLines_);
 
     addProperty(properties_);
     addProperty(metaData_);
@@ -94,6 +132,11 @@ IntegralLineTracerProcessor<Tracer>::IntegralLineTracerProcessor()
     properties_.normalizeSamples_.setCurrentStateAsDefault();
 
     annotationSamplers_.setOptional(true);
+
+    // The flat lines are only created while flatLines_ is connected
+    flatLines_.onConnect([this]() {
+        if (!flatLines_.hasData()) invalidate(InvalidationLevel::InvalidOutput);
+    });
 }
 
 template <typename Tracer>
@@ -102,10 +145,20 @@ IntegralLineTracerProcessor<Tracer>::~IntegralLineTracerProcessor() {}
 template <typename Tracer>
 void IntegralLineTracerProcessor<Tracer>::process() {
     auto sampler = sampler_.getData();
-    auto lines =
-        std::make_shared<IntegralLineSet>(sampler->getModelMatrix(), sampler->getWorldMatrix());
 
-    Tracer tracer(sampler, properties_);
+    if constexpr (std::is_same_v<Tracer, StreamLine3DTracer>) {
+        if (auto volumeSampler = std::dynamic_pointer_cast<const VolumeDoubleSampler<3>>(sampler)) {
+            dispatchTrace(VolumeStreamLine3DTracer(volumeSampler, properties_));
+            return;
+        }
+    }
+    dispatchTrace(Tracer(sampler, properties_));
+}
+
+template <typename Tracer>
+template <typename LineTracer>
+void IntegralLineTracerProcessor<Tracer>::dispatchTrace(LineTracer tracer) {
+    auto sampler = sampler_.getData();
 
     for (auto meta : annotationSamplers_.getSourceVectorData()) {
         auto key = meta.first->getProcessor()->getIdentifier();
@@ -113,28 +166,93 @@ void IntegralLineTracerProcessor<Tracer>::process() {
         tracer.addMetaDataSampler(key, meta.second);
     }
 
-    std::mutex mutex;
-    size_t startID = 0;
-    for (const auto& seeds : seeds_) {
-        util::forEachParallel(*seeds, [&](const auto& p, size_t i) {
-            IntegralLine line = tracer.traceFrom(p);
-            auto size = line.getPositions().size();
-            if (size > 1) {
-                std::lock_guard<std::mutex> lock(mutex);
-                lines->push_back(std::move(line), startID + i);
+    using Result =
+        std::pair<std::shared_ptr<IntegralLineSet>, std::shared_ptr<FlatIntegralLineSet>>;
+
+    dispatchOne(
+        [tracer = std::move(tracer), seeds = seeds_.getVectorData(),
+         modelMatrix = sampler->getModelMatrix(), worldMatrix = sampler->getWorldMatrix(),
+         curvature = calculateCurvature_.get(), tortuosity = calculateTortuosity_.get(),
+         flat = flatLines_.isConnected()](pool::Stop stop, pool::Progress progress) -> Result {
+            auto lines = trace(tracer, seeds, modelMatrix, worldMatrix, stop, progress);
+            if (!lines) return {};
+
+            if (curvature) {
+                util::curvature(*lines);
             }
+            if (tortuosity) {
+                util::tortuosity(*lines);
+            }
+            if (flat) {
+                return {lines, std::make_shared<FlatIntegralLineSet>(*lines)};
+            }
+            return {lines, nullptr};
+        },
+        [this](Result result) {
+            lines_.setData(result.first);
+            flatLines_.setData(result.second);
+            newResults();
         });
-        startID += seeds->size();
+}
+
+template <typename Tracer>
+template <typename LineTracer, typename Stop, typename Progress>
+std::shared_ptr<IntegralLineSet> IntegralLineTracerProcessor<Tracer>::trace(
+    const LineTracer& tracer, const std::vector<std::shared_ptr<const Seeds>>& seeds,
+    const mat4& modelMatrix, const mat4& worldMatrix, const Stop& stop,
+    const Progress& progress) {
+
+    constexpr size_t blockSize = 256;
+
+    // offsets[i] is the index of the first seed of seeds[i]
+    std::vector<size_t> offsets{0};
+    for (const auto& s : seeds) {
+        offsets.push_back(offsets.back() + s->size());
     }
+    const auto total = offsets.back();
+    const auto nBlocks = (total + blockSize - 1) / blockSize;
+
+    std::vector<std::vector<std::pair<size_t, IntegralLine>>> blocks(nBlocks);
+    std::atomic<size_t> traced{0};
+    // Progress is not thread safe, a block that finds it busy skips its report since the block
+    // holding the lock reports the count of all finished blocks anyway. Those reports may arrive
+    // out of order, so the completion is reported once all blocks are done.
+    std::mutex progressMutex;
+
+    util::parallelFor(nBlocks, [&](size_t block) {
+        const auto first = block * blockSize;
+        const auto last = std::min(total, first + blockSize);
+        auto set = static_cast<size_t>(
+            std::upper_bound(offsets.begin(), offsets.end(), first) - offsets.begin() - 1);
+        for (auto i = first; i < last; ++i) {
+            if (stop) return;
+            while (i >= offsets[set + 1]) ++set;
+            auto result = tracer.traceFrom((*seeds[set])[i - offsets[set]]);
+            if (result.line.getPositions().size() > 1) {
+                blocks[block].emplace_back(i, std::move(result.line));
+            }
+        }
+
+        traced.fetch_add(last - first);
+        if (const std::unique_lock lock{progressMutex, std::try_to_lock}) {
+            progress(traced.load(), total);
+        }
+    });
+    if (stop) return nullptr;
+    progress(total, total);
 
-    if (calculateCurvature_) {
-        util::curvature(*lines);
+    auto lines = std::make_shared<IntegralLineSet>(modelMatrix, worldMatrix);
+    size_t count = 0;
+    for (const auto& block : blocks) {
+        count += block.size();
     }
-    if (calculateTortuosity_) {
-        util::tortuosity(*lines);
+    lines->getVector().reserve(count);
+    for (auto& block : blocks) {
+        for (auto& [index, line] : block) {
+            lines->push_back(std::move(line), index);
+        }
     }
-
-    lines_.setData(lines);
+    return lines;
 }
 
 using StreamLines2D = IntegralLineTracerProcessor<StreamLine2DTracer>;
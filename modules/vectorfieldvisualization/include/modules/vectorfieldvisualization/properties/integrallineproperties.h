@@ -48,7 +48,11 @@ namespace inviwo {
 
 class IVW_MODULE_VECTORFIELDVISUALIZATION_API IntegralLineProperties : public CompositeProperty {
 public:
-    enum class IntegrationScheme { Euler, RK4 };
+    /**
+     * Euler and RK4 take fixed steps. RK45 is the adaptive Dormand-Prince scheme, it adapts its
+     * steps to the tolerance and places the points at the step size using dense output.
+     */
+    enum class IntegrationScheme { Euler, RK4, RK45 };
 
     enum class Direction { Forward = 1, Backward = 2, Bidirectional = 3 };
 
@@ -63,6 +67,7 @@ public:
 
     int getNumberOfSteps() const;
     float getStepSize() const;
+    double getTolerance() const;
 
     IntegralLineProperties::Direction getStepDirection() const;
     IntegralLineProperties::IntegrationScheme getIntegrationScheme() const;
@@ -75,6 +80,7 @@ private:
 public:
     IntProperty numberOfSteps_;
     FloatProperty stepSize_;
+    DoubleProperty tolerance_;
     BoolProperty normalizeSamples_;
 
     OptionProperty<IntegralLineProperties::Direction> stepDirection_;
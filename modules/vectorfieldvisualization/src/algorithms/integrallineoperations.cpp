@@ -36,11 +36,13 @@
 #include <inviwo/core/util/glmmat.h>                                          // for dmat4
 #include <inviwo/core/util/glmvec.h>                                          // for dvec3, dvec4
 #include <inviwo/core/util/logcentral.h>                                      // for LogCentral
+#include <inviwo/core/util/threadutil.h>                                      // for parallelFor
 #include <modules/vectorfieldvisualization/datastructures/integralline.h>     // for IntegralLine
 #include <modules/vectorfieldvisualization/datastructures/integrallineset.h>  // for IntegralLin...
 
 #include <algorithm>      // for transform
 #include <cmath>          // for acos
+#include <cstddef>        // for size_t
 #include <memory>         // for unique_ptr
 #include <sstream>        // for basic_strin...
 #include <type_traits>    // for remove_exte...
@@ -118,9 +120,8 @@ void curvature(IntegralLine& line, dmat4 toWorld) {
     K[0] = K[1];  // Copy second to first
 }
 void curvature(IntegralLineSet& lines) {
-    for (auto& line : lines) {
-        curvature(line, dmat4(lines.getModelMatrix()));
-    }
+    const dmat4 toWorld{lines.getModelMatrix()};
+    util::parallelFor(lines.size(), [&](size_t i) { curvature(lines[i], toWorld); });
 }
 
 IntegralLine tortuosity(const IntegralLine& line, dmat4 toWorld) {
@@ -163,9 +164,8 @@ void tortuosity(IntegralLine& line, dmat4 toWorld) {
     }
 }
 void tortuosity(IntegralLineSet& lines) {
-    for (auto& line : lines) {
-        tortuosity(line, dmat4(lines.getModelMatrix()));
-    }
+    const dmat4 toWorld{lines.getModelMatrix()};
+    util::parallelFor(lines.size(), [&](size_t i) { tortuosity(lines[i], toWorld); });
 }
 
 }  // namespace util
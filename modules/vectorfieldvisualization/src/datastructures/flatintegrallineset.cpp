@@ -0,0 +1,377 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/vectorfieldvisualization/datastructures/flatintegrallineset.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>                         // for Buffer
+#include <inviwo/core/datastructures/buffer/bufferram.h>                      // for BufferRAM
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>             // for BufferRAMPr...
+#include <inviwo/core/datastructures/geometry/geometrytype.h>                 // for BufferType
+#include <inviwo/core/datastructures/geometry/mesh.h>                         // for Mesh
+#include <inviwo/core/util/exception.h>                                       // for Exception
+#include <inviwo/core/util/formatdispatching.h>                               // for singleDispatch
+#include <inviwo/core/util/formats.h>                                         // for DataFormatBase
+#include <inviwo/core/util/glmmat.h>                                          // for mat4
+#include <inviwo/core/util/glmutils.h>                                        // for same_extent
+#include <inviwo/core/util/glmvec.h>                                          // for dvec3
+#include <inviwo/core/util/threadutil.h>                                      // for parallelFor
+#include <modules/vectorfieldvisualization/datastructures/integralline.h>     // for IntegralLine
+#include <modules/vectorfieldvisualization/datastructures/integrallineset.h>  // for IntegralLin...
+
+#include <algorithm>   // for copy, equal
+#include <functional>  // for function
+#include <limits>      // for numeric_li...
+#include <utility>     // for move
+
+namespace inviwo {
+
+namespace {
+
+constexpr size_t blockSize = 1024;
+
+// Run work(begin, end) over blocks of lines, since the lines are typically short
+void forEachBlock(size_t count, const std::function<void(size_t, size_t)>& work) {
+    util::parallelFor((count + blockSize - 1) / blockSize, [&](size_t block) {
+        work(block * blockSize, std::min(count, (block + 1) * blockSize));
+    });
+}
+
+std::uint32_t toOffset(size_t points) {
+    if (points > std::numeric_limits<std::uint32_t>::max()) {
+        throw Exception(SourceContext{}, "Too many points in integral line set: {}", points);
+    }
+    return static_cast<std::uint32_t>(points);
+}
+
+std::shared_ptr<BufferBase> createBuffer(const DataFormatBase* format, size_t size) {
+    return dispatching::singleDispatch<std::shared_ptr<BufferBase>, dispatching::filter::All>(
+        format->getId(), []<typename T>(size_t n) -> std::shared_ptr<BufferBase> {
+            return std::make_shared<Buffer<T>>(n);
+        },
+        size);
+}
+
+void checkMetaData(const std::map<std::string, std::shared_ptr<BufferBase>, std::less<>>& expected,
+                   const IntegralLine& line) {
+    const auto& metaData = line.getMetaDataBuffers();
+    const auto sameChannel = [](const auto& a, const auto& b) {
+        return a.first == b.first && a.second->getDataFormat() == b.second->getDataFormat();
+    };
+    if (metaData.size() != expected.size() ||
+        !std::equal(metaData.begin(), metaData.end(), expected.begin(), sameChannel)) {
+        throw Exception(SourceContext{},
+                        "Meta data of integral line {} does not match the integral line set",
+                        line.getIndex());
+    }
+    for (const auto& [key, buffer] : metaData) {
+        if (buffer->getSize() != line.getPositions().size()) {
+            throw Exception(SourceContext{},
+                            "Meta data {} of integral line {} has {} values but the line has {} "
+                            "points",
+                            key, line.getIndex(), buffer->getSize(), line.getPositions().size());
+        }
+    }
+}
+
+}  // namespace
+
+FlatIntegralLineSet::FlatIntegralLineSet(mat4 modelMatrix, mat4 worldMatrix)
+    : positions_{std::make_shared<Buffer<dvec3>>()}
+    , offsets_{0}
+    , indices_{}
+    , forwardTerminationReasons_{}
+    , backwardTerminationReasons_{}
+    , metaData_{}
+    , modelMatrix_{modelMatrix}
+    , worldMatrix_{worldMatrix} {}
+
+FlatIntegralLineSet::FlatIntegralLineSet(const IntegralLineSet& lines)
+    : FlatIntegralLineSet(lines.getModelMatrix(), lines.getWorldMatrix()) {
+
+    const auto nLines = lines.size();
+    if (nLines == 0) return;
+
+    offsets_.resize(nLines + 1);
+    indices_.resize(nLines);
+    forwardTerminationReasons_.resize(nLines);
+    backwardTerminationReasons_.resize(nLines);
+
+    size_t points = 0;
+    for (size_t i = 0; i < nLines; ++i) {
+        const auto& line = lines[i];
+        offsets_[i] = toOffset(points);
+        indices_[i] = line.getIndex();
+        forwardTerminationReasons_[i] = line.getForwardTerminationReason();
+        backwardTerminationReasons_[i] = line.getBackwardTerminationReason();
+        points += line.getPositions().size();
+    }
+    offsets_[nLines] = toOffset(points);
+
+    for (const auto& [key, buffer] : lines.front().getMetaDataBuffers()) {
+        metaData_.emplace(key, createBuffer(buffer->getDataFormat(), points));
+    }
+    for (const auto& line : lines) {
+        checkMetaData(metaData_, line);
+    }
+
+    positions_ = std::make_shared<Buffer<dvec3>>(points);
+    auto& positions = positions_->getEditableRAMRepresentation()->getDataContainer();
+    forEachBlock(nLines, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            const auto& src = lines[i].getPositions();
+            std::copy(src.begin(), src.end(), positions.begin() + offsets_[i]);
+        }
+    });
+
+    for (auto& [key, buffer] : metaData_) {
+        buffer->getEditableRepresentation<BufferRAM>()->dispatch<void>([&](auto ram) {
+            using T = util::PrecisionValueType<decltype(ram)>;
+            auto& data = ram->getDataContainer();
+            forEachBlock(nLines, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i) {
+                    const auto& src = lines[i].getMetaData<T>(key);
+                    std::copy(src.begin(), src.end(), data.begin() + offsets_[i]);
+                }
+            });
+        });
+    }
+}
+
+FlatIntegralLineSet::FlatIntegralLineSet(const FlatIntegralLineSet& rhs)
+    : positions_{rhs.positions_->clone()}
+    , offsets_{rhs.offsets_}
+    , indices_{rhs.indices_}
+    , forwardTerminationReasons_{rhs.forwardTerminationReasons_}
+    , backwardTerminationReasons_{rhs.backwardTerminationReasons_}
+    , metaData_{}
+    , modelMatrix_{rhs.modelMatrix_}
+    , worldMatrix_{rhs.worldMatrix_} {
+    for (const auto& [key, buffer] : rhs.metaData_) {
+        metaData_.emplace(key, std::shared_ptr<BufferBase>(buffer->clone()));
+    }
+}
+
+FlatIntegralLineSet& FlatIntegralLineSet::operator=(const FlatIntegralLineSet& that) {
+    if (this != &that) {
+        FlatIntegralLineSet copy(that);
+        *this = std::move(copy);
+    }
+    return *this;
+}
+
+FlatIntegralLineSet::~FlatIntegralLineSet() = default;
+
+mat4 FlatIntegralLineSet::getModelMatrix() const { return modelMatrix_; }
+mat4 FlatIntegralLineSet::getWorldMatrix() const { return worldMatrix_; }
+
+size_t FlatIntegralLineSet::size() const { return indices_.size(); }
+
+bool FlatIntegralLineSet::empty() const { return indices_.empty(); }
+
+size_t FlatIntegralLineSet::getNumberOfPoints() const { return offsets_.back(); }
+
+void FlatIntegralLineSet::push_back(const IntegralLine& line) {
+    if (empty() && metaData_.empty()) {
+        for (const auto& [key, buffer] : line.getMetaDataBuffers()) {
+            metaData_.emplace(key, createBuffer(buffer->getDataFormat(), 0));
+        }
+    }
+    checkMetaData(metaData_, line);
+
+    const auto& src = line.getPositions();
+    const auto offset = toOffset(getNumberOfPoints() + src.size());
+
+    auto& positions = positions_->getEditableRAMRepresentation()->getDataContainer();
+    positions.insert(positions.end(), src.begin(), src.end());
+    for (const auto& [key, buffer] : line.getMetaDataBuffers()) {
+        metaData_.find(key)->second->append(*buffer);
+    }
+    offsets_.push_back(offset);
+    indices_.push_back(line.getIndex());
+    forwardTerminationReasons_.push_back(line.getForwardTerminationReason());
+    backwardTerminationReasons_.push_back(line.getBackwardTerminationReason());
+}
+
+IntegralLine FlatIntegralLineSet::getLine(size_t idx) const {
+    const auto begin = offsets_[idx];
+    const auto end = offsets_[idx + 1];
+
+    IntegralLine line;
+    const auto positions = getPositions(idx);
+    line.getPositions().assign(positions.begin(), positions.end());
+    for (const auto& [key, buffer] : metaData_) {
+        buffer->getRepresentation<BufferRAM>()->dispatch<void>([&](const auto ram) {
+            using T = util::PrecisionValueType<decltype(ram)>;
+            const auto& data = ram->getDataContainer();
+            line.createMetaData<T>(key)->getEditableRAMRepresentation()->getDataContainer().assign(
+                data.begin() + begin, data.begin() + end);
+        });
+    }
+    line.setIndex(indices_[idx]);
+    line.setForwardTerminationReason(forwardTerminationReasons_[idx]);
+    line.setBackwardTerminationReason(backwardTerminationReasons_[idx]);
+    return line;
+}
+
+IntegralLineSet FlatIntegralLineSet::toIntegralLineSet() const {
+    IntegralLineSet set(modelMatrix_, worldMatrix_);
+    auto& lines = set.getVector();
+    lines.resize(size());
+    forEachBlock(size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            lines[i] = getLine(i);
+        }
+    });
+    return set;
+}
+
+std::span<const std::uint32_t> FlatIntegralLineSet::getOffsets() const { return offsets_; }
+
+std::span<const dvec3> FlatIntegralLineSet::getPositions() const {
+    return positions_->getRAMRepresentation()->getDataContainer();
+}
+
+std::span<const dvec3> FlatIntegralLineSet::getPositions(size_t line) const {
+    return getPositions().subspan(offsets_[line], offsets_[line + 1] - offsets_[line]);
+}
+
+std::shared_ptr<const Buffer<dvec3>> FlatIntegralLineSet::getPositionBuffer() const {
+    return positions_;
+}
+
+std::uint32_t FlatIntegralLineSet::getIndex(size_t line) const { return indices_[line]; }
+
+auto FlatIntegralLineSet::getForwardTerminationReason(size_t line) const -> TerminationReason {
+    return forwardTerminationReasons_[line];
+}
+
+auto FlatIntegralLineSet::getBackwardTerminationReason(size_t line) const -> TerminationReason {
+    return backwardTerminationReasons_[line];
+}
+
+bool FlatIntegralLineSet::hasMetaData(std::string_view name) const {
+    return metaData_.find(name) != metaData_.end();
+}
+
+std::vector<std::string> FlatIntegralLineSet::getMetaDataKeys() const {
+    std::vector<std::string> keys;
+    for (const auto& item : metaData_) {
+        keys.push_back(item.first);
+    }
+    return keys;
+}
+
+auto FlatIntegralLineSet::getMetaDataBuffers() const
+    -> const std::map<std::string, std::shared_ptr<BufferBase>, std::less<>>& {
+    return metaData_;
+}
+
+std::shared_ptr<const BufferBase> FlatIntegralLineSet::getMetaDataBuffer(
+    std::string_view name) const {
+    if (auto it = metaData_.find(name); it != metaData_.end()) {
+        return it->second;
+    }
+    return nullptr;
+}
+
+const BufferBase& FlatIntegralLineSet::metaData(std::string_view name,
+                                                const DataFormatBase* format) const {
+    auto it = metaData_.find(name);
+    if (it == metaData_.end()) {
+        throw Exception(SourceContext{}, "No meta data with name: {}", name);
+    }
+    if (it->second->getDataFormat() != format) {
+        throw Exception(SourceContext{},
+                        "Incorrect dataformat for meta data {} asking for {} but is {}", name,
+                        format->getString(), it->second->getDataFormat()->getString());
+    }
+    return *it->second;
+}
+
+static_assert(FlatIntegralLineSet::metaDataLocation ==
+                  static_cast<int>(BufferType::IntMetaAttrib) + 1,
+              "Meta data channels must not overlap the locations of the named buffer types");
+
+std::shared_ptr<Mesh> util::toMesh(const FlatIntegralLineSet& lines,
+                                   FlatIntegralLineSet::Precision precision,
+                                   int metaDataLocation) {
+    const auto toMeshBuffer = [&](const BufferBase& buffer) -> std::shared_ptr<BufferBase> {
+        const auto* format = buffer.getDataFormat();
+        if (precision == FlatIntegralLineSet::Precision::Double ||
+            format->getNumericType() != NumericType::Float || format->getPrecision() != 64) {
+            // Buffer representations are copy on write, hence the clone does not copy any data
+            return std::shared_ptr<BufferBase>(buffer.clone());
+        }
+        return buffer.getRepresentation<BufferRAM>()
+            ->dispatch<std::shared_ptr<BufferBase>, dispatching::filter::Floats>([](auto ram) {
+                using T = util::PrecisionValueType<decltype(ram)>;
+                using F = typename util::same_extent<T, float>::type;
+                const auto& src = ram->getDataContainer();
+                std::vector<F> dst(src.size());
+                forEachBlock(src.size(), [&](size_t begin, size_t end) {
+                    std::transform(src.begin() + begin, src.begin() + end, dst.begin() + begin,
+                                   [](const T& v) { return static_cast<F>(v); });
+                });
+                return util::makeBuffer(std::move(dst));
+            });
+    };
+
+    auto mesh = std::make_shared<Mesh>(DrawType::Lines, ConnectivityType::None);
+    mesh->setModelMatrix(lines.getModelMatrix());
+    mesh->setWorldMatrix(lines.getWorldMatrix());
+
+    mesh->addBuffer(BufferType::PositionAttrib, toMeshBuffer(*lines.getPositionBuffer()));
+    int location = metaDataLocation;
+    for (const auto& [key, buffer] : lines.getMetaDataBuffers()) {
+        mesh->addBuffer(Mesh::BufferInfo{BufferType::Unknown, location++}, toMeshBuffer(*buffer));
+    }
+
+    // A line with n points has n - 1 segments, lines with a single point are skipped
+    const auto offsets = lines.getOffsets();
+    std::vector<std::uint32_t> segmentOffsets(lines.size() + 1, 0);
+    for (size_t i = 0; i < lines.size(); ++i) {
+        const auto points = offsets[i + 1] - offsets[i];
+        segmentOffsets[i + 1] = segmentOffsets[i] + (points > 0 ? points - 1 : 0);
+    }
+    std::vector<std::uint32_t> indices(2 * static_cast<size_t>(segmentOffsets.back()));
+    forEachBlock(lines.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            auto out = indices.begin() + 2 * static_cast<size_t>(segmentOffsets[i]);
+            for (auto p = offsets[i]; p + 1 < offsets[i + 1]; ++p) {
+                *out++ = p;
+                *out++ = p + 1;
+            }
+        }
+    });
+    mesh->addIndices(Mesh::MeshInfo{DrawType::Lines, ConnectivityType::None},
+                     util::makeIndexBuffer(std::move(indices)));
+    return mesh;
+}
+
+}  // namespace inviwo
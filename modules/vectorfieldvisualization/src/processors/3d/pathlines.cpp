@@ -54,6 +54,7 @@
 #include <inviwo/core/properties/transferfunctionproperty.h>                     // for Transfer...
 #include <inviwo/core/util/glmvec.h>                                             // for dvec3, vec4
 #include <inviwo/core/util/logcentral.h>                                         // for LogCentral
+#include <inviwo/core/util/parallel.h>                                           // for parallelFor
 #include <inviwo/core/util/spatial4dsampler.h>                                   // for Spatial4...
 #include <inviwo/core/util/statecoordinator.h>                                   // for StateCoo...
 #include <inviwo/core/util/staticstring.h>                                       // for operator+
@@ -72,7 +73,8 @@
 #include <memory>         // for shared_ptr
 #include <type_traits>    // for remove_e...
 #include <unordered_set>  // for unordere...
-#include <utility>        // for pair
+#include <utility>        // for pair, move
+#include <vector>         // for vector
 
 #include <fmt/core.h>         // for format
 #include <glm/common.hpp>     // for clamp
@@ -81,10 +83,6 @@
 #include <glm/vec3.hpp>       // for operator*
 #include <glm/vec4.hpp>       // for operator*
 
-#ifdef IVW_USE_OPENMP
-#include <omp.h>
-#endif
-
 namespace inviwo {
 class Deserializer;
 
@@ -196,21 +194,17 @@ void PathLinesDeprecated::process() {
     auto lines = std::make_shared<IntegralLineSet>(sampler->getModelMatrix());
     std::vector<BasicMesh::Vertex> vertices;
     for (const auto& seeds : seedPoints_) {
-
-#ifdef IVW_USE_OPENMP
-#pragma omp parallel for
-#endif
-        for (long long j = 0; j < static_cast<long long>(seeds->size()); j++) {
+        std::vector<IntegralLine> traced(seeds->size());
+        util::parallelFor(0, seeds->size(), [&](size_t j) {
             const auto& p = (*seeds)[j];
             vec4 P = m * vec4(p, 1.0f);
-            IntegralLine line = tracer.traceFrom(vec4(vec3(P), pathLineProperties_.getStartT()));
-            auto size = line.getPositions().size();
-            if (size > 1) {
-#ifdef IVW_USE_OPENMP
-#pragma omp critical
-#endif
-                lines->push_back(line, lines->size());
-            };
+            traced[j] = tracer.traceFrom(vec4(vec3(P), pathLineProperties_.getStartT()));
+        });
+        // append in seed order to keep the line indices deterministic
+        for (auto& line : traced) {
+            if (line.getPositions().size() > 1) {
+                lines->push_back(std::move(line), lines->size());
+            }
         }
     }
 
@@ -0,0 +1,70 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <modules/vectorfieldvisualization/processors/flatintegrallinestomesh.h>
+
+#include <inviwo/core/ports/meshport.h>                                           // for MeshOut...
+#include <inviwo/core/processors/processor.h>                                     // for Processor
+#include <inviwo/core/processors/processorinfo.h>                                 // for Process...
+#include <inviwo/core/processors/processorstate.h>                                // for CodeState
+#include <inviwo/core/processors/processortags.h>                                 // for Tags
+#include <inviwo/core/properties/optionproperty.h>                                // for OptionP...
+#include <modules/vectorfieldvisualization/datastructures/flatintegrallineset.h>  // for FlatInt...
+
+namespace inviwo {
+
+// The Class Identifier has to be globally unique. Use a reverse DNS naming scheme
+const ProcessorInfo FlatIntegralLinesToMesh::processorInfo_{
+    "org.inviwo.FlatIntegralLinesToMesh",  // Class identifier
+    "Flat Integral Lines To Mesh",         // Display name
+    "Integral Lines",                      // Category
+    CodeState::Experimental,               // Code state
+    Tags::CPU,                             // Tags
+};
+const ProcessorInfo& FlatIntegralLinesToMesh::getProcessorInfo() const { return processorInfo_; }
+
+FlatIntegralLinesToMesh::FlatIntegralLinesToMesh()
+    : Processor()
+    , lines_("lines")
+    , mesh_("mesh")
+    , precision_("precision", "Precision",
+                 {{"float", "Float", FlatIntegralLineSet::Precision::Float},
+                  {"double", "Double", FlatIntegralLineSet::Precision::Double}},
+                 1) {
+    addPort(lines_);
+    addPort(mesh_);
+
+    addProperty(precision_);
+}
+
+void FlatIntegralLinesToMesh::process() {
+    mesh_.setData(util::toMesh(*lines_.getData(), precision_.get()));
+}
+
+}  // namespace inviwo
@@ -32,8 +32,10 @@
 #include <inviwo/core/datastructures/coordinatetransformer.h>  // for CoordinateSpace, Coordinat...
 #include <inviwo/core/properties/boolproperty.h>               // for BoolProperty
 #include <inviwo/core/properties/compositeproperty.h>          // for CompositeProperty
+#include <inviwo/core/properties/invalidationlevel.h>          // for InvalidationLevel
 #include <inviwo/core/properties/optionproperty.h>             // for OptionProperty
 #include <inviwo/core/properties/ordinalproperty.h>            // for FloatProperty, IntProperty
+#include <inviwo/core/properties/propertysemantics.h>          // for PropertySemantics
 #include <inviwo/core/util/staticstring.h>                     // for operator+
 
 namespace inviwo {
@@ -43,6 +45,8 @@ IntegralLineProperties::IntegralLineProperties(std::string_view identifier,
     : CompositeProperty(identifier, displayName)
     , numberOfSteps_("steps", "Number of Steps", util::ordinalCount(100, 1000))
     , stepSize_("stepSize", "Step size", util::ordinalScale(0.001f, 1.0f))
+    , tolerance_("tolerance", "Tolerance", 1.0e-6, 1.0e-12, 1.0e-2, 1.0e-7,
+                 InvalidationLevel::InvalidOutput, PropertySemantics::Text)
     , normalizeSamples_("normalizeSamples", "Normalize Samples", true)
     , stepDirection_("stepDirection", "Step Direction")
     , integrationScheme_("integrationScheme", "Integration Scheme")
@@ -54,6 +58,7 @@ IntegralLineProperties::IntegralLineProperties(const IntegralLineProperties& rhs
     : CompositeProperty(rhs)
     , numberOfSteps_(rhs.numberOfSteps_)
     , stepSize_(rhs.stepSize_)
+    , tolerance_(rhs.tolerance_)
     , normalizeSamples_(rhs.normalizeSamples_)
     , stepDirection_(rhs.stepDirection_)
     , integrationScheme_(rhs.integrationScheme_)
@@ -71,6 +76,8 @@ int IntegralLineProperties::getNumberOfSteps() const { return numberOfSteps_.get
 
 float IntegralLineProperties::getStepSize() const { return stepSize_.get(); }
 
+double IntegralLineProperties::getTolerance() const { return tolerance_.get(); }
+
 IntegralLineProperties::Direction IntegralLineProperties::getStepDirection() const {
     return stepDirection_.get();
 }
@@ -95,6 +102,8 @@ void IntegralLineProperties::setUpProperties() {
                                  IntegralLineProperties::IntegrationScheme::Euler);
     integrationScheme_.addOption("rk4", "Runge-Kutta (RK4)",
                                  IntegralLineProperties::IntegrationScheme::RK4);
+    integrationScheme_.addOption("rk45", "Dormand-Prince (RK45)",
+                                 IntegralLineProperties::IntegrationScheme::RK45);
     integrationScheme_.setSelectedValue(IntegralLineProperties::IntegrationScheme::RK4);
 
     seedPointsSpace_.addOption("data", "Data", CoordinateSpace::Data);
@@ -105,9 +114,14 @@ void IntegralLineProperties::setUpProperties() {
     addProperty(stepSize_);
     addProperty(stepDirection_);
     addProperty(integrationScheme_);
+    addProperty(tolerance_);
     addProperty(seedPointsSpace_);
     addProperty(normalizeSamples_);
 
+    tolerance_.visibilityDependsOn(integrationScheme_, [](const auto& p) {
+        return p.get() == IntegralLineProperties::IntegrationScheme::RK45;
+    });
+
     setAllPropertiesCurrentStateAsDefault();
 }
 
@@ -42,6 +42,7 @@
 #include <inviwo/core/util/staticstring.h>
 #include <inviwo/core/util/stringconversion.h>
 #include <modules/base/processors/inputselector.h>
+#include <modules/vectorfieldvisualization/datastructures/flatintegrallineset.h>
 #include <modules/vectorfieldvisualization/datastructures/integrallineset.h>
 #include <modules/vectorfieldvisualization/processors/2d/seedpointgenerator2d.h>
 #include <modules/vectorfieldvisualization/processors/3d/pathlines.h>
@@ -52,6 +53,7 @@
 #include <modules/vectorfieldvisualization/processors/datageneration/seedpointgenerator.h>
 #include <modules/vectorfieldvisualization/processors/datageneration/seedpointsfrommask.h>
 #include <modules/vectorfieldvisualization/processors/discardshortlines.h>
+#include <modules/vectorfieldvisualization/processors/flatintegrallinestomesh.h>
 #include <modules/vectorfieldvisualization/processors/integrallinetracerprocessor.h>
 #include <modules/vectorfieldvisualization/processors/integrallinevectortomesh.h>
 #include <modules/vectorfieldvisualization/processors/seed3dto4d.h>
@@ -106,6 +108,7 @@ VectorFieldVisualizationModule::VectorFieldVisualizationModule(InviwoApplication
     registerProcessor<PathLines3D>();
     registerProcessor<SeedsFromMaskSequence>();
     registerProcessor<DiscardShortLines>();
+    registerProcessor<FlatIntegralLinesToMesh>();
 
     registerProcessor<SeedPointGenerator2D>();
     registerProcessor<LineSetSelector>();
@@ -115,6 +118,7 @@ VectorFieldVisualizationModule::VectorFieldVisualizationModule(InviwoApplication
     registerProperty<IntegralLineVectorToMesh::ColorByProperty>();
 
     registerDefaultsForDataType<IntegralLineSet>();
+    registerDefaultsForDataType<FlatIntegralLineSet>();
 }
 
 int VectorFieldVisualizationModule::getVersion() const { return 4; }
@@ -0,0 +1,206 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/vectorfieldvisualization/datastructures/flatintegrallineset.h>
+#include <modules/vectorfieldvisualization/datastructures/integralline.h>
+#include <modules/vectorfieldvisualization/datastructures/integrallineset.h>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferram.h>
+#include <inviwo/core/datastructures/geometry/mesh.h>
+#include <inviwo/core/util/exception.h>
+
+#include <glm/gtx/transform.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+using Reason = IntegralLine::TerminationReason;
+
+IntegralLine createLine(uint32_t index, size_t points) {
+    IntegralLine line;
+    auto& speed = line.getMetaData<double>("speed", true);
+    auto& cell = line.getMetaData<ivec2>("cell", true);
+    for (size_t i = 0; i < points; ++i) {
+        const auto t = static_cast<double>(i);
+        line.getPositions().emplace_back(t, 10.0 * index, -t);
+        speed.push_back(index + 0.5 * t);
+        cell.emplace_back(index, i);
+    }
+    line.setIndex(index);
+    line.setForwardTerminationReason(index % 2 == 0 ? Reason::Steps : Reason::OutOfBounds);
+    line.setBackwardTerminationReason(Reason::ZeroVelocity);
+    return line;
+}
+
+// Lines with 3, 1, 4 and 0 points
+IntegralLineSet createLines() {
+    IntegralLineSet lines(glm::scale(vec3{2.0f}), glm::translate(vec3{1.0f, 2.0f, 3.0f}));
+    lines.push_back(createLine(7, 3), IntegralLineSet::SetIndex::No);
+    lines.push_back(createLine(3, 1), IntegralLineSet::SetIndex::No);
+    lines.push_back(createLine(12, 4), IntegralLineSet::SetIndex::No);
+    lines.push_back(createLine(4, 0), IntegralLineSet::SetIndex::No);
+    return lines;
+}
+
+void expectEqualLines(const IntegralLine& expected, const IntegralLine& result) {
+    EXPECT_EQ(result.getIndex(), expected.getIndex());
+    EXPECT_EQ(result.getForwardTerminationReason(), expected.getForwardTerminationReason());
+    EXPECT_EQ(result.getBackwardTerminationReason(), expected.getBackwardTerminationReason());
+    EXPECT_EQ(result.getPositions(), expected.getPositions());
+    EXPECT_EQ(result.getMetaDataKeys(), expected.getMetaDataKeys());
+    EXPECT_EQ(result.getMetaData<double>("speed"), expected.getMetaData<double>("speed"));
+    EXPECT_EQ(result.getMetaData<ivec2>("cell"), expected.getMetaData<ivec2>("cell"));
+}
+
+}  // namespace
+
+TEST(FlatIntegralLineSet, Offsets) {
+    const auto lines = createLines();
+    const FlatIntegralLineSet flat(lines);
+
+    ASSERT_EQ(flat.size(), 4);
+    EXPECT_EQ(flat.getNumberOfPoints(), 8);
+    const auto offsets = flat.getOffsets();
+    EXPECT_EQ(std::vector<std::uint32_t>(offsets.begin(), offsets.end()),
+              (std::vector<std::uint32_t>{0, 3, 4, 8, 8}));
+
+    for (size_t i = 0; i < lines.size(); ++i) {
+        const auto positions = flat.getPositions(i);
+        EXPECT_EQ(std::vector<dvec3>(positions.begin(), positions.end()),
+                  lines[i].getPositions());
+        EXPECT_EQ(flat.getIndex(i), lines[i].getIndex());
+        EXPECT_EQ(flat.getForwardTerminationReason(i), lines[i].getForwardTerminationReason());
+        EXPECT_EQ(flat.getBackwardTerminationReason(i), lines[i].getBackwardTerminationReason());
+    }
+    EXPECT_EQ(flat.getModelMatrix(), lines.getModelMatrix());
+    EXPECT_EQ(flat.getWorldMatrix(), lines.getWorldMatrix());
+}
+
+TEST(FlatIntegralLineSet, MetaData) {
+    const auto lines = createLines();
+    const FlatIntegralLineSet flat(lines);
+
+    EXPECT_EQ(flat.getMetaDataKeys(), (std::vector<std::string>{"cell", "speed"}));
+    EXPECT_EQ(flat.getMetaData<double>("speed").size(), flat.getNumberOfPoints());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        const auto speed = flat.getMetaData<double>("speed", i);
+        EXPECT_EQ(std::vector<double>(speed.begin(), speed.end()),
+                  lines[i].getMetaData<double>("speed"));
+        const auto cell = flat.getMetaData<ivec2>("cell", i);
+        EXPECT_EQ(std::vector<ivec2>(cell.begin(), cell.end()),
+                  lines[i].getMetaData<ivec2>("cell"));
+    }
+
+    EXPECT_THROW(flat.getMetaData<float>("speed"), Exception);
+    EXPECT_THROW(flat.getMetaData<double>("missing"), Exception);
+
+    // Every line has to have the same meta data channels
+    auto mismatched = createLines();
+    mismatched[1].getMetaData<float>("extra", true).push_back(1.0f);
+    EXPECT_THROW(FlatIntegralLineSet{mismatched}, Exception);
+}
+
+TEST(FlatIntegralLineSet, PushBack) {
+    const auto lines = createLines();
+    const FlatIntegralLineSet flat(lines);
+
+    FlatIntegralLineSet appended(lines.getModelMatrix(), lines.getWorldMatrix());
+    for (const auto& line : lines) {
+        appended.push_back(line);
+    }
+    EXPECT_EQ(appended.size(), flat.size());
+    EXPECT_EQ(appended.getNumberOfPoints(), flat.getNumberOfPoints());
+    for (size_t i = 0; i < flat.size(); ++i) {
+        expectEqualLines(flat.getLine(i), appended.getLine(i));
+    }
+
+    auto other = createLine(1, 2);
+    other.getMetaData<float>("extra", true).assign(2, 1.0f);
+    EXPECT_THROW(appended.push_back(other), Exception);
+}
+
+TEST(FlatIntegralLineSet, RoundTrip) {
+    const auto lines = createLines();
+    const auto result = FlatIntegralLineSet(lines).toIntegralLineSet();
+
+    EXPECT_EQ(result.getModelMatrix(), lines.getModelMatrix());
+    EXPECT_EQ(result.getWorldMatrix(), lines.getWorldMatrix());
+    ASSERT_EQ(result.size(), lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        expectEqualLines(lines[i], result[i]);
+    }
+}
+
+TEST(FlatIntegralLineSet, ToMesh) {
+    const FlatIntegralLineSet flat(createLines());
+
+    const auto mesh = util::toMesh(flat);
+    EXPECT_EQ(mesh->getModelMatrix(), flat.getModelMatrix());
+    EXPECT_EQ(mesh->getWorldMatrix(), flat.getWorldMatrix());
+
+    // The positions and then the meta data channels in key order
+    ASSERT_EQ(mesh->getNumberOfBuffers(), 3);
+    EXPECT_EQ(mesh->getBufferInfo(0).type, BufferType::PositionAttrib);
+    EXPECT_EQ(mesh->getBuffer(0)->getDataFormat(), DataVec3Float64::get());
+    EXPECT_EQ(mesh->getBufferInfo(1).location, FlatIntegralLineSet::metaDataLocation);
+    EXPECT_EQ(mesh->getBuffer(1)->getDataFormat(), DataVec2Int32::get());
+    EXPECT_EQ(mesh->getBufferInfo(2).location, FlatIntegralLineSet::metaDataLocation + 1);
+    EXPECT_EQ(mesh->getBuffer(2)->getDataFormat(), DataFloat64::get());
+
+    const auto& positions = static_cast<const Buffer<dvec3>*>(mesh->getBuffer(0))
+                                ->getRAMRepresentation()
+                                ->getDataContainer();
+    const auto flatPositions = flat.getPositions();
+    EXPECT_EQ(positions, std::vector<dvec3>(flatPositions.begin(), flatPositions.end()));
+
+    // Line segments within each line, the line with a single point and the empty line are skipped
+    ASSERT_EQ(mesh->getNumberOfIndicies(), 1);
+    EXPECT_EQ(mesh->getIndexMeshInfo(0).dt, DrawType::Lines);
+    EXPECT_EQ(mesh->getIndices(0)->getRAMRepresentation()->getDataContainer(),
+              (std::vector<std::uint32_t>{0, 1, 1, 2, 4, 5, 5, 6, 6, 7}));
+
+    const auto single = util::toMesh(flat, FlatIntegralLineSet::Precision::Float, 3);
+    EXPECT_EQ(single->getBuffer(0)->getDataFormat(), DataVec3Float32::get());
+    EXPECT_EQ(single->getBuffer(1)->getDataFormat(), DataVec2Int32::get());
+    EXPECT_EQ(single->getBuffer(2)->getDataFormat(), DataFloat32::get());
+    EXPECT_EQ(single->getBufferInfo(1).location, 3);
+    EXPECT_EQ(single->getBufferInfo(2).location, 4);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,291 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <modules/vectorfieldvisualization/integrallinetracer.h>
+#include <modules/vectorfieldvisualization/processors/integrallinetracerprocessor.h>
+#include <modules/vectorfieldvisualization/properties/integrallineproperties.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/util/spatialsampler.h>
+
+#include <glm/gtc/constants.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+/**
+ * An analytic vector field over the unit cube, counting the number of samples
+ */
+class FunctionSampler : public SpatialSampler<dvec3> {
+public:
+    FunctionSampler(std::function<dvec3(const dvec3&)> field)
+        : SpatialSampler<dvec3>(*entity()), field_{std::move(field)} {}
+
+    size_t getNumberOfSamples() const { return samples_; }
+
+protected:
+    virtual dvec3 sampleDataSpace(const dvec3& pos) const override {
+        ++samples_;
+        return field_(pos);
+    }
+    virtual bool withinBoundsDataSpace(const dvec3& pos) const override {
+        return glm::all(glm::greaterThanEqual(pos, dvec3{0.0})) &&
+               glm::all(glm::lessThanEqual(pos, dvec3{1.0}));
+    }
+
+private:
+    // Data space and model space coincide
+    static std::shared_ptr<const Volume> entity() {
+        static const auto volume = [] {
+            auto v = std::make_shared<Volume>(size3_t{2});
+            v->setModelMatrix(mat4{1.0f});
+            return v;
+        }();
+        return volume;
+    }
+
+    std::function<dvec3(const dvec3&)> field_;
+    mutable std::atomic<size_t> samples_{0};
+};
+
+// A rotation around the center of the cube with angular velocity one, the orbits are circles in
+// the z-planes with a period of 2 pi
+dvec3 circular(const dvec3& p) { return {0.5 - p.y, p.x - 0.5, 0.0}; }
+
+constexpr int orbitSteps = 200;
+constexpr double radius = 0.25;
+const dvec3 center{0.5};
+
+IntegralLineProperties properties(IntegralLineProperties::IntegrationScheme scheme,
+                                  IntegralLineProperties::Direction direction, int steps,
+                                  float stepSize) {
+    IntegralLineProperties props("properties", "Properties");
+    props.integrationScheme_.setSelectedValue(scheme);
+    props.stepDirection_.setSelectedValue(direction);
+    props.numberOfSteps_.set(steps);
+    props.stepSize_.set(stepSize);
+    props.tolerance_.set(1.0e-9);
+    props.normalizeSamples_.set(false);
+    return props;
+}
+
+IntegralLine traceOrbit(IntegralLineProperties::IntegrationScheme scheme,
+                        IntegralLineProperties::Direction direction, size_t* samples = nullptr) {
+    auto sampler = std::make_shared<FunctionSampler>(circular);
+    const auto stepSize = static_cast<float>(glm::two_pi<double>() / orbitSteps);
+    const StreamLine3DTracer tracer(sampler, properties(scheme, direction, orbitSteps, stepSize));
+    auto line = tracer.traceFrom(center + dvec3{radius, 0.0, 0.0}).line;
+    if (samples) *samples = sampler->getNumberOfSamples();
+    return line;
+}
+
+}  // namespace
+
+TEST(IntegralLineTracer, RK45CircularOrbit) {
+    using Scheme = IntegralLineProperties::IntegrationScheme;
+    const auto line = traceOrbit(Scheme::RK45, IntegralLineProperties::Direction::Forward);
+
+    EXPECT_EQ(line.getForwardTerminationReason(), IntegralLine::TerminationReason::Steps);
+    EXPECT_EQ(line.getBackwardTerminationReason(), IntegralLine::TerminationReason::StartPoint);
+
+    // The seed and one point per step, each one step size further along the orbit
+    const auto& positions = line.getPositions();
+    ASSERT_EQ(positions.size(), orbitSteps + 2);
+    const auto stepSize =
+        static_cast<double>(static_cast<float>(glm::two_pi<double>() / orbitSteps));
+    for (size_t i = 0; i < positions.size(); ++i) {
+        const auto angle = static_cast<double>(i) * stepSize;
+        const dvec3 expected = center + radius * dvec3{std::cos(angle), std::sin(angle), 0.0};
+        EXPECT_NEAR(glm::distance(positions[i], expected), 0.0, 1.0e-6) << "point " << i;
+    }
+
+    // The orbit closes after one period
+    EXPECT_NEAR(glm::distance(positions[orbitSteps], positions.front()), 0.0, 1.0e-6);
+}
+
+TEST(IntegralLineTracer, RK45Backward) {
+    using Scheme = IntegralLineProperties::IntegrationScheme;
+    const auto line = traceOrbit(Scheme::RK45, IntegralLineProperties::Direction::Backward);
+
+    EXPECT_EQ(line.getForwardTerminationReason(), IntegralLine::TerminationReason::StartPoint);
+    EXPECT_EQ(line.getBackwardTerminationReason(), IntegralLine::TerminationReason::Steps);
+
+    // The line ends at the seed, and the backward orbit closes as well
+    const auto& positions = line.getPositions();
+    ASSERT_EQ(positions.size(), orbitSteps + 2);
+    EXPECT_EQ(positions.back(), center + dvec3{radius, 0.0, 0.0});
+    EXPECT_NEAR(glm::distance(positions[1], positions.back()), 0.0, 1.0e-6);
+    // Going backwards in time the orbit is clockwise
+    EXPECT_LT(positions[orbitSteps].y, center.y);
+}
+
+TEST(IntegralLineTracer, RK45MatchesRK4WithFewerSamples) {
+    using Scheme = IntegralLineProperties::IntegrationScheme;
+    size_t rk4Samples = 0;
+    size_t rk45Samples = 0;
+    const auto rk4 =
+        traceOrbit(Scheme::RK4, IntegralLineProperties::Direction::Forward, &rk4Samples);
+    const auto rk45 =
+        traceOrbit(Scheme::RK45, IntegralLineProperties::Direction::Forward, &rk45Samples);
+
+    ASSERT_EQ(rk4.getPositions().size(), rk45.getPositions().size());
+    for (size_t i = 0; i < rk4.getPositions().size(); ++i) {
+        EXPECT_NEAR(glm::distance(rk4.getPositions()[i], rk45.getPositions()[i]), 0.0, 1.0e-6)
+            << "point " << i;
+    }
+    // The adaptive steps are longer than the point spacing for this smooth field
+    EXPECT_LT(rk45Samples, rk4Samples);
+}
+
+TEST(IntegralLineTracer, RK45OutOfBounds) {
+    using Scheme = IntegralLineProperties::IntegrationScheme;
+    auto sampler = std::make_shared<FunctionSampler>([](const dvec3&) { return dvec3{1, 0, 0}; });
+    const float stepSize = 0.01f;
+    const StreamLine3DTracer tracer(
+        sampler, properties(Scheme::RK45, IntegralLineProperties::Direction::Forward, 200,
+                            stepSize));
+    const auto line = tracer.traceFrom(dvec3{0.5}).line;
+
+    EXPECT_EQ(line.getForwardTerminationReason(), IntegralLine::TerminationReason::OutOfBounds);
+    const auto& positions = line.getPositions();
+    // The boundary is 50 steps away, the last points are placed within a few steps from it
+    EXPECT_LE(positions.size(), 52);
+    ASSERT_GE(positions.size(), 45);
+    EXPECT_LE(positions.back().x, 1.0);
+    EXPECT_GT(positions.back().x, 1.0 - 4.0 * stepSize);
+    for (size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_NEAR(positions[i].x, 0.5 + static_cast<double>(i) * stepSize, 1.0e-9);
+    }
+}
+
+TEST(IntegralLineTracer, RK45ZeroVelocity) {
+    using Scheme = IntegralLineProperties::IntegrationScheme;
+    auto sampler = std::make_shared<FunctionSampler>(circular);
+    const StreamLine3DTracer tracer(
+        sampler, properties(Scheme::RK45, IntegralLineProperties::Direction::Bidirectional, 100,
+                            0.01f));
+
+    // The center is a critical point, no line is traced from it
+    EXPECT_TRUE(tracer.traceFrom(center).line.getPositions().empty());
+}
+
+TEST(IntegralLineTracer, ParallelTraceIsDeterministic) {
+    using Scheme = IntegralLineProperties::IntegrationScheme;
+    using Seeds = StreamLines3D::Seeds;
+
+    auto sampler = std::make_shared<FunctionSampler>(circular);
+    const StreamLine3DTracer tracer(
+        sampler, properties(Scheme::RK4, IntegralLineProperties::Direction::Bidirectional, 40,
+                            0.05f));
+
+    // Several seed vectors spanning many blocks. Seeds at the center and outside of the domain
+    // give no line, hence the line indices are not consecutive.
+    std::vector<std::shared_ptr<const Seeds>> seeds;
+    for (size_t n : {300, 1, 0, 700}) {
+        auto vector = std::make_shared<Seeds>();
+        for (size_t i = 0; i < n; ++i) {
+            const auto t = static_cast<float>(i) / static_cast<float>(n);
+            switch (i % 7) {
+                case 0:
+                    vector->emplace_back(0.5f);
+                    break;
+                case 3:
+                    vector->emplace_back(1.5f, t, 0.5f);
+                    break;
+                default:
+                    vector->emplace_back(0.5f + 0.4f * t, 0.5f, t);
+            }
+        }
+        seeds.push_back(std::move(vector));
+    }
+    std::vector<vec3> allSeeds;
+    for (const auto& vector : seeds) {
+        allSeeds.insert(allSeeds.end(), vector->begin(), vector->end());
+    }
+
+    const auto trace = [&]() {
+        std::mutex mutex;
+        std::vector<size_t> reported;
+        auto lines = StreamLines3D::trace(tracer, seeds, mat4{1.0f}, mat4{1.0f}, false,
+                                          [&](size_t traced, size_t total) {
+                                              const std::scoped_lock lock{mutex};
+                                              EXPECT_EQ(total, allSeeds.size());
+                                              reported.push_back(traced);
+                                          });
+        EXPECT_FALSE(reported.empty());
+        EXPECT_TRUE(std::is_sorted(reported.begin(), reported.end()));
+        EXPECT_LE(reported.back(), allSeeds.size());
+        return lines;
+    };
+
+    auto& app = *InviwoApplication::getPtr();
+    const auto poolSize = app.getPoolSize();
+    app.resizePool(0);
+    const auto serial = trace();
+    app.resizePool(4);
+    const auto parallel = trace();
+    app.resizePool(poolSize);
+
+    ASSERT_TRUE(serial);
+    ASSERT_TRUE(parallel);
+    ASSERT_EQ(parallel->size(), serial->size());
+    EXPECT_LT(serial->size(), allSeeds.size());
+    for (size_t i = 0; i < serial->size(); ++i) {
+        const auto& line = (*parallel)[i];
+        EXPECT_EQ(line.getIndex(), (*serial)[i].getIndex());
+        EXPECT_EQ(line.getPositions(), (*serial)[i].getPositions());
+        if (i > 0) {
+            EXPECT_LT((*parallel)[i - 1].getIndex(), line.getIndex());
+        }
+        // The lines are the ones traced from the seeds of their indices
+        const auto expected = tracer.traceFrom(allSeeds[line.getIndex()]).line;
+        EXPECT_EQ(line.getPositions(), expected.getPositions());
+    }
+
+    // A stopped trace has no result
+    EXPECT_FALSE(StreamLines3D::trace(tracer, seeds, mat4{1.0f}, mat4{1.0f}, true,
+                                      [](size_t, size_t) {}));
+}
+
+}  // namespace inviwo
@@ -35,9 +35,11 @@
 #include <inviwo/core/processors/poolprocessor.h>              // for PoolProcessor
 #include <inviwo/core/processors/processorinfo.h>              // for ProcessorInfo
 #include <inviwo/core/properties/boolproperty.h>               // for BoolProperty
+#include <inviwo/core/properties/optionproperty.h>             // for OptionProperty
 #include <inviwo/core/properties/ordinalproperty.h>            // for OrdinalProperty
 #include <inviwo/dataframe/datastructures/dataframe.h>         // for DataFrameInport
 #include <inviwo/dataframe/properties/columnoptionproperty.h>  // for ColumnOptionProperty
+#include <modules/base/algorithm/volume/volumevoronoi.h>       // for VoronoiMethod
 
 namespace inviwo {
 
@@ -56,6 +58,7 @@ private:
     DataFrameInport dataFrame_;
     VolumeOutport outport_;
     BoolProperty weighted_;
+    OptionProperty<util::VoronoiMethod> method_;
 
     ColumnOptionProperty iCol_;
     IntProperty indexOffset_;
@@ -60,6 +60,13 @@ VolumeVoronoiSegmentation::VolumeVoronoiSegmentation()
         Voronoi algorithm)"_unindentHelp)
     , weighted_("weighted", "Weighted voronoi", "Use the weighted version of voronoi or not."_help,
                 false)
+    , method_{"method",
+              "Method",
+              "Brute force compares every voxel to every seed point. Hierarchical culls seed "
+              "points per block of voxels and is much faster for many seed points, with "
+              "identical results"_help,
+              {{"hierarchical", "Hierarchical", util::VoronoiMethod::Hierarchical},
+               {"bruteForce", "Brute Force", util::VoronoiMethod::BruteForce}}}
     , iCol_{"iCol", "Segment Index Column", dataFrame_, ColumnOptionProperty::AddNoneOption::No, 0}
     , indexOffset_{"indexOffset",
                    "Index Offset",
@@ -75,7 +82,7 @@ VolumeVoronoiSegmentation::VolumeVoronoiSegmentation()
     addPort(dataFrame_);
     addPort(outport_);
 
-    addProperties(weighted_, iCol_, indexOffset_, xCol_, yCol_, zCol_, wCol_);
+    addProperties(weighted_, method_, iCol_, indexOffset_, xCol_, yCol_, zCol_, wCol_);
 }
 
 namespace {
@@ -93,7 +100,8 @@ constexpr auto copyColumn = [](const Column& col, auto& dstContainer, auto assig
 void VolumeVoronoiSegmentation::process() {
     auto calc = [dataFrame = dataFrame_.getData(), volume = volume_.getData(), iCol = iCol_.get(),
                  xCol = xCol_.get(), yCol = yCol_.get(), zCol = zCol_.get(), wCol = wCol_.get(),
-                 weighted = weighted_.get(), offset = indexOffset_.get()]() {
+                 weighted = weighted_.get(), offset = indexOffset_.get(),
+                 method = method_.get()]() {
         if (iCol < 0 || static_cast<size_t>(iCol) >= dataFrame->getNumberOfColumns()) {
             throw Exception("Missing column");
         }
@@ -127,7 +135,7 @@ void VolumeVoronoiSegmentation::process() {
         const auto voronoiVolume = util::voronoiSegmentation(
             volume->getDimensions(), volume->getCoordinateTransformer().getIndexToDataMatrix(),
             volume->getCoordinateTransformer().getDataToModelMatrix(), seedPointsWithIndices,
-            volume->getWrapping(), radii);
+            volume->getWrapping(), radii, method);
 
         voronoiVolume->setModelMatrix(volume->getModelMatrix());
         voronoiVolume->setWorldMatrix(volume->getWorldMatrix());
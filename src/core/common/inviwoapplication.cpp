@@ -172,6 +172,14 @@ InviwoApplication::InviwoApplication(int argc, char** argv, std::string_view dis
         systemSettings_->poolSize_.onChange([this]() { resizePool(systemSettings_->poolSize_); });
     }
 
+    const auto updateEvaluationMode = [this]() {
+        processorNetworkEvaluator_->setEvaluationMode(systemSettings_->parallelEvaluation_
+                                                          ? EvaluationMode::Parallel
+                                                          : EvaluationMode::Sequential);
+    };
+    updateEvaluationMode();
+    systemSettings_->parallelEvaluation_.onChange(updateEvaluationMode);
+
     // initialize singletons
     init(this);
     RenderContext::init();
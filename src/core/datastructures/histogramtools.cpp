@@ -29,27 +29,57 @@
 
 #include <inviwo/core/datastructures/histogramtools.h>
 #include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/resourcemanager/resource.h>
 #include <inviwo/core/util/zip.h>
 
 #include <utility>
 
 namespace inviwo {
 
+HistogramCache::State::~State() { resource::removeEvictable(resource::toRAM(this)); }
+
+void HistogramCache::makeEvictable(const std::shared_ptr<State>& cache) {
+    size_t bytes = 0;
+    {
+        const std::scoped_lock lock{cache->mutex};
+        if (cache->status != Status::Valid) return;
+        for (const auto& histogram : cache->histograms) {
+            bytes += sizeof(Histogram1D) + histogram.counts.size() * sizeof(size_t);
+        }
+    }
+
+    resource::addEvictable(resource::toRAM(cache.get()), bytes,
+                           [weakState = std::weak_ptr<State>(cache)]() {
+                               if (auto state = weakState.lock()) {
+                                   const std::scoped_lock lock{state->mutex};
+                                   if (state->status != Status::Valid) return;
+                                   state->histograms.clear();
+                                   state->status = Status::NotSet;
+                               }
+                           });
+}
+
 HistogramCache::HistogramCache() : state_{std::make_shared<State>()} {}
 HistogramCache::HistogramCache(const HistogramCache& rhs) : state_{std::make_shared<State>()} {
-    const std::scoped_lock lock{rhs.state_->mutex};
-    state_->histograms = rhs.state_->histograms;
-    state_->callbacks = rhs.state_->callbacks;
-    state_->status = rhs.state_->status;
+    {
+        const std::scoped_lock lock{rhs.state_->mutex};
+        state_->histograms = rhs.state_->histograms;
+        state_->callbacks = rhs.state_->callbacks;
+        state_->status = rhs.state_->status;
+    }
+    makeEvictable(state_);
 }
 HistogramCache::HistogramCache(HistogramCache&& rhs) noexcept : state_{std::move(rhs.state_)} {}
 HistogramCache& HistogramCache::operator=(const HistogramCache& that) {
     if (this != &that) {
         state_ = std::make_shared<State>();
-        const std::scoped_lock lock{that.state_->mutex};
-        state_->histograms = that.state_->histograms;
-        state_->callbacks = that.state_->callbacks;
-        state_->status = that.state_->status;
+        {
+            const std::scoped_lock lock{that.state_->mutex};
+            state_->histograms = that.state_->histograms;
+            state_->callbacks = that.state_->callbacks;
+            state_->status = that.state_->status;
+        }
+        makeEvictable(state_);
     }
     return *this;
 }
@@ -63,6 +93,7 @@ HistogramCache& HistogramCache::operator=(HistogramCache&& that) noexcept {
 auto HistogramCache::calculateHistograms(
     const std::function<std::vector<Histogram1D>()>& calculate,
     const std::function<void(const std::vector<Histogram1D>&)>& whenDone) const -> Result {
+    resource::useEvictable(resource::toRAM(state_.get()));
     const std::scoped_lock lock{state_->mutex};
 
     Result result;
@@ -84,10 +115,13 @@ auto HistogramCache::calculateHistograms(
                 dispatchFrontAndForget([weakState = std::weak_ptr<State>(state),
                                         newHistograms = std::move(newHistograms)]() mutable {
                     if (auto state = weakState.lock()) {
-                        const std::scoped_lock lock{state->mutex};
-                        state->histograms = std::move(newHistograms);
-                        state->status = Status::Valid;
-                        state->callbacks.invoke(state->histograms);
+                        {
+                            const std::scoped_lock lock{state->mutex};
+                            state->histograms = std::move(newHistograms);
+                            state->status = Status::Valid;
+                            state->callbacks.invoke(state->histograms);
+                        }
+                        makeEvictable(state);
                     }
                 });
             }
@@ -34,6 +34,7 @@
 #include <inviwo/core/datastructures/volume/volume.h>
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
 #include <inviwo/core/datastructures/volume/volumeramconverter.h>
+#include <inviwo/core/datastructures/volume/volumebrickedconverter.h>
 #include <inviwo/core/datastructures/image/layerramprecision.h>
 #include <inviwo/core/datastructures/image/layerramconverter.h>
 #include <inviwo/core/datastructures/buffer/bufferramprecision.h>
@@ -136,6 +137,12 @@ void registerCoreRepresentationsHelper(T& obj) {
     // Register Converters
     obj.template registerRepresentationConverter<VolumeRepresentation>(
         std::make_unique<VolumeDisk2RAMConverter>());
+    obj.template registerRepresentationConverter<VolumeRepresentation>(
+        std::make_unique<VolumeDisk2BrickedConverter>());
+    obj.template registerRepresentationConverter<VolumeRepresentation>(
+        std::make_unique<VolumeRAM2BrickedConverter>());
+    obj.template registerRepresentationConverter<VolumeRepresentation>(
+        std::make_unique<VolumeBricked2RAMConverter>());
     obj.template registerRepresentationConverter<LayerRepresentation>(
         std::make_unique<LayerDisk2RAMConverter>());
 }
@@ -0,0 +1,167 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/volume/brickcache.h>
+
+#include <inviwo/core/datastructures/volume/volumeram.h>
+
+#include <atomic>
+#include <exception>
+
+namespace inviwo {
+
+size_t BrickCache::KeyHash::operator()(const Key& key) const {
+    return std::hash<size_t>{}(key.source * 0x9E3779B97F4A7C15ull ^ key.brick);
+}
+
+BrickCache::BrickCache(size_t budget) : budget_{budget}, size_{0} {}
+
+BrickCache::~BrickCache() = default;
+
+std::shared_ptr<const VolumeRAM> BrickCache::get(const Key& key, const Loader& load) {
+    std::promise<std::shared_ptr<const VolumeRAM>> promise;
+    {
+        std::unique_lock lock{mutex_};
+        if (auto it = entries_.find(key); it != entries_.end()) {
+            lru_.splice(lru_.begin(), lru_, it->second);
+            return it->second->brick;
+        }
+        if (auto it = loading_.find(key); it != loading_.end()) {
+            auto future = it->second;
+            lock.unlock();
+            return future.get();
+        }
+        loading_.emplace(key, promise.get_future().share());
+    }
+
+    std::shared_ptr<const VolumeRAM> brick;
+    try {
+        brick = load();
+    } catch (...) {
+        {
+            std::scoped_lock lock{mutex_};
+            loading_.erase(key);
+        }
+        promise.set_exception(std::current_exception());
+        throw;
+    }
+
+    {
+        std::scoped_lock lock{mutex_};
+        loading_.erase(key);
+        insert(key, brick);
+    }
+    promise.set_value(brick);
+    return brick;
+}
+
+std::shared_ptr<const VolumeRAM> BrickCache::find(const Key& key) {
+    std::scoped_lock lock{mutex_};
+    if (auto it = entries_.find(key); it != entries_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second);
+        return it->second->brick;
+    }
+    return nullptr;
+}
+
+bool BrickCache::contains(const Key& key) const {
+    std::scoped_lock lock{mutex_};
+    return entries_.contains(key);
+}
+
+void BrickCache::erase(size_t source) {
+    std::scoped_lock lock{mutex_};
+    for (auto it = lru_.begin(); it != lru_.end();) {
+        if (it->key.source == source) {
+            size_ -= it->bytes;
+            entries_.erase(it->key);
+            it = lru_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void BrickCache::clear() {
+    std::scoped_lock lock{mutex_};
+    entries_.clear();
+    lru_.clear();
+    size_ = 0;
+}
+
+void BrickCache::setBudget(size_t bytes) {
+    std::scoped_lock lock{mutex_};
+    budget_ = bytes;
+    evict();
+}
+
+size_t BrickCache::getBudget() const {
+    std::scoped_lock lock{mutex_};
+    return budget_;
+}
+
+size_t BrickCache::getSize() const {
+    std::scoped_lock lock{mutex_};
+    return size_;
+}
+
+size_t BrickCache::getNumberOfBricks() const {
+    std::scoped_lock lock{mutex_};
+    return entries_.size();
+}
+
+std::shared_ptr<BrickCache> BrickCache::getDefault() {
+    static const auto cache = std::make_shared<BrickCache>();
+    return cache;
+}
+
+size_t BrickCache::newSource() {
+    static std::atomic<size_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed);
+}
+
+void BrickCache::insert(const Key& key, std::shared_ptr<const VolumeRAM> brick) {
+    if (!brick) return;
+    const auto bytes = brick->getNumberOfBytes();
+    lru_.push_front(Entry{key, std::move(brick), bytes});
+    entries_[key] = lru_.begin();
+    size_ += bytes;
+    evict();
+}
+
+void BrickCache::evict() {
+    while (size_ > budget_ && !lru_.empty()) {
+        const auto& entry = lru_.back();
+        size_ -= entry.bytes;
+        entries_.erase(entry.key);
+        lru_.pop_back();
+    }
+}
+
+}  // namespace inviwo
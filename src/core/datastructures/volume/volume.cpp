@@ -49,7 +49,8 @@ Volume::Volume(size3_t defaultDimensions, const DataFormatBase* defaultFormat,
     , defaultSwizzleMask_{defaultSwizzleMask}
     , defaultInterpolation_{interpolation}
     , defaultWrapping_{wrapping}
-    , histograms_{} {}
+    , histograms_{}
+    , pyramid_{} {}
 
 Volume::Volume(const VolumeConfig& config)
     : Data<Volume, VolumeRepresentation>{}
@@ -65,7 +66,8 @@ Volume::Volume(const VolumeConfig& config)
     , defaultSwizzleMask_{config.swizzleMask.value_or(VolumeConfig::defaultSwizzleMask)}
     , defaultInterpolation_{config.interpolation.value_or(VolumeConfig::defaultInterpolation)}
     , defaultWrapping_{config.wrapping.value_or(VolumeConfig::defaultWrapping)}
-    , histograms_{} {}
+    , histograms_{}
+    , pyramid_{} {}
 
 Volume::Volume(std::shared_ptr<VolumeRepresentation> in)
     : Data<Volume, VolumeRepresentation>{}
@@ -78,7 +80,8 @@ Volume::Volume(std::shared_ptr<VolumeRepresentation> in)
     , defaultSwizzleMask_{in->getSwizzleMask()}
     , defaultInterpolation_{in->getInterpolation()}
     , defaultWrapping_{in->getWrapping()}
-    , histograms_{} {
+    , histograms_{}
+    , pyramid_{} {
 
     addRepresentation(std::move(in));
 }
@@ -96,12 +99,51 @@ Volume::Volume(const Volume& rhs, NoData, const VolumeConfig& config)
     , defaultSwizzleMask_{config.swizzleMask.value_or(rhs.getSwizzleMask())}
     , defaultInterpolation_{config.interpolation.value_or(rhs.getInterpolation())}
     , defaultWrapping_{config.wrapping.value_or(rhs.getWrapping())}
-    , histograms_{} {}
+    , histograms_{}
+    , pyramid_{} {}
+
+Volume::Volume(const Volume& rhs)
+    : Data<Volume, VolumeRepresentation>{rhs}
+    , StructuredGridEntity<3>{rhs}
+    , MetaDataOwner{rhs}
+    , dataMap{rhs.dataMap}
+    , axes{rhs.axes}
+    , defaultDimensions_{rhs.defaultDimensions_}
+    , defaultDataFormat_{rhs.defaultDataFormat_}
+    , defaultSwizzleMask_{rhs.defaultSwizzleMask_}
+    , defaultInterpolation_{rhs.defaultInterpolation_}
+    , defaultWrapping_{rhs.defaultWrapping_}
+    , histograms_{rhs.histograms_}
+    , pyramid_{} {}
+
+Volume& Volume::operator=(const Volume& that) {
+    if (this != &that) {
+        Data<Volume, VolumeRepresentation>::operator=(that);
+        StructuredGridEntity<3>::operator=(that);
+        MetaDataOwner::operator=(that);
+        dataMap = that.dataMap;
+        axes = that.axes;
+        defaultDimensions_ = that.defaultDimensions_;
+        defaultDataFormat_ = that.defaultDataFormat_;
+        defaultSwizzleMask_ = that.defaultSwizzleMask_;
+        defaultInterpolation_ = that.defaultInterpolation_;
+        defaultWrapping_ = that.defaultWrapping_;
+        histograms_ = that.histograms_;
+        pyramid_ = VolumePyramid{};
+    }
+    return *this;
+}
 
 Volume* Volume::clone() const { return new Volume(*this); }
 Volume::~Volume() = default;
 
+void Volume::invalidateAllOther(const VolumeRepresentation* repr) {
+    pyramid_.clear();
+    Data<Volume, VolumeRepresentation>::invalidateAllOther(repr);
+}
+
 void Volume::setDimensions(const size3_t& dim) {
+    pyramid_.clear();
     defaultDimensions_ = dim;
     setLastAndInvalidateOther(&VolumeRepresentation::setDimensions, dim);
 }
@@ -257,6 +299,17 @@ HistogramCache::Result Volume::calculateHistograms(
     return histograms_.calculateHistograms(histCalc(*this), whenDone);
 }
 
+VolumePyramid::Result Volume::calculatePyramid(
+    const std::function<VolumePyramid::Callback>& whenLevelDone) const {
+    return pyramid_.request(*this, whenLevelDone);
+}
+
+const VolumePyramid& Volume::getPyramid() const { return pyramid_; }
+
+VolumePyramid& Volume::getPyramid() { return pyramid_; }
+
+void Volume::discardPyramid() { pyramid_.discard(*this); }
+
 template class IVW_CORE_TMPL_INST DataReaderType<Volume>;
 template class IVW_CORE_TMPL_INST DataWriterType<Volume>;
 template class IVW_CORE_TMPL_INST DataReaderType<VolumeSequence>;
@@ -0,0 +1,255 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <cstring>
+
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+VolumeRAMBrickSource::VolumeRAMBrickSource(std::shared_ptr<const VolumeRAM> volume)
+    : volume_{std::move(volume)} {
+    if (!volume_) throw NullPointerException("VolumeRAMBrickSource requires a volume");
+}
+
+const size3_t& VolumeRAMBrickSource::getDimensions() const { return volume_->getDimensions(); }
+
+const DataFormatBase* VolumeRAMBrickSource::getDataFormat() const {
+    return volume_->getDataFormat();
+}
+
+std::shared_ptr<VolumeRAM> VolumeRAMBrickSource::load(size3_t offset, size3_t dims) const {
+    auto brick = createVolumeRAM(dims, volume_->getDataFormat());
+    util::copyVoxels(volume_->getData(), volume_->getDimensions(), offset, brick->getData(), dims,
+                     size3_t{0}, dims, volume_->getDataFormat()->getSizeInBytes());
+    return brick;
+}
+
+/**
+ * State shared between copies of a VolumeBricked. Since the source is read only the copies can
+ * also share the cached bricks, which are released once the last copy is gone.
+ */
+struct VolumeBricked::Bricks {
+    Bricks(std::shared_ptr<const VolumeBrickSource> aSource, std::shared_ptr<BrickCache> aCache)
+        : id{BrickCache::newSource()}, source{std::move(aSource)}, cache{std::move(aCache)} {}
+    Bricks(const Bricks&) = delete;
+    Bricks& operator=(const Bricks&) = delete;
+    ~Bricks() { cache->erase(id); }
+
+    size_t id;
+    std::shared_ptr<const VolumeBrickSource> source;
+    std::shared_ptr<BrickCache> cache;
+};
+
+VolumeBricked::VolumeBricked(std::shared_ptr<const VolumeBrickSource> source, size3_t brickSize,
+                             const SwizzleMask& swizzleMask, InterpolationType interpolation,
+                             const Wrapping3D& wrapping, std::shared_ptr<BrickCache> cache)
+    : VolumeRepresentation{}
+    , bricks_{}
+    , dimensions_{source ? source->getDimensions() : size3_t{0}}
+    , brickSize_{glm::max(brickSize, size3_t{1})}
+    , brickCount_{(dimensions_ + brickSize_ - size3_t{1}) / brickSize_}
+    , swizzleMask_{swizzleMask}
+    , interpolation_{interpolation}
+    , wrapping_{wrapping} {
+    if (!source) throw NullPointerException("VolumeBricked requires a brick source");
+    bricks_ = std::make_shared<const Bricks>(std::move(source),
+                                             cache ? std::move(cache) : BrickCache::getDefault());
+}
+
+VolumeBricked* VolumeBricked::clone() const { return new VolumeBricked(*this); }
+
+std::type_index VolumeBricked::getTypeIndex() const {
+    return std::type_index(typeid(VolumeBricked));
+}
+
+const DataFormatBase* VolumeBricked::getDataFormat() const {
+    return bricks_->source->getDataFormat();
+}
+
+void VolumeBricked::setDimensions(size3_t) {
+    throw Exception("Can not set dimension of a Volume Bricked");
+}
+
+const size3_t& VolumeBricked::getDimensions() const { return dimensions_; }
+
+void VolumeBricked::setSwizzleMask(const SwizzleMask& mask) { swizzleMask_ = mask; }
+
+SwizzleMask VolumeBricked::getSwizzleMask() const { return swizzleMask_; }
+
+void VolumeBricked::setInterpolation(InterpolationType interpolation) {
+    interpolation_ = interpolation;
+}
+
+InterpolationType VolumeBricked::getInterpolation() const { return interpolation_; }
+
+void VolumeBricked::setWrapping(const Wrapping3D& wrapping) { wrapping_ = wrapping; }
+
+Wrapping3D VolumeBricked::getWrapping() const { return wrapping_; }
+
+size3_t VolumeBricked::getBrickDimensions(const size3_t& brick) const {
+    const auto offset = getBrickOffset(brick);
+    return glm::min(brickSize_, dimensions_ - glm::min(offset, dimensions_));
+}
+
+bool VolumeBricked::isResident(const size3_t& brick) const {
+    const auto index = brick.x + brickCount_.x * (brick.y + brickCount_.y * brick.z);
+    return bricks_->cache->contains({bricks_->id, index});
+}
+
+std::shared_ptr<const VolumeRAM> VolumeBricked::getBrickData(const size3_t& brick) const {
+    if (glm::any(glm::greaterThanEqual(brick, brickCount_))) {
+        throw RangeException(SourceContext{}, "Brick ({}, {}, {}) outside of brick grid", brick.x,
+                             brick.y, brick.z);
+    }
+    const auto index = brick.x + brickCount_.x * (brick.y + brickCount_.y * brick.z);
+    return bricks_->cache->get({bricks_->id, index}, [&]() -> std::shared_ptr<const VolumeRAM> {
+        return bricks_->source->load(getBrickOffset(brick), getBrickDimensions(brick));
+    });
+}
+
+void VolumeBricked::prefetch(const size3_t& offset, const size3_t& dims) const {
+    checkRegion(offset, dims);
+    if (glm::compMul(dims) == 0) return;
+    const auto first = getBrick(offset);
+    const auto count = getBrick(offset + dims - size3_t{1}) - first + size3_t{1};
+    util::parallelFor(glm::compMul(count), [&](size_t i) {
+        getBrickData(first +
+                     size3_t{i % count.x, (i / count.x) % count.y, i / (count.x * count.y)});
+    });
+}
+
+std::shared_ptr<VolumeRAM> VolumeBricked::getRegion(const size3_t& offset,
+                                                    const size3_t& dims) const {
+    checkRegion(offset, dims);
+    auto region = createVolumeRAM(dims, getDataFormat(), nullptr, swizzleMask_, interpolation_,
+                                  wrapping_);
+    if (glm::compMul(dims) == 0) return region;
+
+    const auto elementSize = getDataFormat()->getSizeInBytes();
+    const auto first = getBrick(offset);
+    const auto count = getBrick(offset + dims - size3_t{1}) - first + size3_t{1};
+    void* dst = region->getData();
+    // Each brick is copied into a disjoint part of the region, so bricks can be handled in parallel
+    util::parallelFor(glm::compMul(count), [&](size_t i) {
+        const size3_t brick =
+            first + size3_t{i % count.x, (i / count.x) % count.y, i / (count.x * count.y)};
+        const auto data = getBrickData(brick);
+        const auto brickOffset = getBrickOffset(brick);
+        const auto start = glm::max(offset, brickOffset);
+        const auto stop = glm::min(offset + dims, brickOffset + data->getDimensions());
+        util::copyVoxels(data->getData(), data->getDimensions(), start - brickOffset, dst, dims,
+                         start - offset, stop - start, elementSize);
+    });
+    return region;
+}
+
+double VolumeBricked::getAsDouble(const size3_t& pos) const {
+    const auto brick = getBrick(pos);
+    return getBrickData(brick)->getAsDouble(pos - getBrickOffset(brick));
+}
+
+dvec2 VolumeBricked::getAsDVec2(const size3_t& pos) const {
+    const auto brick = getBrick(pos);
+    return getBrickData(brick)->getAsDVec2(pos - getBrickOffset(brick));
+}
+
+dvec3 VolumeBricked::getAsDVec3(const size3_t& pos) const {
+    const auto brick = getBrick(pos);
+    return getBrickData(brick)->getAsDVec3(pos - getBrickOffset(brick));
+}
+
+dvec4 VolumeBricked::getAsDVec4(const size3_t& pos) const {
+    const auto brick = getBrick(pos);
+    return getBrickData(brick)->getAsDVec4(pos - getBrickOffset(brick));
+}
+
+const VolumeBrickSource& VolumeBricked::getSource() const { return *bricks_->source; }
+
+void VolumeBricked::setSource(std::shared_ptr<const VolumeBrickSource> source,
+                              std::optional<size3_t> brickSize) {
+    if (!source) throw NullPointerException("VolumeBricked requires a brick source");
+    if (brickSize) brickSize_ = glm::max(*brickSize, size3_t{1});
+    dimensions_ = source->getDimensions();
+    brickCount_ = (dimensions_ + brickSize_ - size3_t{1}) / brickSize_;
+    bricks_ = std::make_shared<const Bricks>(std::move(source), bricks_->cache);
+}
+
+BrickCache& VolumeBricked::getCache() const { return *bricks_->cache; }
+
+void VolumeBricked::checkRegion(const size3_t& offset, const size3_t& dims) const {
+    if (glm::any(glm::greaterThan(offset + dims, dimensions_))) {
+        throw RangeException(SourceContext{},
+                             "Region ({}, {}, {}) + ({}, {}, {}) outside of volume ({}, {}, {})",
+                             offset.x, offset.y, offset.z, dims.x, dims.y, dims.z, dimensions_.x,
+                             dimensions_.y, dimensions_.z);
+    }
+}
+
+void util::copyVoxels(const void* src, const size3_t& srcDims, const size3_t& srcOffset, void* dst,
+                      const size3_t& dstDims, const size3_t& dstOffset, const size3_t& region,
+                      size_t elementSize) {
+    const auto* srcBytes = static_cast<const std::byte*>(src);
+    auto* dstBytes = static_cast<std::byte*>(dst);
+    const auto rowBytes = region.x * elementSize;
+    for (size_t z = 0; z < region.z; ++z) {
+        for (size_t y = 0; y < region.y; ++y) {
+            const auto srcIndex =
+                srcOffset.x + srcDims.x * (srcOffset.y + y + srcDims.y * (srcOffset.z + z));
+            const auto dstIndex =
+                dstOffset.x + dstDims.x * (dstOffset.y + y + dstDims.y * (dstOffset.z + z));
+            std::memcpy(dstBytes + dstIndex * elementSize, srcBytes + srcIndex * elementSize,
+                        rowBytes);
+        }
+    }
+}
+
+std::shared_ptr<const VolumeBricked> util::getBrickedRepresentation(const Volume& volume) {
+    if (volume.hasRepresentation<VolumeRAM>()) return nullptr;
+    if (volume.hasRepresentation<VolumeBricked>()) {
+        return volume.getRepresentationShared<VolumeBricked>();
+    }
+    if (volume.hasRepresentation<VolumeDisk>()) {
+        const auto bytes =
+            glm::compMul(volume.getDimensions()) * volume.getDataFormat()->getSizeInBytes();
+        if (bytes > BrickCache::getDefault()->getBudget()) {
+            return volume.getRepresentationShared<VolumeBricked>();
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace inviwo
@@ -0,0 +1,102 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/volume/volumebrickedconverter.h>
+
+namespace inviwo {
+
+namespace {
+
+std::shared_ptr<const VolumeBrickSource> brickSource(const VolumeDisk& disk) {
+    if (auto provider = dynamic_cast<const VolumeBrickSourceProvider*>(disk.getLoader())) {
+        return provider->createBrickSource(disk);
+    }
+    return std::make_shared<VolumeRAMBrickSource>(
+        std::static_pointer_cast<const VolumeRAM>(disk.createRepresentation()));
+}
+
+}  // namespace
+
+std::shared_ptr<VolumeBricked> VolumeDisk2BrickedConverter::createFrom(
+    std::shared_ptr<const VolumeDisk> source) const {
+    auto bricks = brickSource(*source);
+    const auto size = bricks->getPreferredBrickSize().value_or(VolumeBricked::defaultBrickSize);
+    return std::make_shared<VolumeBricked>(std::move(bricks), size, source->getSwizzleMask(),
+                                           source->getInterpolation(), source->getWrapping());
+}
+
+void VolumeDisk2BrickedConverter::update(std::shared_ptr<const VolumeDisk> source,
+                                         std::shared_ptr<VolumeBricked> destination) const {
+    auto bricks = brickSource(*source);
+    const auto size = bricks->getPreferredBrickSize().value_or(VolumeBricked::defaultBrickSize);
+    destination->setSource(std::move(bricks), size);
+    destination->setSwizzleMask(source->getSwizzleMask());
+    destination->setInterpolation(source->getInterpolation());
+    destination->setWrapping(source->getWrapping());
+}
+
+std::shared_ptr<VolumeBricked> VolumeRAM2BrickedConverter::createFrom(
+    std::shared_ptr<const VolumeRAM> source) const {
+    return std::make_shared<VolumeBricked>(std::make_shared<VolumeRAMBrickSource>(source),
+                                           VolumeBricked::defaultBrickSize,
+                                           source->getSwizzleMask(), source->getInterpolation(),
+                                           source->getWrapping());
+}
+
+void VolumeRAM2BrickedConverter::update(std::shared_ptr<const VolumeRAM> source,
+                                        std::shared_ptr<VolumeBricked> destination) const {
+    destination->setSource(std::make_shared<VolumeRAMBrickSource>(source));
+    destination->setSwizzleMask(source->getSwizzleMask());
+    destination->setInterpolation(source->getInterpolation());
+    destination->setWrapping(source->getWrapping());
+}
+
+std::shared_ptr<VolumeRAM> VolumeBricked2RAMConverter::createFrom(
+    std::shared_ptr<const VolumeBricked> source) const {
+    return source->getRegion(size3_t{0}, source->getDimensions());
+}
+
+void VolumeBricked2RAMConverter::update(std::shared_ptr<const VolumeBricked> source,
+                                        std::shared_ptr<VolumeRAM> destination) const {
+    if (source->getDimensions() != destination->getDimensions()) {
+        destination->setDimensions(source->getDimensions());
+    }
+    const auto dims = source->getDimensions();
+    const auto elementSize = source->getDataFormat()->getSizeInBytes();
+    void* dst = destination->getData();
+    source->forEachBrick(size3_t{0}, dims, [&](const VolumeRAM& brick, const size3_t& offset) {
+        util::copyVoxels(brick.getData(), brick.getDimensions(), size3_t{0}, dst, dims, offset,
+                         brick.getDimensions(), elementSize);
+    });
+    destination->setSwizzleMask(source->getSwizzleMask());
+    destination->setInterpolation(source->getInterpolation());
+    destination->setWrapping(source->getWrapping());
+}
+
+}  // namespace inviwo
@@ -0,0 +1,442 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/datastructures/volume/volumepyramid.h>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/resourcemanager/resource.h>
+#include <inviwo/core/util/exception.h>
+#include <inviwo/core/util/glmutils.h>
+#include <inviwo/core/util/indexmapper.h>
+#include <inviwo/core/util/logcentral.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <algorithm>
+#include <type_traits>
+
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+namespace {
+
+/**
+ * Halve the z slices [zBegin, zEnd) of @p src into @p dst at @p dstOffset, averaging 2x2x2 blocks
+ * with voxels outside of @p src clamped to its border.
+ */
+template <typename T>
+void halveSlices(const T* src, const size3_t& srcDims, T* dst, const size3_t& dstDims,
+                 const size3_t& dstOffset, size_t zBegin, size_t zEnd) {
+    using P = util::same_extent_t<T, double>;
+    const util::IndexMapper3D srcIndex(srcDims);
+    const util::IndexMapper3D dstIndex(dstDims);
+    const auto last = srcDims - size3_t{1};
+    const auto count = (srcDims + size3_t{1}) / size3_t{2};
+
+    for (size_t z = zBegin; z < zEnd; ++z) {
+        const size_t z0 = 2 * z;
+        const size_t z1 = std::min(z0 + 1, last.z);
+        for (size_t y = 0; y < count.y; ++y) {
+            const size_t y0 = 2 * y;
+            const size_t y1 = std::min(y0 + 1, last.y);
+            for (size_t x = 0; x < count.x; ++x) {
+                const size_t x0 = 2 * x;
+                const size_t x1 = std::min(x0 + 1, last.x);
+                P sum = static_cast<P>(src[srcIndex(x0, y0, z0)]) +
+                        static_cast<P>(src[srcIndex(x1, y0, z0)]) +
+                        static_cast<P>(src[srcIndex(x0, y1, z0)]) +
+                        static_cast<P>(src[srcIndex(x1, y1, z0)]) +
+                        static_cast<P>(src[srcIndex(x0, y0, z1)]) +
+                        static_cast<P>(src[srcIndex(x1, y0, z1)]) +
+                        static_cast<P>(src[srcIndex(x0, y1, z1)]) +
+                        static_cast<P>(src[srcIndex(x1, y1, z1)]);
+                sum *= 0.125;
+                if constexpr (std::is_integral_v<util::value_type_t<T>>) {
+                    sum = glm::round(sum);
+                }
+                dst[dstIndex(dstOffset + size3_t{x, y, z})] = static_cast<T>(sum);
+            }
+        }
+    }
+}
+
+/**
+ * A quick preview of @p level made by picking the center voxel of each block instead of
+ * averaging. Only touches a small fraction of the source data.
+ */
+std::shared_ptr<VolumeRAM> stridedLevel(const VolumeRAM& volume, size_t level) {
+    return volume.dispatch<std::shared_ptr<VolumeRAM>>(
+        [level]<typename T>(const VolumeRAMPrecision<T>* src) -> std::shared_ptr<VolumeRAM> {
+            const auto srcDims = src->getDimensions();
+            const auto dstDims = util::pyramidLevelDimensions(srcDims, level);
+            const size_t stride = size_t{1} << level;
+            auto dst = std::make_shared<VolumeRAMPrecision<T>>(
+                dstDims, src->getSwizzleMask(), src->getInterpolation(), src->getWrapping());
+
+            const T* in = src->getDataTyped();
+            T* out = dst->getDataTyped();
+            const util::IndexMapper3D srcIndex(srcDims);
+            const util::IndexMapper3D dstIndex(dstDims);
+            util::parallelFor(dstDims.z, [&](size_t z) {
+                for (size_t y = 0; y < dstDims.y; ++y) {
+                    for (size_t x = 0; x < dstDims.x; ++x) {
+                        const auto pos = glm::min(size3_t{x, y, z} * stride + stride / 2,
+                                                  srcDims - size3_t{1});
+                        out[dstIndex(x, y, z)] = in[srcIndex(pos)];
+                    }
+                }
+            });
+            return dst;
+        });
+}
+
+std::shared_ptr<const Volume> makeLevel(VolumeConfig config, std::shared_ptr<VolumeRAM> data) {
+    config.dimensions = data->getDimensions();
+    auto volume = std::make_shared<Volume>(config);
+    volume->addRepresentation(std::move(data));
+    return volume;
+}
+
+}  // namespace
+
+VolumePyramid::State::~State() { resource::removeEvictable(resource::toRAM(this)); }
+
+void VolumePyramid::makeEvictable(const std::shared_ptr<State>& pyramid) {
+    size_t bytes = 0;
+    {
+        const std::scoped_lock lock{pyramid->mutex};
+        if (pyramid->status != Status::Valid) return;
+        for (size_t level = 1; level < pyramid->levels.size(); ++level) {
+            if (pyramid->levels[level]) {
+                bytes += glm::compMul(util::pyramidLevelDimensions(pyramid->dimensions, level)) *
+                         pyramid->bytesPerVoxel;
+            }
+        }
+    }
+    if (bytes == 0) return;
+
+    resource::addEvictable(resource::toRAM(pyramid.get()), bytes,
+                           [weakState = std::weak_ptr<State>(pyramid)]() {
+                               if (auto state = weakState.lock()) {
+                                   const std::scoped_lock lock{state->mutex};
+                                   if (state->status != Status::Valid) return;
+                                   state->levels.clear();
+                                   state->status = Status::NotSet;
+                               }
+                           });
+}
+
+VolumePyramid::VolumePyramid() : state_{std::make_shared<State>()} {}
+VolumePyramid::VolumePyramid(const VolumePyramid& rhs) : state_{std::make_shared<State>()} {
+    {
+        const std::scoped_lock lock{rhs.state_->mutex};
+        // A pyramid being built belongs to the original, the copy will have to request its own
+        if (rhs.state_->status == Status::Valid) {
+            state_->dimensions = rhs.state_->dimensions;
+            state_->bytesPerVoxel = rhs.state_->bytesPerVoxel;
+            state_->levels = rhs.state_->levels;
+            state_->status = rhs.state_->status;
+        }
+    }
+    makeEvictable(state_);
+}
+VolumePyramid::VolumePyramid(VolumePyramid&& rhs) noexcept : state_{std::move(rhs.state_)} {}
+VolumePyramid& VolumePyramid::operator=(const VolumePyramid& that) {
+    if (this != &that) {
+        *this = VolumePyramid{that};
+    }
+    return *this;
+}
+VolumePyramid& VolumePyramid::operator=(VolumePyramid&& that) noexcept {
+    if (this != &that) {
+        state_ = std::move(that.state_);
+    }
+    return *this;
+}
+
+auto VolumePyramid::request(const Volume& volume,
+                            const std::function<Callback>& whenLevelDone) const -> Result {
+    const std::scoped_lock lock{state_->mutex};
+
+    Result result;
+
+    if (state_->status == Status::Valid && whenLevelDone) {
+        whenLevelDone(state_->levels.size() - 1);
+        result.progress = Progress::Done;
+    } else if (state_->status != Status::Valid && whenLevelDone) {
+        result.handle = state_->callbacks.add(whenLevelDone);
+        result.progress = Progress::Building;
+    }
+
+    if (state_->status != Status::NotSet) return result;
+
+    const auto dims = volume.getDimensions();
+    const auto levels = util::pyramidLevelCount(dims);
+    state_->dimensions = dims;
+    state_->bytesPerVoxel = volume.getDataFormat()->getSizeInBytes();
+    state_->levels.assign(levels, nullptr);
+    state_->status = Status::Building;
+    result.progress = Progress::Building;
+
+    if (levels == 1) {
+        // Already small enough, the pyramid is only the volume itself
+        state_->status = Status::Valid;
+        state_->callbacks.invoke(0);
+        result.progress = Progress::Done;
+        return result;
+    }
+
+    // Prefer reading out-of-core volumes brick by brick
+    auto bricked = util::getBrickedRepresentation(volume);
+    auto ram = bricked ? nullptr : volume.getRepresentationShared<VolumeRAM>();
+
+    const auto publish = [weakState = std::weak_ptr<State>(state_)](
+                             size_t level, std::shared_ptr<const Volume> data, bool last) {
+        dispatchFrontAndForget([weakState, level, data = std::move(data), last]() {
+            if (auto state = weakState.lock()) {
+                {
+                    const std::scoped_lock lock{state->mutex};
+                    state->levels[level] = data;
+                    if (last) state->status = Status::Valid;
+                    state->callbacks.invoke(level);
+                }
+                if (last) makeEvictable(state);
+            }
+        });
+    };
+
+    dispatchPool([config = volume.config(), ram, bricked, levels, publish,
+                  weakState = std::weak_ptr<State>(state_)]() {
+        try {
+            if (ram && levels > 2) {
+                publish(levels - 1, makeLevel(config, stridedLevel(*ram, levels - 1)), false);
+            }
+            auto previous = ram ? util::volumeHalve(*ram) : util::volumeHalve(*bricked);
+            for (size_t level = 1; level < levels; ++level) {
+                if (level > 1) previous = util::volumeHalve(*previous);
+                publish(level, makeLevel(config, previous), level + 1 == levels);
+                // Stop if the pyramid has been discarded in the meantime
+                if (weakState.expired()) return;
+            }
+        } catch (const Exception& e) {
+            log::exception(e);
+        } catch (const std::exception& e) {
+            log::exception(e);
+        }
+        // Allow a later request to try again after a failure
+        dispatchFrontAndForget([weakState]() {
+            if (auto state = weakState.lock()) {
+                const std::scoped_lock lock{state->mutex};
+                if (state->status == Status::Building) state->status = Status::NotSet;
+            }
+        });
+    });
+
+    return result;
+}
+
+void VolumePyramid::discard(const Volume& volume) {
+    {
+        const std::scoped_lock lock{state_->mutex};
+        if (state_->status == Status::NotSet) return;
+    }
+    // A build in progress keeps publishing to the old state, which is dropped here
+    auto newState = std::make_shared<State>();
+    {
+        const std::scoped_lock lock{state_->mutex};
+        newState->callbacks = std::move(state_->callbacks);
+    }
+    state_ = std::move(newState);
+    request(volume, nullptr);
+}
+
+void VolumePyramid::clear() {
+    // A build in progress keeps publishing to the old state, which is dropped here
+    auto newState = std::make_shared<State>();
+    {
+        const std::scoped_lock lock{state_->mutex};
+        if (state_->status == Status::NotSet) return;
+        newState->callbacks = std::move(state_->callbacks);
+    }
+    state_ = std::move(newState);
+}
+
+void VolumePyramid::assign(const Volume& volume,
+                           std::vector<std::shared_ptr<const Volume>> levels) {
+    const auto dims = volume.getDimensions();
+    if (levels.size() + 1 != util::pyramidLevelCount(dims)) {
+        throw Exception(SourceContext{}, "Expected {} pyramid levels, got {}",
+                        util::pyramidLevelCount(dims) - 1, levels.size());
+    }
+
+    auto newState = std::make_shared<State>();
+    {
+        const std::scoped_lock lock{state_->mutex};
+        newState->callbacks = std::move(state_->callbacks);
+    }
+    newState->dimensions = dims;
+    newState->bytesPerVoxel = volume.getDataFormat()->getSizeInBytes();
+    newState->levels.push_back(nullptr);
+    newState->levels.insert(newState->levels.end(), levels.begin(), levels.end());
+    newState->status = Status::Valid;
+    state_ = std::move(newState);
+
+    {
+        const std::scoped_lock lock{state_->mutex};
+        state_->callbacks.invoke(state_->levels.size() - 1);
+    }
+    makeEvictable(state_);
+}
+
+size_t VolumePyramid::getNumberOfLevels() const {
+    const std::scoped_lock lock{state_->mutex};
+    return state_->levels.size();
+}
+
+size3_t VolumePyramid::getDimensions(size_t level) const {
+    const std::scoped_lock lock{state_->mutex};
+    return util::pyramidLevelDimensions(state_->dimensions, level);
+}
+
+bool VolumePyramid::isDone() const {
+    const std::scoped_lock lock{state_->mutex};
+    return state_->status == Status::Valid;
+}
+
+std::shared_ptr<const Volume> VolumePyramid::getLevel(size_t level) const {
+    resource::useEvictable(resource::toRAM(state_.get()));
+    const std::scoped_lock lock{state_->mutex};
+    return level < state_->levels.size() ? state_->levels[level] : nullptr;
+}
+
+std::pair<size_t, std::shared_ptr<const Volume>> VolumePyramid::getAvailable(size_t level) const {
+    resource::useEvictable(resource::toRAM(state_.get()));
+    const std::scoped_lock lock{state_->mutex};
+    for (size_t i = level; i < state_->levels.size(); ++i) {
+        if (state_->levels[i]) return {i, state_->levels[i]};
+    }
+    return {level, nullptr};
+}
+
+size_t VolumePyramid::findLevel(const size3_t& resolution) const {
+    const std::scoped_lock lock{state_->mutex};
+    size_t level = 0;
+    while (level + 1 < state_->levels.size() &&
+           glm::all(glm::greaterThanEqual(
+               util::pyramidLevelDimensions(state_->dimensions, level + 1), resolution))) {
+        ++level;
+    }
+    return level;
+}
+
+size_t VolumePyramid::findLevelForBudget(size_t bytes) const {
+    const std::scoped_lock lock{state_->mutex};
+    size_t level = 0;
+    while (level + 1 < state_->levels.size() &&
+           glm::compMul(util::pyramidLevelDimensions(state_->dimensions, level)) *
+                   state_->bytesPerVoxel >
+               bytes) {
+        ++level;
+    }
+    return level;
+}
+
+size3_t util::pyramidLevelDimensions(const size3_t& dims, size_t level) {
+    const size_t scale = size_t{1} << std::min(level, size_t{63});
+    return glm::max((dims + size3_t{scale - 1}) / size3_t{scale}, size3_t{1});
+}
+
+size_t util::pyramidLevelCount(const size3_t& dims, size_t minSize) {
+    size_t count = 1;
+    while (glm::compMax(pyramidLevelDimensions(dims, count - 1)) > std::max(minSize, size_t{1})) {
+        ++count;
+    }
+    return count;
+}
+
+std::shared_ptr<VolumeRAM> util::volumeHalve(const VolumeRAM& volume) {
+    return volume.dispatch<std::shared_ptr<VolumeRAM>>(
+        []<typename T>(const VolumeRAMPrecision<T>* src) -> std::shared_ptr<VolumeRAM> {
+            const auto srcDims = src->getDimensions();
+            const auto dstDims = pyramidLevelDimensions(srcDims, 1);
+            auto dst = std::make_shared<VolumeRAMPrecision<T>>(
+                dstDims, src->getSwizzleMask(), src->getInterpolation(), src->getWrapping());
+
+            const T* in = src->getDataTyped();
+            T* out = dst->getDataTyped();
+            util::parallelFor(dstDims.z, [&](size_t z) {
+                halveSlices(in, srcDims, out, dstDims, size3_t{0}, z, z + 1);
+            });
+            return dst;
+        });
+}
+
+std::shared_ptr<VolumeRAM> util::volumeHalve(const VolumeBricked& volume) {
+    const auto srcDims = volume.getDimensions();
+    const auto dstDims = pyramidLevelDimensions(srcDims, 1);
+    auto dst = createVolumeRAM(dstDims, volume.getDataFormat(), nullptr, volume.getSwizzleMask(),
+                               volume.getInterpolation(), volume.getWrapping());
+    const auto brickSize = volume.getBrickSize();
+
+    dst->dispatch<void>([&]<typename T>(VolumeRAMPrecision<T>* out) {
+        if (glm::all(glm::equal(brickSize % size3_t{2}, size3_t{0}))) {
+            // With an even brick size each brick maps to a disjoint block of the result
+            const auto count = volume.getBrickCount();
+            util::parallelFor(glm::compMul(count), [&](size_t i) {
+                const size3_t brick{i % count.x, (i / count.x) % count.y, i / (count.x * count.y)};
+                const auto data = volume.getBrickData(brick);
+                const auto* src = static_cast<const VolumeRAMPrecision<T>*>(data.get());
+                const auto regionDims = src->getDimensions();
+                halveSlices(src->getDataTyped(), regionDims, out->getDataTyped(), dstDims,
+                            volume.getBrickOffset(brick) / size3_t{2}, 0, (regionDims.z + 1) / 2);
+            });
+        } else {
+            // Otherwise halve regions of twice the brick size, which also map to disjoint blocks
+            // of the result, each region only loads the bricks it overlaps
+            const auto regionSize = brickSize * size3_t{2};
+            const auto count = (srcDims + regionSize - size3_t{1}) / regionSize;
+            util::parallelFor(glm::compMul(count), [&](size_t i) {
+                const size3_t index{i % count.x, (i / count.x) % count.y, i / (count.x * count.y)};
+                const auto offset = index * regionSize;
+                const auto data = volume.getRegion(offset, glm::min(regionSize, srcDims - offset));
+                const auto* src = static_cast<const VolumeRAMPrecision<T>*>(data.get());
+                const auto regionDims = src->getDimensions();
+                halveSlices(src->getDataTyped(), regionDims, out->getDataTyped(), dstDims,
+                            offset / size3_t{2}, 0, (regionDims.z + 1) / 2);
+            });
+        }
+    });
+    return dst;
+}
+
+}  // namespace inviwo
@@ -45,4 +45,17 @@ std::shared_ptr<VolumeRAM> createVolumeRAM(const size3_t& dimensions, const Data
         });
 }
 
+std::shared_ptr<VolumeRAM> createVolumeRAM(const size3_t& dimensions, const DataFormatBase* format,
+                                           std::shared_ptr<const void> sharedData,
+                                           const SwizzleMask& swizzleMask,
+                                           InterpolationType interpolation,
+                                           const Wrapping3D& wrapping) {
+    return dispatching::singleDispatch<std::shared_ptr<VolumeRAM>, dispatching::filter::All>(
+        format->getId(), [&]<typename T>() {
+            return std::make_shared<VolumeRAMPrecision<T>>(
+                std::static_pointer_cast<const T>(sharedData), dimensions, swizzleMask,
+                interpolation, wrapping);
+        });
+}
+
 }  // namespace inviwo
@@ -0,0 +1,443 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/blockcompression.h>
+
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/raiiutils.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <zlib.h>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <system_error>
+#include <vector>
+
+namespace inviwo::util::blockcompression {
+
+namespace {
+
+// gzip member header with a single "IV" extra subfield holding the compressed member size and
+// the uncompressed block size, see RFC 1952
+constexpr size_t headerSize = 24;
+constexpr size_t trailerSize = 8;
+constexpr size_t maxBlockSize = size_t{1} << 30;
+constexpr size_t blocksPerBatch = 64;
+
+using Header = std::array<unsigned char, headerSize>;
+
+void putLE32(unsigned char* dest, std::uint32_t value) {
+    for (size_t i = 0; i < 4; ++i) {
+        dest[i] = static_cast<unsigned char>((value >> (8 * i)) & 0xFFu);
+    }
+}
+
+std::uint32_t getLE32(const unsigned char* src) {
+    std::uint32_t value = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        value |= static_cast<std::uint32_t>(src[i]) << (8 * i);
+    }
+    return value;
+}
+
+Header makeHeader(std::uint32_t memberSize, std::uint32_t blockSize) {
+    Header header{0x1f, 0x8b,  // ID1, ID2
+                  8,           // CM: deflate
+                  4,           // FLG: FEXTRA
+                  0, 0, 0, 0,  // MTIME
+                  0,           // XFL
+                  255,         // OS: unknown
+                  12, 0,       // XLEN
+                  'I', 'V',    // SI1, SI2
+                  8, 0};       // SLEN
+    putLE32(header.data() + 16, memberSize);
+    putLE32(header.data() + 20, blockSize);
+    return header;
+}
+
+using Block = Index::Block;
+
+/**
+ * Returns the member size and the uncompressed block size if @p header is the header of a block
+ * compressed gzip member.
+ */
+std::optional<std::pair<size_t, size_t>> parseHeader(const Header& header) {
+    const auto expected = makeHeader(0, 0);
+    if (!std::equal(header.begin(), header.begin() + 4, expected.begin()) ||
+        !std::equal(header.begin() + 10, header.begin() + 16, expected.begin() + 10)) {
+        return std::nullopt;
+    }
+    const size_t memberSize = getLE32(header.data() + 16);
+    const size_t blockSize = getLE32(header.data() + 20);
+    if (memberSize < headerSize + trailerSize) return std::nullopt;
+    return std::pair{memberSize, blockSize};
+}
+
+class File {
+public:
+    File(const std::filesystem::path& path, const char* mode)
+        : path_{path}, file_{filesystem::fopen(path, mode)} {
+        if (!file_) {
+            throw DataReaderException(SourceContext{}, "Could not open file: {:?g}", path);
+        }
+    }
+    File(const File&) = delete;
+    File& operator=(const File&) = delete;
+    ~File() { std::fclose(file_); }
+
+    bool seek(size_t pos) {
+#ifdef WIN32
+        return _fseeki64(file_, static_cast<__int64>(pos), SEEK_SET) == 0;
+#else
+        return fseeko(file_, static_cast<off_t>(pos), SEEK_SET) == 0;
+#endif
+    }
+    bool read(void* dest, size_t bytes) { return std::fread(dest, 1, bytes, file_) == bytes; }
+    void write(const void* src, size_t bytes) {
+        if (std::fwrite(src, 1, bytes, file_) != bytes) {
+            throw DataReaderException(SourceContext{}, "Could not write to file: {:?g}", path_);
+        }
+    }
+
+private:
+    std::filesystem::path path_;
+    FILE* file_;
+};
+
+std::vector<unsigned char> compressBlock(const unsigned char* src, size_t bytes) {
+    z_stream zs{};
+    if (deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8,
+                     Z_DEFAULT_STRATEGY) != Z_OK) {
+        throw DataReaderException(SourceContext{}, "Could not initialize compression");
+    }
+    const util::OnScopeExit end{[&zs]() { deflateEnd(&zs); }};
+
+    const auto bound = deflateBound(&zs, static_cast<uLong>(bytes));
+    std::vector<unsigned char> member(headerSize + bound + trailerSize);
+
+    zs.next_in = const_cast<Bytef*>(src);
+    zs.avail_in = static_cast<uInt>(bytes);
+    zs.next_out = member.data() + headerSize;
+    zs.avail_out = static_cast<uInt>(bound);
+    if (deflate(&zs, Z_FINISH) != Z_STREAM_END) {
+        throw DataReaderException(SourceContext{}, "Could not compress data");
+    }
+
+    const auto memberSize = headerSize + zs.total_out + trailerSize;
+    member.resize(memberSize);
+    const auto header =
+        makeHeader(static_cast<std::uint32_t>(memberSize), static_cast<std::uint32_t>(bytes));
+    std::copy(header.begin(), header.end(), member.begin());
+    auto* trailer = member.data() + memberSize - trailerSize;
+    putLE32(trailer, static_cast<std::uint32_t>(crc32(0, src, static_cast<uInt>(bytes))));
+    putLE32(trailer + 4, static_cast<std::uint32_t>(bytes));
+    return member;
+}
+
+/**
+ * Inflate the gzip @p member into @p dest, returns false if the member is corrupt or does not hold
+ * exactly @p bytes bytes.
+ */
+bool decompressBlock(std::span<const unsigned char> member, unsigned char* dest, size_t bytes) {
+    // zlib rejects a null output pointer even when there is nothing to write
+    unsigned char empty = 0;
+    if (bytes == 0) dest = &empty;
+
+    z_stream zs{};
+    if (inflateInit2(&zs, -MAX_WBITS) != Z_OK) {
+        throw DataReaderException(SourceContext{}, "Could not initialize decompression");
+    }
+    const util::OnScopeExit end{[&zs]() { inflateEnd(&zs); }};
+
+    zs.next_in = const_cast<Bytef*>(member.data() + headerSize);
+    zs.avail_in = static_cast<uInt>(member.size() - headerSize - trailerSize);
+    zs.next_out = dest;
+    zs.avail_out = static_cast<uInt>(bytes);
+    if (inflate(&zs, Z_FINISH) != Z_STREAM_END || zs.total_out != bytes) return false;
+
+    const auto* trailer = member.data() + member.size() - trailerSize;
+    return getLE32(trailer) == crc32(0, dest, static_cast<uInt>(bytes)) &&
+           getLE32(trailer + 4) == static_cast<std::uint32_t>(bytes);
+}
+
+/**
+ * Read and decompress @p blocks, sorted by offset, and copy the parts overlapping any of the
+ * @p ranges to their destinations. The members are read in batches to bound the memory use.
+ */
+void readBlocks(File& file, const std::filesystem::path& path, std::span<const Block> blocks,
+                std::span<const Index::Range> ranges) {
+    const auto corrupt = [&]() {
+        return DataReaderException(SourceContext{}, "Corrupt compressed data in file: {:?g}",
+                                   path);
+    };
+
+    std::vector<std::vector<unsigned char>> members(std::min(blocks.size(), blocksPerBatch));
+    for (size_t first = 0; first < blocks.size(); first += members.size()) {
+        const auto batch = blocks.subspan(first, std::min(members.size(), blocks.size() - first));
+        for (size_t i = 0; i < batch.size(); ++i) {
+            members[i].resize(batch[i].memberSize);
+            if (!file.seek(batch[i].filePos) || !file.read(members[i].data(), members[i].size())) {
+                throw DataReaderException(SourceContext{}, "Could not read from file: {:?g}",
+                                          path);
+            }
+        }
+
+        util::parallelFor(batch.size(), [&](size_t i) {
+            const auto& block = batch[i];
+            const auto blockEnd = block.offset + block.size;
+
+            // Decompress directly into the destination of a range covering the whole block
+            const auto covering = std::ranges::find_if(ranges, [&](const Index::Range& range) {
+                return range.bytes > 0 && range.offset <= block.offset &&
+                       range.offset + range.bytes >= blockEnd;
+            });
+            std::vector<unsigned char> tmp;
+            unsigned char* data = nullptr;
+            if (covering != ranges.end()) {
+                data = static_cast<unsigned char*>(covering->dest) +
+                       (block.offset - covering->offset);
+            } else {
+                tmp.resize(block.size);
+                data = tmp.data();
+            }
+            if (!decompressBlock(members[i], data, block.size)) throw corrupt();
+
+            for (auto it = ranges.begin(); it != ranges.end(); ++it) {
+                if (it == covering || it->offset >= blockEnd ||
+                    it->offset + it->bytes <= block.offset) {
+                    continue;
+                }
+                const auto begin = std::max(it->offset, block.offset);
+                const auto end = std::min(it->offset + it->bytes, blockEnd);
+                std::copy(data + (begin - block.offset), data + (end - block.offset),
+                          static_cast<unsigned char*>(it->dest) + (begin - it->offset));
+            }
+        });
+    }
+}
+
+void checkBlockSize(size_t blockSize) {
+    if (blockSize == 0 || blockSize > maxBlockSize) {
+        throw DataReaderException(SourceContext{}, "Invalid compression block size: {}",
+                                  blockSize);
+    }
+}
+
+}  // namespace
+
+bool isBlockCompressed(const std::filesystem::path& path) {
+    FILE* file = filesystem::fopen(path, "rb");
+    if (!file) return false;
+    const util::OnScopeExit closeFile{[file]() { std::fclose(file); }};
+
+    Header header{};
+    return std::fread(header.data(), 1, header.size(), file) == header.size() &&
+           parseHeader(header).has_value();
+}
+
+void write(const std::filesystem::path& path, const void* source, size_t bytes,
+           size_t blockSize) {
+    checkBlockSize(blockSize);
+
+    File file{path, "wb"};
+    const auto* src = static_cast<const unsigned char*>(source);
+    // Always write at least one member to produce a valid gzip file
+    const auto nBlocks = std::max(size_t{1}, (bytes + blockSize - 1) / blockSize);
+
+    // Compress a batch of blocks at a time to bound the memory use
+    std::vector<std::vector<unsigned char>> members(std::min(nBlocks, blocksPerBatch));
+    for (size_t first = 0; first < nBlocks; first += members.size()) {
+        const auto count = std::min(members.size(), nBlocks - first);
+        util::parallelFor(count, [&](size_t i) {
+            const auto begin = (first + i) * blockSize;
+            members[i] = compressBlock(src + begin, std::min(blockSize, bytes - begin));
+        });
+        for (size_t i = 0; i < count; ++i) {
+            file.write(members[i].data(), members[i].size());
+        }
+    }
+}
+
+void read(const std::filesystem::path& path, size_t offset, size_t bytes, void* dest) {
+    if (bytes == 0) return;
+
+    File file{path, "rb"};
+
+    // Walk the member headers to find the blocks overlapping [offset, offset + bytes)
+    std::vector<Block> blocks;
+    size_t filePos = 0;
+    size_t blockOffset = 0;
+    while (blockOffset < offset + bytes) {
+        Header header{};
+        if (!file.seek(filePos) || !file.read(header.data(), header.size())) {
+            throw DataReaderException(SourceContext{},
+                                      "Could not read {} bytes at offset {} from file: {:?g}",
+                                      bytes, offset, path);
+        }
+        const auto sizes = parseHeader(header);
+        if (!sizes) {
+            throw DataReaderException(SourceContext{}, "File is not block compressed: {:?g}",
+                                      path);
+        }
+        const auto [memberSize, blockSize] = *sizes;
+        if (blockOffset + blockSize > offset) {
+            blocks.push_back({filePos, memberSize, blockOffset, blockSize});
+        }
+        filePos += memberSize;
+        blockOffset += blockSize;
+    }
+
+    const Index::Range range{offset, bytes, dest};
+    readBlocks(file, path, blocks, {&range, 1});
+}
+
+Index::Index(const std::filesystem::path& path) : path_{path} {
+    std::error_code ec;
+    const auto fileSize = std::filesystem::file_size(path, ec);
+    if (ec) {
+        throw DataReaderException(SourceContext{}, "Could not open file: {:?g}", path);
+    }
+
+    File file{path, "rb"};
+    size_t filePos = 0;
+    size_t offset = 0;
+    while (filePos < fileSize) {
+        Header header{};
+        if (!file.seek(filePos) || !file.read(header.data(), header.size())) {
+            throw DataReaderException(SourceContext{}, "Corrupt compressed data in file: {:?g}",
+                                      path);
+        }
+        const auto sizes = parseHeader(header);
+        if (!sizes) {
+            throw DataReaderException(SourceContext{}, "File is not block compressed: {:?g}",
+                                      path);
+        }
+        const auto [memberSize, blockSize] = *sizes;
+        blocks_.push_back({filePos, memberSize, offset, blockSize});
+        filePos += memberSize;
+        offset += blockSize;
+    }
+    if (blocks_.empty()) {
+        throw DataReaderException(SourceContext{}, "File is not block compressed: {:?g}", path);
+    }
+}
+
+size_t Index::size() const { return blocks_.back().offset + blocks_.back().size; }
+
+void Index::read(std::span<const Range> ranges) const {
+    // Collect the blocks overlapping any of the ranges, each block only once
+    std::vector<Block> needed;
+    for (const auto& range : ranges) {
+        if (range.bytes == 0) continue;
+        if (range.offset + range.bytes > size()) {
+            throw DataReaderException(SourceContext{},
+                                      "Could not read {} bytes at offset {} from file: {:?g}",
+                                      range.bytes, range.offset, path_);
+        }
+        auto it = std::ranges::upper_bound(blocks_, range.offset, {}, &Block::offset);
+        for (--it; it != blocks_.end() && it->offset < range.offset + range.bytes; ++it) {
+            needed.push_back(*it);
+        }
+    }
+    if (needed.empty()) return;
+    std::ranges::sort(needed, {}, &Block::offset);
+    const auto duplicates = std::ranges::unique(needed, {}, &Block::offset);
+    needed.erase(duplicates.begin(), duplicates.end());
+
+    File file{path_, "rb"};
+    readBlocks(file, path_, needed, ranges);
+}
+
+void Index::read(size_t offset, size_t bytes, void* dest) const {
+    const Range range{offset, bytes, dest};
+    read({&range, 1});
+}
+
+std::vector<unsigned char> compress(std::span<const unsigned char> source, size_t blockSize) {
+    checkBlockSize(blockSize);
+
+    const auto nBlocks = std::max(size_t{1}, (source.size() + blockSize - 1) / blockSize);
+    std::vector<std::vector<unsigned char>> members(nBlocks);
+    util::parallelFor(nBlocks, [&](size_t i) {
+        const auto begin = i * blockSize;
+        members[i] =
+            compressBlock(source.data() + begin, std::min(blockSize, source.size() - begin));
+    });
+
+    std::vector<unsigned char> result;
+    result.reserve(std::accumulate(members.begin(), members.end(), size_t{0},
+                                   [](size_t sum, const auto& m) { return sum + m.size(); }));
+    for (const auto& member : members) {
+        result.insert(result.end(), member.begin(), member.end());
+    }
+    return result;
+}
+
+void decompress(std::span<const unsigned char> source, std::span<unsigned char> dest) {
+    const auto corrupt = []() {
+        return DataReaderException(SourceContext{}, "Corrupt compressed data");
+    };
+
+    std::vector<Block> blocks;
+    size_t pos = 0;
+    size_t offset = 0;
+    while (pos < source.size()) {
+        if (source.size() - pos < headerSize) throw corrupt();
+        Header header{};
+        std::copy_n(source.begin() + pos, headerSize, header.begin());
+        const auto sizes = parseHeader(header);
+        if (!sizes || sizes->first > source.size() - pos) throw corrupt();
+        blocks.push_back({pos, sizes->first, offset, sizes->second});
+        pos += sizes->first;
+        offset += sizes->second;
+    }
+    if (offset != dest.size()) throw corrupt();
+
+    util::parallelFor(blocks.size(), [&](size_t i) {
+        const auto& block = blocks[i];
+        if (!decompressBlock(source.subspan(block.filePos, block.memberSize),
+                             dest.data() + block.offset, block.size)) {
+            throw corrupt();
+        }
+    });
+}
+
+}  // namespace inviwo::util::blockcompression
@@ -28,7 +28,9 @@
  *********************************************************************************/
 
 #include <inviwo/core/io/bytereaderutil.h>
+#include <inviwo/core/io/blockcompression.h>
 #include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/util/threadutil.h>
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/filesystem.h>
 #include <inviwo/core/io/curlutils.h>
@@ -39,28 +41,61 @@
 #include <fmt/format.h>
 #include <fmt/std.h>
 
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 
 namespace inviwo {
 
 namespace {
 
-void convertToLittleEndian(void* dest, size_t bytes, size_t elementSize) {
-    auto temp = std::make_unique<char[]>(elementSize);
-
-    for (std::size_t i = 0; i < bytes; i += elementSize) {
-        for (std::size_t j = 0; j < elementSize; j++) {
-            temp[j] = static_cast<char*>(dest)[i + j];
-        }
+template <typename U>
+void swapBytes(std::byte* data, size_t count) {
+    // The memcpy calls are optimized away, the loop compiles to bswap/rev instructions, and is
+    // vectorized when the target supports byte shuffles
+    for (size_t i = 0; i < count; ++i) {
+        U value;
+        std::memcpy(&value, data + i * sizeof(U), sizeof(U));
+        value = std::byteswap(value);
+        std::memcpy(data + i * sizeof(U), &value, sizeof(U));
+    }
+}
 
-        for (std::size_t j = 0; j < elementSize; j++) {
-            static_cast<char*>(dest)[i + j] = temp[elementSize - j - 1];
-        }
+void swapBytes(std::byte* data, size_t count, size_t elementSize) {
+    switch (elementSize) {
+        case 2:
+            return swapBytes<std::uint16_t>(data, count);
+        case 4:
+            return swapBytes<std::uint32_t>(data, count);
+        case 8:
+            return swapBytes<std::uint64_t>(data, count);
+        default:
+            for (size_t i = 0; i < count; ++i) {
+                std::reverse(data + i * elementSize, data + (i + 1) * elementSize);
+            }
     }
 }
 
 }  // namespace
 
+void util::convertToLittleEndian(void* dest, size_t bytes, size_t elementSize) {
+    auto* data = static_cast<std::byte*>(dest);
+    const auto elements = bytes / elementSize;
+
+    // Large buffers are split into chunks of whole elements that are swapped in parallel
+    constexpr size_t chunkBytes = size_t{4} << 20;
+    const auto chunkElements = std::max(size_t{1}, chunkBytes / elementSize);
+    const auto chunks = (elements + chunkElements - 1) / chunkElements;
+    util::parallelFor(chunks, [&](size_t chunk) {
+        const auto first = chunk * chunkElements;
+        const auto count = std::min(chunkElements, elements - first);
+        swapBytes(data + first * elementSize, count, elementSize);
+    });
+}
+
 void util::readBytesIntoBuffer(const std::filesystem::path& path, size_t offset, size_t bytes,
                                ByteOrder byteOrder, size_t elementSize, void* dest) {
     const auto filePath = net::downloadAndCacheIfUrl(path);
@@ -71,7 +106,16 @@ void util::readBytesIntoBuffer(const std::filesystem::path& path, size_t offset,
     }
     const util::OnScopeExit closeFile{[file]() { std::fclose(file); }};
 
-    std::fseek(file, static_cast<long>(offset), SEEK_SET);
+    // std::fseek takes a long offset which is only 32 bit on Windows
+#ifdef WIN32
+    const auto seek = _fseeki64(file, static_cast<__int64>(offset), SEEK_SET);
+#else
+    const auto seek = fseeko(file, static_cast<off_t>(offset), SEEK_SET);
+#endif
+    if (seek != 0) {
+        throw DataReaderException(SourceContext{}, "Could not seek to offset {} in file: {:?g}",
+                                  offset, path);
+    }
     if (std::fread(static_cast<char*>(dest), bytes, 1, file) != 1) {
         throw DataReaderException(SourceContext{}, "Could not read from file: {:?g}", path);
     }
@@ -85,17 +129,19 @@ void util::readCompressedBytesIntoBuffer(const std::filesystem::path& path, size
                                          void* dest) {
     const auto filePath = net::downloadAndCacheIfUrl(path);
 
-    auto fin = bxz::ifstream{filePath.generic_string(), std::ios::in | std::ios::binary};
-
-    if (fin.good()) {
+    if (util::blockcompression::isBlockCompressed(filePath)) {
+        util::blockcompression::read(filePath, offset, bytes, dest);
+    } else {
+        auto fin = bxz::ifstream{filePath.generic_string(), std::ios::in | std::ios::binary};
+        if (!fin.good()) {
+            throw DataReaderException(SourceContext{}, "Could not read from file: {:?g}", path);
+        }
         fin.seekg(static_cast<std::streamoff>(offset));
         fin.read(static_cast<char*>(dest), static_cast<std::streamsize>(bytes));
+    }
 
-        if (byteOrder == ByteOrder::BigEndian && elementSize > 1) {
-            convertToLittleEndian(dest, bytes, elementSize);
-        }
-    } else {
-        throw DataReaderException(SourceContext{}, "Could not read from file: {:?g}", path);
+    if (byteOrder == ByteOrder::BigEndian && elementSize > 1) {
+        convertToLittleEndian(dest, bytes, elementSize);
     }
 }
 
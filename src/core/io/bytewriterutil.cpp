@@ -28,14 +28,13 @@
  *********************************************************************************/
 
 #include <inviwo/core/io/bytewriterutil.h>
+#include <inviwo/core/io/blockcompression.h>
 #include <inviwo/core/io/datareaderexception.h>
 #include <inviwo/core/util/raiiutils.h>
 #include <inviwo/core/util/filesystem.h>
 #include <inviwo/core/io/curlutils.h>
 #include <inviwo/core/io/inviwofileformattypes.h>
 
-#include <bxzstr/bxzstr.hpp>
-
 #include <fmt/format.h>
 #include <fmt/std.h>
 
@@ -57,26 +56,12 @@ void writeUncompressedBytes(const std::filesystem::path& path, const void* sourc
     }
 }
 
-void writeCompressedBytes(const std::filesystem::path& path, const void* source, size_t bytes) {
-    auto fout = bxz::ofstream{path.generic_string(), bxz::z};
-
-    if (fout.good()) {
-        try {
-            fout.write(static_cast<const char*>(source), static_cast<std::streamsize>(bytes));
-        } catch (const std::ios_base::failure&) {
-            throw DataReaderException(SourceContext{}, "Could not write to file: {:?g}", path);
-        }
-    } else {
-        throw DataReaderException(SourceContext{}, "Could not open file: {:?g}", path);
-    }
-}
-
 }  // namespace
 
 void util::writeBytes(const std::filesystem::path& path, const void* source, size_t bytes,
                       Compression compression) {
     if (compression == Compression::Enabled) {
-        writeCompressedBytes(path, source, bytes);
+        util::blockcompression::write(path, source, bytes);
     } else {
         writeUncompressedBytes(path, source, bytes);
     }
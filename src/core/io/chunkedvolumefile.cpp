@@ -0,0 +1,474 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/chunkedvolumefile.h>
+
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/util/filesystem.h>
+#include <inviwo/core/util/formats.h>
+#include <inviwo/core/util/glmcomp.h>
+#include <inviwo/core/util/glmfmt.h>
+#include <inviwo/core/util/glmutils.h>
+#include <inviwo/core/util/threadutil.h>
+
+#include <zlib.h>
+
+#include <fmt/format.h>
+#include <fmt/std.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+#include <glm/gtx/component_wise.hpp>
+
+namespace inviwo {
+
+namespace {
+
+constexpr std::array<char, 8> magic{'I', 'V', 'W', 'C', 'H', 'U', 'N', 'K'};
+constexpr size_t headerSize = magic.size() + 4 + 4 + 8;
+constexpr size_t chunksPerBatch = 64;
+
+class File {
+public:
+    File(const std::filesystem::path& path, const char* mode)
+        : path_{path}, file_{filesystem::fopen(path, mode)} {
+        if (!file_) {
+            throw DataReaderException(SourceContext{}, "Could not open file: {:?g}", path);
+        }
+    }
+    File(const File&) = delete;
+    File& operator=(const File&) = delete;
+    ~File() { std::fclose(file_); }
+
+    bool seek(size_t pos) {
+#ifdef WIN32
+        return _fseeki64(file_, static_cast<__int64>(pos), SEEK_SET) == 0;
+#else
+        return fseeko(file_, static_cast<off_t>(pos), SEEK_SET) == 0;
+#endif
+    }
+    size_t size() {
+#ifdef WIN32
+        _fseeki64(file_, 0, SEEK_END);
+        return static_cast<size_t>(_ftelli64(file_));
+#else
+        fseeko(file_, 0, SEEK_END);
+        return static_cast<size_t>(ftello(file_));
+#endif
+    }
+    bool read(void* dest, size_t bytes) { return std::fread(dest, 1, bytes, file_) == bytes; }
+    void write(const void* src, size_t bytes) {
+        if (std::fwrite(src, 1, bytes, file_) != bytes) {
+            throw DataWriterException(SourceContext{}, "Could not write to file: {:?g}", path_);
+        }
+    }
+
+private:
+    std::filesystem::path path_;
+    FILE* file_;
+};
+
+class ByteWriter {
+public:
+    template <typename T>
+    void put(T value) {
+        if constexpr (std::is_floating_point_v<T>) {
+            put(std::bit_cast<std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>>(
+                value));
+        } else {
+            for (size_t i = 0; i < sizeof(T); ++i) {
+                bytes.push_back(static_cast<unsigned char>((value >> (8 * i)) & 0xFFu));
+            }
+        }
+    }
+    void putSize3(const size3_t& value) {
+        put(static_cast<std::uint64_t>(value.x));
+        put(static_cast<std::uint64_t>(value.y));
+        put(static_cast<std::uint64_t>(value.z));
+    }
+    std::vector<unsigned char> bytes;
+};
+
+class ByteReader {
+public:
+    ByteReader(std::span<const unsigned char> bytes, const std::filesystem::path& path)
+        : bytes_{bytes}, path_{path} {}
+
+    template <typename T>
+    T get() {
+        if constexpr (std::is_floating_point_v<T>) {
+            using U = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+            return std::bit_cast<T>(get<U>());
+        } else {
+            if (pos_ + sizeof(T) > bytes_.size()) {
+                throw DataReaderException(SourceContext{},
+                                          "Unexpected end of chunked volume file: {:?g}", path_);
+            }
+            T value = 0;
+            for (size_t i = 0; i < sizeof(T); ++i) {
+                value |= static_cast<T>(static_cast<T>(bytes_[pos_ + i]) << (8 * i));
+            }
+            pos_ += sizeof(T);
+            return value;
+        }
+    }
+    size3_t getSize3() {
+        const auto x = get<std::uint64_t>();
+        const auto y = get<std::uint64_t>();
+        const auto z = get<std::uint64_t>();
+        return {x, y, z};
+    }
+
+private:
+    std::span<const unsigned char> bytes_;
+    size_t pos_ = 0;
+    const std::filesystem::path& path_;
+};
+
+/**
+ * Per channel min/max, ignoring NaNs, and a histogram over @p range.
+ */
+void computeStatistics(const VolumeRAM& ram, size_t bins, const dvec2& range,
+                       ChunkedVolumeFile::Chunk& chunk) {
+    ram.dispatch<void>([&]<typename T>(const VolumeRAMPrecision<T>* vr) {
+        constexpr size_t channels = util::extent_v<T>;
+        const auto size = glm::compMul(vr->getDimensions());
+        const auto* data = vr->getDataTyped();
+
+        chunk.min = dvec4{std::numeric_limits<double>::max()};
+        chunk.max = dvec4{std::numeric_limits<double>::lowest()};
+        chunk.histogram.assign(bins * channels, 0);
+        const double scale = range.y > range.x ? static_cast<double>(bins) / (range.y - range.x)
+                                               : 0.0;
+
+        for (size_t i = 0; i < size; ++i) {
+            auto value = data[i];
+            for (size_t c = 0; c < channels; ++c) {
+                const auto v = static_cast<double>(util::glmcomp(value, c));
+                if (std::isnan(v)) continue;
+                const auto ci = static_cast<glm::length_t>(c);
+                chunk.min[ci] = std::min(chunk.min[ci], v);
+                chunk.max[ci] = std::max(chunk.max[ci], v);
+                const auto bin = std::clamp((v - range.x) * scale, 0.0,
+                                            static_cast<double>(bins - 1));
+                ++chunk.histogram[c * bins + static_cast<size_t>(bin)];
+            }
+        }
+    });
+}
+
+std::vector<unsigned char> compressChunk(const void* src, size_t bytes,
+                                         const ChunkedVolumeFile::WriteOptions& options) {
+    const auto* in = static_cast<const unsigned char*>(src);
+    if (options.codec == ChunkedVolumeFile::Codec::None) {
+        return {in, in + bytes};
+    }
+
+    auto size = compressBound(static_cast<uLong>(bytes));
+    std::vector<unsigned char> out(size);
+    if (compress2(out.data(), &size, in, static_cast<uLong>(bytes),
+                  std::clamp(options.compressionLevel, 1, 9)) != Z_OK) {
+        throw DataWriterException(SourceContext{}, "Could not compress data");
+    }
+    out.resize(size);
+    return out;
+}
+
+void decompressChunk(ChunkedVolumeFile::Codec codec, std::span<const unsigned char> stored,
+                     unsigned char* dest, size_t bytes, const std::filesystem::path& path) {
+    const auto corrupt = [&]() {
+        return DataReaderException(SourceContext{}, "Corrupt chunk in file: {:?g}", path);
+    };
+
+    if (codec == ChunkedVolumeFile::Codec::None) {
+        if (stored.size() != bytes) throw corrupt();
+        std::memcpy(dest, stored.data(), bytes);
+        return;
+    }
+
+    auto size = static_cast<uLong>(bytes);
+    if (uncompress(dest, &size, stored.data(), static_cast<uLong>(stored.size())) != Z_OK ||
+        size != bytes) {
+        throw corrupt();
+    }
+}
+
+}  // namespace
+
+size3_t ChunkedVolumeFile::Level::chunkOffset(const size3_t& chunk) const {
+    return chunk * chunkSize;
+}
+
+size3_t ChunkedVolumeFile::Level::chunkDimensions(const size3_t& chunk) const {
+    return glm::min(chunkSize, dimensions - chunkOffset(chunk));
+}
+
+size_t ChunkedVolumeFile::Level::chunkIndex(const size3_t& chunk) const {
+    return chunk.x + chunkCount.x * (chunk.y + chunkCount.y * chunk.z);
+}
+
+ChunkedVolumeFile::ChunkedVolumeFile(const std::filesystem::path& path) : path_{path} {
+    File file{path, "rb"};
+    const auto fileSize = file.size();
+
+    std::array<unsigned char, headerSize> header{};
+    if (!file.seek(0) || !file.read(header.data(), header.size()) ||
+        !std::equal(magic.begin(), magic.end(), header.begin())) {
+        throw DataReaderException(SourceContext{}, "Not a chunked volume file: {:?g}", path);
+    }
+    ByteReader h{std::span{header}.subspan(magic.size()), path};
+    if (const auto fileVersion = h.get<std::uint32_t>(); fileVersion > version) {
+        throw DataReaderException(SourceContext{},
+                                  "Unsupported chunked volume file version {} in {:?g}",
+                                  fileVersion, path);
+    }
+    codec_ = static_cast<Codec>(h.get<std::uint32_t>());
+    if (codec_ != Codec::None && codec_ != Codec::Deflate) {
+        throw DataReaderException(SourceContext{}, "Unsupported compression in {:?g}", path);
+    }
+    const auto indexPos = static_cast<size_t>(h.get<std::uint64_t>());
+    if (indexPos < headerSize || indexPos > fileSize) {
+        throw DataReaderException(SourceContext{}, "Corrupt chunk index in {:?g}", path);
+    }
+
+    std::vector<unsigned char> index(fileSize - indexPos);
+    if (!file.seek(indexPos) || !file.read(index.data(), index.size())) {
+        throw DataReaderException(SourceContext{}, "Could not read chunk index from {:?g}", path);
+    }
+
+    ByteReader r{index, path};
+    format_ = DataFormatBase::get(static_cast<DataFormatId>(r.get<std::uint32_t>()));
+    if (!format_) {
+        throw DataReaderException(SourceContext{}, "Unknown data format in {:?g}", path);
+    }
+    const auto channels = static_cast<glm::length_t>(format_->getComponents());
+    const size_t nLevels = r.get<std::uint32_t>();
+    histogramBins_ = r.get<std::uint32_t>();
+    histogramRange_.x = r.get<double>();
+    histogramRange_.y = r.get<double>();
+
+    for (size_t l = 0; l < nLevels; ++l) {
+        auto& level = levels_.emplace_back();
+        level.dimensions = r.getSize3();
+        level.chunkSize = r.getSize3();
+        if (glm::any(glm::equal(level.chunkSize, size3_t{0}))) {
+            throw DataReaderException(SourceContext{}, "Corrupt chunk index in {:?g}", path);
+        }
+        level.chunkCount = (level.dimensions + level.chunkSize - size3_t{1}) / level.chunkSize;
+        level.chunks.resize(glm::compMul(level.chunkCount));
+        for (auto& chunk : level.chunks) {
+            chunk.position = static_cast<size_t>(r.get<std::uint64_t>());
+            chunk.storedSize = static_cast<size_t>(r.get<std::uint64_t>());
+            if (chunk.position < headerSize || chunk.position > indexPos ||
+                chunk.storedSize > indexPos - chunk.position) {
+                throw DataReaderException(SourceContext{}, "Corrupt chunk index in {:?g}", path);
+            }
+            for (glm::length_t c = 0; c < channels; ++c) chunk.min[c] = r.get<double>();
+            for (glm::length_t c = 0; c < channels; ++c) chunk.max[c] = r.get<double>();
+            chunk.histogram.resize(histogramBins_ * static_cast<size_t>(channels));
+            for (auto& count : chunk.histogram) count = r.get<std::uint32_t>();
+        }
+    }
+}
+
+void ChunkedVolumeFile::write(const std::filesystem::path& path,
+                              std::span<const VolumeBrickSource* const> levels,
+                              const WriteOptions& options) {
+    if (levels.empty()) {
+        throw DataWriterException(SourceContext{}, "Expected at least one level to write");
+    }
+    if (glm::any(glm::equal(options.chunkSize, size3_t{0}))) {
+        throw DataWriterException(SourceContext{}, "Invalid chunk size: {}", options.chunkSize);
+    }
+    if (options.histogramBins == 0 ||
+        options.histogramBins > std::numeric_limits<std::uint32_t>::max()) {
+        throw DataWriterException(SourceContext{}, "Invalid number of histogram bins: {}",
+                                  options.histogramBins);
+    }
+    const auto* format = levels.front()->getDataFormat();
+    const auto channels = static_cast<glm::length_t>(format->getComponents());
+    const auto elementSize = format->getSizeInBytes();
+    for (const auto* source : levels) {
+        if (source->getDataFormat() != format) {
+            throw DataWriterException(SourceContext{}, "All levels must have the same format");
+        }
+    }
+
+    File file{path, "wb"};
+    ByteWriter header;
+    for (auto c : magic) header.put(static_cast<std::uint8_t>(c));
+    header.put(version);
+    header.put(static_cast<std::uint32_t>(options.codec));
+    header.put(std::uint64_t{0});
+    file.write(header.bytes.data(), header.bytes.size());
+
+    ByteWriter index;
+    index.put(static_cast<std::uint32_t>(format->getId()));
+    index.put(static_cast<std::uint32_t>(levels.size()));
+    index.put(static_cast<std::uint32_t>(options.histogramBins));
+    index.put(options.histogramRange.x);
+    index.put(options.histogramRange.y);
+
+    size_t position = headerSize;
+    std::vector<std::vector<unsigned char>> stored(chunksPerBatch);
+    std::vector<Chunk> chunks(chunksPerBatch);
+    for (const auto* source : levels) {
+        Level level;
+        level.dimensions = source->getDimensions();
+        level.chunkSize = options.chunkSize;
+        level.chunkCount = (level.dimensions + level.chunkSize - size3_t{1}) / level.chunkSize;
+        const auto nChunks = glm::compMul(level.chunkCount);
+        const auto& count = level.chunkCount;
+
+        index.putSize3(level.dimensions);
+        index.putSize3(level.chunkSize);
+
+        // Load and compress a batch of chunks at a time to bound the memory use
+        for (size_t first = 0; first < nChunks; first += chunksPerBatch) {
+            const auto batch = std::min(chunksPerBatch, nChunks - first);
+            util::parallelFor(batch, [&](size_t i) {
+                const auto c = first + i;
+                const size3_t chunk{c % count.x, (c / count.x) % count.y, c / (count.x * count.y)};
+                const auto dims = level.chunkDimensions(chunk);
+                const auto ram = source->load(level.chunkOffset(chunk), dims);
+                computeStatistics(*ram, options.histogramBins, options.histogramRange, chunks[i]);
+                stored[i] =
+                    compressChunk(ram->getData(), glm::compMul(dims) * elementSize, options);
+            });
+            for (size_t i = 0; i < batch; ++i) {
+                file.write(stored[i].data(), stored[i].size());
+                index.put(static_cast<std::uint64_t>(position));
+                index.put(static_cast<std::uint64_t>(stored[i].size()));
+                for (glm::length_t c = 0; c < channels; ++c) index.put(chunks[i].min[c]);
+                for (glm::length_t c = 0; c < channels; ++c) index.put(chunks[i].max[c]);
+                for (auto bin : chunks[i].histogram) index.put(bin);
+                position += stored[i].size();
+            }
+        }
+    }
+
+    file.write(index.bytes.data(), index.bytes.size());
+
+    ByteWriter indexPos;
+    indexPos.put(static_cast<std::uint64_t>(position));
+    if (!file.seek(headerSize - 8)) {
+        throw DataWriterException(SourceContext{}, "Could not write to file: {:?g}", path);
+    }
+    file.write(indexPos.bytes.data(), indexPos.bytes.size());
+}
+
+const std::filesystem::path& ChunkedVolumeFile::getPath() const { return path_; }
+
+auto ChunkedVolumeFile::getCodec() const -> Codec { return codec_; }
+
+const DataFormatBase* ChunkedVolumeFile::getDataFormat() const { return format_; }
+
+size_t ChunkedVolumeFile::getNumberOfLevels() const { return levels_.size(); }
+
+auto ChunkedVolumeFile::getLevel(size_t level) const -> const Level& { return levels_.at(level); }
+
+size_t ChunkedVolumeFile::getHistogramBins() const { return histogramBins_; }
+
+dvec2 ChunkedVolumeFile::getHistogramRange() const { return histogramRange_; }
+
+std::vector<size_t> ChunkedVolumeFile::getHistogram(size_t level, size_t channel) const {
+    std::vector<size_t> histogram(histogramBins_, 0);
+    for (const auto& chunk : getLevel(level).chunks) {
+        for (size_t i = 0; i < histogramBins_; ++i) {
+            histogram[i] += chunk.histogram[channel * histogramBins_ + i];
+        }
+    }
+    return histogram;
+}
+
+void ChunkedVolumeFile::read(size_t levelIndex, const size3_t& offset, const size3_t& dims,
+                             void* dest) const {
+    const auto& level = getLevel(levelIndex);
+    if (glm::any(glm::greaterThan(offset + dims, level.dimensions))) {
+        throw DataReaderException(SourceContext{},
+                                  "Region {} + {} is outside of the volume dimensions {}",
+                                  offset, dims, level.dimensions);
+    }
+    if (glm::compMul(dims) == 0) return;
+
+    const auto elementSize = format_->getSizeInBytes();
+    const auto first = offset / level.chunkSize;
+    const auto last = (offset + dims - size3_t{1}) / level.chunkSize;
+    const auto count = last - first + size3_t{1};
+    const auto nChunks = glm::compMul(count);
+
+    File file{path_, "rb"};
+    // Read a batch of chunks at a time and decompress them in parallel
+    std::vector<std::vector<unsigned char>> stored(std::min(nChunks, chunksPerBatch));
+    std::vector<size3_t> chunks(stored.size());
+    for (size_t begin = 0; begin < nChunks; begin += stored.size()) {
+        const auto batch = std::min(stored.size(), nChunks - begin);
+        for (size_t i = 0; i < batch; ++i) {
+            const auto c = begin + i;
+            chunks[i] = first + size3_t{c % count.x, (c / count.x) % count.y,
+                                        c / (count.x * count.y)};
+            const auto& chunk = level.chunks[level.chunkIndex(chunks[i])];
+            stored[i].resize(chunk.storedSize);
+            if (!file.seek(chunk.position) || !file.read(stored[i].data(), chunk.storedSize)) {
+                throw DataReaderException(SourceContext{}, "Could not read from file: {:?g}",
+                                          path_);
+            }
+        }
+        util::parallelFor(batch, [&](size_t i) {
+            const auto chunkOffset = level.chunkOffset(chunks[i]);
+            const auto chunkDims = level.chunkDimensions(chunks[i]);
+            std::vector<unsigned char> data(glm::compMul(chunkDims) * elementSize);
+            decompressChunk(codec_, stored[i], data.data(), data.size(), path_);
+
+            const auto lower = glm::max(offset, chunkOffset);
+            const auto upper = glm::min(offset + dims, chunkOffset + chunkDims);
+            util::copyVoxels(data.data(), chunkDims, lower - chunkOffset, dest, dims,
+                             lower - offset, upper - lower, elementSize);
+        });
+    }
+}
+
+std::shared_ptr<VolumeRAM> ChunkedVolumeFile::read(size_t level, const size3_t& offset,
+                                                   const size3_t& dims) const {
+    auto ram = createVolumeRAM(dims, format_);
+    read(level, offset, dims, ram->getData());
+    return ram;
+}
+
+}  // namespace inviwo
@@ -0,0 +1,116 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/chunkedvolumeramloader.h>
+
+#include <inviwo/core/datastructures/volume/volumeram.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/util/formats.h>
+
+#include <fmt/std.h>
+
+namespace inviwo {
+
+namespace {
+
+class ChunkedBrickSource : public VolumeBrickSource {
+public:
+    ChunkedBrickSource(std::shared_ptr<const ChunkedVolumeFile> file, size_t level)
+        : file_{std::move(file)}, level_{level} {}
+
+    virtual const size3_t& getDimensions() const override {
+        return file_->getLevel(level_).dimensions;
+    }
+    virtual const DataFormatBase* getDataFormat() const override {
+        return file_->getDataFormat();
+    }
+    virtual std::shared_ptr<VolumeRAM> load(size3_t offset, size3_t dims) const override {
+        return file_->read(level_, offset, dims);
+    }
+    virtual std::optional<size3_t> getPreferredBrickSize() const override {
+        return file_->getLevel(level_).chunkSize;
+    }
+
+private:
+    std::shared_ptr<const ChunkedVolumeFile> file_;
+    size_t level_;
+};
+
+void checkFormat(const ChunkedVolumeFile& file, size_t level, const VolumeRepresentation& src) {
+    if (file.getDataFormat() != src.getDataFormat() ||
+        file.getLevel(level).dimensions != src.getDimensions()) {
+        throw DataReaderException(SourceContext{},
+                                  "Chunked volume file {:?g} does not match the expected format",
+                                  file.getPath());
+    }
+}
+
+}  // namespace
+
+ChunkedVolumeRAMLoader::ChunkedVolumeRAMLoader(std::shared_ptr<const ChunkedVolumeFile> file,
+                                               size_t level)
+    : file_{std::move(file)}, level_{level} {}
+
+ChunkedVolumeRAMLoader* ChunkedVolumeRAMLoader::clone() const {
+    return new ChunkedVolumeRAMLoader(*this);
+}
+
+std::shared_ptr<VolumeRepresentation> ChunkedVolumeRAMLoader::createRepresentation(
+    const VolumeRepresentation& src) const {
+    checkFormat(*file_, level_, src);
+
+    auto volumeRAM = createVolumeRAM(src.getDimensions(), src.getDataFormat(), nullptr,
+                                     src.getSwizzleMask(), src.getInterpolation(),
+                                     src.getWrapping());
+    file_->read(level_, size3_t{0}, src.getDimensions(), volumeRAM->getData());
+    return volumeRAM;
+}
+
+void ChunkedVolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentation> dest,
+                                                  const VolumeRepresentation& src) const {
+    checkFormat(*file_, level_, src);
+    auto volumeDst = std::static_pointer_cast<VolumeRAM>(dest);
+
+    if (src.getDimensions() != volumeDst->getDimensions()) {
+        volumeDst->setDimensions(src.getDimensions());
+    }
+    file_->read(level_, size3_t{0}, src.getDimensions(), volumeDst->getData());
+
+    volumeDst->setSwizzleMask(src.getSwizzleMask());
+    volumeDst->setInterpolation(src.getInterpolation());
+    volumeDst->setWrapping(src.getWrapping());
+}
+
+std::shared_ptr<const VolumeBrickSource> ChunkedVolumeRAMLoader::createBrickSource(
+    const VolumeRepresentation& src) const {
+    checkFormat(*file_, level_, src);
+    return std::make_shared<ChunkedBrickSource>(file_, level_);
+}
+
+}  // namespace inviwo
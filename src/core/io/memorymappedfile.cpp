@@ -0,0 +1,193 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/io/memorymappedfile.h>
+
+#include <inviwo/core/util/exception.h>
+
+#ifdef WIN32
+struct IUnknown;  // Workaround for "combaseapi.h(229): error C2187: syntax error: 'identifier' was
+                  // unexpected here" when using /permissive-
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <utility>
+
+#include <fmt/std.h>
+
+namespace inviwo::util {
+
+size_t MemoryMappedFile::pageSize() {
+#ifdef WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<size_t>(info.dwAllocationGranularity);
+#else
+    return static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& path, size_t offset,
+                                   std::optional<size_t> bytes)
+    : path_{path} {
+
+    const auto granularity = pageSize();
+    const auto baseOffset = offset - offset % granularity;
+
+#ifdef WIN32
+    file_ = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        file_ = nullptr;
+        throw FileException(SourceContext{}, "Could not open file: {:?g}", path);
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file_, &fileSize)) {
+        unmap();
+        throw FileException(SourceContext{}, "Could not query the size of file: {:?g}", path);
+    }
+    const auto totalSize = static_cast<size_t>(fileSize.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        throw FileException(SourceContext{}, "Could not open file: {:?g}", path);
+    }
+    struct stat info{};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        throw FileException(SourceContext{}, "Could not query the size of file: {:?g}", path);
+    }
+    const auto totalSize = static_cast<size_t>(info.st_size);
+#endif
+
+    const auto size = bytes.value_or(offset <= totalSize ? totalSize - offset : 0);
+    if (offset > totalSize || size > totalSize - offset) {
+#ifdef WIN32
+        unmap();
+#else
+        ::close(fd);
+#endif
+        throw FileException(SourceContext{},
+                            "Could not map {} bytes at offset {} of file {:?g} with size {}",
+                            size, offset, path, totalSize);
+    }
+
+    if (size == 0) {
+        // Mapping zero bytes is an error, represent an empty range with a null pointer
+#ifdef WIN32
+        unmap();
+#else
+        ::close(fd);
+#endif
+        return;
+    }
+
+    const auto baseSize = size + (offset - baseOffset);
+#ifdef WIN32
+    mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping_) {
+        unmap();
+        throw FileException(SourceContext{}, "Could not map file: {:?g}", path);
+    }
+    base_ = MapViewOfFile(mapping_, FILE_MAP_READ, static_cast<DWORD>(baseOffset >> 32),
+                          static_cast<DWORD>(baseOffset & 0xFFFFFFFF), baseSize);
+    if (!base_) {
+        unmap();
+        throw FileException(SourceContext{}, "Could not map file: {:?g}", path);
+    }
+#else
+    void* base =
+        ::mmap(nullptr, baseSize, PROT_READ, MAP_SHARED, fd, static_cast<off_t>(baseOffset));
+    // The mapping keeps its own reference to the file
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        throw FileException(SourceContext{}, "Could not map file: {:?g}", path);
+    }
+    base_ = base;
+#endif
+
+    baseSize_ = baseSize;
+    data_ = static_cast<const std::byte*>(base_) + (offset - baseOffset);
+    size_ = size;
+}
+
+MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& rhs) noexcept
+    : path_{std::move(rhs.path_)}
+    , base_{std::exchange(rhs.base_, nullptr)}
+    , baseSize_{std::exchange(rhs.baseSize_, 0)}
+    , data_{std::exchange(rhs.data_, nullptr)}
+    , size_{std::exchange(rhs.size_, 0)}
+#ifdef WIN32
+    , file_{std::exchange(rhs.file_, nullptr)}
+    , mapping_{std::exchange(rhs.mapping_, nullptr)}
+#endif
+{
+}
+
+MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& rhs) noexcept {
+    if (this != &rhs) {
+        unmap();
+        path_ = std::move(rhs.path_);
+        base_ = std::exchange(rhs.base_, nullptr);
+        baseSize_ = std::exchange(rhs.baseSize_, 0);
+        data_ = std::exchange(rhs.data_, nullptr);
+        size_ = std::exchange(rhs.size_, 0);
+#ifdef WIN32
+        file_ = std::exchange(rhs.file_, nullptr);
+        mapping_ = std::exchange(rhs.mapping_, nullptr);
+#endif
+    }
+    return *this;
+}
+
+MemoryMappedFile::~MemoryMappedFile() { unmap(); }
+
+void MemoryMappedFile::unmap() noexcept {
+#ifdef WIN32
+    if (base_) UnmapViewOfFile(base_);
+    if (mapping_) CloseHandle(mapping_);
+    if (file_) CloseHandle(file_);
+    mapping_ = nullptr;
+    file_ = nullptr;
+#else
+    if (base_) ::munmap(base_, baseSize_);
+#endif
+    base_ = nullptr;
+    baseSize_ = 0;
+    data_ = nullptr;
+    size_ = 0;
+}
+
+}  // namespace inviwo::util
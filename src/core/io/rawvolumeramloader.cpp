@@ -30,11 +30,144 @@
 #include <inviwo/core/io/rawvolumeramloader.h>
 
 #include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/blockcompression.h>
+#include <inviwo/core/io/curlutils.h>
+#include <inviwo/core/io/memorymappedfile.h>
+#include <inviwo/core/util/exception.h>
 
 #include <glm/gtx/component_wise.hpp>
 
+#include <mutex>
+#include <optional>
+#include <vector>
+
 namespace inviwo {
 
+namespace {
+
+/**
+ * Big endian data is swapped per component, the components of a voxel keep their order.
+ */
+size_t componentSize(const DataFormatBase* format) { return format->getPrecision() / 8; }
+
+/**
+ * Try to memory map the data. This is only possible if the data is stored uncompressed, in native
+ * (little endian) byte order or with single byte components, and properly aligned in the file.
+ * Returns nullptr otherwise, or if the mapping fails, in which case the data should be read
+ * instead.
+ */
+std::shared_ptr<const util::MemoryMappedFile> mapFile(const std::filesystem::path& rawFile,
+                                                      size_t offset, size_t bytes,
+                                                      ByteOrder byteOrder, Compression compression,
+                                                      const DataFormatBase* format) {
+    if (compression == Compression::Enabled) return nullptr;
+    if (byteOrder == ByteOrder::BigEndian && componentSize(format) > 1) return nullptr;
+    if (offset % componentSize(format) != 0) return nullptr;
+
+    try {
+        return std::make_shared<const util::MemoryMappedFile>(net::downloadAndCacheIfUrl(rawFile),
+                                                              offset, bytes);
+    } catch (const Exception&) {
+        return nullptr;
+    }
+}
+
+/**
+ * Reads bricks directly from a raw file. The file is memory mapped when possible, otherwise the
+ * rows covered by a brick are read slice by slice. For block compressed files the block index is
+ * built once, and only the blocks covering the rows of a brick are decompressed. Other compressed
+ * files can not be read partially, those are read in full once on first access.
+ */
+class RawBrickSource : public VolumeBrickSource {
+public:
+    RawBrickSource(const std::filesystem::path& rawFile, size_t offset, ByteOrder byteOrder,
+                   Compression compression, const size3_t& dimensions,
+                   const DataFormatBase* format)
+        : rawFile_{rawFile}
+        , offset_{offset}
+        , byteOrder_{byteOrder}
+        , compression_{compression}
+        , dimensions_{dimensions}
+        , format_{format}
+        , mapping_{mapFile(rawFile, offset,
+                           glm::compMul(dimensions) * format->getSizeInBytes(), byteOrder,
+                           compression, format)}
+        , index_{createIndex(rawFile, compression)} {}
+
+    virtual const size3_t& getDimensions() const override { return dimensions_; }
+    virtual const DataFormatBase* getDataFormat() const override { return format_; }
+
+    virtual std::shared_ptr<VolumeRAM> load(size3_t offset, size3_t dims) const override {
+        auto brick = createVolumeRAM(dims, format_);
+        const auto elementSize = format_->getSizeInBytes();
+
+        if (mapping_) {
+            util::copyVoxels(mapping_->data(), dimensions_, offset, brick->getData(), dims,
+                             size3_t{0}, dims, elementSize);
+        } else if (index_) {
+            // Decompress the rows of all slices at once, such that every block is only
+            // decompressed once even if it covers several slices
+            const auto sliceBytes = dimensions_.x * dims.y * elementSize;
+            std::vector<std::byte> rows(sliceBytes * dims.z);
+            std::vector<util::blockcompression::Index::Range> ranges(dims.z);
+            for (size_t z = 0; z < dims.z; ++z) {
+                const auto first = dimensions_.x * (offset.y + dimensions_.y * (offset.z + z));
+                ranges[z] = {offset_ + first * elementSize, sliceBytes,
+                             rows.data() + z * sliceBytes};
+            }
+            index_->read(ranges);
+            if (byteOrder_ == ByteOrder::BigEndian && componentSize(format_) > 1) {
+                util::convertToLittleEndian(rows.data(), rows.size(), componentSize(format_));
+            }
+            util::copyVoxels(rows.data(), size3_t{dimensions_.x, dims.y, dims.z},
+                             size3_t{offset.x, 0, 0}, brick->getData(), dims, size3_t{0}, dims,
+                             elementSize);
+        } else if (compression_ == Compression::Disabled) {
+            std::vector<std::byte> rows(dimensions_.x * dims.y * elementSize);
+            for (size_t z = 0; z < dims.z; ++z) {
+                const auto first = dimensions_.x * (offset.y + dimensions_.y * (offset.z + z));
+                util::readBytesIntoBuffer(rawFile_, offset_ + first * elementSize, rows.size(),
+                                          byteOrder_, componentSize(format_), rows.data());
+                util::copyVoxels(rows.data(), size3_t{dimensions_.x, dims.y, 1},
+                                 size3_t{offset.x, 0, 0}, brick->getData(), dims,
+                                 size3_t{0, 0, z}, size3_t{dims.x, dims.y, 1}, elementSize);
+            }
+        } else {
+            std::call_once(loadFull_, [&]() {
+                full_ = createVolumeRAM(dimensions_, format_);
+                util::readCompressedBytesIntoBuffer(rawFile_, offset_, full_->getNumberOfBytes(),
+                                                    byteOrder_, componentSize(format_),
+                                                    full_->getData());
+            });
+            util::copyVoxels(full_->getData(), dimensions_, offset, brick->getData(), dims,
+                             size3_t{0}, dims, elementSize);
+        }
+        return brick;
+    }
+
+private:
+    static std::optional<util::blockcompression::Index> createIndex(
+        const std::filesystem::path& rawFile, Compression compression) {
+        if (compression == Compression::Disabled) return std::nullopt;
+        const auto filePath = net::downloadAndCacheIfUrl(rawFile);
+        if (!util::blockcompression::isBlockCompressed(filePath)) return std::nullopt;
+        return util::blockcompression::Index{filePath};
+    }
+
+    std::filesystem::path rawFile_;
+    size_t offset_;
+    ByteOrder byteOrder_;
+    Compression compression_;
+    size3_t dimensions_;
+    const DataFormatBase* format_;
+    std::shared_ptr<const util::MemoryMappedFile> mapping_;
+    std::optional<util::blockcompression::Index> index_;
+    mutable std::once_flag loadFull_;
+    mutable std::shared_ptr<VolumeRAM> full_;
+};
+
+}  // namespace
+
 RawVolumeRAMLoader::RawVolumeRAMLoader(const std::filesystem::path& rawFile, size_t offset,
                                        ByteOrder byteOrder, Compression compression)
     : rawFile_{rawFile}, offset_{offset}, byteOrder_{byteOrder}, compression_{compression} {}
@@ -45,13 +178,21 @@ std::shared_ptr<VolumeRepresentation> RawVolumeRAMLoader::createRepresentation(
     const VolumeRepresentation& src) const {
 
     const auto size = glm::compMul(src.getDimensions()) * src.getDataFormat()->getSizeInBytes();
+
+    if (auto mapping = mapFile(rawFile_, offset_, size, byteOrder_, compression_,
+                           src.getDataFormat())) {
+        return createVolumeRAM(src.getDimensions(), src.getDataFormat(),
+                               util::MemoryMappedFile::share<std::byte>(std::move(mapping)),
+                               src.getSwizzleMask(), src.getInterpolation(), src.getWrapping());
+    }
+
     auto data = std::make_unique<char[]>(size);
     if (compression_ == Compression::Enabled) {
         util::readCompressedBytesIntoBuffer(rawFile_, offset_, size, byteOrder_,
-                                            src.getDataFormat()->getSizeInBytes(), data.get());
+                                            componentSize(src.getDataFormat()), data.get());
     } else {
         util::readBytesIntoBuffer(rawFile_, offset_, size, byteOrder_,
-                                  src.getDataFormat()->getSizeInBytes(), data.get());
+                                  componentSize(src.getDataFormat()), data.get());
     }
 
     auto volumeRAM =
@@ -66,23 +207,39 @@ void RawVolumeRAMLoader::updateRepresentation(std::shared_ptr<VolumeRepresentati
                                               const VolumeRepresentation& src) const {
     auto volumeDst = std::static_pointer_cast<VolumeRAM>(dest);
 
-    if (src.getDimensions() != volumeDst->getDimensions()) {
-        volumeDst->setDimensions(src.getDimensions());
-    }
-
     const auto size = glm::compMul(src.getDimensions());
-    if (compression_ == Compression::Enabled) {
-        util::readCompressedBytesIntoBuffer(
-            rawFile_, offset_, size * src.getDataFormat()->getSizeInBytes(), byteOrder_,
-            src.getDataFormat()->getSizeInBytes(), volumeDst->getData());
+
+    if (auto mapping = mapFile(rawFile_, offset_, size * src.getDataFormat()->getSizeInBytes(),
+                           byteOrder_, compression_, src.getDataFormat())) {
+        volumeDst->dispatch<void>([&]<typename T>(VolumeRAMPrecision<T>* vrprecision) {
+            vrprecision->setSharedData(util::MemoryMappedFile::share<T>(std::move(mapping)),
+                                       src.getDimensions());
+        });
     } else {
-        util::readBytesIntoBuffer(rawFile_, offset_, size * src.getDataFormat()->getSizeInBytes(),
-                                  byteOrder_, src.getDataFormat()->getSizeInBytes(),
-                                  volumeDst->getData());
+        if (src.getDimensions() != volumeDst->getDimensions()) {
+            volumeDst->setDimensions(src.getDimensions());
+        }
+
+        if (compression_ == Compression::Enabled) {
+            util::readCompressedBytesIntoBuffer(
+                rawFile_, offset_, size * src.getDataFormat()->getSizeInBytes(), byteOrder_,
+                componentSize(src.getDataFormat()), volumeDst->getData());
+        } else {
+            util::readBytesIntoBuffer(
+                rawFile_, offset_, size * src.getDataFormat()->getSizeInBytes(), byteOrder_,
+                componentSize(src.getDataFormat()), volumeDst->getData());
+        }
     }
 
     volumeDst->setSwizzleMask(src.getSwizzleMask());
     volumeDst->setInterpolation(src.getInterpolation());
     volumeDst->setWrapping(src.getWrapping());
 }
+
+std::shared_ptr<const VolumeBrickSource> RawVolumeRAMLoader::createBrickSource(
+    const VolumeRepresentation& src) const {
+    return std::make_shared<RawBrickSource>(rawFile_, offset_, byteOrder_, compression_,
+                                            src.getDimensions(), src.getDataFormat());
+}
+
 }  // namespace inviwo
@@ -35,15 +35,51 @@
 #include <inviwo/core/network/networkutils.h>
 #include <inviwo/core/network/networklock.h>
 #include <inviwo/core/util/clock.h>
+#include <inviwo/core/util/threadpool.h>
+#include <inviwo/core/common/inviwoapplication.h>
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <unordered_map>
 
 namespace inviwo {
 
+namespace {
+
+/**
+ * Group the topologically sorted processors into levels such that each processor only depends on
+ * processors in earlier levels. Processors within a level are independent of each other.
+ */
+std::vector<std::vector<Processor*>> dependencyLevels(const std::vector<Processor*>& sorted) {
+    std::unordered_map<Processor*, size_t> levelOf;
+    std::vector<std::vector<Processor*>> levels;
+    for (auto* processor : sorted) {
+        size_t level = 0;
+        for (auto* inport : processor->getInports()) {
+            for (auto* outport : inport->getConnectedOutports()) {
+                if (!processor->isConnectionActive(inport, outport)) continue;
+                if (auto it = levelOf.find(outport->getProcessor()); it != levelOf.end()) {
+                    level = std::max(level, it->second + 1);
+                }
+            }
+        }
+        levelOf[processor] = level;
+        if (levels.size() <= level) levels.resize(level + 1);
+        levels[level].push_back(processor);
+    }
+    return levels;
+}
+
+}  // namespace
+
 ProcessorNetworkEvaluator::ProcessorNetworkEvaluator(ProcessorNetwork* processorNetwork)
     : processorNetwork_(processorNetwork)
     , processorsSorted_(util::topologicalSortFiltered(processorNetwork_))
     , needsSorting_(true)
     , evaluationQueued_(false)
-    , exceptionHandler_(StandardEvaluationErrorHandler()) {
+    , exceptionHandler_(StandardEvaluationErrorHandler())
+    , mode_{EvaluationMode::Sequential} {
 
     processorNetwork_->addObserver(this);
 }
@@ -52,6 +88,14 @@ void ProcessorNetworkEvaluator::setExceptionHandler(EvaluationErrorHandler handl
     exceptionHandler_ = handler;
 }
 
+void ProcessorNetworkEvaluator::setEvaluationMode(EvaluationMode mode) {
+    if (mode_ == mode) return;
+    mode_ = mode;
+    needsSorting_ = true;
+}
+
+EvaluationMode ProcessorNetworkEvaluator::getEvaluationMode() const { return mode_; }
+
 void ProcessorNetworkEvaluator::onProcessorNetworkEvaluateRequest() {
     // Direct request, thus we don't want to queue the evaluation anymore
     evaluationQueued_ = false;
@@ -102,63 +146,155 @@ void ProcessorNetworkEvaluator::evaluate() {
 
     if (needsSorting_) {
         processorsSorted_ = util::topologicalSortFiltered(processorNetwork_);
+        if (mode_ == EvaluationMode::Parallel) {
+            processorLevels_ = dependencyLevels(processorsSorted_);
+        } else {
+            processorLevels_.clear();
+        }
         needsSorting_ = false;
     }
 
     IVW_CPU_PROFILING_IF(500, "Evaluated Processor Network");
 
+    auto* app = processorNetwork_->getApplication();
+    if (mode_ == EvaluationMode::Parallel && app && app->getThreadPool().getSize() > 0) {
+        evaluateParallel();
+    } else {
+        evaluateSequential();
+    }
+
+    notifyObserversProcessorNetworkEvaluationEnd();
+}
+
+bool ProcessorNetworkEvaluator::prepare(Processor* processor) {
+    try {
+        // re-initialize resources (e.g., shaders) if necessary
+        if (processor->getInvalidationLevel() >= InvalidationLevel::InvalidResources) {
+            processor->initializeResources();
+        }
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::InitResource, SourceContext{});
+        return false;
+    }
+
+    try {
+        // call onChange for all invalid inports
+        for (auto inport : processor->getInports()) {
+            inport->callOnChangeIfChanged();
+        }
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::PortOnChange, SourceContext{});
+        return false;
+    }
+    return true;
+}
+
+void ProcessorNetworkEvaluator::notReady(Processor* processor) {
+    try {
+        processor->doIfNotReady();
+    } catch (...) {
+        exceptionHandler_(processor, EvaluationType::NotReady, SourceContext{});
+    }
+}
+
+void ProcessorNetworkEvaluator::evaluateSequential() {
     for (auto processor : processorsSorted_) {
-        if (!processor->isValid()) {
-            if (processor->isReady()) {
-                try {
-                    // re-initialize resources (e.g., shaders) if necessary
-                    if (processor->getInvalidationLevel() >= InvalidationLevel::InvalidResources) {
-                        processor->initializeResources();
-                    }
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::InitResource, SourceContext{});
-                    continue;
-                }
+        if (processor->isValid()) continue;
 
-                try {
-                    // call onChange for all invalid inports
-                    for (auto inport : processor->getInports()) {
-                        inport->callOnChangeIfChanged();
-                    }
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::PortOnChange, SourceContext{});
-                    continue;
-                }
+        if (!processor->isReady()) {
+            notReady(processor);
+            continue;
+        }
 
-                processor->notifyObserversAboutToProcess(processor);
+        if (!prepare(processor)) continue;
 
-                try {
-                    IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
-                    // do the actual processing
-                    processor->process();
+        processor->notifyObserversAboutToProcess(processor);
 
-                    // Set processor as valid only if we still are ready.
-                    // Callbacks might have made our inports invalid, if so abort
-                    // the evaluation by not setting the processor valid.
-                    if (processor->isReady()) processor->setValid();
+        try {
+            IVW_CPU_PROFILING_IF(500, "Processed " << processor->getIdentifier());
+            // do the actual processing
+            processor->process();
 
-                } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::Process, SourceContext{});
-                }
+            // Set processor as valid only if we still are ready.
+            // Callbacks might have made our inports invalid, if so abort
+            // the evaluation by not setting the processor valid.
+            if (processor->isReady()) processor->setValid();
+
+        } catch (...) {
+            exceptionHandler_(processor, EvaluationType::Process, SourceContext{});
+        }
+
+        processor->notifyObserversFinishedProcess(processor);
+    }
+}
+
+void ProcessorNetworkEvaluator::evaluateParallel() {
+    auto& pool = processorNetwork_->getApplication()->getThreadPool();
+
+    std::vector<Processor*> toProcess;
+    std::vector<std::exception_ptr> errors;
+    std::vector<std::future<void>> futures;
 
-                processor->notifyObserversFinishedProcess(processor);
+    for (const auto& level : processorLevels_) {
+        toProcess.clear();
+        for (auto* processor : level) {
+            if (processor->isValid()) continue;
 
-            } else {
+            if (!processor->isReady()) {
+                notReady(processor);
+                continue;
+            }
+
+            if (!prepare(processor)) continue;
+
+            processor->notifyObserversAboutToProcess(processor);
+            toProcess.push_back(processor);
+        }
+
+        errors.assign(toProcess.size(), nullptr);
+        const auto run = [&toProcess, &errors](size_t i) {
+            try {
+                IVW_CPU_PROFILING_IF(500, "Processed " << toProcess[i]->getIdentifier());
+                toProcess[i]->process();
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        };
+
+        // Hand off the thread safe processors to the pool, a single processor gains nothing from
+        // being dispatched so that is processed directly.
+        futures.clear();
+        if (toProcess.size() > 1) {
+            for (size_t i = 0; i < toProcess.size(); ++i) {
+                if (toProcess[i]->getThreading() == ProcessorThreading::Any) {
+                    futures.push_back(pool.enqueue(ThreadPool::Priority::Interactive, run, i));
+                }
+            }
+        }
+        // Process the rest on this thread while the pool is working
+        for (size_t i = 0; i < toProcess.size(); ++i) {
+            if (toProcess.size() == 1 ||
+                toProcess[i]->getThreading() != ProcessorThreading::Any) {
+                run(i);
+            }
+        }
+        for (auto& future : futures) future.wait();
+
+        for (size_t i = 0; i < toProcess.size(); ++i) {
+            auto* processor = toProcess[i];
+            if (errors[i]) {
                 try {
-                    processor->doIfNotReady();
+                    std::rethrow_exception(errors[i]);
                 } catch (...) {
-                    exceptionHandler_(processor, EvaluationType::NotReady, SourceContext{});
+                    exceptionHandler_(processor, EvaluationType::Process, SourceContext{});
                 }
+            } else if (processor->isReady()) {
+                // Set processor as valid only if we still are ready, see evaluateSequential
+                processor->setValid();
             }
+            processor->notifyObserversFinishedProcess(processor);
         }
     }
-
-    notifyObserversProcessorNetworkEvaluationEnd();
 }
 
 void ProcessorNetworkEvaluator::onProcessorSinkChanged(Processor*) { needsSorting_ = true; }
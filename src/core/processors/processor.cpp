@@ -69,7 +69,8 @@ Processor::Processor(std::string_view identifier, std::string_view displayName)
                 [this]() { return inports_.empty(); }}
     , identifier_(identifier)
     , displayName_{displayName}
-    , network_(nullptr) {
+    , network_(nullptr)
+    , threading_{ProcessorThreading::MainThread} {
 
     if (!identifier_.empty()) {
         util::validateIdentifier(identifier_, "Processor");
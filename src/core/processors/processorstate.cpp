@@ -50,4 +50,17 @@ std::string_view enumToStr(CodeState cs) {
 
 std::ostream& operator<<(std::ostream& ss, CodeState cs) { return ss << enumToStr(cs); }
 
+std::string_view enumToStr(ProcessorThreading pt) {
+    switch (pt) {
+        case ProcessorThreading::MainThread:
+            return "MainThread";
+        case ProcessorThreading::Any:
+            return "Any";
+    }
+    throw Exception(SourceContext{}, "Found invalid ProcessorThreading enum value '{}'",
+                    static_cast<int>(pt));
+}
+
+std::ostream& operator<<(std::ostream& ss, ProcessorThreading pt) { return ss << enumToStr(pt); }
+
 }  // namespace inviwo
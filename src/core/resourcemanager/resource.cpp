@@ -47,6 +47,11 @@ ResourceManager* getResourceManager() {
     return util::getResourceManager(app);
 }
 
+ResourceManager* getBudgetManager() {
+    if (!InviwoApplication::isInitialized()) return nullptr;
+    return util::getResourceManager(InviwoApplication::getPtr());
+}
+
 }  // namespace
 
 void add(const RAM& key, Resource resource) {
@@ -100,6 +105,22 @@ void meta(const PY& key, const ResourceMeta& meta) {
     }
 }
 
+void addEvictable(const RAM& key, size_t bytes, std::function<void()> release) {
+    if (auto* rm = getBudgetManager()) {
+        rm->addEvictable(key, bytes, std::move(release));
+    }
+}
+void useEvictable(const RAM& key) {
+    if (auto* rm = getBudgetManager()) {
+        rm->useEvictable(key);
+    }
+}
+void removeEvictable(const RAM& key) {
+    if (auto* rm = getBudgetManager()) {
+        rm->removeEvictable(key);
+    }
+}
+
 RAM toRAM(const void* ptr) {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
     return resource::RAM{reinterpret_cast<std::uintptr_t>(ptr)};
@@ -29,4 +29,104 @@
 
 #include <inviwo/core/resourcemanager/resourcemanager.h>
 
-namespace inviwo {}  // namespace inviwo
+#include <iterator>
+#include <vector>
+
+namespace inviwo {
+
+void ResourceManager::addEvictable(const resource::RAM& key, size_t bytes,
+                                   std::function<void()> release) {
+    {
+        const std::scoped_lock lock{evictableMutex_};
+        if (auto it = evictables_.find(key); it != evictables_.end()) {
+            evictableSize_ = evictableSize_ - it->second->bytes + bytes;
+            it->second->bytes = bytes;
+            it->second->release = std::move(release);
+            ++it->second->uses;
+            lru_.splice(lru_.begin(), lru_, it->second);
+        } else {
+            lru_.push_front(Evictable{key, bytes, 1, std::move(release)});
+            evictables_.emplace(key, lru_.begin());
+            evictableSize_ += bytes;
+        }
+    }
+    evict();
+}
+
+void ResourceManager::useEvictable(const resource::RAM& key) {
+    const std::scoped_lock lock{evictableMutex_};
+    if (auto it = evictables_.find(key); it != evictables_.end()) {
+        ++it->second->uses;
+        lru_.splice(lru_.begin(), lru_, it->second);
+    }
+}
+
+bool ResourceManager::removeEvictable(const resource::RAM& key) {
+    const std::scoped_lock lock{evictableMutex_};
+    if (auto it = evictables_.find(key); it != evictables_.end()) {
+        evictableSize_ -= it->second->bytes;
+        lru_.erase(it->second);
+        evictables_.erase(it);
+        return true;
+    }
+    return false;
+}
+
+void ResourceManager::setBudget(size_t bytes) {
+    {
+        const std::scoped_lock lock{evictableMutex_};
+        budget_ = bytes;
+    }
+    evict();
+}
+
+size_t ResourceManager::getBudget() const {
+    const std::scoped_lock lock{evictableMutex_};
+    return budget_;
+}
+
+void ResourceManager::setEvictionPolicy(EvictionPolicy policy) {
+    const std::scoped_lock lock{evictableMutex_};
+    policy_ = policy;
+}
+
+auto ResourceManager::getEvictionPolicy() const -> EvictionPolicy {
+    const std::scoped_lock lock{evictableMutex_};
+    return policy_;
+}
+
+size_t ResourceManager::getEvictableSize() const {
+    const std::scoped_lock lock{evictableMutex_};
+    return evictableSize_;
+}
+
+size_t ResourceManager::getNumberOfEvictables() const {
+    const std::scoped_lock lock{evictableMutex_};
+    return lru_.size();
+}
+
+void ResourceManager::evict() {
+    // Release outside of the lock, the release functions might register or remove evictables
+    std::vector<std::function<void()>> released;
+    {
+        const std::scoped_lock lock{evictableMutex_};
+        while (evictableSize_ > budget_ && !lru_.empty()) {
+            auto victim = std::prev(lru_.end());
+            if (policy_ == EvictionPolicy::LeastFrequentlyUsed) {
+                // The list is ordered by recency, ties go to the least recently used
+                for (auto it = lru_.begin(); it != lru_.end(); ++it) {
+                    if (it->uses <= victim->uses) victim = it;
+                }
+            }
+            evictableSize_ -= victim->bytes;
+            released.push_back(std::move(victim->release));
+            evictables_.erase(victim->key);
+            lru_.erase(victim);
+        }
+    }
+    for (auto& release : released) {
+        if (release) release();
+    }
+}
+
+}  // namespace inviwo
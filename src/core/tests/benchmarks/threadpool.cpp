@@ -0,0 +1,196 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <inviwo/core/util/threadpool.h>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * The previous implementation of inviwo::ThreadPool: one shared queue guarded by a single mutex,
+ * and a heap allocated packaged_task wrapped in a std::function for every task.
+ */
+class LegacyThreadPool {
+public:
+    explicit LegacyThreadPool(size_t threads) {
+        for (size_t i = 0; i < threads; ++i) {
+            workers_.emplace_back([this]() {
+                for (;;) {
+                    std::function<void()> task;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        condition_.wait(lock, [this] { return stop_ || !tasks_.empty(); });
+                        if (stop_ && tasks_.empty()) return;
+                        task = std::move(tasks_.front());
+                        tasks_.pop();
+                    }
+                    task();
+                }
+            });
+        }
+    }
+    ~LegacyThreadPool() {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        condition_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    template <class F, class... Args>
+    auto enqueue(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>> {
+        using return_type = std::invoke_result_t<F, Args...>;
+        auto task = std::make_shared<std::packaged_task<return_type()>>(
+            std::bind(std::forward<F>(f), std::forward<Args>(args)...));
+        std::future<return_type> res = task->get_future();
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            tasks_.emplace([task]() { (*task)(); });
+        }
+        condition_.notify_one();
+        return res;
+    }
+
+    void enqueueRaw(std::function<void()> task) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            tasks_.emplace(std::move(task));
+        }
+        condition_.notify_one();
+    }
+
+private:
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    bool stop_ = false;
+};
+
+size_t threadCount() { return std::max(2u, std::thread::hardware_concurrency()); }
+
+template <typename Pool>
+std::unique_ptr<Pool> makePool() {
+    if constexpr (std::is_same_v<Pool, inviwo::ThreadPool>) {
+        return std::make_unique<Pool>(threadCount(), []() {}, []() {});
+    } else {
+        return std::make_unique<Pool>(threadCount());
+    }
+}
+
+int work(int i) {
+    int res = i;
+    for (int j = 0; j < 64; ++j) res = res * 31 + j;
+    return res;
+}
+
+/// Submit many small tasks from one thread and wait for all the futures
+template <typename Pool>
+void Enqueue(benchmark::State& state) {
+    auto pool = makePool<Pool>();
+    const auto count = static_cast<int>(state.range(0));
+    std::vector<std::future<int>> futures;
+    futures.reserve(count);
+    for (auto _ : state) {
+        futures.clear();
+        for (int i = 0; i < count; ++i) futures.push_back(pool->enqueue(work, i));
+        for (auto& future : futures) benchmark::DoNotOptimize(future.get());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// Submit many small fire and forget tasks, like PoolProcessor::dispatchMany
+template <typename Pool>
+void EnqueueRaw(benchmark::State& state) {
+    auto pool = makePool<Pool>();
+    const auto count = static_cast<int>(state.range(0));
+    for (auto _ : state) {
+        std::latch done{count};
+        std::atomic<int> sum = 0;
+        for (int i = 0; i < count; ++i) {
+            pool->enqueueRaw([&done, &sum, i]() {
+                sum += work(i);
+                done.count_down();
+            });
+        }
+        done.wait();
+        benchmark::DoNotOptimize(sum.load());
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+
+/// Tasks that in turn submit tasks from the worker threads
+template <typename Pool>
+void Nested(benchmark::State& state) {
+    auto pool = makePool<Pool>();
+    const auto count = static_cast<int>(state.range(0));
+    constexpr int fanOut = 16;
+    for (auto _ : state) {
+        std::latch done{count * fanOut};
+        std::atomic<int> sum = 0;
+        for (int i = 0; i < count; ++i) {
+            pool->enqueueRaw([&pool, &done, &sum, i]() {
+                for (int j = 0; j < fanOut; ++j) {
+                    pool->enqueueRaw([&done, &sum, i, j]() {
+                        sum += work(i * fanOut + j);
+                        done.count_down();
+                    });
+                }
+            });
+        }
+        done.wait();
+        benchmark::DoNotOptimize(sum.load());
+    }
+    state.SetItemsProcessed(state.iterations() * count * fanOut);
+}
+
+}  // namespace
+
+BENCHMARK(Enqueue<LegacyThreadPool>)->RangeMultiplier(8)->Range(64, 32768)->UseRealTime();
+BENCHMARK(Enqueue<inviwo::ThreadPool>)->RangeMultiplier(8)->Range(64, 32768)->UseRealTime();
+BENCHMARK(EnqueueRaw<LegacyThreadPool>)->RangeMultiplier(8)->Range(64, 32768)->UseRealTime();
+BENCHMARK(EnqueueRaw<inviwo::ThreadPool>)->RangeMultiplier(8)->Range(64, 32768)->UseRealTime();
+BENCHMARK(Nested<LegacyThreadPool>)->RangeMultiplier(8)->Range(64, 4096)->UseRealTime();
+BENCHMARK(Nested<inviwo::ThreadPool>)->RangeMultiplier(8)->Range(64, 4096)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,150 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/io/blockcompression.h>
+#include <inviwo/core/io/bytereaderutil.h>
+#include <inviwo/core/io/bytewriterutil.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/tempfilehandle.h>
+
+#include <bit>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+std::vector<std::uint32_t> testData() {
+    std::vector<std::uint32_t> data(100'003);
+    std::iota(data.begin(), data.end(), std::uint32_t{0});
+    return data;
+}
+
+}  // namespace
+
+TEST(BlockCompression, ReadRanges) {
+    const auto data = testData();
+    const util::TempFileHandle file{"inviwo", ".gz"};
+    constexpr size_t blockSize = 4096;
+    util::blockcompression::write(file.getFileName(), data.data(), data.size() * 4, blockSize);
+    EXPECT_TRUE(util::blockcompression::isBlockCompressed(file.getFileName()));
+
+    // whole file, within one block, across block boundaries, and the last partial block
+    for (const auto& [first, count] : std::vector<std::pair<size_t, size_t>>{
+             {0, data.size()}, {10, 20}, {1000, 2000}, {data.size() - 3, 3}}) {
+        std::vector<std::uint32_t> result(count);
+        util::blockcompression::read(file.getFileName(), first * 4, count * 4, result.data());
+        EXPECT_TRUE(std::equal(result.begin(), result.end(), data.begin() + first))
+            << "range " << first << " + " << count;
+    }
+
+    std::vector<std::uint32_t> result(10);
+    EXPECT_THROW(util::blockcompression::read(file.getFileName(), (data.size() - 5) * 4,
+                                              result.size() * 4, result.data()),
+                 DataReaderException);
+}
+
+TEST(BlockCompression, Index) {
+    const auto data = testData();
+    const util::TempFileHandle file{"inviwo", ".gz"};
+    util::blockcompression::write(file.getFileName(), data.data(), data.size() * 4, 4096);
+
+    const util::blockcompression::Index index{file.getFileName()};
+    EXPECT_EQ(index.size(), data.size() * 4);
+    EXPECT_EQ(index.blocks().size(), (data.size() * 4 + 4095) / 4096);
+
+    // several ranges sharing blocks, and one covering whole blocks
+    std::vector<std::uint32_t> a(3), b(5), c(5000);
+    const std::vector<util::blockcompression::Index::Range> ranges{
+        {1020 * 4, a.size() * 4, a.data()},
+        {1030 * 4, b.size() * 4, b.data()},
+        {100 * 4, c.size() * 4, c.data()}};
+    index.read(ranges);
+    EXPECT_TRUE(std::equal(a.begin(), a.end(), data.begin() + 1020));
+    EXPECT_TRUE(std::equal(b.begin(), b.end(), data.begin() + 1030));
+    EXPECT_TRUE(std::equal(c.begin(), c.end(), data.begin() + 100));
+
+    EXPECT_THROW(index.read((data.size() - 1) * 4, 8, a.data()), DataReaderException);
+
+    const util::TempFileHandle raw{"inviwo", ".raw"};
+    util::writeBytes(raw.getFileName(), data.data(), data.size() * 4, Compression::Disabled);
+    EXPECT_THROW(util::blockcompression::Index{raw.getFileName()}, DataReaderException);
+}
+
+TEST(BlockCompression, BigEndian) {
+    auto data = testData();
+    for (auto& item : data) item = std::byteswap(item);
+    const util::TempFileHandle file{"inviwo", ".gz"};
+    util::writeBytes(file.getFileName(), data.data(), data.size() * 4, Compression::Enabled);
+
+    std::vector<std::uint32_t> result(data.size() - 7);
+    util::readCompressedBytesIntoBuffer(file.getFileName(), 7 * 4, result.size() * 4,
+                                        ByteOrder::BigEndian, 4, result.data());
+    for (size_t i = 0; i < result.size(); ++i) {
+        ASSERT_EQ(result[i], i + 7);
+    }
+}
+
+TEST(BlockCompression, InMemory) {
+    const auto data = testData();
+    const std::span<const unsigned char> bytes{
+        reinterpret_cast<const unsigned char*>(data.data()), data.size() * 4};
+    const auto compressed = util::blockcompression::compress(bytes, 4096);
+
+    std::vector<std::uint32_t> result(data.size());
+    util::blockcompression::decompress(
+        compressed, {reinterpret_cast<unsigned char*>(result.data()), result.size() * 4});
+    EXPECT_EQ(result, data);
+
+    result.pop_back();
+    EXPECT_THROW(util::blockcompression::decompress(
+                     compressed, {reinterpret_cast<unsigned char*>(result.data()),
+                                  result.size() * 4}),
+                 DataReaderException);
+
+    const auto empty = util::blockcompression::compress({});
+    EXPECT_NO_THROW(util::blockcompression::decompress(empty, {}));
+}
+
+TEST(BlockCompression, NotBlockCompressed) {
+    const auto data = testData();
+    const util::TempFileHandle file{"inviwo", ".raw"};
+    util::writeBytes(file.getFileName(), data.data(), data.size() * 4, Compression::Disabled);
+    EXPECT_FALSE(util::blockcompression::isBlockCompressed(file.getFileName()));
+}
+
+}  // namespace inviwo
@@ -0,0 +1,202 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/chunkedvolumefile.h>
+#include <inviwo/core/io/chunkedvolumeramloader.h>
+#include <inviwo/core/io/datareaderexception.h>
+#include <inviwo/core/io/datawriterexception.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/util/indexmapper.h>
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size3_t dims{21, 10, 9};
+
+std::shared_ptr<VolumeRAMPrecision<std::uint16_t>> createVolume() {
+    auto ram = std::make_shared<VolumeRAMPrecision<std::uint16_t>>(dims);
+    auto* data = ram->getDataTyped();
+    std::iota(data, data + glm::compMul(dims), std::uint16_t{0});
+    return ram;
+}
+
+}  // namespace
+
+TEST(ChunkedVolumeFile, ReadRegions) {
+    const auto ram = createVolume();
+    const VolumeRAMBrickSource source{ram};
+    const util::TempFileHandle file{"inviwo", ".ivc"};
+
+    for (auto codec : {ChunkedVolumeFile::Codec::None, ChunkedVolumeFile::Codec::Deflate}) {
+        const std::vector<const VolumeBrickSource*> levels{&source};
+        ChunkedVolumeFile::write(file.getFileName(), levels,
+                                 {.chunkSize = size3_t{8, 4, 4}, .codec = codec});
+
+        const ChunkedVolumeFile chunked{file.getFileName()};
+        EXPECT_EQ(chunked.getCodec(), codec);
+        EXPECT_EQ(chunked.getDataFormat(), ram->getDataFormat());
+        ASSERT_EQ(chunked.getNumberOfLevels(), 1);
+        EXPECT_EQ(chunked.getLevel(0).dimensions, dims);
+        EXPECT_EQ(chunked.getLevel(0).chunkCount, size3_t(3, 3, 3));
+
+        // whole volume, within one chunk, and across chunk boundaries
+        const util::IndexMapper3D index{dims};
+        for (const auto& [offset, size] : std::vector<std::pair<size3_t, size3_t>>{
+                 {size3_t{0}, dims},
+                 {size3_t{1, 1, 1}, size3_t{2}},
+                 {size3_t{5, 3, 2}, size3_t{12, 7, 7}}}) {
+            const auto region = chunked.read(0, offset, size);
+            const auto* result =
+                static_cast<const VolumeRAMPrecision<std::uint16_t>*>(region.get());
+            const util::IndexMapper3D regionIndex{size};
+            for (size_t i = 0; i < glm::compMul(size); ++i) {
+                const auto pos = regionIndex(i);
+                ASSERT_EQ(result->getDataTyped()[i], index(offset + pos)) << "position " << i;
+            }
+        }
+
+        EXPECT_THROW(chunked.read(0, size3_t{20, 0, 0}, size3_t{2, 1, 1}), DataReaderException);
+    }
+}
+
+TEST(ChunkedVolumeFile, ChunkStatistics) {
+    const auto ram = createVolume();
+    const VolumeRAMBrickSource source{ram};
+    const util::TempFileHandle file{"inviwo", ".ivc"};
+    const auto voxels = glm::compMul(dims);
+
+    const std::vector<const VolumeBrickSource*> levels{&source};
+    ChunkedVolumeFile::write(
+        file.getFileName(), levels,
+        {.chunkSize = size3_t{8}, .histogramBins = 10,
+         .histogramRange = dvec2{0.0, static_cast<double>(voxels)}});
+
+    const ChunkedVolumeFile chunked{file.getFileName()};
+    const auto& first = chunked.getLevel(0).chunks.front();
+    EXPECT_EQ(first.min.x, 0.0);
+    EXPECT_EQ(first.max.x, static_cast<double>(util::IndexMapper3D{dims}(size3_t{7})));
+
+    const auto histogram = chunked.getHistogram(0, 0);
+    ASSERT_EQ(histogram.size(), 10);
+    EXPECT_EQ(std::accumulate(histogram.begin(), histogram.end(), size_t{0}), voxels);
+    EXPECT_EQ(histogram.front(), voxels / 10);
+}
+
+TEST(ChunkedVolumeFile, InvalidOptions) {
+    const VolumeRAMBrickSource source{createVolume()};
+    const util::TempFileHandle file{"inviwo", ".ivc"};
+    const std::vector<const VolumeBrickSource*> levels{&source};
+
+    EXPECT_THROW(ChunkedVolumeFile::write(file.getFileName(), levels, {.chunkSize = size3_t{0}}),
+                 DataWriterException);
+    EXPECT_THROW(ChunkedVolumeFile::write(file.getFileName(), levels, {.histogramBins = 0}),
+                 DataWriterException);
+}
+
+TEST(ChunkedVolumeFile, CorruptChunkPosition) {
+    const VolumeRAMBrickSource source{createVolume()};
+    const util::TempFileHandle file{"inviwo", ".ivc"};
+    const std::vector<const VolumeBrickSource*> levels{&source};
+    ChunkedVolumeFile::write(file.getFileName(), levels, {.codec = ChunkedVolumeFile::Codec::None});
+
+    const auto readU64 = [](std::fstream& stream, std::streamoff pos) {
+        std::array<unsigned char, 8> bytes{};
+        stream.seekg(pos);
+        stream.read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+        std::uint64_t value = 0;
+        for (size_t i = 0; i < bytes.size(); ++i) value |= std::uint64_t{bytes[i]} << (8 * i);
+        return value;
+    };
+    const auto writeU64 = [](std::fstream& stream, std::streamoff pos, std::uint64_t value) {
+        std::array<unsigned char, 8> bytes{};
+        for (size_t i = 0; i < bytes.size(); ++i) bytes[i] = (value >> (8 * i)) & 0xFFu;
+        stream.seekp(pos);
+        stream.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    };
+
+    // the index position follows the magic, version, and codec. The position and size of the first
+    // chunk follow the format, number of levels, histogram bins and range, and level dimensions
+    std::fstream stream{file.getFileName(), std::ios::in | std::ios::out | std::ios::binary};
+    const auto indexPos = static_cast<std::streamoff>(readU64(stream, 16));
+    const auto positionPos = indexPos + 3 * 4 + 2 * 8 + 6 * 8;
+    const auto position = readU64(stream, positionPos);
+    const auto size = readU64(stream, positionPos + 8);
+
+    for (const auto& [pos, bytes] : std::vector<std::pair<std::uint64_t, std::uint64_t>>{
+             {0, size},
+             {position, std::numeric_limits<std::uint64_t>::max()},
+             {std::numeric_limits<std::uint64_t>::max(), size}}) {
+        writeU64(stream, positionPos, pos);
+        writeU64(stream, positionPos + 8, bytes);
+        stream.flush();
+        EXPECT_THROW(ChunkedVolumeFile{file.getFileName()}, DataReaderException);
+    }
+}
+
+TEST(ChunkedVolumeFile, Levels) {
+    const auto ram = createVolume();
+    const auto half = std::make_shared<VolumeRAMPrecision<std::uint16_t>>(size3_t{11, 5, 5});
+    const VolumeRAMBrickSource source{ram};
+    const VolumeRAMBrickSource halfSource{half};
+    const util::TempFileHandle file{"inviwo", ".ivc"};
+
+    const std::vector<const VolumeBrickSource*> levels{&source, &halfSource};
+    ChunkedVolumeFile::write(file.getFileName(), levels);
+
+    auto chunked = std::make_shared<const ChunkedVolumeFile>(file.getFileName());
+    ASSERT_EQ(chunked->getNumberOfLevels(), 2);
+    EXPECT_EQ(chunked->getLevel(1).dimensions, size3_t(11, 5, 5));
+
+    const ChunkedVolumeRAMLoader loader{chunked, 0};
+    const VolumeRAMPrecision<std::uint16_t> expected{dims};
+    const auto loaded = loader.createRepresentation(expected);
+    const auto* result = static_cast<const VolumeRAMPrecision<std::uint16_t>*>(loaded.get());
+    EXPECT_TRUE(std::equal(result->getDataTyped(), result->getDataTyped() + glm::compMul(dims),
+                           ram->getDataTyped()));
+
+    const VolumeRAMPrecision<float> wrongFormat{dims};
+    EXPECT_THROW(loader.createRepresentation(wrongFormat), DataReaderException);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,121 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/buffer/buffer.h>
+#include <inviwo/core/datastructures/buffer/bufferramprecision.h>
+#include <inviwo/core/datastructures/image/layer.h>
+#include <inviwo/core/datastructures/image/layerramprecision.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+
+#include <memory>
+#include <numeric>
+#include <utility>
+
+namespace inviwo {
+
+TEST(CopyOnWrite, VolumeCloneSharesData) {
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(size3_t{4, 5, 6});
+    std::iota(ram->getView().begin(), ram->getView().end(), 0.0f);
+    Volume volume{ram};
+
+    std::unique_ptr<Volume> clone{volume.clone()};
+    const auto* src = volume.getRepresentation<VolumeRAM>();
+    const auto* dst = clone->getRepresentation<VolumeRAM>();
+    ASSERT_NE(src, dst);
+    EXPECT_EQ(src->getData(), dst->getData());
+
+    // Changing metadata on the representation does not copy the data
+    auto* edit = clone->getEditableRepresentation<VolumeRAM>();
+    edit->setSwizzleMask(swizzlemasks::defaultData(1));
+    EXPECT_EQ(src->getData(), std::as_const(*edit).getData());
+
+    // Writing makes a private copy and leaves the original untouched
+    edit->setFromDouble(size3_t{0, 0, 0}, 42.0);
+    EXPECT_NE(src->getData(), std::as_const(*edit).getData());
+    EXPECT_EQ(edit->getAsDouble(size3_t{0, 0, 0}), 42.0);
+    EXPECT_EQ(edit->getAsDouble(size3_t{1, 0, 0}), 1.0);
+    EXPECT_EQ(src->getAsDouble(size3_t{0, 0, 0}), 0.0);
+
+    // The original is the sole owner again and can be written in place
+    const auto* before = src->getData();
+    volume.getEditableRepresentation<VolumeRAM>()->setFromDouble(size3_t{1, 0, 0}, 7.0);
+    EXPECT_EQ(src->getData(), before);
+    EXPECT_EQ(src->getAsDouble(size3_t{1, 0, 0}), 7.0);
+    EXPECT_EQ(edit->getAsDouble(size3_t{1, 0, 0}), 1.0);
+}
+
+TEST(CopyOnWrite, VolumeWithoutOwnershipIsCopied) {
+    VolumeRAMPrecision<float> ram{size3_t{2, 2, 2}};
+    std::unique_ptr<float[]> data{ram.getDataTyped()};
+    ram.removeDataOwnership();
+
+    std::unique_ptr<VolumeRAMPrecision<float>> clone{ram.clone()};
+    EXPECT_NE(std::as_const(*clone).getDataTyped(), data.get());
+}
+
+TEST(CopyOnWrite, LayerCloneSharesData) {
+    auto ram = std::make_shared<LayerRAMPrecision<vec4>>(size2_t{8, 8});
+    std::fill(ram->getView().begin(), ram->getView().end(), vec4{1.0f});
+    Layer layer{ram};
+
+    std::unique_ptr<Layer> clone{layer.clone()};
+    const auto* src = layer.getRepresentation<LayerRAM>();
+    const auto* dst = clone->getRepresentation<LayerRAM>();
+    EXPECT_EQ(src->getData(), dst->getData());
+
+    auto* edit = clone->getEditableRepresentation<LayerRAM>();
+    edit->setFromDVec4(size2_t{3, 3}, dvec4{2.0});
+    EXPECT_NE(src->getData(), std::as_const(*edit).getData());
+    EXPECT_EQ(edit->getAsDVec4(size2_t{3, 3}), dvec4{2.0});
+    EXPECT_EQ(src->getAsDVec4(size2_t{3, 3}), dvec4{1.0});
+}
+
+TEST(CopyOnWrite, BufferCloneSharesData) {
+    auto ram = std::make_shared<BufferRAMPrecision<vec3>>(std::vector<vec3>(16, vec3{1.0f}));
+    Buffer<vec3> buffer{ram};
+
+    std::unique_ptr<Buffer<vec3>> clone{buffer.clone()};
+    const auto* src = buffer.getRAMRepresentation();
+    auto* edit = clone->getEditableRAMRepresentation();
+    EXPECT_EQ(src->getData(), std::as_const(*edit).getData());
+
+    edit->add(vec3{2.0f});
+    EXPECT_EQ(src->getSize(), size_t{16});
+    EXPECT_EQ(edit->getSize(), size_t{17});
+    EXPECT_EQ(src->get(0), vec3{1.0f});
+    EXPECT_EQ(edit->get(16), vec3{2.0f});
+}
+
+}  // namespace inviwo
@@ -36,6 +36,8 @@
 #include <inviwo/core/util/zip.h>
 #include <inviwo/core/datastructures/datamapper.h>
 
+#include <cstdint>
+#include <numeric>
 #include <vector>
 #include <ranges>
 #include <random>
@@ -198,4 +200,24 @@ TEST_F(Histogram1DTest, floatFractionalRangeUpper) {
     EXPECT_EQ(20, histograms[0].totalCounts) << "different total counts";
 }
 
+TEST_F(Histogram1DTest, partitioned) {
+    // more values than fit in one partition, with a remainder
+    const size_t numValues = 3 * util::detail::histogramGrainSize + 5;
+    std::vector<std::uint8_t> data(numValues);
+    for (size_t i = 0; i < numValues; ++i) {
+        data[i] = static_cast<std::uint8_t>(i % 256);
+    }
+    const DataMapper dataMap{dvec2{0.0, 255.0}};
+    auto histograms = util::calculateHistograms<std::uint8_t>(data, dataMap, 256);
+
+    ASSERT_EQ(256, histograms[0].counts.size());
+    EXPECT_EQ(numValues, histograms[0].totalCounts);
+    EXPECT_EQ(numValues, std::accumulate(histograms[0].counts.begin(),
+                                         histograms[0].counts.end(), size_t{0}));
+    EXPECT_EQ(numValues / 256 + 1, histograms[0].counts[0]);
+    EXPECT_EQ(numValues / 256, histograms[0].counts[255]);
+    EXPECT_EQ(0.0, histograms[0].dataStats.min);
+    EXPECT_EQ(255.0, histograms[0].dataStats.max);
+}
+
 }  // namespace inviwo
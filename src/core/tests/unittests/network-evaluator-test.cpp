@@ -42,7 +42,9 @@
 #include <inviwo/core/ports/datainport.h>
 #include <inviwo/core/ports/dataoutport.h>
 
+#include <atomic>
 #include <functional>
+#include <thread>
 
 namespace inviwo {
 
@@ -256,4 +258,90 @@ TEST(NetworkEvaluator, Error) {
     }
 }
 
+TEST(NetworkEvaluator, Parallel) {
+    ProcessorNetwork network{InviwoApplication::getPtr()};
+    ProcessorNetworkEvaluator evaluator{&network};
+    evaluator.setEvaluationMode(EvaluationMode::Parallel);
+
+    auto at = createA();
+    auto a = at.get();
+    Instrument ai(*a);
+    a->onProcess = [func = a->onProcess](TestProcessor& p) {
+        func(p);
+        static_cast<DataOutport<int>*>(p.getOutports()[0])->setData(std::make_shared<int>(0));
+    };
+
+    const auto mainThread = std::this_thread::get_id();
+    std::atomic<int> offMainThread = 0;
+    bool shouldThrow = false;
+    const auto addSink = [&](std::string_view id, ProcessorThreading threading) {
+        auto pt = createB();
+        pt->setIdentifier(id);
+        pt->setThreading(threading);
+        auto* p = pt.get();
+        network.addProcessor(std::move(pt));
+        network.addConnection(a->getOutports()[0], p->getInports()[0]);
+        return p;
+    };
+
+    TestProcessor* b = nullptr;
+    TestProcessor* c = nullptr;
+    TestProcessor* d = nullptr;
+    {
+        NetworkLock lock(&network);
+        network.addProcessor(std::move(at));
+        b = addSink("b", ProcessorThreading::Any);
+        c = addSink("c", ProcessorThreading::Any);
+        d = addSink("d", ProcessorThreading::MainThread);
+        for (auto* p : {b, c}) {
+            p->onProcess = [&](TestProcessor&) {
+                if (std::this_thread::get_id() != mainThread) ++offMainThread;
+                if (shouldThrow) throw Exception(SourceContext{}, "Error");
+            };
+        }
+        d->onProcess = [&](TestProcessor&) {
+            EXPECT_EQ(std::this_thread::get_id(), mainThread);
+        };
+    }
+    {
+        SCOPED_TRACE("Initial evaluation");
+        ai.checkAndReset(1, 1, 0);
+        for (auto* p : {a, b, c, d}) EXPECT_TRUE(p->isValid());
+        if (InviwoApplication::getPtr()->getThreadPool().getSize() > 0) {
+            EXPECT_EQ(offMainThread, 2);
+        }
+    }
+
+    Instrument bi(*b);
+    Instrument ci(*c);
+    Instrument di(*d);
+    for (auto* p : {b, c}) {
+        p->onProcess = [&, func = p->onProcess](TestProcessor& self) {
+            func(self);
+            if (shouldThrow) throw Exception(SourceContext{}, "Error");
+        };
+    }
+
+    {
+        SCOPED_TRACE("Invalid output with throw");
+        unsigned int throwCount = 0;
+        evaluator.setExceptionHandler([&](Processor*, EvaluationType type, SourceContext) {
+            EXPECT_EQ(std::this_thread::get_id(), mainThread);
+            EXPECT_EQ(type, EvaluationType::Process);
+            ++throwCount;
+        });
+
+        shouldThrow = true;
+        a->invalidate(InvalidationLevel::InvalidOutput);
+        EXPECT_EQ(throwCount, 2);
+        ai.checkAndReset(0, 1, 0);
+        bi.checkAndReset(0, 1, 0);
+        ci.checkAndReset(0, 1, 0);
+        di.checkAndReset(0, 1, 0);
+        EXPECT_FALSE(b->isValid());
+        EXPECT_FALSE(c->isValid());
+        EXPECT_TRUE(d->isValid());
+    }
+}
+
 }  // namespace inviwo
@@ -0,0 +1,125 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/util/parallel.h>
+
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+namespace inviwo {
+
+TEST(Parallel, ForRange) {
+    std::vector<int> visits(1000, 0);
+    util::parallelFor(10, 990, [&](size_t i) { ++visits[i]; }, 7);
+    for (size_t i = 0; i < visits.size(); ++i) {
+        EXPECT_EQ(visits[i], (i >= 10 && i < 990) ? 1 : 0) << "at " << i;
+    }
+}
+
+TEST(Parallel, ForBlocks) {
+    std::vector<int> visits(1001, 0);
+    std::atomic<size_t> blocks{0};
+    util::parallelForBlocks(
+        visits.size(),
+        [&](size_t begin, size_t end) {
+            EXPECT_LE(end - begin, 100);
+            ++blocks;
+            for (size_t i = begin; i < end; ++i) ++visits[i];
+        },
+        100);
+    EXPECT_EQ(blocks, 11);
+    EXPECT_EQ(std::accumulate(visits.begin(), visits.end(), 0), 1001);
+}
+
+TEST(Parallel, For2D) {
+    const size2_t dims{13, 17};
+    std::vector<int> visits(dims.x * dims.y, 0);
+    util::parallelFor(dims, [&](const size2_t& pos) { ++visits[pos.x + pos.y * dims.x]; });
+    for (auto v : visits) EXPECT_EQ(v, 1);
+}
+
+TEST(Parallel, For3D) {
+    const size3_t dims{5, 7, 3};
+    std::vector<int> visits(dims.x * dims.y * dims.z, 0);
+    util::parallelFor(dims, [&](const size3_t& pos) {
+        ++visits[pos.x + pos.y * dims.x + pos.z * dims.x * dims.y];
+    });
+    for (auto v : visits) EXPECT_EQ(v, 1);
+}
+
+TEST(Parallel, Reduce) {
+    const auto sum = util::parallelReduce(
+        size_t{1}, size_t{1001}, size_t{0}, [](size_t i) { return i; }, std::plus<>{}, 10);
+    EXPECT_EQ(sum, 500500);
+
+    const size3_t dims{8, 9, 10};
+    const auto count = util::parallelReduce(
+        dims, size_t{0}, [](const size3_t&) { return size_t{1}; }, std::plus<>{});
+    EXPECT_EQ(count, 720);
+}
+
+TEST(Parallel, ReduceIsOrdered) {
+    // concatenation is associative but not commutative
+    std::vector<size_t> expected(100);
+    std::iota(expected.begin(), expected.end(), size_t{0});
+    const auto result = util::parallelReduce(
+        size_t{0}, size_t{100}, std::vector<size_t>{},
+        [](size_t i) { return std::vector<size_t>{i}; },
+        [](std::vector<size_t> a, std::vector<size_t> b) {
+            a.insert(a.end(), b.begin(), b.end());
+            return a;
+        },
+        3);
+    EXPECT_EQ(result, expected);
+}
+
+TEST(Parallel, Stop) {
+    std::atomic<bool> stop{true};
+    std::atomic<size_t> calls{0};
+    util::parallelFor(0, 1000, [&](size_t) { ++calls; }, 1, stop);
+    EXPECT_EQ(calls, 0);
+}
+
+TEST(Parallel, Nested) {
+    std::vector<std::atomic<size_t>> counts(16);
+    util::parallelFor(0, counts.size(), [&](size_t i) {
+        EXPECT_GT(util::parallelDepth(), 0);
+        util::parallelFor(0, 100, [&](size_t) { ++counts[i]; });
+    });
+    for (const auto& c : counts) EXPECT_EQ(c, 100);
+    EXPECT_EQ(util::parallelDepth(), 0);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,158 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/io/rawvolumeramloader.h>
+#include <inviwo/core/io/memorymappedfile.h>
+#include <inviwo/core/io/tempfilehandle.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size3_t dims{4, 5, 6};
+constexpr size_t header = 16;
+
+util::TempFileHandle createRawFile() {
+    util::TempFileHandle file{"inviwo", ".raw"};
+    std::vector<char> head(header, 'x');
+    std::vector<float> data(glm::compMul(dims));
+    std::iota(data.begin(), data.end(), 0.0f);
+    std::fwrite(head.data(), 1, head.size(), file);
+    std::fwrite(data.data(), sizeof(float), data.size(), file);
+    std::fflush(file);
+    return file;
+}
+
+}  // namespace
+
+TEST(MemoryMappedFile, Range) {
+    auto file = createRawFile();
+    const util::MemoryMappedFile mapped{file.getFileName(), header + sizeof(float)};
+    ASSERT_EQ(mapped.size(), (glm::compMul(dims) - 1) * sizeof(float));
+    float value = 0.0f;
+    std::memcpy(&value, mapped.data(), sizeof(float));
+    EXPECT_EQ(value, 1.0f);
+
+    EXPECT_THROW(util::MemoryMappedFile(file.getFileName(), 0, mapped.size() + 2 * header),
+                 FileException);
+}
+
+TEST(RawVolumeRAMLoader, MappedCopyOnWrite) {
+    auto file = createRawFile();
+    const VolumeDisk disk{dims, DataFloat32::get()};
+    const RawVolumeRAMLoader loader{file.getFileName(), header, ByteOrder::LittleEndian,
+                                    Compression::Disabled};
+
+    auto repr = loader.createRepresentation(disk);
+    auto* ram = dynamic_cast<VolumeRAMPrecision<float>*>(repr.get());
+    ASSERT_NE(ram, nullptr);
+    EXPECT_TRUE(ram->hasSharedData());
+    EXPECT_EQ(ram->getDimensions(), dims);
+
+    const auto* cram = ram;
+    EXPECT_EQ(cram->getDataTyped()[0], 0.0f);
+    EXPECT_EQ(cram->getAsDouble(size3_t{1, 2, 3}), 1.0 + 2.0 * 4.0 + 3.0 * 20.0);
+
+    // clones share the mapped data
+    std::unique_ptr<VolumeRAMPrecision<float>> clone{ram->clone()};
+    EXPECT_TRUE(clone->hasSharedData());
+    EXPECT_EQ(std::as_const(*clone).getDataTyped(), cram->getDataTyped());
+
+    // writing makes a private copy and leaves the other clone untouched
+    clone->setFromDouble(size3_t{0, 0, 0}, 42.0);
+    EXPECT_FALSE(clone->hasSharedData());
+    EXPECT_TRUE(ram->hasSharedData());
+    EXPECT_EQ(std::as_const(*clone).getDataTyped()[0], 42.0f);
+    EXPECT_EQ(std::as_const(*clone).getDataTyped()[1], 1.0f);
+    EXPECT_EQ(cram->getDataTyped()[0], 0.0f);
+}
+
+TEST(RawVolumeRAMLoader, BigEndianIsRead) {
+    auto file = createRawFile();
+    const VolumeDisk disk{dims, DataFloat32::get()};
+    const RawVolumeRAMLoader loader{file.getFileName(), header, ByteOrder::BigEndian,
+                                    Compression::Disabled};
+
+    auto repr = loader.createRepresentation(disk);
+    auto* ram = dynamic_cast<VolumeRAMPrecision<float>*>(repr.get());
+    ASSERT_NE(ram, nullptr);
+    EXPECT_FALSE(ram->hasSharedData());
+}
+
+TEST(RawVolumeRAMLoader, BigEndianSingleByteComponentsAreMapped) {
+    auto file = createRawFile();
+    const VolumeDisk disk{size3_t{2, 2, 2}, DataVec3UInt8::get()};
+    const RawVolumeRAMLoader loader{file.getFileName(), header, ByteOrder::BigEndian,
+                                    Compression::Disabled};
+
+    auto repr = loader.createRepresentation(disk);
+    auto* ram = dynamic_cast<VolumeRAMPrecision<glm::u8vec3>*>(repr.get());
+    ASSERT_NE(ram, nullptr);
+    EXPECT_TRUE(ram->hasSharedData());
+}
+
+TEST(RawVolumeRAMLoader, BigEndianSwapsComponents) {
+    util::TempFileHandle file{"inviwo", ".raw"};
+    const std::vector<float> data{1.0f, 2.0f, 3.0f, 4.0f};
+    for (const auto value : data) {
+        std::array<char, sizeof(float)> bytes{};
+        std::memcpy(bytes.data(), &value, sizeof(float));
+        std::reverse(bytes.begin(), bytes.end());
+        std::fwrite(bytes.data(), 1, bytes.size(), file);
+    }
+    std::fflush(file);
+
+    const VolumeDisk disk{size3_t{2, 1, 1}, DataVec2Float32::get()};
+    const RawVolumeRAMLoader loader{file.getFileName(), 0, ByteOrder::BigEndian,
+                                    Compression::Disabled};
+
+    auto repr = loader.createRepresentation(disk);
+    auto* ram = dynamic_cast<VolumeRAMPrecision<glm::f32vec2>*>(repr.get());
+    ASSERT_NE(ram, nullptr);
+    const auto* cram = ram;
+    EXPECT_EQ(cram->getDataTyped()[0], glm::f32vec2(1.0f, 2.0f));
+    EXPECT_EQ(cram->getDataTyped()[1], glm::f32vec2(3.0f, 4.0f));
+}
+
+}  // namespace inviwo
@@ -0,0 +1,119 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/resourcemanager/resourcemanager.h>
+
+#include <vector>
+
+namespace inviwo {
+
+TEST(ResourceManager, EvictableWithinBudget) {
+    ResourceManager rm;
+    rm.setBudget(100);
+
+    int released = 0;
+    rm.addEvictable(resource::RAM{1}, 40, [&]() { ++released; });
+    rm.addEvictable(resource::RAM{2}, 60, [&]() { ++released; });
+
+    EXPECT_EQ(released, 0);
+    EXPECT_EQ(rm.getEvictableSize(), 100);
+    EXPECT_EQ(rm.getNumberOfEvictables(), 2);
+}
+
+TEST(ResourceManager, EvictLeastRecentlyUsed) {
+    ResourceManager rm;
+    rm.setBudget(100);
+
+    std::vector<int> released;
+    rm.addEvictable(resource::RAM{1}, 40, [&]() { released.push_back(1); });
+    rm.addEvictable(resource::RAM{2}, 40, [&]() { released.push_back(2); });
+    rm.useEvictable(resource::RAM{1});
+    rm.addEvictable(resource::RAM{3}, 40, [&]() { released.push_back(3); });
+
+    EXPECT_EQ(released, std::vector<int>{2});
+    EXPECT_EQ(rm.getEvictableSize(), 80);
+}
+
+TEST(ResourceManager, EvictLeastFrequentlyUsed) {
+    ResourceManager rm;
+    rm.setBudget(100);
+    rm.setEvictionPolicy(ResourceManager::EvictionPolicy::LeastFrequentlyUsed);
+
+    std::vector<int> released;
+    rm.addEvictable(resource::RAM{1}, 30, [&]() { released.push_back(1); });
+    rm.addEvictable(resource::RAM{2}, 30, [&]() { released.push_back(2); });
+    rm.addEvictable(resource::RAM{3}, 30, [&]() { released.push_back(3); });
+    rm.useEvictable(resource::RAM{1});
+    rm.useEvictable(resource::RAM{1});
+    rm.useEvictable(resource::RAM{3});
+    // 2 is used the least
+    rm.addEvictable(resource::RAM{4}, 30, [&]() { released.push_back(4); });
+    EXPECT_EQ(released, std::vector<int>{2});
+
+    // 3 and 4 are tied, 4 is the most recently used
+    rm.useEvictable(resource::RAM{4});
+    rm.setBudget(60);
+    EXPECT_EQ(released, (std::vector<int>{2, 3}));
+    EXPECT_EQ(rm.getNumberOfEvictables(), 2);
+}
+
+TEST(ResourceManager, RemoveEvictable) {
+    ResourceManager rm;
+    rm.setBudget(100);
+
+    int released = 0;
+    rm.addEvictable(resource::RAM{1}, 80, [&]() { ++released; });
+    EXPECT_TRUE(rm.removeEvictable(resource::RAM{1}));
+    EXPECT_FALSE(rm.removeEvictable(resource::RAM{1}));
+    rm.addEvictable(resource::RAM{2}, 80, [&]() { ++released; });
+
+    EXPECT_EQ(released, 0);
+    EXPECT_EQ(rm.getEvictableSize(), 80);
+}
+
+TEST(ResourceManager, ShrinkBudget) {
+    ResourceManager rm;
+    rm.setBudget(100);
+
+    std::vector<int> released;
+    rm.addEvictable(resource::RAM{1}, 30, [&]() { released.push_back(1); });
+    rm.addEvictable(resource::RAM{2}, 30, [&]() { released.push_back(2); });
+    rm.addEvictable(resource::RAM{3}, 30, [&]() { released.push_back(3); });
+    rm.setBudget(40);
+
+    EXPECT_EQ(released, (std::vector<int>{1, 2}));
+    EXPECT_EQ(rm.getNumberOfEvictables(), 1);
+}
+
+}  // namespace inviwo
@@ -0,0 +1,276 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/datastructures/volume/brickcache.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+#include <inviwo/core/datastructures/volume/volumedisk.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+#include <inviwo/core/io/blockcompression.h>
+#include <inviwo/core/io/rawvolumeramloader.h>
+#include <inviwo/core/io/tempfilehandle.h>
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+constexpr size3_t dims{10, 7, 5};
+
+std::shared_ptr<VolumeRAMPrecision<float>> createVolume() {
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(dims);
+    auto* data = ram->getDataTyped();
+    std::iota(data, data + glm::compMul(dims), 0.0f);
+    return ram;
+}
+
+float valueAt(const size3_t& pos) {
+    return static_cast<float>(pos.x + dims.x * (pos.y + dims.y * pos.z));
+}
+
+class CountingSource : public VolumeRAMBrickSource {
+public:
+    using VolumeRAMBrickSource::VolumeRAMBrickSource;
+    virtual std::shared_ptr<VolumeRAM> load(size3_t offset, size3_t size) const override {
+        ++loads;
+        return VolumeRAMBrickSource::load(offset, size);
+    }
+    mutable std::atomic<size_t> loads{0};
+};
+
+}  // namespace
+
+TEST(BrickCache, LeastRecentlyUsedIsEvicted) {
+    const auto brickBytes = glm::compMul(size3_t{4}) * sizeof(float);
+    BrickCache cache{2 * brickBytes};
+    const auto load = []() -> std::shared_ptr<const VolumeRAM> {
+        return std::make_shared<VolumeRAMPrecision<float>>(size3_t{4});
+    };
+
+    const auto source = BrickCache::newSource();
+    auto first = cache.get({source, 0}, load);
+    cache.get({source, 1}, load);
+    EXPECT_EQ(cache.get({source, 0}, load), first);
+    EXPECT_EQ(cache.getSize(), 2 * brickBytes);
+
+    // brick 1 is the least recently used one
+    cache.get({source, 2}, load);
+    EXPECT_TRUE(cache.contains({source, 0}));
+    EXPECT_FALSE(cache.contains({source, 1}));
+    EXPECT_TRUE(cache.contains({source, 2}));
+    EXPECT_EQ(cache.getNumberOfBricks(), 2);
+
+    cache.setBudget(brickBytes);
+    EXPECT_EQ(cache.getNumberOfBricks(), 1);
+    EXPECT_FALSE(cache.contains({source, 0}));
+    // bricks in use stay valid after eviction
+    EXPECT_EQ(first->getDimensions(), size3_t{4});
+
+    cache.erase(source);
+    EXPECT_EQ(cache.getNumberOfBricks(), 0);
+    EXPECT_EQ(cache.getSize(), 0);
+}
+
+TEST(VolumeBricked, Bricks) {
+    auto cache = std::make_shared<BrickCache>();
+    const VolumeBricked bricked{std::make_shared<VolumeRAMBrickSource>(createVolume()),
+                                size3_t{4},
+                                swizzlemasks::rgba,
+                                InterpolationType::Linear,
+                                wrapping3d::clampAll,
+                                cache};
+
+    EXPECT_EQ(bricked.getDimensions(), dims);
+    EXPECT_EQ(bricked.getBrickCount(), size3_t(3, 2, 2));
+    EXPECT_EQ(bricked.getBrick(size3_t{9, 3, 4}), size3_t(2, 0, 1));
+    EXPECT_EQ(bricked.getBrickDimensions(size3_t{2, 1, 1}), size3_t(2, 3, 1));
+
+    EXPECT_FALSE(bricked.isResident(size3_t{2, 1, 1}));
+    const auto brick = bricked.getBrickData(size3_t{2, 1, 1});
+    EXPECT_TRUE(bricked.isResident(size3_t{2, 1, 1}));
+    EXPECT_EQ(brick->getDimensions(), size3_t(2, 3, 1));
+    EXPECT_EQ(brick->getAsDouble(size3_t{1, 2, 0}), valueAt(size3_t{9, 6, 4}));
+    EXPECT_EQ(bricked.getAsDouble(size3_t{5, 3, 2}), valueAt(size3_t{5, 3, 2}));
+
+    EXPECT_THROW(bricked.getBrickData(size3_t{3, 0, 0}), RangeException);
+    EXPECT_THROW(bricked.getRegion(size3_t{8, 0, 0}, size3_t{3, 1, 1}), RangeException);
+}
+
+TEST(VolumeBricked, SetSourceBrickSize) {
+    VolumeBricked bricked{std::make_shared<VolumeRAMBrickSource>(createVolume()),
+                          size3_t{4},
+                          swizzlemasks::rgba,
+                          InterpolationType::Linear,
+                          wrapping3d::clampAll,
+                          std::make_shared<BrickCache>()};
+
+    bricked.setSource(std::make_shared<VolumeRAMBrickSource>(createVolume()));
+    EXPECT_EQ(bricked.getBrickSize(), size3_t{4});
+
+    bricked.setSource(std::make_shared<VolumeRAMBrickSource>(createVolume()), size3_t{5, 7, 5});
+    EXPECT_EQ(bricked.getBrickSize(), size3_t(5, 7, 5));
+    EXPECT_EQ(bricked.getBrickCount(), size3_t(2, 1, 1));
+    EXPECT_EQ(bricked.getAsDouble(size3_t{6, 3, 4}), valueAt(size3_t{6, 3, 4}));
+}
+
+TEST(VolumeBricked, RegionOnlyLoadsTouchedBricks) {
+    auto cache = std::make_shared<BrickCache>();
+    auto source = std::make_shared<CountingSource>(createVolume());
+    const VolumeBricked bricked{source,
+                                size3_t{4},
+                                swizzlemasks::rgba,
+                                InterpolationType::Linear,
+                                wrapping3d::clampAll,
+                                cache};
+
+    const size3_t offset{3, 1, 2};
+    const size3_t size{2, 5, 1};
+    const auto region = bricked.getRegion(offset, size);
+    ASSERT_EQ(region->getDimensions(), size);
+    size3_t pos;
+    for (pos.z = 0; pos.z < size.z; ++pos.z) {
+        for (pos.y = 0; pos.y < size.y; ++pos.y) {
+            for (pos.x = 0; pos.x < size.x; ++pos.x) {
+                EXPECT_EQ(region->getAsDouble(pos), valueAt(offset + pos));
+            }
+        }
+    }
+    // x bricks 0 and 1, y bricks 0 and 1, z brick 0
+    EXPECT_EQ(source->loads.load(), 4);
+    EXPECT_EQ(cache->getNumberOfBricks(), 4);
+
+    bricked.getRegion(offset, size);
+    EXPECT_EQ(source->loads.load(), 4);
+
+    size_t visited = 0;
+    bricked.forEachBrick(size3_t{0}, dims, [&](const VolumeRAM& brick, const size3_t& brickOffset) {
+        EXPECT_EQ(brick.getAsDouble(size3_t{0}), valueAt(brickOffset));
+        ++visited;
+    });
+    EXPECT_EQ(visited, 12);
+    EXPECT_EQ(source->loads.load(), 12);
+}
+
+TEST(VolumeBricked, BudgetBoundsResidentBricks) {
+    const auto brickBytes = glm::compMul(size3_t{4}) * sizeof(float);
+    auto cache = std::make_shared<BrickCache>(2 * brickBytes);
+    const VolumeBricked bricked{std::make_shared<VolumeRAMBrickSource>(createVolume()),
+                                size3_t{4},
+                                swizzlemasks::rgba,
+                                InterpolationType::Linear,
+                                wrapping3d::clampAll,
+                                cache};
+
+    const auto all = bricked.getRegion(size3_t{0}, dims);
+    EXPECT_LE(cache->getSize(), 2 * brickBytes);
+    EXPECT_EQ(all->getAsDouble(size3_t{9, 6, 4}), valueAt(size3_t{9, 6, 4}));
+}
+
+TEST(VolumeBricked, CopiesShareBricks) {
+    auto cache = std::make_shared<BrickCache>();
+    auto bricked = std::make_unique<VolumeBricked>(
+        std::make_shared<VolumeRAMBrickSource>(createVolume()), size3_t{4}, swizzlemasks::rgba,
+        InterpolationType::Linear, wrapping3d::clampAll, cache);
+    bricked->getBrickData(size3_t{0});
+
+    std::unique_ptr<VolumeBricked> copy{bricked->clone()};
+    EXPECT_TRUE(copy->isResident(size3_t{0}));
+
+    bricked.reset();
+    EXPECT_EQ(cache->getNumberOfBricks(), 1);
+    copy.reset();
+    EXPECT_EQ(cache->getNumberOfBricks(), 0);
+}
+
+TEST(VolumeBricked, RawFileBricks) {
+    util::TempFileHandle file{"inviwo", ".raw"};
+    std::vector<float> data(glm::compMul(dims));
+    std::iota(data.begin(), data.end(), 0.0f);
+    std::fwrite(data.data(), sizeof(float), data.size(), file);
+    std::fflush(file);
+
+    const VolumeDisk disk{dims, DataFloat32::get()};
+    for (auto byteOrder : {ByteOrder::LittleEndian, ByteOrder::BigEndian}) {
+        const RawVolumeRAMLoader loader{file.getFileName(), 0, byteOrder, Compression::Disabled};
+        const auto source = loader.createBrickSource(disk);
+        ASSERT_EQ(source->getDimensions(), dims);
+
+        // the file is little endian, reading it as big endian swaps the bytes of each value
+        const auto expected = [&](const size3_t& pos) {
+            const auto value = valueAt(pos);
+            if (byteOrder == ByteOrder::LittleEndian) return value;
+            return std::bit_cast<float>(std::byteswap(std::bit_cast<std::uint32_t>(value)));
+        };
+
+        const size3_t offset{4, 4, 4};
+        const auto brick = source->load(offset, size3_t{4, 3, 1});
+        ASSERT_EQ(brick->getDimensions(), size3_t(4, 3, 1));
+        EXPECT_EQ(static_cast<float>(brick->getAsDouble(size3_t{0})), expected(offset));
+        EXPECT_EQ(static_cast<float>(brick->getAsDouble(size3_t{3, 2, 0})),
+                  expected(offset + size3_t{3, 2, 0}));
+    }
+}
+
+TEST(VolumeBricked, BlockCompressedRawFileBricks) {
+    const util::TempFileHandle file{"inviwo", ".raw.gz"};
+    const auto ram = createVolume();
+    // Small blocks such that a brick covers several blocks and a block covers several rows
+    util::blockcompression::write(file.getFileName(), ram->getData(), ram->getNumberOfBytes(),
+                                  100);
+
+    const VolumeDisk disk{dims, DataFloat32::get()};
+    const RawVolumeRAMLoader loader{file.getFileName(), 0, ByteOrder::LittleEndian,
+                                    Compression::Enabled};
+    const auto source = loader.createBrickSource(disk);
+
+    const size3_t offset{3, 2, 1};
+    const size3_t size{5, 4, 3};
+    const auto brick = source->load(offset, size);
+    ASSERT_EQ(brick->getDimensions(), size);
+    for (size_t z = 0; z < size.z; ++z) {
+        for (size_t y = 0; y < size.y; ++y) {
+            for (size_t x = 0; x < size.x; ++x) {
+                const size3_t pos{x, y, z};
+                ASSERT_EQ(static_cast<float>(brick->getAsDouble(pos)), valueAt(offset + pos));
+            }
+        }
+    }
+}
+
+}  // namespace inviwo
@@ -0,0 +1,214 @@
+/*********************************************************************************
+ *
+ * Inviwo - Interactive Visualization Workshop
+ *
+ * Copyright (c) 2026 Inviwo Foundation
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ *********************************************************************************/
+
+#include <warn/push>
+#include <warn/ignore/all>
+#include <gtest/gtest.h>
+#include <warn/pop>
+
+#include <inviwo/core/common/inviwoapplication.h>
+#include <inviwo/core/datastructures/volume/brickcache.h>
+#include <inviwo/core/datastructures/volume/volume.h>
+#include <inviwo/core/datastructures/volume/volumebricked.h>
+#include <inviwo/core/datastructures/volume/volumepyramid.h>
+#include <inviwo/core/datastructures/volume/volumeramprecision.h>
+
+#include <inviwo/core/util/exception.h>
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+namespace inviwo {
+
+namespace {
+
+// Levels 1 and 2 are {20, 10, 5} and {10, 5, 3}
+constexpr size3_t pyramidDims{40, 20, 10};
+
+std::shared_ptr<Volume> createVolume(float value) {
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(pyramidDims);
+    auto* data = ram->getDataTyped();
+    std::fill(data, data + glm::compMul(pyramidDims), value);
+    return std::make_shared<Volume>(ram);
+}
+
+/**
+ * The levels are built on the pool and published on the main thread
+ */
+void waitUntilDone(const VolumePyramid& pyramid) {
+    auto* app = InviwoApplication::getPtr();
+    const auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+    while (!pyramid.isDone() && std::chrono::steady_clock::now() < timeout) {
+        app->processFront();
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    ASSERT_TRUE(pyramid.isDone());
+}
+
+}  // namespace
+
+TEST(VolumePyramid, LevelDimensions) {
+    const size3_t dims{100, 33, 8};
+    EXPECT_EQ(util::pyramidLevelDimensions(dims, 0), dims);
+    EXPECT_EQ(util::pyramidLevelDimensions(dims, 1), size3_t(50, 17, 4));
+    EXPECT_EQ(util::pyramidLevelDimensions(dims, 2), size3_t(25, 9, 2));
+    EXPECT_EQ(util::pyramidLevelDimensions(dims, 3), size3_t(13, 5, 1));
+    EXPECT_EQ(util::pyramidLevelDimensions(dims, 10), size3_t(1, 1, 1));
+
+    EXPECT_EQ(util::pyramidLevelCount(dims), 4);
+    EXPECT_EQ(util::pyramidLevelCount(size3_t{16}), 1);
+    EXPECT_EQ(util::pyramidLevelCount(size3_t{17}), 2);
+    EXPECT_EQ(util::pyramidLevelCount(size3_t{512}, 1), 10);
+}
+
+TEST(VolumePyramid, HalveAverages) {
+    const size3_t dims{3, 2, 2};
+    VolumeRAMPrecision<unsigned char> ram{dims};
+    auto* data = ram.getDataTyped();
+    std::iota(data, data + glm::compMul(dims), static_cast<unsigned char>(0));
+
+    const auto half = util::volumeHalve(ram);
+    ASSERT_EQ(half->getDimensions(), size3_t(2, 1, 1));
+    const auto* res = static_cast<const VolumeRAMPrecision<unsigned char>*>(half.get());
+    // (0 + 1 + 3 + 4 + 6 + 7 + 9 + 10) / 8 = 5
+    EXPECT_EQ(res->getDataTyped()[0], 5);
+    // The last column is clamped: (2 + 2 + 5 + 5 + 8 + 8 + 11 + 11) / 8 = 6.5
+    EXPECT_EQ(res->getDataTyped()[1], 7);
+}
+
+TEST(VolumePyramid, BrickedMatchesRAM) {
+    const size3_t dims{21, 14, 9};
+    auto ram = std::make_shared<VolumeRAMPrecision<float>>(dims);
+    auto* data = ram->getDataTyped();
+    std::iota(data, data + glm::compMul(dims), 0.0f);
+
+    const VolumeBricked bricked{std::make_shared<VolumeRAMBrickSource>(ram), size3_t{4},
+                                swizzlemasks::rgba, InterpolationType::Linear,
+                                wrapping3d::clampAll, std::make_shared<BrickCache>()};
+
+    const VolumeBricked odd{std::make_shared<VolumeRAMBrickSource>(ram), size3_t{5},
+                            swizzlemasks::rgba, InterpolationType::Linear, wrapping3d::clampAll,
+                            std::make_shared<BrickCache>()};
+
+    const auto expected = util::volumeHalve(*ram);
+    const auto* a = static_cast<const VolumeRAMPrecision<float>*>(expected.get());
+    for (const auto* volume : {&bricked, &odd}) {
+        const auto result = util::volumeHalve(*volume);
+        ASSERT_EQ(result->getDimensions(), expected->getDimensions());
+
+        const auto* b = static_cast<const VolumeRAMPrecision<float>*>(result.get());
+        for (size_t i = 0; i < glm::compMul(expected->getDimensions()); ++i) {
+            EXPECT_FLOAT_EQ(a->getDataTyped()[i], b->getDataTyped()[i])
+                << "index " << i << " brick size " << volume->getBrickSize().x;
+        }
+    }
+}
+
+TEST(VolumePyramid, Request) {
+    auto volume = createVolume(3.0f);
+
+    std::vector<size_t> levels;
+    const auto building = volume->calculatePyramid([&](size_t level) { levels.push_back(level); });
+    EXPECT_EQ(building.progress, VolumePyramid::Progress::Building);
+    waitUntilDone(volume->getPyramid());
+
+    const auto& pyramid = volume->getPyramid();
+    ASSERT_EQ(pyramid.getNumberOfLevels(), 3);
+    EXPECT_EQ(pyramid.getLevel(0), nullptr);
+    ASSERT_FALSE(levels.empty());
+    EXPECT_EQ(levels.back(), 2);
+    EXPECT_NE(std::ranges::find(levels, 1), levels.end());
+
+    for (size_t level = 1; level < 3; ++level) {
+        const auto data = pyramid.getLevel(level);
+        ASSERT_NE(data, nullptr);
+        EXPECT_EQ(data->getDimensions(), util::pyramidLevelDimensions(pyramidDims, level));
+        EXPECT_EQ(pyramid.getDimensions(level), data->getDimensions());
+        const auto* ram = data->getRepresentation<VolumeRAM>();
+        EXPECT_DOUBLE_EQ(ram->getAsDouble(size3_t{0}), 3.0);
+        EXPECT_DOUBLE_EQ(ram->getAsDouble(data->getDimensions() - size3_t{1}), 3.0);
+    }
+
+    // A finished pyramid calls back right away with the coarsest level
+    levels.clear();
+    const auto done = volume->calculatePyramid([&](size_t level) { levels.push_back(level); });
+    EXPECT_EQ(done.progress, VolumePyramid::Progress::Done);
+    EXPECT_EQ(levels, std::vector<size_t>{2});
+}
+
+TEST(VolumePyramid, FindLevel) {
+    auto volume = createVolume(1.0f);
+    EXPECT_EQ(volume->getPyramid().findLevel(size3_t{1}), 0);
+
+    const auto result = volume->calculatePyramid(nullptr);
+    waitUntilDone(volume->getPyramid());
+    const auto& pyramid = volume->getPyramid();
+
+    EXPECT_EQ(pyramid.findLevel(pyramidDims), 0);
+    EXPECT_EQ(pyramid.findLevel(size3_t{21, 10, 5}), 0);
+    EXPECT_EQ(pyramid.findLevel(size3_t{20, 10, 5}), 1);
+    EXPECT_EQ(pyramid.findLevel(size3_t{11, 1, 1}), 1);
+    EXPECT_EQ(pyramid.findLevel(size3_t{10, 5, 3}), 2);
+    EXPECT_EQ(pyramid.findLevel(size3_t{1}), 2);
+}
+
+TEST(VolumePyramid, FindLevelForBudget) {
+    auto volume = createVolume(1.0f);
+    const auto result = volume->calculatePyramid(nullptr);
+    waitUntilDone(volume->getPyramid());
+    const auto& pyramid = volume->getPyramid();
+
+    // 32000, 4000, and 600 bytes per level
+    EXPECT_EQ(pyramid.findLevelForBudget(32000), 0);
+    EXPECT_EQ(pyramid.findLevelForBudget(31999), 1);
+    EXPECT_EQ(pyramid.findLevelForBudget(4000), 1);
+    EXPECT_EQ(pyramid.findLevelForBudget(3999), 2);
+    EXPECT_EQ(pyramid.findLevelForBudget(600), 2);
+    // The coarsest level if none fits
+    EXPECT_EQ(pyramid.findLevelForBudget(0), 2);
+}
+
+TEST(VolumePyramid, DroppedOnCopyAndEdit) {
+    auto volume = createVolume(1.0f);
+    const auto result = volume->calculatePyramid(nullptr);
+    waitUntilDone(volume->getPyramid());
+
+    const Volume copy{*volume};
+    EXPECT_EQ(copy.getPyramid().getNumberOfLevels(), 0);
+    EXPECT_EQ(volume->getPyramid().getNumberOfLevels(), 3);
+
+    volume->getEditableRepresentation<VolumeRAM>()->setFromDouble(size3_t{0}, 2.0);
+    EXPECT_FALSE(volume->getPyramid().isDone());
+    EXPECT_EQ(volume->getPyramid().getNumberOfLevels(), 0);
+}
+
+}  // namespace inviwo
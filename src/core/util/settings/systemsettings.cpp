@@ -34,6 +34,7 @@
 #include <inviwo/core/util/commandlineparser.h>
 
 #include <inviwo/core/resourcemanager/resourcemanager.h>
+#include <inviwo/core/datastructures/volume/brickcache.h>
 
 namespace inviwo {
 
@@ -70,6 +71,33 @@ SystemSettings::SystemSettings(InviwoApplication* app)
                               "Useful for gettting a overview of memory usage, "
                               "but comes with a small runtime overhead"_help,
                               false}
+    , parallelEvaluation_{"parallelEvaluation", "Parallel network evaluation",
+                          "Process independent processors concurrently on the thread pool. "
+                          "Only processors that declare themselves thread safe are dispatched, "
+                          "all others are still processed on the main thread. No built-in "
+                          "processor declares itself thread safe yet"_help,
+                          false}
+    , brickCacheSize_{"brickCacheSize",
+                      "Brick Cache Size (MB)",
+                      "Memory budget for the bricks of out-of-core volumes that are kept in "
+                      "memory, least recently used bricks are released first"_help,
+                      BrickCache::defaultBudget / (1024 * 1024),
+                      {16, ConstraintBehavior::Immutable},
+                      {65536, ConstraintBehavior::Ignore}}
+    , evictableBudget_{"evictableBudget",
+                       "Evictable Data Budget (MB)",
+                       "Memory budget for data that can be released and recomputed when needed, "
+                       "like volume pyramids, cached histograms, and file cache items"_help,
+                       ResourceManager::defaultBudget / (1024 * 1024),
+                       {16, ConstraintBehavior::Immutable},
+                       {262144, ConstraintBehavior::Ignore}}
+    , evictionPolicy_{"evictionPolicy",
+                      "Eviction Policy",
+                      "Which evictable data to release first when the budget is exceeded"_help,
+                      {{"lru", "Least Recently Used",
+                        ResourceManager::EvictionPolicy::LeastRecentlyUsed},
+                       {"lfu", "Least Frequently Used",
+                        ResourceManager::EvictionPolicy::LeastFrequentlyUsed}}}
     , redirectCout_{"redirectCout", "Redirect cout to LogCentral",
                     "Enabling this means that any std::cout messages will no longer end up in the "
                     "console, which can be confusing. "
@@ -87,7 +115,8 @@ SystemSettings::SystemSettings(InviwoApplication* app)
                   enableGesturesProperty_, enablePickingProperty_, enableSoundProperty_,
                   logStackTraceProperty_, moduleSearchPaths_, runtimeModuleReloading_,
                   breakOnMessage_, breakOnException_, stackTraceInException_,
-                  enableResourceTracking_, redirectCout_, redirectCerr_);
+                  enableResourceTracking_, parallelEvaluation_, brickCacheSize_, evictableBudget_,
+                  evictionPolicy_, redirectCout_, redirectCerr_);
 
     logStackTraceProperty_.onChange(
         [this]() { LogCentral::getPtr()->setLogStacktrace(logStackTraceProperty_.get()); });
@@ -111,6 +140,18 @@ SystemSettings::SystemSettings(InviwoApplication* app)
         }
     });
 
+    BrickCache::getDefault()->setBudget(brickCacheSize_.get() * 1024 * 1024);
+    brickCacheSize_.onChange(
+        [this]() { BrickCache::getDefault()->setBudget(brickCacheSize_.get() * 1024 * 1024); });
+
+    app_->getResourceManager()->setBudget(evictableBudget_.get() * 1024 * 1024);
+    evictableBudget_.onChange([this]() {
+        app_->getResourceManager()->setBudget(evictableBudget_.get() * 1024 * 1024);
+    });
+    app_->getResourceManager()->setEvictionPolicy(evictionPolicy_.get());
+    evictionPolicy_.onChange(
+        [this]() { app_->getResourceManager()->setEvictionPolicy(evictionPolicy_.get()); });
+
     redirectCout_.onChange([this]() {
         if (redirectCout_ && !cout_) {
             if (app_->getCommandLineParser().getLogToConsole()) {
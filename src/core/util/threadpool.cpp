@@ -32,20 +32,41 @@
 #include <inviwo/core/util/stdextensions.h>
 #include <inviwo/core/util/threadutil.h>
 
+#include <algorithm>
+
 namespace inviwo {
 
+namespace {
+
+constexpr size_t priorityIndex(ThreadPool::Priority priority) {
+    return static_cast<size_t>(priority);
+}
+
+constexpr ThreadPool::Priority priorities[] = {ThreadPool::Priority::Interactive,
+                                               ThreadPool::Priority::Background};
+
+}  // namespace
+
 // the constructor just launches some amount of workers
 ThreadPool::ThreadPool(size_t threads, std::function<void()> onThreadStart,
                        std::function<void()> onThreadStop)
-    : onThreadStart_{std::move(onThreadStart)}, onThreadStop_{std::move(onThreadStop)} {
+    : queues_(maxWorkers)
+    , nQueues_{0}
+    , nextQueue_{0}
+    , pending_{0}
+    , sleeping_{0}
+    , onThreadStart_{std::move(onThreadStart)}
+    , onThreadStop_{std::move(onThreadStop)} {
+    threads = std::min(threads, maxWorkers);
     while (workers.size() < threads) {
-        workers.push_back(std::make_unique<Worker>(*this));
+        workers.push_back(std::make_unique<Worker>(*this, acquireQueue()));
     }
 }
 
 size_t ThreadPool::trySetSize(size_t size) {
+    size = std::min(size, maxWorkers);
     while (workers.size() < size) {
-        workers.push_back(std::make_unique<Worker>(*this));
+        workers.push_back(std::make_unique<Worker>(*this, acquireQueue()));
     }
 
     if (workers.size() > size) {
@@ -60,7 +81,7 @@ size_t ThreadPool::trySetSize(size_t size) {
             if (active <= size) break;
         }
 
-        condition.notify_all();
+        wakeAll();
 
         std::erase_if(workers, [](const std::unique_ptr<Worker>& worker) {
             return worker->state == State::Done;
@@ -71,54 +92,155 @@ size_t ThreadPool::trySetSize(size_t size) {
 
 size_t ThreadPool::getSize() const { return workers.size(); }
 
-size_t ThreadPool::getQueueSize() {
-    std::unique_lock<std::mutex> lock(queue_mutex);
-    return tasks.size();
-}
+size_t ThreadPool::getQueueSize() { return pending_.load(); }
 
 ThreadPool::~ThreadPool() {
     for (auto& worker : workers) worker->state = State::Abort;
-    condition.notify_all();
+    wakeAll();
     workers.clear();  // this will join all threads.
 }
 
-ThreadPool::Worker::~Worker() { thread.join(); }
+ThreadPool::Local& ThreadPool::local() {
+    thread_local Local local;
+    return local;
+}
 
-ThreadPool::Worker::Worker(ThreadPool& pool)
-    : state{State::Free}, thread{[this, &pool]() {
+ThreadPool::Queue& ThreadPool::acquireQueue() {
+    const auto n = nQueues_.load();
+    for (size_t i = 0; i < n; ++i) {
+        auto expected = false;
+        if (queues_[i]->owned.compare_exchange_strong(expected, true)) return *queues_[i];
+    }
+    // Only the thread managing the pool adds queues, and the slot is preallocated, so we only
+    // have to publish the new queue by incrementing the count.
+    queues_[n] = std::make_unique<Queue>(n);
+    queues_[n]->owned = true;
+    nQueues_.store(n + 1);
+    return *queues_[n];
+}
+
+void ThreadPool::Queue::push(Task task, Priority priority) {
+    const std::scoped_lock lock{mutex};
+    tasks[priorityIndex(priority)].push_back(std::move(task));
+}
+
+bool ThreadPool::Queue::tryPop(Task& task, Priority priority) {
+    const std::scoped_lock lock{mutex};
+    auto& queue = tasks[priorityIndex(priority)];
+    if (queue.empty()) return false;
+    task = std::move(queue.back());
+    queue.pop_back();
+    return true;
+}
+
+bool ThreadPool::Queue::trySteal(Task& task, Priority priority) {
+    // Don't wait for a busy queue, just try the next one.
+    const std::unique_lock lock{mutex, std::try_to_lock};
+    if (!lock) return false;
+    auto& queue = tasks[priorityIndex(priority)];
+    if (queue.empty()) return false;
+    task = std::move(queue.front());
+    queue.pop_front();
+    return true;
+}
+
+bool ThreadPool::findTask(Queue& own, Task& task) {
+    for (auto priority : priorities) {
+        if (own.tryPop(task, priority)) return true;
+
+        const auto n = nQueues_.load();
+        for (size_t i = 1; i < n; ++i) {
+            if (queues_[(own.index + i) % n]->trySteal(task, priority)) return true;
+        }
+    }
+    return false;
+}
+
+void ThreadPool::push(Task task, Priority priority) {
+    // Count the task before it becomes visible to make sure pending_ never underflows
+    ++pending_;
+    if (auto& l = local(); l.pool == this) {
+        l.queue->push(std::move(task), priority);
+    } else {
+        const auto n = nQueues_.load();
+        queues_[nextQueue_.fetch_add(1, std::memory_order_relaxed) % n]->push(std::move(task),
+                                                                              priority);
+    }
+
+    // A sleeping worker increments sleeping_ before checking pending_, so either it sees the
+    // new task, or we see it sleeping.
+    if (sleeping_.load() > 0) {
+        {
+            const std::scoped_lock lock{sleepMutex_};
+        }
+        condition_.notify_one();
+    }
+}
+
+void ThreadPool::wakeAll() {
+    {
+        const std::scoped_lock lock{sleepMutex_};
+    }
+    condition_.notify_all();
+}
+
+ThreadPool::Worker::~Worker() {
+    thread.join();
+    queue.owned = false;
+}
+
+ThreadPool::Worker::Worker(ThreadPool& pool, Queue& aQueue)
+    : state{State::Free}, queue{aQueue}, thread{[this, &pool]() {
         util::setThreadDescription("Inviwo Worker Thread");
+        pool.local() = Local{&pool, &queue};
         pool.onThreadStart_();
-        util::OnScopeExit cleanup{[&pool]() { pool.onThreadStop_(); }};
+        util::OnScopeExit cleanup{[&pool]() {
+            pool.onThreadStop_();
+            pool.local() = Local{};
+        }};
 
+        Task task;
         for (;;) {
-            std::function<void()> task;
-            state = State::Free;
-            {
-                std::unique_lock<std::mutex> lock(pool.queue_mutex);
-                pool.condition.wait(lock, [this, &pool] {
-                    return state == State::Abort || state == State::Stop || !pool.tasks.empty();
-                });
-                if (state == State::Abort || (state == State::Stop && pool.tasks.empty())) break;
-                task = std::move(pool.tasks.front());
-                pool.tasks.pop();
+            if (state == State::Abort) break;
+
+            if (pool.findTask(queue, task)) {
+                --pool.pending_;
+                auto expected = State::Free;
+                state.compare_exchange_strong(expected, State::Working);
+                try {
+                    task();
+                } catch (...) {  // Make sure we don't leak any exceptions.
+                }
+                task = Task{};
+                expected = State::Working;
+                state.compare_exchange_strong(expected, State::Free);
+                continue;
             }
-            state = State::Working;
-            try {
-                task();
-            } catch (...) {  // Make sure we don't leak any exceptions.
+
+            // The task might be in a queue that was busy, only stop once everything is done.
+            if (pool.pending_ > 0) {
+                std::this_thread::yield();
+                continue;
             }
+            if (state == State::Stop) break;
+
+            std::unique_lock<std::mutex> lock(pool.sleepMutex_);
+            ++pool.sleeping_;
+            pool.condition_.wait(lock, [this, &pool] {
+                const auto s = state.load();
+                return s == State::Abort || s == State::Stop || pool.pending_ > 0;
+            });
+            --pool.sleeping_;
         }
         state = State::Done;
     }} {}
 
-void ThreadPool::enqueueRaw(std::function<void()> task) {
+void ThreadPool::enqueueRaw(Task task, Priority priority) {
     if (workers.empty()) {
         task();  // No worker threads, just run the task.
     } else {
-        std::unique_lock<std::mutex> lock(queue_mutex);
-        tasks.emplace(std::move(task));
+        push(std::move(task), priority);
     }
-    condition.notify_one();
 }
 
 }  // namespace inviwo
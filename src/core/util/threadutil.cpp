@@ -31,6 +31,12 @@
 #include <inviwo/core/util/stringconversion.h>
 #include <inviwo/core/common/inviwoapplication.h>
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+
 #ifdef WIN32
 #include <windows.h>
 #include <process.h>
@@ -88,6 +94,56 @@ size_t util::getPoolSize() {
     return 0u;
 }
 
+namespace {
+thread_local size_t depth = 0;
+}  // namespace
+
+size_t util::parallelDepth() { return depth; }
+
+void util::parallelFor(size_t count, const std::function<void(size_t)>& work) {
+    if (count == 0) return;
+
+    struct State {
+        std::atomic<size_t> next{0};
+        std::atomic<size_t> done{0};
+        std::mutex mutex;
+        std::exception_ptr error;
+    };
+    auto state = std::make_shared<State>();
+
+    // A helper that starts after all items are taken will only touch the shared state, never work.
+    const auto run = [state, count, &work]() {
+        ++depth;
+        for (auto i = state->next++; i < count; i = state->next++) {
+            try {
+                work(i);
+            } catch (...) {
+                const std::scoped_lock lock{state->mutex};
+                if (!state->error) state->error = std::current_exception();
+            }
+            if (++state->done == count) state->done.notify_all();
+        }
+        --depth;
+    };
+
+    // When nested inside another loop and all workers already have work queued, helpers would
+    // only start once the calling thread has taken every item anyway.
+    const auto poolSize = getPoolSize();
+    const auto saturated =
+        depth > 0 && poolSize > 0 && getThreadPool().getQueueSize() >= poolSize;
+    const auto helpers = saturated ? 0 : std::min(poolSize, count - 1);
+    for (size_t i = 0; i < helpers; ++i) {
+        getThreadPool().enqueueRaw(run);
+    }
+    run();
+
+    for (auto done = state->done.load(); done < count; done = state->done.load()) {
+        state->done.wait(done);
+    }
+
+    if (state->error) std::rethrow_exception(state->error);
+}
+
 size_t util::processFront() { return processFront(InviwoApplication::getPtr()); }
 size_t util::processFront(InviwoApplication* app) { return app->processFront(); }
 